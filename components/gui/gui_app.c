@@ -119,6 +119,10 @@ void gui_app_init(void)
         vTaskDelay(1000 / portTICK_PERIOD_MS);
     }
     lv_scr_load(screen2);
+#if LV_USE_SCR_PRELOAD
+    /* The game screen is shown after the first player is selected */
+    lv_scr_preload(screen1, LV_USE_LAYER_CACHE);
+#endif
     if (pdPASS != xTaskCreate(&_wait_for_sensor_input_task, "_wait_for_sensor_input_task", 2 * 1024, NULL, 5, NULL))
     {
         printf("_wait_for_sensor_input_tasktask was not initialized successfully\n");
@@ -318,6 +322,9 @@ static void _wait_for_sensor_input_task(void *p_parameter)
             }
             vTaskDelay(1000 / portTICK_PERIOD_MS);
             lv_scr_load_anim(screen2, LV_SCR_LOAD_ANIM_FADE_IN, 2 * FADE_IN_TIME, 5000 / portTICK_PERIOD_MS, false);
+#if LV_USE_SCR_PRELOAD
+            lv_scr_preload(screen1, LV_USE_LAYER_CACHE);
+#endif
         }
     }
 }
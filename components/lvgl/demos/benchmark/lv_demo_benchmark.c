@@ -852,6 +852,9 @@ static void generate_report(void)
            LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR, LVGL_VERSION_PATCH);
     LV_LOG("Weighted FPS: %"LV_PRIu32"\r\n", fps_weighted);
     LV_LOG("Opa. speed: %"LV_PRIu32"%%\r\n", opa_speed_pct);
+#if LV_USE_DRAW_SW_PARALLEL
+    LV_LOG("Render threads: %"LV_PRIu32"\r\n", lv_draw_sw_parallel_get_thread_cnt());
+#endif
 
     row++;
     char buf[256];
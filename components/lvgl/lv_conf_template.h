@@ -80,9 +80,87 @@
 /*Default display refresh period. LVG will redraw changed areas with this period time*/
 #define LV_DISP_DEF_REFR_PERIOD 30      /*[ms]*/
 
+/*Allow more than two draw buffers with `lv_disp_draw_buf_init_ring()`.
+ *Rendering can go on while several rendered buffers wait for the display, so a slow or bursty
+ *`flush_cb` (e.g. DMA over SPI) stalls the rendering less.*/
+#define LV_USE_DISP_BUF_RING 0
+#if LV_USE_DISP_BUF_RING
+    /*Maximal number of buffers in a ring*/
+    #define LV_DISP_BUF_RING_MAX 4
+#endif
+
+/*Merge the invalidated areas by the cost of redrawing them instead of joining only overlapping ones,
+ *and merge the cheapest areas instead of redrawing the whole screen when there are too many.
+ *See `lv_refr_get_inv_stats()`*/
+#define LV_USE_REFR_REGION 0
+#if LV_USE_REFR_REGION
+    /*Overhead of refreshing an area in pixels, i.e. two areas are joined if it saves more than this*/
+    #define LV_REFR_REGION_AREA_COST 1024
+#endif
+
+/*Don't draw the objects, or the parts of them, which are covered by an opaque younger sibling.
+ *Also skip the previous screen during screen load animations where the new screen covers it.
+ *See `lv_refr_get_draw_stats()`*/
+#define LV_USE_REFR_OCCLUSION 0
+
+/*Retained mode: record the rectangles, labels, images, lines and arcs drawn by the objects and
+ *replay them until the object is invalidated or moved instead of sending the draw events again.
+ *Objects drawing anything else or using masks (e.g. clip corner) are drawn normally.
+ *Costs memory for the recorded draw descriptors of every visible object.
+ *See `lv_refr_set_draw_list()` and `lv_draw_list_get_stats()`*/
+#define LV_USE_DRAW_LIST 0
+#if LV_USE_DRAW_LIST
+    /*Maximum number of draw calls recorded per object part (main and post). Objects drawing more are not cached*/
+    #define LV_DRAW_LIST_MAX_CMD 16
+#endif
+
+/*Allow keeping the rendered image of an object and its children with `lv_obj_set_layer_cache()`.
+ *The image is drawn (with the object's opacity and transformations) while the object and its children don't change.
+ *Layers with transparent parts need LV_COLOR_SCREEN_TRANSP 1, else the object is drawn normally.
+ *See `lv_draw_layer_cache_get_stats()`*/
+#define LV_USE_LAYER_CACHE 0
+#if LV_USE_LAYER_CACHE
+    /*Memory used for the cached layers [bytes]. The least recently used layers are freed if it's full.*/
+    #define LV_LAYER_CACHE_SIZE (256 * 1024)
+#endif
+
+/*Draw the scrolling of opaque containers by moving the already rendered pixels and redrawing only the newly visible part.
+ *Works only with `direct_mode` and a single, screen-sized draw buffer. See `lv_refr_get_scroll_copy_stats()`
+ *The scroll throw also slows down by the elapsed time instead of per read period, so it doesn't depend on the frame rate.*/
+#define LV_USE_SCROLL_COPY 0
+
+/*Give every display its own render context (the display being refreshed, draw masks, temporary buffers, etc.)
+ *so different displays can be refreshed concurrently on different threads/cores with `lv_refr_disp()`,
+ *while the rest of LVGL is not running. The shared caches (images, gradients, layers) are locked.
+ *Requires pthreads. The performance and memory monitors are not supported with concurrent refreshing.*/
+#define LV_USE_REFR_CTX 0
+#if LV_USE_REFR_CTX
+    /*Keyword of thread local variables, e.g. `_Thread_local` (C11) or `__thread` (GCC, Clang)*/
+    #define LV_REFR_CTX_THREAD_LOCAL __thread
+#endif
+
+/*Pace the refreshing of the displays: adapt the refresh period to the measured render and flush time
+ *to keep a steady frame rate under load instead of alternating between two periods.
+ *If the driver calls `lv_disp_vsync()` on the vsync/tearing effect signal, rendering starts only at a vsync.
+ *See `lv_refr_get_frame_stats()`*/
+#define LV_USE_FRAME_PACING 0
+#if LV_USE_FRAME_PACING
+    /*Number of 1 ms wide bins in the frame time histogram. The last bin counts the longer frames too.*/
+    #define LV_FRAME_PACING_HIST_SIZE 64
+#endif
+
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*Index the children of objects with many children (e.g. lists, tables built from objects) by their position
+ *to not check all of them when searching the pressed object. Scrolling doesn't outdate the index,
+ *but moving, resizing, adding or removing objects does. See `lv_indev_enable_hit_index()`*/
+#define LV_USE_INDEV_HIT_INDEX 0
+#if LV_USE_INDEV_HIT_INDEX
+    /*Index only the children of objects having at least this many children*/
+    #define LV_INDEV_HIT_INDEX_MIN_CHILD_CNT 16
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 0
@@ -169,6 +247,25 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Render large software blends on a pool of worker threads.
+ *The blended area is split into horizontal bands, one band per thread, and the threads are joined
+ *before the blend returns, so the result is identical to single threaded rendering.
+ *Requires pthreads (ESP-IDF provides them on top of FreeRTOS).*/
+#define LV_USE_DRAW_SW_PARALLEL 0
+#if LV_USE_DRAW_SW_PARALLEL
+    /*Number of render threads including the one calling `lv_timer_handler()`. Typically the number of cores.*/
+    #define LV_DRAW_SW_PARALLEL_THREAD_CNT 2
+
+    /*Blends smaller than this [px] are rendered on the calling thread as splitting them costs more than it gains*/
+    #define LV_DRAW_SW_PARALLEL_MIN_PX (8 * 1024)
+#endif
+
+/*Blend with SSE2/AVX2 (x86) or NEON (Arm) kernels, e.g. to speed up simulators on a PC.
+ *The best instruction set supported by the CPU is selected in `lv_init()`.
+ *The result is identical to the C code. Used with 32 bit colors and with 16 bit colors
+ *if LV_COLOR_16_SWAP and LV_COLOR_MIX_ROUND_OFS are 0, otherwise the C code runs.*/
+#define LV_USE_DRAW_SW_SIMD 0
+
 /*-------------
  * GPU
  *-----------*/
@@ -214,6 +311,10 @@
     #define LV_GPU_SDL_CUSTOM_BLEND_MODE (SDL_VERSION_ATLEAST(2, 0, 6))
 #endif
 
+/*Draw context for the PIE (128 bit SIMD) instructions of ESP32-S3 to fill, copy and mix 16 bit colors.
+ *The PIE kernels are not added yet, so the blends still run on the software renderer.*/
+#define LV_USE_GPU_ESP32_PIE 0
+
 /*-------------
  * Logging
  *-----------*/
@@ -293,6 +394,35 @@
     #define LV_SPRINTF_USE_FLOAT 0
 #endif  /*LV_SPRINTF_CUSTOM*/
 
+/*Cache the resolved values of the most frequently used style properties (paddings, background, border, text, etc)
+ *of the objects' main part, so `lv_obj_get_style_...()` doesn't need to search the styles of the object
+ *and its parents every time. Any style, state or parent change outdates the caches.
+ *Costs 32 style values per object. See `lv_obj_enable_style_cache()`*/
+#define LV_USE_OBJ_STYLE_CACHE 0
+
+/*Cache the self size of the objects (e.g. the size of a label's text) reported in `LV_EVENT_GET_SELF_SIZE`
+ *to not measure the content again in each layout update. Changing the content, style or content size outdates it.
+ *Costs 4 coordinates per object.*/
+#define LV_USE_OBJ_SELF_SIZE_CACHE 0
+
+/*Count the events dispatched to the objects and the ones skipped because
+ *neither the object's callbacks nor its class handle them. See `lv_event_get_stats()`*/
+#define LV_USE_EVENT_STATS 0
+
+/*Allocate the objects, their special attributes, style and children arrays up to 256 bytes from pools of
+ *8 byte size classes instead of one by one from the heap. It's faster, fragments the heap less and saves the
+ *heap's per allocation header if there are many objects. See `lv_slab_get_stats()`*/
+#define LV_USE_OBJ_POOL 0
+
+/*Delete the objects of `lv_obj_del()` and `lv_obj_clean()` in bulk: the animations and group members of all the deleted
+ *objects are removed in one pass at the end, the focus moves only once and the dying parents get no events about
+ *their deleted children. See `lv_obj_enable_bulk_del()`*/
+#define LV_USE_OBJ_BULK_DEL 0
+
+/*Prepare a screen in idle time before loading it: update its layout step by step and, with `LV_USE_LAYER_CACHE`,
+ *render it into a pinned layer band by band. The transition then only draws the cached layers. See `lv_scr_preload()`*/
+#define LV_USE_SCR_PRELOAD 0
+
 #define LV_USE_USER_DATA 1
 
 /*Garbage Collector settings
@@ -555,6 +685,8 @@
 
 #define LV_USE_TILEVIEW   1
 
+#define LV_USE_VLIST      1
+
 #define LV_USE_WIN        1
 
 /*-----------
@@ -573,6 +705,14 @@
 
     /*Default transition time in [ms]*/
     #define LV_THEME_DEFAULT_TRANSITION_TIME 80
+
+    /*1: Keep the styles in constant tables (generated by scripts/theme_default_gen.py) instead of RAM.
+     *The tables are used if the theme is initialized in LV_THEME_DEFAULT_DARK mode with LV_DPI_DEF
+     *on a display of LV_THEME_DEFAULT_CONST_HOR_RES width, else the styles are still created in RAM*/
+    #define LV_THEME_DEFAULT_CONST 0
+    #if LV_THEME_DEFAULT_CONST
+        #define LV_THEME_DEFAULT_CONST_HOR_RES 800
+    #endif
 #endif /*LV_USE_THEME_DEFAULT*/
 
 /*A very simple theme that is a good starting point for a custom theme*/
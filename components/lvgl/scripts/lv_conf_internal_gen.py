@@ -168,6 +168,10 @@ LV_EXPORT_CONST_INT(LV_DPI_DEF);
     #define LV_LOG_TRACE_ANIM       0
 #endif  /*LV_USE_LOG*/
 
+#if LV_USE_REFR_CTX == 0
+    #define LV_REFR_CTX_THREAD_LOCAL
+#endif  /*LV_USE_REFR_CTX*/
+
 
 /*If running without lv_conf.h add typedefs with default value*/
 #ifdef LV_CONF_SKIP
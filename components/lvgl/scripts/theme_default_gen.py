@@ -0,0 +1,351 @@
+#!/usr/bin/env python3
+
+'''
+Generates lv_theme_default_const.h from style_init() of lv_theme_default.c.
+
+Every `lv_style_set_<prop>(&styles-><name>, <value>)` becomes an LV_STYLE_CONST_<PROP> entry in a
+constant property array. The values are turned into constant expressions:
+  - `lv_disp_dpx(theme.disp, n)` and `LV_DPX(n)` are calculated with LV_DPI_DEF,
+  - `disp_size` is the size of a LV_THEME_DEFAULT_CONST_HOR_RES wide display,
+  - `theme.flags & MODE_DARK` is LV_THEME_DEFAULT_DARK,
+  - the palette colors are replaced by their hex codes.
+The values depending on `theme.color_primary/secondary` or `theme.font_*` are set in
+`const_styles_update()` at runtime, so their arrays remain in RAM.
+'''
+
+import os
+import sys
+import re
+
+SCRIPT_DIR = os.path.dirname(__file__)
+THEME_DIR = os.path.join(SCRIPT_DIR, "..", "src", "extra", "themes", "default")
+THEME_SRC = os.path.join(THEME_DIR, "lv_theme_default.c")
+THEME_CONST = os.path.join(THEME_DIR, "lv_theme_default_const.h")
+COLOR_SRC = os.path.join(SCRIPT_DIR, "..", "src", "misc", "lv_color.c")
+COLOR_HDR = os.path.join(SCRIPT_DIR, "..", "src", "misc", "lv_color.h")
+STYLE_GEN_HDR = os.path.join(SCRIPT_DIR, "..", "src", "misc", "lv_style_gen.h")
+
+if sys.version_info < (3,6,0):
+  print("Python >=3.6 is required", file=sys.stderr)
+  exit(1)
+
+# The setters setting more properties at once
+MULTI_SETTERS = {
+  'size': ['WIDTH', 'HEIGHT'],
+  'pad_all': ['PAD_TOP', 'PAD_BOTTOM', 'PAD_LEFT', 'PAD_RIGHT'],
+  'pad_hor': ['PAD_LEFT', 'PAD_RIGHT'],
+  'pad_ver': ['PAD_TOP', 'PAD_BOTTOM'],
+  'pad_gap': ['PAD_ROW', 'PAD_COLUMN'],
+}
+
+PLACEHOLDERS = {'num': '0', 'ptr': 'NULL', 'color': 'CONST_COLOR(0)'}
+
+def error(msg):
+  print("theme_default_gen.py: " + msg, file=sys.stderr)
+  exit(1)
+
+def read(path):
+  with open(path) as f:
+    return f.read()
+
+def palette_colors():
+  '''Parse the color tables of lv_palette_main/lighten/darken and the lv_palette_t enum'''
+  names = re.search(r'typedef enum \{([^{}]*)\} lv_palette_t;', read(COLOR_HDR), re.S).group(1)
+  names = re.findall(r'\b(LV_PALETTE_\w+)', names)
+  names = [n for n in names if n != 'LV_PALETTE_NONE']
+
+  src = read(COLOR_SRC)
+  colors = {}
+  for func in ['main', 'lighten', 'darken']:
+    table = re.search(r'lv_color_t lv_palette_' + func + r'\(.*?static const lv_color_t colors\[\].*? = \{(.*?)\n    \};',
+                      src, re.S).group(1)
+    rgb = ['0x%s%s%s' % m for m in re.findall(r'LV_COLOR_MAKE\(0x(\w\w), 0x(\w\w), 0x(\w\w)\)', table)]
+    if func == 'main':
+      for i, n in enumerate(names): colors[(func, n, 0)] = rgb[i]
+    else:
+      lvl_cnt = len(rgb) // len(names)
+      for i, n in enumerate(names):
+        for l in range(lvl_cnt): colors[(func, n, l + 1)] = rgb[i * lvl_cnt + l]
+  return colors
+
+def prop_types():
+  '''Tell the type of the value of each property from the LV_STYLE_CONST_... macros'''
+  types = {}
+  for name, field in re.findall(r'#define LV_STYLE_CONST_(\w+)\(val\) \\\s*\{ \\\s*\.prop = LV_STYLE_\w+, \.value = \{ \.(\w+) = (?:\([\w ]+\))?val \}',
+                                read(STYLE_GEN_HDR)):
+    types[name] = field
+  return types
+
+def object_macros(src):
+  '''The object-like macros of lv_theme_default.c'''
+  macros = {}
+  for name, body in re.findall(r'^#define (\w+)[ \t]+(.+)$', src, re.M):
+    macros[name] = body.strip()
+  return macros
+
+def split_args(s):
+  '''Split "a, b(c, d), e" to ["a", "b(c, d)", "e"]'''
+  args = []
+  depth = 0
+  cur = ''
+  for c in s:
+    if c == ',' and depth == 0:
+      args.append(cur.strip())
+      cur = ''
+      continue
+    if c == '(': depth += 1
+    if c == ')': depth -= 1
+    cur += c
+  args.append(cur.strip())
+  return args
+
+class Translator:
+  def __init__(self, src):
+    self.macros = object_macros(src)
+    self.colors = palette_colors()
+    self.vars = {}
+
+  def expand(self, expr):
+    for _ in range(10):
+      new = expr
+      for name, body in self.macros.items():
+        if name in ('MODE_DARK',): continue
+        new = re.sub(r'\b' + name + r'\b', lambda m: body, new)
+      if new == expr: return expr
+      expr = new
+    error("Too deep macros in " + expr)
+
+  def palette(self, m):
+    func, args = m.group(1), split_args(m.group(2))
+    key = (func, args[0], int(args[1]) if len(args) > 1 else 0)
+    if key not in self.colors: error("Unknown palette color: " + m.group(0))
+    return self.colors[key]
+
+  def translate(self, expr):
+    '''Translate an expression of style_init() to a constant expression'''
+    expr = re.sub(r'theme\.flags\s*&\s*MODE_DARK', 'LV_THEME_DEFAULT_DARK', expr)
+    for var, name in self.vars.items():
+      expr = re.sub(r'\b' + var + r'\b', name, expr)
+    expr = self.expand(expr)
+    expr = re.sub(r'theme\.flags\s*&\s*MODE_DARK', 'LV_THEME_DEFAULT_DARK', expr)
+    expr = expr.replace('lv_disp_dpx(theme.disp, ', 'CONST_DPX(')
+    expr = re.sub(r'\bLV_DPX\(', 'CONST_DPX(', expr)
+    expr = re.sub(r'\bdisp_size\b', 'CONST_DISP_SIZE', expr)
+    expr = re.sub(r'\blv_palette_(main|lighten|darken)\(([^()]*)\)', self.palette, expr)
+    expr = re.sub(r'\blv_color_hex\((0x\w+)\)', r'\1', expr)
+    expr = re.sub(r'\blv_color_white\(\)', '0xFFFFFF', expr)
+    expr = re.sub(r'\blv_color_black\(\)', '0x000000', expr)
+    expr = re.sub(r'\blv_pct\(', 'LV_PCT(', expr)
+    expr = re.sub(r'\s+', ' ', expr).strip()
+
+    if re.search(r'\b(theme|styles|lv_disp_dpx|lv_palette_\w+|lv_color_\w+|disp_size)\b', expr):
+      error("Can't make a constant from: " + expr)
+    return expr
+
+  def add_var(self, var, expr):
+    '''A color variable like `color_scr`'''
+    name = 'CONST_' + var.upper()
+    self.vars[var] = name
+    return name, self.translate(expr)
+
+def style_init_body(src):
+  m = re.search(r'\nstatic void style_init\(void\)\n\{\n(.*?)\n\}\n', src, re.S)
+  if not m: error("style_init() is not found")
+  return m.group(1)
+
+def statements(body):
+  '''Join the lines of the statements'''
+  cur = ''
+  for line in body.split('\n'):
+    line = re.sub(r'/\*.*?\*/', '', line).strip()
+    if not line: continue
+    if line.startswith('#'):
+      yield line
+      continue
+    cur += ' ' + line if cur else line
+    if cur.count('(') == cur.count(')') and (cur.endswith(';') or cur.endswith('{') or cur.endswith('}')):
+      yield cur
+      cur = ''
+  if cur: error("Unterminated statement: " + cur)
+
+def parse(src):
+  '''Collect the styles with their properties and the conditions around them'''
+  tr = Translator(src)
+  styles = {}
+  order = []
+  var_defs = []
+  conds = []
+
+  for st in statements(style_init_body(src)):
+    m = re.match(r'#if(.*)$', st)
+    if m:
+      conds.append(m.group(1).strip())
+      continue
+    if st.startswith('#else'):
+      conds[-1] = '!(' + conds[-1] + ')'
+      continue
+    if st.startswith('#endif'):
+      conds.pop()
+      continue
+
+    m = re.match(r'if\((.*)\) \{$', st)
+    if m:
+      conds.append(tr.translate(m.group(1)))
+      continue
+    if st == '}':
+      conds.pop()
+      continue
+    if st == '} else {':
+      conds[-1] = '!(' + conds[-1] + ')'
+      continue
+
+    m = re.match(r'(color_\w+) = (.*);$', st)
+    if m:
+      var_defs.append(tr.add_var(m.group(1), m.group(2)))
+      continue
+
+    m = re.match(r'style_init_reset\(&styles->(\w+)\);$', st)
+    if m:
+      name = m.group(1)
+      styles[name] = {'conds': list(conds), 'props': []}
+      order.append(name)
+      continue
+
+    m = re.match(r'lv_style_set_(\w+)\(&styles->(\w+), (.*)\);$', st)
+    if m:
+      setter, name, value = m.groups()
+      if name not in styles: error("Property is set before style_init_reset(): " + st)
+      style = styles[name]
+      if conds[:len(style['conds'])] != style['conds']: error("Unexpected conditions at: " + st)
+      props = MULTI_SETTERS.get(setter, [setter.upper()])
+      dynamic = re.search(r'\btheme\.(color_|font_)', value) is not None
+      for prop in props:
+        style['props'].append({'prop': prop, 'value': value, 'dynamic': dynamic,
+                               'conds': conds[len(style['conds']):]})
+      continue
+
+    error("Unknown statement in style_init(): " + st)
+
+  return tr, styles, order, var_defs
+
+def cond_lines(conds, indent=''):
+  return [indent + '#if ' + c for c in conds]
+
+def generate():
+  src = read(THEME_SRC)
+  tr, styles, order, var_defs = parse(src)
+  types = prop_types()
+
+  out = []
+  out.append('''/**
+ * GENERATED FILE, DO NOT EDIT IT!
+ * @file lv_theme_default_const.h
+ * The styles of the default theme in constant tables.
+ * Generated by scripts/theme_default_gen.py from style_init() of lv_theme_default.c
+ * Included only by lv_theme_default.c
+ */
+
+/* clang-format off */
+
+#define CONST_DPX(n)        _LV_DPX_CALC(LV_DPI_DEF, n)
+#define CONST_DISP_SIZE     DISP_SIZE_OF(LV_THEME_DEFAULT_CONST_HOR_RES)
+#define CONST_COLOR(c)      LV_COLOR_MAKE((((c) >> 16) & 0xFF), (((c) >> 8) & 0xFF), ((c) & 0xFF))
+''')
+  for name, value in var_defs:
+    out.append('#define %-19s (%s)' % (name, value))
+
+  out.append('''
+#if LV_USE_ASSERT_STYLE
+#define CONST_STYLE(props, groups)                                      \\
+    {                                                                   \\
+        .sentinel = LV_STYLE_SENTINEL_VALUE,                            \\
+        .v_p = { .const_props = props },                                \\
+        .prop1 = LV_STYLE_PROP_ANY,                                     \\
+        .has_group = groups,                                            \\
+        .prop_cnt = sizeof(props) / sizeof((props)[0]) - 1,             \\
+    }
+#else
+#define CONST_STYLE(props, groups)                                      \\
+    {                                                                   \\
+        .v_p = { .const_props = props },                                \\
+        .prop1 = LV_STYLE_PROP_ANY,                                     \\
+        .has_group = groups,                                            \\
+        .prop_cnt = sizeof(props) / sizeof((props)[0]) - 1,             \\
+    }
+#endif
+
+#define CONST_GROUP(prop)   (1 << _LV_STYLE_PROP_GROUP(prop))
+''')
+
+  updates = []
+  for name in order:
+    style = styles[name]
+    props = style['props']
+
+    # Later values of the same property override the earlier ones
+    uniq = []
+    for p in props:
+      same = [u for u in uniq if u['prop'] == p['prop']]
+      if same:
+        if same[0]['conds'] != p['conds']: error("%s is set with different conditions in %s" % (p['prop'], name))
+        same[0].update(p)
+      else:
+        uniq.append(dict(p))
+
+    # The dynamic values go first to have fixed indices
+    dyn = [p for p in uniq if p['dynamic']]
+    stat = [p for p in uniq if not p['dynamic']]
+    for p in dyn:
+      if p['conds']: error("Conditional runtime value in " + name)
+
+    out.extend(cond_lines(style['conds']))
+    out.append('static %slv_style_const_prop_t %s_props[] = {' % ('' if dyn else 'const ', name))
+
+    for i, p in enumerate(dyn):
+      t = types[p['prop']]
+      out.append('    LV_STYLE_CONST_%s(%s),    /*Set at runtime*/' % (p['prop'], PLACEHOLDERS[t]))
+      updates.append((style['conds'], '%s_props[%d].value.%s = %s;' % (name, i, t, p['value'])))
+
+    act_conds = []
+    for p in stat:
+      if p['conds'] != act_conds:
+        out.extend(['#endif'] * len(act_conds))
+        out.extend(cond_lines(p['conds']))
+        act_conds = p['conds']
+      value = tr.translate(p['value'])
+      if types[p['prop']] == 'color': value = 'CONST_COLOR(%s)' % value
+      out.append('    LV_STYLE_CONST_%s(%s),' % (p['prop'], value))
+    out.extend(['#endif'] * len(act_conds))
+
+    out.append('    {.prop = LV_STYLE_PROP_INV}')
+    out.append('};')
+    out.extend(['#endif'] * len(style['conds']))
+    out.append('')
+
+  out.append('static const my_theme_styles_t const_styles = {')
+  for name in order:
+    style = styles[name]
+    groups = []
+    for p in style['props']:
+      g = 'CONST_GROUP(LV_STYLE_%s)' % p['prop']
+      if g not in groups: groups.append(g)
+    out.extend(cond_lines(style['conds']))
+    out.append('    .%s = CONST_STYLE(%s_props, %s),' % (name, name, ' | '.join(groups) if groups else '0'))
+    out.extend(['#endif'] * len(style['conds']))
+  out.append('};')
+  out.append('')
+
+  out.append('/*Set the values depending on the parameters of `lv_theme_default_init()`*/')
+  out.append('static void const_styles_update(void)')
+  out.append('{')
+  for conds, line in updates:
+    out.extend(cond_lines(conds))
+    out.append('    ' + line)
+    out.extend(['#endif'] * len(conds))
+  out.append('}')
+  out.append('')
+
+  with open(THEME_CONST, 'w') as f:
+    f.write('\n'.join(out))
+
+generate()
@@ -28,6 +28,13 @@ static void set_x_anim(void * obj, int32_t v);
 static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_ready(lv_anim_t * a);
 static bool is_out_anim(lv_scr_load_anim_t a);
+#if LV_USE_SCR_PRELOAD
+    static void scr_preload_timer_cb(lv_timer_t * t);
+    #if LV_USE_LAYER_CACHE
+        static void scr_preload_pin_cache(lv_obj_t * scr, bool * own);
+        static void scr_preload_release_cache(lv_obj_t * scr, bool own);
+    #endif
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -259,9 +266,26 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
     lv_obj_remove_local_style_prop(lv_scr_act(), LV_STYLE_OPA, 0);
 
 
+#if LV_USE_SCR_PRELOAD
+    if(d->preload_scr == new_scr) {
+        /*Nothing more to prepare. The layers are released after the first refresh of the loaded screen.*/
+        if(d->preload_timer) {
+            lv_timer_del(d->preload_timer);
+            d->preload_timer = NULL;
+        }
+    }
+    else if(d->preload_scr && d->preload_timer == NULL) {
+        /*An earlier preloaded screen was loaded but its layers are not released yet*/
+        _lv_disp_release_scr_preload(d);
+    }
+#endif
+
     /*Shortcut for immediate load*/
     if(time == 0 && delay == 0) {
         scr_load_internal(new_scr);
+#if LV_USE_SCR_PRELOAD
+        if(d->preload_scr == new_scr) d->preload_release = 1;
+#endif
         return;
     }
 
@@ -462,6 +486,97 @@ lv_timer_t * _lv_disp_get_refr_timer(lv_disp_t * disp)
     return disp->refr_timer;
 }
 
+#if LV_USE_SCR_PRELOAD
+void lv_scr_preload(lv_obj_t * scr, bool render)
+{
+    LV_ASSERT_NULL(scr);
+
+    lv_disp_t * d = lv_obj_get_disp(scr);
+    if(d->preload_scr == scr && d->preload_timer && d->preload_render == render) return;
+
+    /*Only one screen is preloaded at a time*/
+    if(d->preload_scr || d->preload_prev_scr) _lv_disp_release_scr_preload(d);
+
+    d->preload_scr = scr;
+    d->preload_ready = 0;
+#if LV_USE_LAYER_CACHE
+    if(render) {
+        bool own;
+        scr_preload_pin_cache(scr, &own);
+        d->preload_own_cache = own ? 1 : 0;
+        d->preload_render = 1;
+    }
+#else
+    LV_UNUSED(render);
+#endif
+
+    d->preload_timer = lv_timer_create(scr_preload_timer_cb, LV_DISP_DEF_REFR_PERIOD, d);
+}
+
+bool lv_scr_is_preloaded(const lv_obj_t * scr)
+{
+    LV_ASSERT_NULL(scr);
+
+    lv_disp_t * d = lv_obj_get_disp(scr);
+    if(d->preload_scr != scr || d->preload_timer == NULL) return false;
+    if(scr->scr_layout_inv) return false;
+
+#if LV_USE_LAYER_CACHE
+    if(d->preload_render) {
+        lv_draw_layer_cache_t * layer = scr->spec_attr->layer_cache;
+        if(!layer->valid || layer->partial || layer->img.data == NULL) return false;
+    }
+#endif
+
+    return true;
+}
+
+void lv_scr_preload_cancel(lv_obj_t * scr)
+{
+    LV_ASSERT_NULL(scr);
+
+    lv_disp_t * d = lv_obj_get_disp(scr);
+    if(d->preload_scr == scr) _lv_disp_release_scr_preload(d);
+}
+
+void _lv_disp_release_scr_preload(lv_disp_t * disp)
+{
+    if(disp->preload_timer) {
+        lv_timer_del(disp->preload_timer);
+        disp->preload_timer = NULL;
+    }
+
+#if LV_USE_LAYER_CACHE
+    if(disp->preload_render) {
+        scr_preload_release_cache(disp->preload_scr, disp->preload_own_cache);
+        scr_preload_release_cache(disp->preload_prev_scr, disp->preload_own_prev_cache);
+    }
+#endif
+
+    disp->preload_scr = NULL;
+    disp->preload_prev_scr = NULL;
+    disp->preload_render = 0;
+    disp->preload_ready = 0;
+    disp->preload_own_cache = 0;
+    disp->preload_own_prev_cache = 0;
+    disp->preload_release = 0;
+}
+
+void _lv_disp_scr_preload_deleted(lv_obj_t * scr)
+{
+    lv_disp_t * d = lv_obj_get_disp(scr);
+
+    /*The layer cache is deleted with the screen*/
+    if(d->preload_scr == scr) {
+        d->preload_scr = NULL;
+        _lv_disp_release_scr_preload(d);
+    }
+    else if(d->preload_prev_scr == scr) {
+        d->preload_prev_scr = NULL;
+    }
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -481,7 +596,14 @@ static void scr_load_internal(lv_obj_t * scr)
     if(d->act_scr) lv_event_send(scr, LV_EVENT_SCREEN_LOADED, NULL);
     if(d->act_scr) lv_event_send(old_scr, LV_EVENT_SCREEN_UNLOADED, NULL);
 
+#if LV_USE_LAYER_CACHE
+    /*Only shown, not changed*/
+    _lv_obj_keep_layer_cache(scr, true);
+#endif
     lv_obj_invalidate(scr);
+#if LV_USE_LAYER_CACHE
+    _lv_obj_keep_layer_cache(scr, false);
+#endif
 }
 
 static void scr_load_anim_start(lv_anim_t * a)
@@ -492,6 +614,16 @@ static void scr_load_anim_start(lv_anim_t * a)
     d->act_scr = a->var;
 
     lv_event_send(d->act_scr, LV_EVENT_SCREEN_LOAD_START, NULL);
+
+#if LV_USE_SCR_PRELOAD && LV_USE_LAYER_CACHE
+    /*Draw the previous screen from a layer too during the transition. It's rendered in the first frame.*/
+    if(d->preload_scr == d->act_scr && d->preload_render && d->prev_scr && d->preload_prev_scr == NULL) {
+        bool own;
+        scr_preload_pin_cache(d->prev_scr, &own);
+        d->preload_prev_scr = d->prev_scr;
+        d->preload_own_prev_cache = own ? 1 : 0;
+    }
+#endif
 }
 
 static void opa_scale_anim(void * obj, int32_t v)
@@ -521,7 +653,17 @@ static void scr_anim_ready(lv_anim_t * a)
     d->draw_prev_over_act = false;
     d->scr_to_load = NULL;
     lv_obj_remove_local_style_prop(a->var, LV_STYLE_OPA, 0);
+#if LV_USE_LAYER_CACHE
+    _lv_obj_keep_layer_cache(d->act_scr, true);
+#endif
     lv_obj_invalidate(d->act_scr);
+#if LV_USE_LAYER_CACHE
+    _lv_obj_keep_layer_cache(d->act_scr, false);
+#endif
+
+#if LV_USE_SCR_PRELOAD
+    if(d->preload_scr == d->act_scr) d->preload_release = 1;
+#endif
 }
 
 static bool is_out_anim(lv_scr_load_anim_t anim_type)
@@ -532,3 +674,73 @@ static bool is_out_anim(lv_scr_load_anim_t anim_type)
            anim_type == LV_SCR_LOAD_ANIM_OUT_TOP   ||
            anim_type == LV_SCR_LOAD_ANIM_OUT_BOTTOM;
 }
+
+#if LV_USE_SCR_PRELOAD
+static void scr_preload_timer_cb(lv_timer_t * t)
+{
+    lv_disp_t * d = t->user_data;
+    lv_obj_t * scr = d->preload_scr;
+
+    /*Changed since it was ready: prepare it and notify again*/
+    if(!lv_scr_is_preloaded(scr)) d->preload_ready = 0;
+
+    if(!_lv_obj_update_layout_step(scr)) return;
+
+#if LV_USE_LAYER_CACHE
+    if(d->preload_render) {
+        /*Render as many rows as a draw buffer holds: it takes about as long as refreshing a band of the display*/
+        lv_coord_t w = LV_MAX(lv_obj_get_width(scr), 1);
+        lv_coord_t row_cnt = (lv_coord_t)LV_MIN(d->driver->draw_buf->size / w, LV_COORD_MAX);
+        if(!_lv_refr_layer_cache_step(d, scr, row_cnt)) return;
+
+        /*Prepare only the layout if it can't be rendered, e.g. there is not enough memory*/
+        if(!lv_obj_get_layer_cache(scr) || scr->spec_attr->layer_cache->img.data == NULL) {
+            LV_LOG_WARN("Couldn't render the preloaded screen");
+            scr_preload_release_cache(scr, d->preload_own_cache);
+            d->preload_render = 0;
+            d->preload_own_cache = 0;
+        }
+    }
+#endif
+
+    if(d->preload_ready) return;
+    d->preload_ready = 1;
+    lv_event_send(scr, LV_EVENT_READY, NULL);
+}
+
+#if LV_USE_LAYER_CACHE
+/**
+ * Enable the layer cache of a screen if needed and pin its layer
+ * @param scr       pointer to a screen
+ * @param own       set to true if the layer cache was enabled here
+ */
+static void scr_preload_pin_cache(lv_obj_t * scr, bool * own)
+{
+    *own = false;
+    if(!lv_obj_get_layer_cache(scr)) {
+        lv_obj_set_layer_cache(scr, true);
+        *own = true;
+    }
+    lv_draw_layer_cache_set_pinned(scr->spec_attr->layer_cache, true);
+}
+
+/**
+ * Unpin the layer of a screen or delete it if its layer cache was enabled only for preloading
+ * @param scr       pointer to a screen or NULL
+ * @param own       true: the layer cache was enabled by `scr_preload_pin_cache()`
+ */
+static void scr_preload_release_cache(lv_obj_t * scr, bool own)
+{
+    if(scr == NULL || !lv_obj_get_layer_cache(scr)) return;
+
+    if(own) {
+        /*Not with `lv_obj_set_layer_cache()`: the screen is drawn already and needn't be invalidated*/
+        lv_draw_layer_cache_delete(scr->spec_attr->layer_cache);
+        scr->spec_attr->layer_cache = NULL;
+    }
+    else {
+        lv_draw_layer_cache_set_pinned(scr->spec_attr->layer_cache, false);
+    }
+}
+#endif
+#endif
@@ -170,6 +170,45 @@ bool lv_disp_is_invalidation_enabled(lv_disp_t * disp);
  */
 lv_timer_t * _lv_disp_get_refr_timer(lv_disp_t * disp);
 
+#if LV_USE_SCR_PRELOAD
+/**
+ * Prepare a screen in idle time to load it quickly later with `lv_scr_load_anim()`.
+ * Its layout is updated step by step and optionally it's rendered into its cached layer band by band.
+ * `LV_EVENT_READY` is sent to the screen when it's prepared. Changing the screen restarts the preparation.
+ * Only one screen of a display can be preloaded at a time.
+ * @param scr       pointer to a screen to load later
+ * @param render    true: render the screen too (requires `LV_USE_LAYER_CACHE` and a full screen sized layer
+ *                  outside of `LV_LAYER_CACHE_SIZE`); false: update only the layout
+ */
+void lv_scr_preload(lv_obj_t * scr, bool render);
+
+/**
+ * Tell if the preloading of a screen has finished and the screen is still unchanged
+ * @param scr       pointer to a screen
+ * @return          true: the screen can be loaded without further preparation
+ */
+bool lv_scr_is_preloaded(const lv_obj_t * scr);
+
+/**
+ * Stop preloading a screen and free its rendered layer
+ * @param scr       pointer to a screen passed to `lv_scr_preload()`
+ */
+void lv_scr_preload_cancel(lv_obj_t * scr);
+
+/**
+ * Free the cached layers of the preloaded screen and the previous screen. Called after the first refresh
+ * of the loaded screen, when the layers are not needed anymore.
+ * @param disp      pointer to a display
+ */
+void _lv_disp_release_scr_preload(lv_disp_t * disp);
+
+/**
+ * Forget a deleted screen in the preloading
+ * @param scr       pointer to a screen being deleted
+ */
+void _lv_disp_scr_preload_deleted(lv_obj_t * scr);
+#endif
+
 /*------------------------------------------------
  * To improve backward compatibility
  * Recommended only if you have one display
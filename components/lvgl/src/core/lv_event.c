@@ -29,12 +29,19 @@ typedef struct _lv_event_dsc_t {
 static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
 static lv_res_t event_send_core(lv_event_t * e);
 static bool event_is_bubbled(lv_event_t * e);
+static uint64_t event_filter_to_mask(lv_event_code_t filter);
+static void event_mask_update(lv_obj_t * obj);
+static bool obj_handles_event(const lv_obj_t * obj, uint64_t code_mask);
+static bool class_handles_event(const lv_obj_class_t * class_p, uint64_t code_mask);
 
 
 /**********************
  *  STATIC VARIABLES
  **********************/
-static lv_event_t * event_head;
+static LV_REFR_CTX_THREAD_LOCAL lv_event_t * event_head;
+#if LV_USE_EVENT_STATS
+    static lv_event_stats_t event_stats;
+#endif
 
 /**********************
  *      MACROS
@@ -158,6 +165,18 @@ void _lv_event_mark_deleted(lv_obj_t * obj)
     }
 }
 
+#if LV_USE_EVENT_STATS
+const lv_event_stats_t * lv_event_get_stats(void)
+{
+    return &event_stats;
+}
+
+void lv_event_reset_stats(void)
+{
+    lv_memset_00(&event_stats, sizeof(event_stats));
+}
+#endif
+
 
 struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb, lv_event_code_t filter,
                                              void * user_data)
@@ -173,6 +192,7 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].cb = event_cb;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
+    obj->spec_attr->event_mask |= event_filter_to_mask(filter);
 
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
@@ -193,6 +213,7 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_mask_update(obj);
             return true;
         }
     }
@@ -218,6 +239,7 @@ bool lv_obj_remove_event_cb_with_user_data(lv_obj_t * obj, lv_event_cb_t event_c
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_mask_update(obj);
             return true;
         }
     }
@@ -243,6 +265,7 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_mask_update(obj);
             return true;
         }
     }
@@ -435,8 +458,18 @@ static lv_res_t event_send_core(lv_event_t * e)
         if(e->deleted) return LV_RES_INV;
     }
 
+    /*Skip the callbacks and the class if they don't care about this event*/
+    uint64_t code_mask = LV_EVENT_MASK(e->code);
+    bool class_handles = class_handles_event(e->current_target->class_p, code_mask);
+    bool obj_handles = obj_handles_event(e->current_target, code_mask);
+
+#if LV_USE_EVENT_STATS
+    if(class_handles || obj_handles) event_stats.dispatched_cnt++;
+    else event_stats.skipped_cnt++;
+#endif
+
     lv_res_t res = LV_RES_OK;
-    lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+    lv_event_dsc_t * event_dsc = obj_handles ? lv_obj_get_event_dsc(e->current_target, 0) : NULL;
 
     uint32_t i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -455,9 +488,13 @@ static lv_res_t event_send_core(lv_event_t * e)
         event_dsc = lv_obj_get_event_dsc(e->current_target, i);
     }
 
-    res = lv_obj_event_base(NULL, e);
+    if(class_handles) res = lv_obj_event_base(NULL, e);
 
-    event_dsc = res == LV_RES_INV ? NULL : lv_obj_get_event_dsc(e->current_target, 0);
+    /*Check again as the callbacks might be changed in the meantime*/
+    event_dsc = NULL;
+    if(res == LV_RES_OK && obj_handles_event(e->current_target, code_mask)) {
+        event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+    }
 
     i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -525,3 +562,45 @@ static bool event_is_bubbled(lv_event_t * e)
             return true;
     }
 }
+
+static uint64_t event_filter_to_mask(lv_event_code_t filter)
+{
+    filter &= ~LV_EVENT_PREPROCESS;
+    if(filter == LV_EVENT_ALL) return UINT64_MAX;
+    else return LV_EVENT_MASK(filter);
+}
+
+/**
+ * Collect the event codes of all the callbacks of an object again. Used when a callback is removed.
+ * @param obj       pointer to an object
+ */
+static void event_mask_update(lv_obj_t * obj)
+{
+    uint64_t mask = 0;
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        mask |= event_filter_to_mask(obj->spec_attr->event_dsc[i].filter);
+    }
+    obj->spec_attr->event_mask = mask;
+}
+
+static bool obj_handles_event(const lv_obj_t * obj, uint64_t code_mask)
+{
+    if(obj->spec_attr == NULL) return false;
+    return (obj->spec_attr->event_mask & code_mask) ? true : false;
+}
+
+/**
+ * Check if any class in the class chain might handle an event
+ * @param class_p   the class of an object
+ * @param code_mask the event code's bit from `LV_EVENT_MASK()`
+ * @return          true: the event needs to be sent to the class
+ */
+static bool class_handles_event(const lv_obj_class_t * class_p, uint64_t code_mask)
+{
+    while(class_p) {
+        if(class_p->event_cb && (class_p->event_mask == 0 || (class_p->event_mask & code_mask))) return true;
+        class_p = class_p->base_class;
+    }
+    return false;
+}
@@ -91,6 +91,12 @@ typedef enum {
                                       before the class default event processing */
 } lv_event_code_t;
 
+/**
+ * The bit of an event code in the event bitmaps of the objects and classes.
+ * The custom event codes (see `lv_event_register_id()`) share the last bit.
+ */
+#define LV_EVENT_MASK(code) ((uint64_t)1 << ((uint32_t)(code) < _LV_EVENT_LAST ? (uint32_t)(code) : 63))
+
 typedef struct _lv_event_t {
     struct _lv_obj_t * target;
     struct _lv_obj_t * current_target;
@@ -132,6 +138,13 @@ typedef struct {
     const lv_area_t * area;
 } lv_cover_check_info_t;
 
+#if LV_USE_EVENT_STATS
+typedef struct {
+    uint32_t dispatched_cnt;    /*Number of times the callbacks or the class of an object were called*/
+    uint32_t skipped_cnt;       /*Number of times neither the object nor its class handled the event*/
+} lv_event_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -223,6 +236,19 @@ uint32_t lv_event_register_id(void);
  */
 void _lv_event_mark_deleted(struct _lv_obj_t * obj);
 
+#if LV_USE_EVENT_STATS
+/**
+ * Get the statistics of the event dispatching. Bubbled events are counted on each parent too.
+ * @return      pointer to the statistics
+ */
+const lv_event_stats_t * lv_event_get_stats(void);
+
+/**
+ * Reset the statistics of the event dispatching
+ */
+void lv_event_reset_stats(void);
+#endif
+
 
 /**
  * Add an event handler function for an object.
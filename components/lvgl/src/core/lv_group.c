@@ -28,6 +28,10 @@ static bool focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *)
                             void * (*move)(const lv_ll_t *, const void *));
 static void lv_group_refocus(lv_group_t * g);
 static lv_indev_t * get_indev(const lv_group_t * g);
+static bool obj_is_focusable(lv_obj_t * obj);
+#if LV_USE_OBJ_BULK_DEL
+    static lv_obj_t ** get_refocus_candidate(lv_group_t * g, lv_obj_t ** start);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +59,9 @@ lv_group_t * lv_group_create(void)
     _lv_ll_init(&group->obj_ll, sizeof(lv_obj_t *));
 
     group->obj_focus      = NULL;
+#if LV_USE_OBJ_BULK_DEL
+    group->obj_focus_del  = NULL;
+#endif
     group->frozen         = 0;
     group->focus_cb       = NULL;
     group->edge_cb        = NULL;
@@ -212,6 +219,52 @@ void lv_group_remove_obj(lv_obj_t * obj)
     LV_LOG_TRACE("finished");
 }
 
+#if LV_USE_OBJ_BULK_DEL
+void _lv_group_defocus_deleted(lv_obj_t * obj)
+{
+    lv_group_t * g = lv_obj_get_group(obj);
+    if(g == NULL || g->obj_focus == NULL || *g->obj_focus != obj) return;
+
+    if(g->frozen) g->frozen = 0;
+    lv_event_send(obj, LV_EVENT_DEFOCUSED, get_indev(g));
+
+    /*The next object is focused only once, when all the objects are deleted*/
+    g->obj_focus_del = g->obj_focus;
+    g->obj_focus = NULL;
+}
+
+void _lv_group_remove_deleted_objs(void)
+{
+    lv_group_t * g;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_group_ll), g) {
+        /*Find the object to focus while the deleted objects are still in the list*/
+        lv_obj_t ** focus_next = NULL;
+        if(g->obj_focus_del && g->obj_focus == NULL) {
+            focus_next = get_refocus_candidate(g, g->obj_focus_del);
+        }
+        g->obj_focus_del = NULL;
+
+        lv_obj_t ** i = _lv_ll_get_head(&g->obj_ll);
+        while(i) {
+            lv_obj_t ** i_next = _lv_ll_get_next(&g->obj_ll, i);
+            if((*i)->del_pending) {
+                _lv_ll_remove(&g->obj_ll, i);
+                lv_mem_free(i);
+            }
+            i = i_next;
+        }
+
+        if(focus_next) {
+            g->obj_focus = focus_next;
+            lv_res_t res = lv_event_send(*g->obj_focus, LV_EVENT_FOCUSED, get_indev(g));
+            if(res != LV_RES_OK) continue;
+            lv_obj_invalidate(*g->obj_focus);
+            if(g->focus_cb) g->focus_cb(g);
+        }
+    }
+}
+#endif
+
 void lv_group_remove_all_objs(lv_group_t * group)
 {
     /*Defocus the currently focused object*/
@@ -220,6 +273,9 @@ void lv_group_remove_all_objs(lv_group_t * group)
         lv_obj_invalidate(*group->obj_focus);
         group->obj_focus = NULL;
     }
+#if LV_USE_OBJ_BULK_DEL
+    group->obj_focus_del = NULL;
+#endif
 
     /*Remove the objects from the group*/
     lv_obj_t ** obj;
@@ -429,17 +485,7 @@ static bool focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *)
         can_move = true;
 
         if(obj_next == NULL) continue;
-        if(lv_obj_get_state(*obj_next) & LV_STATE_DISABLED) continue;
-
-        /*Hidden objects don't receive focus.
-         *If any parent is hidden, the object is also hidden)*/
-        lv_obj_t * parent = *obj_next;
-        while(parent) {
-            if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) break;
-            parent = lv_obj_get_parent(parent);
-        }
-
-        if(parent && lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) continue;
+        if(!obj_is_focusable(*obj_next)) continue;
 
         /*If we got her a good candidate is found*/
         break;
@@ -465,6 +511,48 @@ static bool focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *)
     return focus_changed;
 }
 
+static bool obj_is_focusable(lv_obj_t * obj)
+{
+#if LV_USE_OBJ_BULK_DEL
+    if(obj->del_pending) return false;
+#endif
+    if(lv_obj_get_state(obj) & LV_STATE_DISABLED) return false;
+
+    /*Hidden objects don't receive focus.
+     *If any parent is hidden, the object is also hidden)*/
+    lv_obj_t * parent = obj;
+    while(parent) {
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) return false;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    return true;
+}
+
+#if LV_USE_OBJ_BULK_DEL
+/**
+ * Find the object to focus instead of a deleted one like `lv_group_refocus()`, i.e. with wrapping
+ * @param g         pointer to a group
+ * @param start     the node of the deleted focused object
+ * @return          the node to focus or NULL if there is no focusable object in the group
+ */
+static lv_obj_t ** get_refocus_candidate(lv_group_t * g, lv_obj_t ** start)
+{
+    bool next = g->refocus_policy == LV_GROUP_REFOCUS_POLICY_NEXT;
+    lv_obj_t ** i = next ? _lv_ll_get_next(&g->obj_ll, start) : _lv_ll_get_prev(&g->obj_ll, start);
+    while(i != start) {
+        if(i == NULL) {
+            i = next ? _lv_ll_get_head(&g->obj_ll) : _lv_ll_get_tail(&g->obj_ll);
+            continue;
+        }
+        if(obj_is_focusable(*i)) return i;
+        i = next ? _lv_ll_get_next(&g->obj_ll, i) : _lv_ll_get_prev(&g->obj_ll, i);
+    }
+
+    return NULL;
+}
+#endif
+
 /**
  * Find an indev preferably with KEYPAD or ENCOEDR type that uses the given group.
  * In other words, find an indev, that is related to the given group.
@@ -59,6 +59,9 @@ typedef void (*lv_group_edge_cb_t)(struct _lv_group_t *, bool);
 typedef struct _lv_group_t {
     lv_ll_t obj_ll;        /**< Linked list to store the objects in the group*/
     struct _lv_obj_t ** obj_focus; /**< The object in focus*/
+#if LV_USE_OBJ_BULK_DEL
+    struct _lv_obj_t ** obj_focus_del; /**< The focused object which is being deleted in a bulk deletion*/
+#endif
 
     lv_group_focus_cb_t focus_cb;              /**< A function to call when a new object is focused (optional)*/
     lv_group_edge_cb_t  edge_cb;               /**< A function to call when an edge is reached, no more focus
@@ -137,6 +140,22 @@ void lv_group_swap_obj(struct _lv_obj_t * obj1, struct _lv_obj_t * obj2);
  */
 void lv_group_remove_obj(struct _lv_obj_t * obj);
 
+#if LV_USE_OBJ_BULK_DEL
+/**
+ * Defocus an object being deleted in a bulk deletion. It stays in its group until `_lv_group_remove_deleted_objs()`.
+ * @param obj       pointer to an object being deleted
+ * @remarks Internal function, do not call directly.
+ */
+void _lv_group_defocus_deleted(struct _lv_obj_t * obj);
+
+/**
+ * Remove the objects deleted in a bulk deletion from all groups and focus the next object
+ * in the groups whose focused object was deleted.
+ * @remarks Internal function, do not call directly.
+ */
+void _lv_group_remove_deleted_objs(void);
+#endif
+
 /**
  * Remove all objects from a group
  * @param group     pointer to a group
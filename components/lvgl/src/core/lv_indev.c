@@ -24,9 +24,30 @@
     #warning "LV_INDEV_DRAG_THROW must be greater than 0"
 #endif
 
+#if LV_USE_INDEV_HIT_INDEX
+    /*Use the index only if there are at most this many children at a point*/
+    #define HIT_INDEX_MAX_CANDIDATES 16
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_INDEV_HIT_INDEX
+typedef struct {
+    lv_area_t area;         /*Click area relative to the parent, independently of the scroll position*/
+    lv_coord_t max_y2;      /*The largest `area.y2` up to this entry*/
+    uint32_t id;            /*Index of the child*/
+} hit_index_entry_t;
+
+typedef struct _lv_indev_hit_index_t {
+    uint32_t gen;                   /*Valid only while it's the same as `hit_index_gen`*/
+    uint32_t child_cnt;
+    uint32_t entry_cnt;
+    uint32_t always_cnt;
+    hit_index_entry_t * entries;    /*Sorted by `area.y1`*/
+    uint32_t * always_ids;          /*Children to check regardless of their position*/
+} hit_index_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -41,12 +62,20 @@ static void indev_proc_reset_query_handler(lv_indev_t * indev);
 static void indev_click_focus(_lv_indev_proc_t * proc);
 static void indev_gesture(_lv_indev_proc_t * proc);
 static bool indev_reset_check(_lv_indev_proc_t * proc);
+#if LV_USE_INDEV_HIT_INDEX
+    static int32_t hit_index_get_candidates(lv_obj_t * obj, const lv_point_t * point, uint32_t * ids);
+    static hit_index_t * hit_index_build(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_indev_t * indev_act;
 static lv_obj_t * indev_obj_act = NULL;
+#if LV_USE_INDEV_HIT_INDEX
+    static uint32_t hit_index_gen = 1;
+    static bool hit_index_en = true;
+#endif
 
 /**********************
  *      MACROS
@@ -314,6 +343,19 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
         int32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
 
+#if LV_USE_INDEV_HIT_INDEX
+        /*If the children are indexed check only the ones around the point*/
+        uint32_t ids[HIT_INDEX_MAX_CANDIDATES];
+        int32_t id_cnt = hit_index_get_candidates(obj, &p_trans, ids);
+        if(id_cnt >= 0) {
+            for(i = 0; i < id_cnt; i++) {
+                found_p = lv_indev_search_obj(obj->spec_attr->children[ids[i]], &p_trans);
+                if(found_p) return found_p;
+            }
+            child_cnt = 0;  /*No need to check all the children*/
+        }
+#endif
+
         /*If a child matches use it*/
         for(i = child_cnt - 1; i >= 0; i--) {
             lv_obj_t * child = obj->spec_attr->children[i];
@@ -328,10 +370,158 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
     else return NULL;
 }
 
+#if LV_USE_INDEV_HIT_INDEX
+void lv_indev_enable_hit_index(bool en)
+{
+    hit_index_en = en;
+}
+
+void _lv_indev_hit_index_invalidate(void)
+{
+    hit_index_gen++;
+    /*0 is reserved for the not yet built indexes*/
+    if(hit_index_gen == 0) hit_index_gen = 1;
+}
+
+void _lv_indev_hit_index_free(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->hit_index == NULL) return;
+
+    lv_mem_free(obj->spec_attr->hit_index);
+    obj->spec_attr->hit_index = NULL;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_USE_INDEV_HIT_INDEX
+/**
+ * Get the children of an object which might be found at a point, using an index of their positions.
+ * @param obj       pointer to an object
+ * @param point     the point transformed to the coordinate system of `obj`
+ * @param ids       store the indexes of the children here from the top to the bottom one
+ * @return          number of the found children or -1 if the index can't be used
+ */
+static int32_t hit_index_get_candidates(lv_obj_t * obj, const lv_point_t * point, uint32_t * ids)
+{
+    if(!hit_index_en) return -1;
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    if(child_cnt < LV_INDEV_HIT_INDEX_MIN_CHILD_CNT) return -1;
+
+    hit_index_t * index = obj->spec_attr->hit_index;
+    if(index == NULL || index->gen != hit_index_gen || index->child_cnt != child_cnt) {
+        index = hit_index_build(obj);
+        if(index == NULL) return -1;
+    }
+
+    /*The positions are stored independently of the scroll position*/
+    lv_coord_t x = point->x - obj->coords.x1 - obj->spec_attr->scroll.x;
+    lv_coord_t y = point->y - obj->coords.y1 - obj->spec_attr->scroll.y;
+
+    /*Find the last entry starting above the point*/
+    uint32_t first = 0;
+    uint32_t last = index->entry_cnt;
+    while(first < last) {
+        uint32_t mid = (first + last) >> 1;
+        if(index->entries[mid].area.y1 <= y) first = mid + 1;
+        else last = mid;
+    }
+
+    if(index->always_cnt > HIT_INDEX_MAX_CANDIDATES) return -1;
+
+    uint32_t id_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < index->always_cnt; i++) {
+        ids[id_cnt++] = index->always_ids[i];
+    }
+
+    /*Go upwards while an entry might still reach down to the point*/
+    for(i = first; i > 0 && index->entries[i - 1].max_y2 >= y; i--) {
+        hit_index_entry_t * e = &index->entries[i - 1];
+        if(x < e->area.x1 || x > e->area.x2 || y > e->area.y2) continue;
+        if(id_cnt == HIT_INDEX_MAX_CANDIDATES) return -1;
+        ids[id_cnt++] = e->id;
+    }
+
+    /*Check the children in the same order as without the index: the last (top) one first*/
+    uint32_t j;
+    for(i = 1; i < id_cnt; i++) {
+        uint32_t id = ids[i];
+        for(j = i; j > 0 && ids[j - 1] < id; j--) ids[j] = ids[j - 1];
+        ids[j] = id;
+    }
+
+    return id_cnt;
+}
+
+/**
+ * Build the position index of an object's children
+ * @param obj       pointer to an object with children
+ * @return          the new index or NULL on error
+ */
+static hit_index_t * hit_index_build(lv_obj_t * obj)
+{
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    hit_index_t * index = obj->spec_attr->hit_index;
+    if(index == NULL || index->child_cnt != child_cnt) {
+        size_t size = sizeof(hit_index_t) + child_cnt * (sizeof(hit_index_entry_t) + sizeof(uint32_t));
+        hit_index_t * new_index = lv_mem_realloc(index, size);
+        if(new_index == NULL) return NULL;
+        index = new_index;
+        obj->spec_attr->hit_index = index;
+        index->entries = (hit_index_entry_t *)(index + 1);
+        index->always_ids = (uint32_t *)(index->entries + child_cnt);
+    }
+
+    index->gen = hit_index_gen;
+    index->child_cnt = child_cnt;
+    index->entry_cnt = 0;
+    index->always_cnt = 0;
+
+    lv_coord_t ofs_x = -obj->spec_attr->scroll.x - obj->coords.x1;
+    lv_coord_t ofs_y = -obj->spec_attr->scroll.y - obj->coords.y1;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        /*Floating children don't scroll, transformed ones might be anywhere, and the children of
+         *objects with visible overflow might be out of their parent. Always check them.*/
+        if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE) ||
+           _lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) {
+            index->always_ids[index->always_cnt++] = i;
+            continue;
+        }
+
+        hit_index_entry_t * e = &index->entries[index->entry_cnt];
+        lv_obj_get_click_area(child, &e->area);
+        _lv_area_join(&e->area, &e->area, &child->coords);
+        lv_area_move(&e->area, ofs_x, ofs_y);
+        e->id = i;
+
+        /*Sort by the top coordinate. The children are usually already sorted so insertion sort is fast.*/
+        uint32_t j = index->entry_cnt;
+        hit_index_entry_t tmp = *e;
+        while(j > 0 && index->entries[j - 1].area.y1 > tmp.area.y1) {
+            index->entries[j] = index->entries[j - 1];
+            j--;
+        }
+        index->entries[j] = tmp;
+        index->entry_cnt++;
+    }
+
+    /*Running maximum of the bottom coordinates to know where to stop searching upwards*/
+    lv_coord_t max_y2 = LV_COORD_MIN;
+    for(i = 0; i < index->entry_cnt; i++) {
+        max_y2 = LV_MAX(max_y2, index->entries[i].area.y2);
+        index->entries[i].max_y2 = max_y2;
+    }
+
+    return index;
+}
+#endif
+
 /**
  * Process a new point from LV_INDEV_TYPE_POINTER input device
  * @param i pointer to an input device
@@ -900,8 +1090,24 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
     proc->types.pointer.vect.x = proc->types.pointer.act_point.x - proc->types.pointer.last_point.x;
     proc->types.pointer.vect.y = proc->types.pointer.act_point.y - proc->types.pointer.last_point.y;
 
+#if LV_USE_SCROLL_COPY
+    /*Normalize the velocity to `LV_INDEV_DEF_READ_PERIOD` to make the throw independent of the read period.
+     *Buffered points (read in the same ms) are not scaled.*/
+    lv_point_t v = proc->types.pointer.vect;
+    uint32_t elaps = lv_tick_elaps(proc->types.pointer.vect_timestamp);
+    proc->types.pointer.vect_timestamp = lv_tick_get();
+    if(elaps > 0) {
+        v.x = (int32_t)v.x * LV_INDEV_DEF_READ_PERIOD / (int32_t)elaps;
+        v.y = (int32_t)v.y * LV_INDEV_DEF_READ_PERIOD / (int32_t)elaps;
+    }
+
+    proc->types.pointer.scroll_throw_vect.x = (proc->types.pointer.scroll_throw_vect.x + v.x) / 2;
+    proc->types.pointer.scroll_throw_vect.y = (proc->types.pointer.scroll_throw_vect.y + v.y) / 2;
+    proc->types.pointer.scroll_throw_v = 0;     /*Start a new throw on release*/
+#else
     proc->types.pointer.scroll_throw_vect.x = (proc->types.pointer.scroll_throw_vect.x + proc->types.pointer.vect.x) / 2;
     proc->types.pointer.scroll_throw_vect.y = (proc->types.pointer.scroll_throw_vect.y + proc->types.pointer.vect.y) / 2;
+#endif
 
     proc->types.pointer.scroll_throw_vect_ori = proc->types.pointer.scroll_throw_vect;
 
@@ -165,6 +165,27 @@ lv_timer_t * lv_indev_get_read_timer(lv_disp_t * indev);
  */
 lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point);
 
+#if LV_USE_INDEV_HIT_INDEX
+/**
+ * Enable or disable the position index of the children in `lv_indev_search_obj()`.
+ * Useful to compare the performance with and without the index.
+ * @param en true: use the index (default); false: check all the children
+ */
+void lv_indev_enable_hit_index(bool en);
+
+/**
+ * Mark the position indexes of the children as outdated.
+ * Called when objects are moved, resized, added, removed or reordered.
+ */
+void _lv_indev_hit_index_invalidate(void);
+
+/**
+ * Free the position index of an object's children
+ * @param obj pointer to an object
+ */
+void _lv_indev_hit_index_free(lv_obj_t * obj);
+#endif
+
 /**********************
  *      MACROS
  **********************/
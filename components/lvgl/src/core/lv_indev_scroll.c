@@ -13,6 +13,9 @@
  *      DEFINES
  *********************/
 #define ELASTIC_SLOWNESS_FACTOR 4   /*Scrolling on elastic parts are slower by this factor*/
+#if LV_USE_SCROLL_COPY
+    #define THROW_STEP_MAX_TIME     200 /*Longer steps are limited to this [ms] (e.g. after a blocking operation)*/
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -30,6 +33,11 @@ static lv_coord_t scroll_throw_predict_y(_lv_indev_proc_t * proc);
 static lv_coord_t scroll_throw_predict_x(_lv_indev_proc_t * proc);
 static lv_coord_t elastic_diff(lv_obj_t * scroll_obj, lv_coord_t diff, lv_coord_t scroll_start, lv_coord_t scroll_end,
                                lv_dir_t dir);
+#if LV_USE_SCROLL_COPY
+static lv_coord_t scroll_throw_step(_lv_indev_proc_t * proc, lv_coord_t * vect, lv_coord_t scroll_throw,
+                                    lv_coord_t scroll_start, lv_coord_t scroll_end, lv_dir_t dir);
+static uint32_t get_throw_ms_factor(uint8_t scroll_throw);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -130,16 +138,22 @@ void _lv_indev_scroll_throw_handler(_lv_indev_proc_t * proc)
         proc->types.pointer.scroll_throw_vect.x = 0;
         /*If no snapping "throw"*/
         if(align_y == LV_SCROLL_SNAP_NONE) {
-            proc->types.pointer.scroll_throw_vect.y =
-                proc->types.pointer.scroll_throw_vect.y * (100 - scroll_throw) / 100;
-
             lv_coord_t sb = lv_obj_get_scroll_bottom(scroll_obj);
             lv_coord_t st = lv_obj_get_scroll_top(scroll_obj);
 
+#if LV_USE_SCROLL_COPY
+            lv_coord_t diff_y = scroll_throw_step(proc, &proc->types.pointer.scroll_throw_vect.y, scroll_throw, st, sb,
+                                                  LV_DIR_VER);
+            if(diff_y) _lv_obj_scroll_by_raw(scroll_obj, 0, diff_y);
+#else
+            proc->types.pointer.scroll_throw_vect.y =
+                proc->types.pointer.scroll_throw_vect.y * (100 - scroll_throw) / 100;
+
             proc->types.pointer.scroll_throw_vect.y = elastic_diff(scroll_obj, proc->types.pointer.scroll_throw_vect.y, st, sb,
                                                                    LV_DIR_VER);
 
             lv_obj_scroll_by(scroll_obj, 0, proc->types.pointer.scroll_throw_vect.y, LV_ANIM_OFF);
+#endif
         }
         /*With snapping find the nearest snap point and scroll there*/
         else {
@@ -154,16 +168,22 @@ void _lv_indev_scroll_throw_handler(_lv_indev_proc_t * proc)
         proc->types.pointer.scroll_throw_vect.y = 0;
         /*If no snapping "throw"*/
         if(align_x == LV_SCROLL_SNAP_NONE) {
-            proc->types.pointer.scroll_throw_vect.x =
-                proc->types.pointer.scroll_throw_vect.x * (100 - scroll_throw) / 100;
-
             lv_coord_t sl = lv_obj_get_scroll_left(scroll_obj);
             lv_coord_t sr = lv_obj_get_scroll_right(scroll_obj);
 
+#if LV_USE_SCROLL_COPY
+            lv_coord_t diff_x = scroll_throw_step(proc, &proc->types.pointer.scroll_throw_vect.x, scroll_throw, sl, sr,
+                                                  LV_DIR_HOR);
+            if(diff_x) _lv_obj_scroll_by_raw(scroll_obj, diff_x, 0);
+#else
+            proc->types.pointer.scroll_throw_vect.x =
+                proc->types.pointer.scroll_throw_vect.x * (100 - scroll_throw) / 100;
+
             proc->types.pointer.scroll_throw_vect.x = elastic_diff(scroll_obj, proc->types.pointer.scroll_throw_vect.x, sl, sr,
                                                                    LV_DIR_HOR);
 
             lv_obj_scroll_by(scroll_obj, proc->types.pointer.scroll_throw_vect.x, 0, LV_ANIM_OFF);
+#endif
         }
         /*With snapping find the nearest snap point and scroll there*/
         else {
@@ -214,6 +234,30 @@ void _lv_indev_scroll_throw_handler(_lv_indev_proc_t * proc)
     }
 }
 
+#if LV_USE_SCROLL_COPY
+lv_coord_t _lv_indev_scroll_throw_step(int32_t * v, int32_t * rem, uint32_t elaps, uint8_t scroll_throw)
+{
+    if(elaps > THROW_STEP_MAX_TIME) elaps = THROW_STEP_MAX_TIME;
+
+    uint32_t k = get_throw_ms_factor(scroll_throw);
+    int64_t dist = *rem;
+    int64_t vel = *v;
+    uint32_t i;
+    for(i = 0; i < elaps && vel != 0; i++) {
+        vel = (vel * k) / 65536;
+        dist += vel / LV_INDEV_DEF_READ_PERIOD;
+
+        /*Stop below 1 px / LV_INDEV_DEF_READ_PERIOD like the throw did with integer steps*/
+        if(vel > -65536 && vel < 65536) vel = 0;
+    }
+
+    *v = (int32_t)vel;
+    lv_coord_t px = (lv_coord_t)(dist / 65536);
+    *rem = vel == 0 ? 0 : (int32_t)(dist - (int64_t)px * 65536);
+    return px;
+}
+#endif
+
 /**
  * Predict where would a scroll throw end
  * @param indev pointer to an input device
@@ -608,6 +652,78 @@ static lv_coord_t scroll_throw_predict_x(_lv_indev_proc_t * proc)
     return move;
 }
 
+#if LV_USE_SCROLL_COPY
+/**
+ * Get the distance to scroll in a throw since the last step
+ * @param proc          pointer to an input device's proc field
+ * @param vect          the throw velocity in px / LV_INDEV_DEF_READ_PERIOD. Updated with the slowed down value.
+ * @param scroll_throw  slow down in percent
+ * @param scroll_start  the scroll top or left of the scrolled object
+ * @param scroll_end    the scroll bottom or right of the scrolled object
+ * @param dir           `LV_DIR_VER` or `LV_DIR_HOR`
+ * @return              the distance to scroll by
+ */
+static lv_coord_t scroll_throw_step(_lv_indev_proc_t * proc, lv_coord_t * vect, lv_coord_t scroll_throw,
+                                    lv_coord_t scroll_start, lv_coord_t scroll_end, lv_dir_t dir)
+{
+    uint32_t elaps;
+    /*The velocity was set from outside (released or stopped), so start a new throw.
+     *The first step is taken as one read period to keep the first move immediate.*/
+    if(*vect != proc->types.pointer.scroll_throw_v / 65536) {
+        proc->types.pointer.scroll_throw_v = (int32_t)(*vect) * 65536;
+        proc->types.pointer.scroll_throw_rem = 0;
+        elaps = LV_INDEV_DEF_READ_PERIOD;
+    }
+    else {
+        elaps = lv_tick_elaps(proc->types.pointer.scroll_throw_timestamp);
+    }
+    proc->types.pointer.scroll_throw_timestamp = lv_tick_get();
+
+    lv_coord_t diff = _lv_indev_scroll_throw_step(&proc->types.pointer.scroll_throw_v,
+                                                  &proc->types.pointer.scroll_throw_rem, elaps, scroll_throw);
+
+    /*Slow down the throw in the elastic area in the same ratio as the distance*/
+    lv_coord_t diff_el = elastic_diff(proc->types.pointer.scroll_obj, diff, scroll_start, scroll_end, dir);
+    if(diff_el != diff) {
+        proc->types.pointer.scroll_throw_v = (int32_t)((int64_t)proc->types.pointer.scroll_throw_v * diff_el / diff);
+        proc->types.pointer.scroll_throw_rem = 0;
+        if(LV_ABS(proc->types.pointer.scroll_throw_v) < 65536) proc->types.pointer.scroll_throw_v = 0;
+    }
+
+    *vect = proc->types.pointer.scroll_throw_v / 65536;
+    return diff_el;
+}
+
+/**
+ * Get the factor with which the throw velocity is multiplied in every ms.
+ * `factor ^ LV_INDEV_DEF_READ_PERIOD = (100 - scroll_throw) / 100`
+ * @param scroll_throw  slow down in percent per LV_INDEV_DEF_READ_PERIOD
+ * @return              the factor in 1/65536 units
+ */
+static uint32_t get_throw_ms_factor(uint8_t scroll_throw)
+{
+    static uint8_t last_throw = 0;
+    static uint32_t last_k = 65536;
+    if(scroll_throw == last_throw) return last_k;
+
+    uint32_t target = ((100 - LV_MIN(scroll_throw, 100)) << 16) / 100;
+    uint32_t min = 0;
+    uint32_t max = 65536;
+    while(min < max) {
+        uint32_t k = (min + max + 1) / 2;
+        uint64_t p = 65536;
+        uint32_t i;
+        for(i = 0; i < LV_INDEV_DEF_READ_PERIOD; i++) p = (p * k) >> 16;
+        if(p <= target) min = k;
+        else max = k - 1;
+    }
+
+    last_throw = scroll_throw;
+    last_k = min;
+    return min;
+}
+#endif
+
 static lv_coord_t elastic_diff(lv_obj_t * scroll_obj, lv_coord_t diff, lv_coord_t scroll_start, lv_coord_t scroll_end,
                                lv_dir_t dir)
 {
@@ -39,6 +39,20 @@ void _lv_indev_scroll_handler(_lv_indev_proc_t * proc);
  */
 void _lv_indev_scroll_throw_handler(_lv_indev_proc_t * proc);
 
+#if LV_USE_SCROLL_COPY
+/**
+ * Advance the velocity and the distance of a scroll throw by the elapsed time.
+ * The velocity is slowed down by `scroll_throw` percent in every `LV_INDEV_DEF_READ_PERIOD` ms,
+ * so the throw looks the same with any read period or frame time. Used internally.
+ * @param v             the velocity in 1/65536 px per `LV_INDEV_DEF_READ_PERIOD` ms. Set to 0 when the throw has finished.
+ * @param rem           the sub-pixel part of the distance in 1/65536 px, kept between the steps
+ * @param elaps         the elapsed time since the last step [ms]
+ * @param scroll_throw  slow down in percent
+ * @return              the distance to scroll in this step [px]
+ */
+lv_coord_t _lv_indev_scroll_throw_step(int32_t * v, int32_t * rem, uint32_t elaps, uint8_t scroll_throw);
+#endif
+
 /**
  * Predict where would a scroll throw end
  * @param indev     pointer to an input device
@@ -70,10 +70,18 @@ const lv_obj_class_t lv_obj_class = {
     .constructor_cb = lv_obj_constructor,
     .destructor_cb = lv_obj_destructor,
     .event_cb = lv_obj_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_PRESSED) | LV_EVENT_MASK(LV_EVENT_RELEASED) |
+                  LV_EVENT_MASK(LV_EVENT_PRESS_LOST) | LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) |
+                  LV_EVENT_MASK(LV_EVENT_KEY) | LV_EVENT_MASK(LV_EVENT_FOCUSED) | LV_EVENT_MASK(LV_EVENT_SCROLL_BEGIN) |
+                  LV_EVENT_MASK(LV_EVENT_SCROLL_END) | LV_EVENT_MASK(LV_EVENT_DEFOCUSED) |
+                  LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) | LV_EVENT_MASK(LV_EVENT_CHILD_CHANGED) |
+                  LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) | LV_EVENT_MASK(LV_EVENT_DRAW_MAIN) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_POST) | LV_EVENT_MASK(LV_EVENT_COVER_CHECK),
     .width_def = LV_DPI_DEF,
     .height_def = LV_DPI_DEF,
     .editable = LV_OBJ_CLASS_EDITABLE_FALSE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_FALSE,
+    .scroll_copy = 1,
     .instance_size = (sizeof(lv_obj_t)),
     .base_class = NULL,
 };
@@ -114,6 +122,11 @@ void lv_init(void)
 
     lv_draw_init();
 
+#if LV_USE_DRAW_SW_SIMD
+    /*Select the blend kernels by the CPU features*/
+    lv_draw_sw_simd_init();
+#endif
+
 #if LV_USE_GPU_STM32_DMA2D
     /*Initialize DMA2D GPU*/
     lv_draw_stm32_dma2d_init();
@@ -187,6 +200,10 @@ void lv_init(void)
 
 void lv_deinit(void)
 {
+#if LV_USE_DRAW_SW_PARALLEL
+    lv_draw_sw_parallel_deinit();
+#endif
+
     _lv_gc_clear_roots();
 
     lv_disp_set_default(NULL);
@@ -242,6 +259,11 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
         lv_obj_invalidate_area(obj, &hor_area);
         lv_obj_invalidate_area(obj, &ver_area);
     }
+
+#if LV_USE_INDEV_HIT_INDEX
+    /*These flags decide whether the object can be found by its position in the parent's index*/
+    if(f & (LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) _lv_indev_hit_index_invalidate();
+#endif
 }
 
 void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
@@ -270,6 +292,9 @@ void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
     }
 
+#if LV_USE_INDEV_HIT_INDEX
+    if(f & (LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) _lv_indev_hit_index_invalidate();
+#endif
 }
 
 void lv_obj_add_state(lv_obj_t * obj, lv_state_t state)
@@ -343,7 +368,7 @@ void lv_obj_allocate_spec_attr(lv_obj_t * obj)
     if(obj->spec_attr == NULL) {
         static uint32_t x = 0;
         x++;
-        obj->spec_attr = lv_mem_alloc(sizeof(_lv_obj_spec_attr_t));
+        obj->spec_attr = _lv_obj_mem_alloc(sizeof(_lv_obj_spec_attr_t));
         LV_ASSERT_MALLOC(obj->spec_attr);
         if(obj->spec_attr == NULL) return;
 
@@ -438,27 +463,57 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+    _lv_obj_style_batch_remove(obj);
 
+#if LV_USE_OBJ_BULK_DEL
+    /*The animations and the groups of all the objects of a bulk deletion are cleaned up in one pass at its end*/
+    if(obj->del_pending) {
+        _lv_group_defocus_deleted(obj);
+    }
+    else {
+        lv_anim_del(obj, NULL);
+        lv_group_t * group = lv_obj_get_group(obj);
+        if(group) lv_group_remove_obj(obj);
+    }
+#else
     /*Remove the animations from this object*/
     lv_anim_del(obj, NULL);
 
     /*Delete from the group*/
     lv_group_t * group = lv_obj_get_group(obj);
     if(group) lv_group_remove_obj(obj);
+#endif
 
     if(obj->spec_attr) {
         if(obj->spec_attr->children) {
-            lv_mem_free(obj->spec_attr->children);
+            _lv_obj_mem_free(obj->spec_attr->children);
             obj->spec_attr->children = NULL;
         }
         if(obj->spec_attr->event_dsc) {
             lv_mem_free(obj->spec_attr->event_dsc);
             obj->spec_attr->event_dsc = NULL;
         }
+#if LV_USE_LAYER_CACHE
+        if(obj->spec_attr->layer_cache) {
+            lv_draw_layer_cache_delete(obj->spec_attr->layer_cache);
+            obj->spec_attr->layer_cache = NULL;
+        }
+#endif
+#if LV_USE_INDEV_HIT_INDEX
+        _lv_indev_hit_index_free(obj);
+#endif
 
-        lv_mem_free(obj->spec_attr);
+        _lv_obj_mem_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
+
+#if LV_USE_DRAW_LIST
+    _lv_obj_free_draw_list(obj);
+#endif
+
+#if LV_USE_OBJ_STYLE_CACHE
+    _lv_obj_free_style_cache(obj);
+#endif
 }
 
 static void lv_obj_draw(lv_event_t * e)
@@ -862,6 +917,11 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     lv_state_t prev_state = obj->state;
     obj->state = new_state;
 
+#if LV_USE_OBJ_STYLE_CACHE
+    /*The children might inherit properties which depend on the state*/
+    _lv_style_cache_invalidate();
+#endif
+
     _lv_style_state_cmp_t cmp_res = _lv_obj_style_state_compare(obj, prev_state, new_state);
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == _LV_STYLE_STATE_CMP_SAME) return;
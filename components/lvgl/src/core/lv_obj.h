@@ -22,12 +22,25 @@ extern "C" {
 #include "../misc/lv_area.h"
 #include "../misc/lv_color.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_slab.h"
 #include "../hal/lv_hal.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+/*The objects, their special attributes, style and children arrays are allocated with these*/
+#if LV_USE_OBJ_POOL
+    #define _lv_obj_mem_alloc(size)         lv_slab_alloc(size)
+    #define _lv_obj_mem_realloc(p, size)    lv_slab_realloc(p, size)
+    #define _lv_obj_mem_free(p)             lv_slab_free(p)
+#else
+    #define _lv_obj_mem_alloc(size)         lv_mem_alloc(size)
+    #define _lv_obj_mem_realloc(p, size)    lv_mem_realloc(p, size)
+    #define _lv_obj_mem_free(p)             lv_mem_free(p)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -158,6 +171,7 @@ typedef struct {
     lv_group_t * group_p;
 
     struct _lv_event_dsc_t * event_dsc; /**< Dynamically allocated event callback and user data array*/
+    uint64_t event_mask;                /**< Bitmap of the event codes having callbacks in `event_dsc`. See `LV_EVENT_MASK()`*/
     lv_point_t scroll;                  /**< The current X/Y scroll offset*/
 
     lv_coord_t ext_click_pad;           /**< Extra click padding in all direction*/
@@ -169,6 +183,12 @@ typedef struct {
     lv_dir_t scroll_dir : 4;                /**< The allowed scroll direction(s)*/
     uint8_t event_dsc_cnt : 6;              /**< Number of event callbacks stored in `event_dsc` array*/
     uint8_t layer_type : 2;    /**< Cache the layer type here. Element of @lv_intermediate_layer_type_t */
+#if LV_USE_LAYER_CACHE
+    lv_draw_layer_cache_t * layer_cache;    /**< The rendered image of the object if the layer cache is enabled*/
+#endif
+#if LV_USE_INDEV_HIT_INDEX
+    struct _lv_indev_hit_index_t * hit_index;   /**< The children indexed by their position for hit testing*/
+#endif
 } _lv_obj_spec_attr_t;
 
 typedef struct _lv_obj_t {
@@ -178,16 +198,36 @@ typedef struct _lv_obj_t {
     _lv_obj_style_t * styles;
 #if LV_USE_USER_DATA
     void * user_data;
+#endif
+#if LV_USE_DRAW_LIST
+    lv_draw_list_t * draw_list;     /*Recorded main and post draw calls*/
+#endif
+#if LV_USE_OBJ_STYLE_CACHE
+    _lv_obj_style_cache_t * style_cache;    /*Resolved style properties*/
+#endif
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    lv_point_t self_size;           /*Result of the last `LV_EVENT_GET_SELF_SIZE`*/
+    lv_point_t self_size_ref;       /*Content width and height when `self_size` was measured*/
 #endif
     lv_area_t coords;
     lv_obj_flag_t flags;
     lv_state_t state;
     uint16_t layout_inv : 1;
     uint16_t scr_layout_inv : 1;
+    uint16_t child_layout_inv : 1;  /*A descendant's layout is invalid*/
     uint16_t skip_trans : 1;
     uint16_t style_cnt  : 6;
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
+    uint16_t style_batch : 1;   /*Has a pending refresh in the style batch*/
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    uint16_t self_size_valid : 1;
+    uint16_t self_size_w_layout : 1;    /*`w_layout` when `self_size` was measured*/
+    uint16_t self_size_h_layout : 1;    /*`h_layout` when `self_size` was measured*/
+#endif
+#if LV_USE_OBJ_BULK_DEL
+    uint16_t del_pending : 1;   /*Being deleted in a bulk deletion. Freed at its end.*/
+#endif
 } lv_obj_t;
 
 
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj.h"
 #include "lv_theme.h"
+#include "lv_indev.h"
 
 /*********************
  *      DEFINES
@@ -44,7 +45,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
     uint32_t s = get_instance_size(class_p);
-    lv_obj_t * obj = lv_mem_alloc(s);
+    lv_obj_t * obj = _lv_obj_mem_alloc(s);
     if(obj == NULL) return NULL;
     lv_memset_00(obj, s);
     obj->class_p = class_p;
@@ -56,7 +57,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         lv_disp_t * disp = lv_disp_get_default();
         if(!disp) {
             LV_LOG_WARN("No display created yet. No place to assign the new screen");
-            lv_mem_free(obj);
+            _lv_obj_mem_free(obj);
             return NULL;
         }
 
@@ -85,17 +86,11 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
             lv_obj_allocate_spec_attr(parent);
         }
 
-        if(parent->spec_attr->children == NULL) {
-            parent->spec_attr->children = lv_mem_alloc(sizeof(lv_obj_t *));
-            parent->spec_attr->children[0] = obj;
-            parent->spec_attr->child_cnt = 1;
-        }
-        else {
-            parent->spec_attr->child_cnt++;
-            parent->spec_attr->children = lv_mem_realloc(parent->spec_attr->children,
-                                                         sizeof(lv_obj_t *) * parent->spec_attr->child_cnt);
-            parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
-        }
+        _lv_obj_resize_children(parent, parent->spec_attr->child_cnt + 1);
+        parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
+#if LV_USE_INDEV_HIT_INDEX
+        _lv_indev_hit_index_invalidate();
+#endif
     }
 
     return obj;
@@ -55,10 +55,13 @@ typedef struct _lv_obj_class_t {
 #endif
     void (*event_cb)(const struct _lv_obj_class_t * class_p,
                      struct _lv_event_t * e);  /**< Widget type specific event function*/
+    uint64_t event_mask;               /**< Bitmap of the event codes handled by `event_cb` (see `LV_EVENT_MASK()`).
+                                            0: `event_cb` is called with all events*/
     lv_coord_t width_def;
     lv_coord_t height_def;
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
+    uint32_t scroll_copy : 1;          /**< 1: the scrolling can be drawn by moving the pixels (LV_USE_SCROLL_COPY)*/
     uint32_t instance_size : 16;
 } lv_obj_class_t;
 
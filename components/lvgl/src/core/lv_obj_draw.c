@@ -401,6 +401,87 @@ lv_layer_type_t _lv_obj_get_layer_type(const lv_obj_t * obj)
     else return LV_LAYER_TYPE_NONE;
 }
 
+#if LV_USE_LAYER_CACHE
+void lv_obj_set_layer_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(lv_obj_get_layer_cache(obj) == en) return;
+
+    if(en) {
+        lv_obj_allocate_spec_attr(obj);
+        obj->spec_attr->layer_cache = lv_draw_layer_cache_create();
+    }
+    else {
+        lv_draw_layer_cache_delete(obj->spec_attr->layer_cache);
+        obj->spec_attr->layer_cache = NULL;
+    }
+
+    lv_obj_invalidate(obj);
+}
+
+bool lv_obj_get_layer_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return obj->spec_attr && obj->spec_attr->layer_cache;
+}
+
+void _lv_obj_invalidate_layer_cache(const lv_obj_t * obj)
+{
+    /*The parents' layers contain this object too*/
+    const lv_obj_t * parent = obj;
+    while(parent) {
+        if(parent->spec_attr && parent->spec_attr->layer_cache) {
+            lv_draw_layer_cache_t * layer = parent->spec_attr->layer_cache;
+            if(parent != obj || layer->keep == 0) layer->valid = 0;
+        }
+        parent = parent->parent;
+    }
+}
+
+void _lv_obj_keep_layer_cache(lv_obj_t * obj, bool keep)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->layer_cache == NULL) return;
+
+    obj->spec_attr->layer_cache->keep = keep ? 1 : 0;
+}
+#endif
+
+#if LV_USE_DRAW_LIST
+lv_draw_list_t * _lv_obj_get_draw_list(lv_obj_t * obj, bool post)
+{
+    if(obj->draw_list == NULL) {
+        /*One list for the main and one for the post draw events*/
+        obj->draw_list = lv_mem_alloc(2 * sizeof(lv_draw_list_t));
+        LV_ASSERT_MALLOC(obj->draw_list);
+        if(obj->draw_list == NULL) return NULL;
+        lv_draw_list_init(&obj->draw_list[0]);
+        lv_draw_list_init(&obj->draw_list[1]);
+    }
+
+    return &obj->draw_list[post ? 1 : 0];
+}
+
+void _lv_obj_invalidate_draw_list(const lv_obj_t * obj)
+{
+    if(obj->draw_list == NULL) return;
+
+    lv_draw_list_invalidate(&obj->draw_list[0]);
+    lv_draw_list_invalidate(&obj->draw_list[1]);
+}
+
+void _lv_obj_free_draw_list(lv_obj_t * obj)
+{
+    if(obj->draw_list == NULL) return;
+
+    lv_draw_list_clear(&obj->draw_list[0]);
+    lv_draw_list_clear(&obj->draw_list[1]);
+    lv_mem_free(obj->draw_list);
+    obj->draw_list = NULL;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
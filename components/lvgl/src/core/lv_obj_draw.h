@@ -161,6 +161,60 @@ lv_coord_t _lv_obj_get_ext_draw_size(const struct _lv_obj_t * obj);
 
 lv_layer_type_t _lv_obj_get_layer_type(const struct _lv_obj_t * obj);
 
+#if LV_USE_LAYER_CACHE
+/**
+ * Keep the rendered image of an object and its children, and only draw this image
+ * (with the object's opacity and transformations) while neither of them changes.
+ * Useful for complex but static widgets, and for moving, fading or transforming objects.
+ * @param obj       pointer to an object
+ * @param en        true: enable the layer cache; false: disable it and free the image
+ */
+void lv_obj_set_layer_cache(struct _lv_obj_t * obj, bool en);
+
+/**
+ * Tell if the layer cache of an object is enabled
+ * @param obj       pointer to an object
+ * @return          true: the layer cache is enabled
+ */
+bool lv_obj_get_layer_cache(const struct _lv_obj_t * obj);
+
+/**
+ * Mark the cached layers of an object and its parents outdated
+ * @param obj       pointer to an object which has changed
+ */
+void _lv_obj_invalidate_layer_cache(const struct _lv_obj_t * obj);
+
+/**
+ * Don't let the invalidations of an object outdate its own cached layer.
+ * Used when only the position or the layer properties of the object change.
+ * @param obj       pointer to an object
+ * @param keep      true: ignore the invalidations; false: handle them again
+ */
+void _lv_obj_keep_layer_cache(struct _lv_obj_t * obj, bool keep);
+#endif
+
+#if LV_USE_DRAW_LIST
+/**
+ * Get the draw list of an object's main or post draw events. Allocate it if not allocated yet.
+ * @param obj       pointer to an object
+ * @param post      true: get the list of the `LV_EVENT_DRAW_POST...` events
+ * @return          pointer to the draw list or NULL if it couldn't be allocated
+ */
+lv_draw_list_t * _lv_obj_get_draw_list(struct _lv_obj_t * obj, bool post);
+
+/**
+ * Mark the draw lists of an object invalid to send the draw events again on the next redraw
+ * @param obj       pointer to an object
+ */
+void _lv_obj_invalidate_draw_list(const struct _lv_obj_t * obj);
+
+/**
+ * Free the draw lists of an object
+ * @param obj       pointer to an object
+ */
+void _lv_obj_free_draw_list(struct _lv_obj_t * obj);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -9,6 +9,7 @@
 #include "lv_obj.h"
 #include "lv_disp.h"
 #include "lv_refr.h"
+#include "lv_indev.h"
 #include "../misc/lv_gc.h"
 
 /*********************
@@ -26,6 +27,9 @@
 static lv_coord_t calc_content_width(lv_obj_t * obj);
 static lv_coord_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    static const lv_point_t * get_self_size(lv_obj_t * obj);
+#endif
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv);
 
 /**********************
@@ -168,6 +172,10 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     /*Invalidate the original area*/
     lv_obj_invalidate(obj);
 
+#if LV_USE_INDEV_HIT_INDEX
+    _lv_indev_hit_index_invalidate();
+#endif
+
     /*Save the original coordinates*/
     lv_area_t ori;
     lv_obj_get_coords(obj, &ori);
@@ -289,6 +297,14 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
 
+    /*Mark the path to the screen to update only the dirty subtrees.
+     *If an ancestor is already marked its ancestors are marked too.*/
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(parent && parent->child_layout_inv == 0) {
+        parent->child_layout_inv = 1;
+        parent = lv_obj_get_parent(parent);
+    }
+
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
     scr->scr_layout_inv = 1;
@@ -300,7 +316,7 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 
 void lv_obj_update_layout(const lv_obj_t * obj)
 {
-    static bool mutex = false;
+    static LV_REFR_CTX_THREAD_LOCAL bool mutex = false;
     if(mutex) {
         LV_LOG_TRACE("Already running, returning");
         return;
@@ -320,6 +336,27 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     mutex = false;
 }
 
+#if LV_USE_SCR_PRELOAD
+bool _lv_obj_update_layout_step(lv_obj_t * scr)
+{
+    /*If the screen's own layout is dirty, its children might be moved anyway*/
+    if(scr->scr_layout_inv && !scr->layout_inv && scr->child_layout_inv) {
+        uint32_t i;
+        uint32_t child_cnt = lv_obj_get_child_cnt(scr);
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = scr->spec_attr->children[i];
+            if(child->layout_inv || child->child_layout_inv) {
+                layout_update_core(child);
+                return false;
+            }
+        }
+    }
+
+    lv_obj_update_layout(scr);
+    return true;
+}
+#endif
+
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
 {
     layout_cnt++;
@@ -604,20 +641,32 @@ void lv_obj_get_content_coords(const lv_obj_t * obj, lv_area_t * area)
 
 lv_coord_t lv_obj_get_self_width(const lv_obj_t * obj)
 {
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    return get_self_size((lv_obj_t *)obj)->x;
+#else
     lv_point_t p = {0, LV_COORD_MIN};
     lv_event_send((lv_obj_t *)obj, LV_EVENT_GET_SELF_SIZE, &p);
     return p.x;
+#endif
 }
 
 lv_coord_t lv_obj_get_self_height(const lv_obj_t * obj)
 {
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    return get_self_size((lv_obj_t *)obj)->y;
+#else
     lv_point_t p = {LV_COORD_MIN, 0};
     lv_event_send((lv_obj_t *)obj, LV_EVENT_GET_SELF_SIZE, &p);
     return p.y;
+#endif
 }
 
 bool lv_obj_refresh_self_size(lv_obj_t * obj)
 {
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    _lv_obj_invalidate_self_size(obj);
+#endif
+
     lv_coord_t w_set = lv_obj_get_style_width(obj, LV_PART_MAIN);
     lv_coord_t h_set = lv_obj_get_style_height(obj, LV_PART_MAIN);
     if(w_set != LV_SIZE_CONTENT && h_set != LV_SIZE_CONTENT) return false;
@@ -626,6 +675,13 @@ bool lv_obj_refresh_self_size(lv_obj_t * obj)
     return true;
 }
 
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+void _lv_obj_invalidate_self_size(lv_obj_t * obj)
+{
+    obj->self_size_valid = 0;
+}
+#endif
+
 void lv_obj_refr_pos(lv_obj_t * obj)
 {
     if(lv_obj_is_layout_positioned(obj)) return;
@@ -739,6 +795,15 @@ void lv_obj_move_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
      *occur without position change*/
     if(diff.x == 0 && diff.y == 0) return;
 
+#if LV_USE_LAYER_CACHE
+    /*Only the position changes, so the cached layer can be drawn at the new place*/
+    _lv_obj_keep_layer_cache(obj, true);
+#endif
+
+#if LV_USE_INDEV_HIT_INDEX
+    _lv_indev_hit_index_invalidate();
+#endif
+
     /*Invalidate the original area*/
     lv_obj_invalidate(obj);
 
@@ -771,6 +836,10 @@ void lv_obj_move_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     /*Invalidate the new area*/
     lv_obj_invalidate(obj);
 
+#if LV_USE_LAYER_CACHE
+    _lv_obj_keep_layer_cache(obj, false);
+#endif
+
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the srollbars*/
     if(parent) {
@@ -838,6 +907,15 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_USE_DRAW_LIST
+    /*Anything might have changed, so send the draw events again next time*/
+    _lv_obj_invalidate_draw_list(obj);
+#endif
+
+#if LV_USE_LAYER_CACHE
+    _lv_obj_invalidate_layer_cache(obj);
+#endif
+
     lv_disp_t * disp   = lv_obj_get_disp(obj);
     if(!lv_disp_is_invalidation_enabled(disp)) return;
 
@@ -937,6 +1015,9 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, lv_coord_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+#if LV_USE_INDEV_HIT_INDEX
+    _lv_indev_hit_index_invalidate();
+#endif
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -1132,9 +1213,15 @@ static void layout_update_core(lv_obj_t * obj)
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+
+    /*Clear the flag before updating the children: if they mark new objects
+     *in the already updated subtrees the path will be marked again for the next round*/
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->child_layout_inv) layout_update_core(child);
+        }
     }
 
     if(obj->layout_inv == 0) return;
@@ -1153,6 +1240,34 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+/**
+ * Get the self size of an object. Measure it again only if its content size
+ * or the layout's control over its size has changed since the last time.
+ * @param obj       pointer to an object
+ * @return          pointer to the cached self size
+ */
+static const lv_point_t * get_self_size(lv_obj_t * obj)
+{
+    lv_coord_t w = lv_obj_get_content_width(obj);
+    lv_coord_t h = lv_obj_get_content_height(obj);
+    if(obj->self_size_valid && obj->self_size_ref.x == w && obj->self_size_ref.y == h &&
+       obj->self_size_w_layout == obj->w_layout && obj->self_size_h_layout == obj->h_layout) {
+        return &obj->self_size;
+    }
+
+    lv_point_t p = {0, 0};
+    lv_event_send(obj, LV_EVENT_GET_SELF_SIZE, &p);
+    obj->self_size = p;
+    obj->self_size_ref.x = w;
+    obj->self_size_ref.y = h;
+    obj->self_size_w_layout = obj->w_layout;
+    obj->self_size_h_layout = obj->h_layout;
+    obj->self_size_valid = 1;
+    return &obj->self_size;
+}
+#endif
+
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv)
 {
     int16_t angle = lv_obj_get_style_transform_angle(obj, 0);
@@ -152,6 +152,16 @@ void lv_obj_mark_layout_as_dirty(struct _lv_obj_t * obj);
  */
 void lv_obj_update_layout(const struct _lv_obj_t * obj);
 
+#if LV_USE_SCR_PRELOAD
+/**
+ * Update the layout of a screen in smaller steps. Each call updates only one dirty child subtree of the screen
+ * if the screen itself doesn't need to be updated.
+ * @param scr       pointer to a screen
+ * @return          true: the layout is up to date; false: call it again
+ */
+bool _lv_obj_update_layout_step(struct _lv_obj_t * scr);
+#endif
+
 /**
  * Register a new layout
  * @param cb        the layout update callback
@@ -341,6 +351,14 @@ lv_coord_t lv_obj_get_self_height(const struct _lv_obj_t * obj);
  */
 bool lv_obj_refresh_self_size(struct _lv_obj_t * obj);
 
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+/**
+ * Measure the self size of an object again when it's needed next time
+ * @param obj       pointer to an object
+ */
+void _lv_obj_invalidate_self_size(struct _lv_obj_t * obj);
+#endif
+
 void lv_obj_refr_pos(struct _lv_obj_t * obj);
 
 void lv_obj_move_to(struct _lv_obj_t * obj, lv_coord_t x, lv_coord_t y);
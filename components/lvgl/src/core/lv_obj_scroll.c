@@ -11,6 +11,7 @@
 #include "lv_indev.h"
 #include "lv_disp.h"
 #include "lv_indev_scroll.h"
+#include "lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -415,12 +416,27 @@ lv_res_t _lv_obj_scroll_by_raw(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 
     lv_obj_allocate_spec_attr(obj);
 
+#if LV_USE_SCROLL_COPY
+    /*Try to move the rendered pixels instead of redrawing the whole object*/
+    bool copy = _lv_refr_scroll_copy_is_possible(obj);
+    lv_area_t sb_old[2];
+    if(copy) lv_obj_get_scrollbar_area(obj, &sb_old[0], &sb_old[1]);
+#endif
+
     obj->spec_attr->scroll.x += x;
     obj->spec_attr->scroll.y += y;
 
     lv_obj_move_children_by(obj, x, y, true);
+
+#if LV_USE_SCROLL_COPY
+    if(copy) copy = _lv_refr_scroll_copy(obj, x, y, sb_old);
+#endif
+
     lv_res_t res = lv_event_send(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RES_OK) return res;
+#if LV_USE_SCROLL_COPY
+    if(copy) return LV_RES_OK;
+#endif
     lv_obj_invalidate(obj);
     return LV_RES_OK;
 }
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj.h"
 #include "lv_disp.h"
+#include "lv_indev.h"
 #include "../misc/lv_gc.h"
 
 /*********************
@@ -27,6 +28,14 @@ typedef struct {
     lv_style_value_t end_value;
 } trans_t;
 
+typedef struct {
+    lv_obj_t * obj;             /*NULL if the object was deleted in the meantime*/
+    lv_part_t part;             /*The changed part or `LV_PART_ANY` if more parts have changed*/
+    lv_style_prop_t prop;       /*The changed property, `LV_STYLE_PROP_INV` if more properties have changed*/
+    uint8_t flags;              /*OR-ed `LV_STYLE_PROP_...` flags of the changed properties*/
+    uint8_t keep_layer_cache : 1;
+} style_batch_t;
+
 typedef enum {
     CACHE_ZERO = 0,
     CACHE_TRUE = 1,
@@ -44,8 +53,13 @@ typedef enum {
  **********************/
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
+static lv_style_value_t resolve_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
+static void refresh_style_core(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, uint8_t flags,
+                               bool keep_layer_cache);
+static void style_batch_add(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, uint8_t flags,
+                            bool keep_layer_cache);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
@@ -54,11 +68,60 @@ static void trans_anim_ready_cb(lv_anim_t * a);
 static lv_layer_type_t calculate_layer_type(lv_obj_t * obj);
 static void fade_anim_cb(void * obj, int32_t v);
 static void fade_in_anim_ready(lv_anim_t * a);
+#if LV_USE_OBJ_STYLE_CACHE
+    static _lv_obj_style_cache_t * get_cache(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+static uint32_t style_batch_depth;
+static bool style_batch_committing;
+static style_batch_t * style_batch;
+static uint32_t style_batch_cnt;
+static uint32_t style_batch_size;
+#if LV_USE_OBJ_STYLE_CACHE
+    static bool style_cache_en = true;
+    static lv_obj_style_cache_stats_t style_cache_stats;
+
+    /*Index + 1 of the cached properties in `_lv_obj_style_cache_t.values`. 0: not cached.
+     *These are read the most while drawing and refreshing the widgets*/
+    static const uint8_t cache_slot[_LV_STYLE_NUM_BUILT_IN_PROPS] = {
+        [LV_STYLE_WIDTH] = 1,
+        [LV_STYLE_RADIUS] = 2,
+        [LV_STYLE_PAD_TOP] = 3,
+        [LV_STYLE_PAD_BOTTOM] = 4,
+        [LV_STYLE_PAD_LEFT] = 5,
+        [LV_STYLE_PAD_RIGHT] = 6,
+        [LV_STYLE_BASE_DIR] = 7,
+        [LV_STYLE_CLIP_CORNER] = 8,
+        [LV_STYLE_BG_COLOR] = 9,
+        [LV_STYLE_BG_OPA] = 10,
+        [LV_STYLE_BG_GRAD_DIR] = 11,
+        [LV_STYLE_BG_GRAD] = 12,
+        [LV_STYLE_BG_DITHER_MODE] = 13,
+        [LV_STYLE_BG_IMG_SRC] = 14,
+        [LV_STYLE_BORDER_COLOR] = 15,
+        [LV_STYLE_BORDER_OPA] = 16,
+        [LV_STYLE_BORDER_WIDTH] = 17,
+        [LV_STYLE_BORDER_SIDE] = 18,
+        [LV_STYLE_BORDER_POST] = 19,
+        [LV_STYLE_OUTLINE_WIDTH] = 20,
+        [LV_STYLE_SHADOW_WIDTH] = 21,
+        [LV_STYLE_TEXT_COLOR] = 22,
+        [LV_STYLE_TEXT_OPA] = 23,
+        [LV_STYLE_TEXT_FONT] = 24,
+        [LV_STYLE_TEXT_LETTER_SPACE] = 25,
+        [LV_STYLE_TEXT_LINE_SPACE] = 26,
+        [LV_STYLE_TEXT_DECOR] = 27,
+        [LV_STYLE_TEXT_ALIGN] = 28,
+        [LV_STYLE_OPA] = 29,
+        [LV_STYLE_COLOR_FILTER_DSC] = 30,
+        [LV_STYLE_TRANSFORM_WIDTH] = 31,
+        [LV_STYLE_TRANSFORM_HEIGHT] = 32,
+    };
+#endif
 
 /**********************
  *      MACROS
@@ -89,7 +152,7 @@ void lv_obj_add_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t se
 
     /*Allocate space for the new style and shift the rest of the style to the end*/
     obj->style_cnt++;
-    obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
+    obj->styles = _lv_obj_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
 
     uint32_t j;
     for(j = obj->style_cnt - 1; j > i ; j--) {
@@ -128,7 +191,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
             lv_style_reset(obj->styles[i].style);
-            lv_mem_free(obj->styles[i].style);
+            _lv_obj_mem_free(obj->styles[i].style);
             obj->styles[i].style = NULL;
         }
 
@@ -139,7 +202,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
         }
 
         obj->style_cnt--;
-        obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
+        obj->styles = _lv_obj_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
 
         deleted = true;
         /*The style from the current `i` index is removed, so `i` points to the next style.
@@ -168,103 +231,136 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    if(!style_refr) return;
+#if LV_USE_OBJ_STYLE_CACHE
+    /*Styles might be added or removed even if the refreshing is disabled*/
+    _lv_style_cache_invalidate();
+#endif
 
-    lv_obj_invalidate(obj);
+    if(!style_refr) return;
 
     lv_part_t part = lv_obj_style_get_selector_part(selector);
+    uint8_t flags = _lv_style_prop_lookup_flags(prop);
+
+    bool keep_layer_cache = false;
+#if LV_USE_LAYER_CACHE
+    /*The position, opacity, blend mode and transformation of the main part
+     *are applied when the cached layer is drawn*/
+    keep_layer_cache = part == LV_PART_MAIN && prop != LV_STYLE_PROP_ANY &&
+                       ((flags & LV_STYLE_PROP_LAYER_REFR) || prop == LV_STYLE_X || prop == LV_STYLE_Y ||
+                        prop == LV_STYLE_ALIGN || prop == LV_STYLE_TRANSLATE_X || prop == LV_STYLE_TRANSLATE_Y ||
+                        prop == LV_STYLE_TRANSFORM_PIVOT_X || prop == LV_STYLE_TRANSFORM_PIVOT_Y);
+#endif
 
-    bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYOUT_REFR);
-    bool is_ext_draw = lv_style_prop_has_flag(prop, LV_STYLE_PROP_EXT_DRAW);
-    bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
-    bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYER_REFR);
+    if(style_batch_depth > 0) style_batch_add(obj, part, prop, flags, keep_layer_cache);
+    else refresh_style_core(obj, part, prop, flags, keep_layer_cache);
+}
 
-    if(is_layout_refr) {
-        if(part == LV_PART_ANY ||
-           part == LV_PART_MAIN ||
-           lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
-           lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
-            lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
-            lv_obj_mark_layout_as_dirty(obj);
-        }
-    }
-    if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
-        lv_obj_t * parent = lv_obj_get_parent(obj);
-        if(parent) lv_obj_mark_layout_as_dirty(parent);
-    }
+void lv_obj_enable_style_refresh(bool en)
+{
+    style_refr = en;
+}
 
-    /*Cache the layer type*/
-    if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layer_refr) {
-        lv_layer_type_t layer_type = calculate_layer_type(obj);
-        if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
-        else if(layer_type != LV_LAYER_TYPE_NONE) {
-            lv_obj_allocate_spec_attr(obj);
-            obj->spec_attr->layer_type = layer_type;
-        }
+void lv_obj_begin_style_batch(void)
+{
+    style_batch_depth++;
+}
+
+void lv_obj_commit_style_batch(void)
+{
+    if(style_batch_depth == 0) {
+        LV_LOG_WARN("no style batch to commit");
+        return;
     }
 
-    if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
-        lv_obj_refresh_ext_draw_size(obj);
+    style_batch_depth--;
+    /*If a batch is committed while refreshing, its objects are added to the array being processed*/
+    if(style_batch_depth > 0 || style_batch_committing) return;
+
+    style_batch_committing = true;
+
+    /*Refreshing can send events which might delete objects or change styles again
+     *so always read the current state of the array*/
+    uint32_t i;
+    for(i = 0; i < style_batch_cnt; i++) {
+        style_batch_t * b = &style_batch[i];
+        if(b->obj == NULL) continue;
+
+        lv_obj_t * obj = b->obj;
+        obj->style_batch = 0;
+        b->obj = NULL;
+        refresh_style_core(obj, b->part, b->prop, b->flags, b->keep_layer_cache);
     }
-    lv_obj_invalidate(obj);
 
-    if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
-        if(part != LV_PART_SCROLLBAR) {
-            refresh_children_style(obj);
+    lv_mem_free(style_batch);
+    style_batch = NULL;
+    style_batch_cnt = 0;
+    style_batch_size = 0;
+    style_batch_committing = false;
+}
+
+void _lv_obj_style_batch_remove(lv_obj_t * obj)
+{
+    if(obj->style_batch == 0) return;
+
+    uint32_t i;
+    for(i = 0; i < style_batch_cnt; i++) {
+        if(style_batch[i].obj == obj) {
+            style_batch[i].obj = NULL;
+            break;
         }
     }
+    obj->style_batch = 0;
 }
 
-void lv_obj_enable_style_refresh(bool en)
+#if LV_USE_OBJ_STYLE_CACHE
+void lv_obj_enable_style_cache(bool en)
 {
-    style_refr = en;
+    style_cache_en = en;
 }
 
-lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+const lv_obj_style_cache_stats_t * lv_obj_get_style_cache_stats(void)
 {
-    lv_style_value_t value_act;
-    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
-    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
-    while(obj) {
-        found = get_prop_core(obj, part, prop, &value_act);
-        if(found == LV_STYLE_RES_FOUND) break;
-        if(!inheritable) break;
+    return &style_cache_stats;
+}
 
-        /*If not found, check the `MAIN` style first*/
-        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
-            part = LV_PART_MAIN;
-            continue;
-        }
+void lv_obj_reset_style_cache_stats(void)
+{
+    lv_memset_00(&style_cache_stats, sizeof(style_cache_stats));
+}
 
-        /*Check the parent too.*/
-        obj = lv_obj_get_parent(obj);
-    }
+void _lv_obj_free_style_cache(lv_obj_t * obj)
+{
+    if(obj->style_cache == NULL) return;
 
-    if(found != LV_STYLE_RES_FOUND) {
-        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
-            const lv_obj_class_t * cls = obj->class_p;
-            while(cls) {
-                if(prop == LV_STYLE_WIDTH) {
-                    if(cls->width_def != 0) break;
-                }
-                else {
-                    if(cls->height_def != 0) break;
-                }
-                cls = cls->base_class;
-            }
+    _lv_obj_mem_free(obj->style_cache);
+    obj->style_cache = NULL;
+}
+#endif
 
-            if(cls) {
-                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
+lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+#if LV_USE_OBJ_STYLE_CACHE
+    /*Only the final values are cached, not the ones without the transitions*/
+    if(style_cache_en && part == LV_PART_MAIN && prop < _LV_STYLE_NUM_BUILT_IN_PROPS && cache_slot[prop] &&
+       !obj->skip_trans) {
+        /*Caching is only an optimization so the object can be modified*/
+        _lv_obj_style_cache_t * cache = get_cache((lv_obj_t *)obj);
+        if(cache) {
+            uint32_t idx = cache_slot[prop] - 1;
+            if(cache->valid & (1UL << idx)) {
+                style_cache_stats.hit_cnt++;
             }
             else {
-                value_act.num = 0;
+                cache->values[idx] = resolve_prop(obj, part, prop);
+                cache->valid |= 1UL << idx;
+                style_cache_stats.miss_cnt++;
             }
-        }
-        else {
-            value_act = lv_style_prop_get_default(prop);
+            return cache->values[idx];
         }
     }
-    return value_act;
+#endif
+
+    return resolve_prop(obj, part, prop);
 }
 
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value,
@@ -500,6 +596,60 @@ lv_text_align_t lv_obj_calculate_style_text_align(const struct _lv_obj_t * obj,
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Resolve the value of a style property from the styles of the object and its parents
+ * @param obj       pointer to an object
+ * @param part      a part from which the property should be get
+ * @param prop      the property to get
+ * @return          the value of the property
+ */
+static lv_style_value_t resolve_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_value_t value_act;
+    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
+    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
+    while(obj) {
+        found = get_prop_core(obj, part, prop, &value_act);
+        if(found == LV_STYLE_RES_FOUND) break;
+        if(!inheritable) break;
+
+        /*If not found, check the `MAIN` style first*/
+        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
+            part = LV_PART_MAIN;
+            continue;
+        }
+
+        /*Check the parent too.*/
+        obj = lv_obj_get_parent(obj);
+    }
+
+    if(found != LV_STYLE_RES_FOUND) {
+        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
+            const lv_obj_class_t * cls = obj->class_p;
+            while(cls) {
+                if(prop == LV_STYLE_WIDTH) {
+                    if(cls->width_def != 0) break;
+                }
+                else {
+                    if(cls->height_def != 0) break;
+                }
+                cls = cls->base_class;
+            }
+
+            if(cls) {
+                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
+            }
+            else {
+                value_act.num = 0;
+            }
+        }
+        else {
+            value_act = lv_style_prop_get_default(prop);
+        }
+    }
+    return value_act;
+}
+
 /**
  * Get the local style of an object for a given part and for a given state.
  * If the local style for the part-state pair doesn't exist allocate and return it.
@@ -518,7 +668,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
     }
 
     obj->style_cnt++;
-    obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
+    obj->styles = _lv_obj_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
     LV_ASSERT_MALLOC(obj->styles);
 
     for(i = obj->style_cnt - 1; i > 0 ; i--) {
@@ -529,7 +679,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
     }
 
     lv_memset_00(&obj->styles[i], sizeof(_lv_obj_style_t));
-    obj->styles[i].style = lv_mem_alloc(sizeof(lv_style_t));
+    obj->styles[i].style = _lv_obj_mem_alloc(sizeof(lv_style_t));
     lv_style_init(obj->styles[i].style);
     obj->styles[i].is_local = 1;
     obj->styles[i].selector = selector;
@@ -554,14 +704,14 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
     if(i != obj->style_cnt) return &obj->styles[i];
 
     obj->style_cnt++;
-    obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
+    obj->styles = _lv_obj_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
 
     for(i = obj->style_cnt - 1; i > 0 ; i--) {
         obj->styles[i] = obj->styles[i - 1];
     }
 
     lv_memset_00(&obj->styles[0], sizeof(_lv_obj_style_t));
-    obj->styles[0].style = lv_mem_alloc(sizeof(lv_style_t));
+    obj->styles[0].style = _lv_obj_mem_alloc(sizeof(lv_style_t));
     lv_style_init(obj->styles[0].style);
     obj->styles[0].is_trans = 1;
     obj->styles[0].selector = selector;
@@ -657,6 +807,129 @@ static void report_style_change_core(void * style, lv_obj_t * obj)
     }
 }
 
+/**
+ * Refresh an object after some of its style properties have changed
+ * @param obj               pointer to an object
+ * @param part              the changed part or `LV_PART_ANY`
+ * @param prop              the changed property, `LV_STYLE_PROP_ANY` or `LV_STYLE_PROP_INV` if only `flags` are known
+ * @param flags             OR-ed `LV_STYLE_PROP_...` flags of the changed properties
+ * @param keep_layer_cache  true: the changes are applied when the cached layer is drawn
+ */
+static void refresh_style_core(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, uint8_t flags,
+                               bool keep_layer_cache)
+{
+    bool is_layout_refr = flags & LV_STYLE_PROP_LAYOUT_REFR;
+    bool is_ext_draw = flags & LV_STYLE_PROP_EXT_DRAW;
+    bool is_inheritable = flags & LV_STYLE_PROP_INHERIT;
+    bool is_layer_refr = flags & LV_STYLE_PROP_LAYER_REFR;
+
+#if LV_USE_LAYER_CACHE
+    if(keep_layer_cache) _lv_obj_keep_layer_cache(obj, true);
+#else
+    LV_UNUSED(keep_layer_cache);
+#endif
+
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    /*Fonts, spacing, zoom etc. can change the measured content*/
+    _lv_obj_invalidate_self_size(obj);
+#endif
+
+    lv_obj_invalidate(obj);
+
+    if(is_layout_refr) {
+        if(part == LV_PART_ANY ||
+           part == LV_PART_MAIN ||
+           lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
+           lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
+            lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
+            lv_obj_mark_layout_as_dirty(obj);
+        }
+    }
+    if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
+        lv_obj_t * parent = lv_obj_get_parent(obj);
+        if(parent) lv_obj_mark_layout_as_dirty(parent);
+    }
+
+    /*Cache the layer type*/
+    if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layer_refr) {
+        lv_layer_type_t layer_type = calculate_layer_type(obj);
+#if LV_USE_INDEV_HIT_INDEX
+        /*Transformed objects are not indexed by their position*/
+        if(layer_type != _lv_obj_get_layer_type(obj)) _lv_indev_hit_index_invalidate();
+#endif
+        if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
+        else if(layer_type != LV_LAYER_TYPE_NONE) {
+            lv_obj_allocate_spec_attr(obj);
+            obj->spec_attr->layer_type = layer_type;
+        }
+    }
+
+    if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
+        lv_obj_refresh_ext_draw_size(obj);
+    }
+    lv_obj_invalidate(obj);
+
+    if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
+        if(part != LV_PART_SCROLLBAR) {
+            refresh_children_style(obj);
+        }
+    }
+
+#if LV_USE_LAYER_CACHE
+    if(keep_layer_cache) _lv_obj_keep_layer_cache(obj, false);
+#endif
+}
+
+/**
+ * Save a style change to refresh the object when the batch is committed.
+ * The changes of the same object are merged.
+ */
+static void style_batch_add(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, uint8_t flags,
+                            bool keep_layer_cache)
+{
+    /*The children need to be refreshed only if an inherited property affects the size or layout.
+     *Drop the inherit flag otherwise to not combine it with another property's flags.*/
+    if((flags & (LV_STYLE_PROP_EXT_DRAW | LV_STYLE_PROP_LAYOUT_REFR)) == 0) flags &= ~LV_STYLE_PROP_INHERIT;
+
+    if(obj->style_batch) {
+        /*Usually the last changed object is changed again so search backwards*/
+        uint32_t i;
+        for(i = style_batch_cnt; i > 0; i--) {
+            style_batch_t * b = &style_batch[i - 1];
+            if(b->obj != obj) continue;
+
+            if(b->part != part) b->part = LV_PART_ANY;
+            if(b->prop != prop) {
+                b->prop = (b->prop == LV_STYLE_PROP_ANY || prop == LV_STYLE_PROP_ANY) ? LV_STYLE_PROP_ANY : LV_STYLE_PROP_INV;
+            }
+            b->flags |= flags;
+            b->keep_layer_cache = b->keep_layer_cache && keep_layer_cache;
+            return;
+        }
+    }
+
+    if(style_batch_cnt == style_batch_size) {
+        uint32_t new_size = style_batch_size ? style_batch_size * 2 : 16;
+        style_batch_t * new_batch = lv_mem_realloc(style_batch, new_size * sizeof(style_batch_t));
+        if(new_batch == NULL) {
+            LV_LOG_WARN("out of memory, refreshing immediately");
+            refresh_style_core(obj, part, prop, flags, keep_layer_cache);
+            return;
+        }
+        style_batch = new_batch;
+        style_batch_size = new_size;
+    }
+
+    style_batch_t * b = &style_batch[style_batch_cnt];
+    b->obj = obj;
+    b->part = part;
+    b->prop = prop;
+    b->flags = flags;
+    b->keep_layer_cache = keep_layer_cache;
+    style_batch_cnt++;
+    obj->style_batch = 1;
+}
+
 /**
  * Recursively refresh the style of the children. Go deeper until a not NULL style is found
  * because the NULL styles are inherited from the parent
@@ -668,6 +941,9 @@ static void refresh_children_style(lv_obj_t * obj)
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+        _lv_obj_invalidate_self_size(child);
+#endif
         lv_obj_invalidate(child);
         lv_event_send(child, LV_EVENT_STYLE_CHANGED, NULL);
         lv_obj_invalidate(child);
@@ -864,3 +1140,31 @@ static void fade_in_anim_ready(lv_anim_t * a)
 }
 
 
+
+#if LV_USE_OBJ_STYLE_CACHE
+/**
+ * Get the style cache of an object. Allocate it or clear it if it's outdated.
+ * @param obj       pointer to an object
+ * @return          pointer to the cache or NULL if it couldn't be allocated
+ */
+static _lv_obj_style_cache_t * get_cache(lv_obj_t * obj)
+{
+    uint32_t gen = _lv_style_cache_get_gen();
+    _lv_obj_style_cache_t * cache = obj->style_cache;
+    if(cache == NULL) {
+        cache = _lv_obj_mem_alloc(sizeof(_lv_obj_style_cache_t));
+        if(cache == NULL) return NULL;
+        obj->style_cache = cache;
+        cache->valid = 0;
+        cache->gen = gen;
+        cache->state = obj->state;
+    }
+    else if(cache->gen != gen || cache->state != obj->state) {
+        cache->valid = 0;
+        cache->gen = gen;
+        cache->state = obj->state;
+    }
+
+    return cache;
+}
+#endif
@@ -54,6 +54,26 @@ typedef struct {
 #endif
 } _lv_obj_style_transition_dsc_t;
 
+#if LV_USE_OBJ_STYLE_CACHE
+/*Number of the frequently used properties cached per object*/
+#define _LV_OBJ_STYLE_CACHE_PROP_CNT 32
+
+/**
+ * The resolved values of the frequently used properties of an object's main part in a given state
+ */
+typedef struct {
+    uint32_t gen;               /*The values are valid only while `_lv_style_cache_get_gen()` returns this*/
+    uint32_t valid;             /*One bit for each value which is already resolved*/
+    lv_state_t state;           /*The state of the object when the values were resolved*/
+    lv_style_value_t values[_LV_OBJ_STYLE_CACHE_PROP_CNT];
+} _lv_obj_style_cache_t;
+
+typedef struct {
+    uint32_t hit_cnt;           /*Number of properties read from the cache*/
+    uint32_t miss_cnt;          /*Number of properties resolved from the styles*/
+} lv_obj_style_cache_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -118,6 +138,51 @@ void lv_obj_refresh_style(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_
  */
 void lv_obj_enable_style_refresh(bool en);
 
+/**
+ * Start collecting the style changes instead of refreshing the objects after each of them.
+ * Every object is refreshed only once in `lv_obj_commit_style_batch()`, considering all of its changed properties.
+ * Until then the layout, extra draw size and layer type of the changed objects are not updated.
+ * Batches can be nested: only the outermost commit refreshes the objects.
+ */
+void lv_obj_begin_style_batch(void);
+
+/**
+ * Close a batch opened by `lv_obj_begin_style_batch()` and refresh the objects whose style has changed
+ */
+void lv_obj_commit_style_batch(void);
+
+/**
+ * Drop an object from the pending style batch. Called when the object is deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_batch_remove(struct _lv_obj_t * obj);
+
+#if LV_USE_OBJ_STYLE_CACHE
+/**
+ * Enable or disable caching the resolved style properties of the objects.
+ * Useful to compare the performance with and without the cache.
+ * @param en        true: use the cache (default); false: always search the styles
+ */
+void lv_obj_enable_style_cache(bool en);
+
+/**
+ * Get the statistics of the style cache
+ * @return          pointer to the statistics
+ */
+const lv_obj_style_cache_stats_t * lv_obj_get_style_cache_stats(void);
+
+/**
+ * Reset the statistics of the style cache
+ */
+void lv_obj_reset_style_cache_stats(void);
+
+/**
+ * Free the style cache of an object
+ * @param obj       pointer to an object
+ */
+void _lv_obj_free_style_cache(struct _lv_obj_t * obj);
+#endif
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
@@ -10,6 +10,7 @@
 
 #include "lv_obj.h"
 #include "lv_indev.h"
+#include "lv_disp.h"
 #include "../misc/lv_anim.h"
 #include "../misc/lv_gc.h"
 #include "../misc/lv_async.h"
@@ -28,11 +29,31 @@
  **********************/
 static void lv_obj_del_async_cb(void * obj);
 static void obj_del_core(lv_obj_t * obj);
+static void del_children(lv_obj_t * obj);
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data);
+static uint32_t get_children_cap(uint32_t child_cnt);
+#if LV_USE_OBJ_BULK_DEL
+    static bool bulk_del_begin(void);
+    static void bulk_del_end(void);
+    static bool bulk_del_add(lv_obj_t * obj);
+    static void sort_ptrs(lv_obj_t ** objs, uint32_t cnt);
+#endif
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    static lv_obj_tree_walk_res_t invalidate_self_size_cb(lv_obj_t * obj, void * user_data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_USE_OBJ_BULK_DEL
+static struct {
+    lv_obj_t ** objs;   /*The objects to free at the end of the bulk deletion*/
+    uint32_t cnt;
+    uint32_t size;
+    uint32_t depth;     /*Nesting of the deletions, e.g. from `LV_EVENT_DELETE`*/
+} bulk_del;
+static bool bulk_del_en = true;
+#endif
 
 /**********************
  *      MACROS
@@ -46,21 +67,31 @@ void lv_obj_del(lv_obj_t * obj)
 {
     LV_LOG_TRACE("begin (delete %p)", (void *)obj);
     LV_ASSERT_OBJ(obj, MY_CLASS);
-    lv_obj_invalidate(obj);
 
     lv_obj_t * par = lv_obj_get_parent(obj);
+#if LV_USE_OBJ_BULK_DEL
+    /*The parent is being deleted too (e.g. the object is deleted in the parent's `LV_EVENT_DELETE`).
+     *It's invalidated already and its layout and scroll don't matter anymore.*/
+    if(par && par->del_pending) par = NULL;
+    else lv_obj_invalidate(obj);
+#else
+    lv_obj_invalidate(obj);
+#endif
     if(par) {
         lv_obj_scrollbar_invalidate(par);
     }
 
     lv_disp_t * disp = NULL;
     bool act_scr_del = false;
-    if(par == NULL) {
+    if(lv_obj_get_parent(obj) == NULL) {
         disp = lv_obj_get_disp(obj);
         if(!disp) return;   /*Shouldn't happen*/
         if(disp->act_scr == obj) act_scr_del = true;
     }
 
+#if LV_USE_OBJ_BULK_DEL
+    bool bulk = bulk_del_begin();
+#endif
     obj_del_core(obj);
 
     /*Call the ancestor's event handler to the parent to notify it about the child delete*/
@@ -78,6 +109,10 @@ void lv_obj_del(lv_obj_t * obj)
         disp->act_scr = NULL;
     }
 
+#if LV_USE_OBJ_BULK_DEL
+    if(bulk) bulk_del_end();
+#endif
+
     LV_ASSERT_MEM_INTEGRITY();
     LV_LOG_TRACE("finished (delete %p)", (void *)obj);
 }
@@ -89,11 +124,13 @@ void lv_obj_clean(lv_obj_t * obj)
 
     lv_obj_invalidate(obj);
 
-    lv_obj_t * child = lv_obj_get_child(obj, 0);
-    while(child) {
-        obj_del_core(child);
-        child = lv_obj_get_child(obj, 0);
-    }
+#if LV_USE_OBJ_BULK_DEL
+    bool bulk = bulk_del_begin();
+#endif
+    del_children(obj);
+#if LV_USE_OBJ_BULK_DEL
+    if(bulk) bulk_del_end();
+#endif
     /*Just to remove scroll animations if any*/
     lv_obj_scroll_to(obj, 0, 0, LV_ANIM_OFF);
     if(obj->spec_attr) {
@@ -129,6 +166,13 @@ void lv_obj_del_async(lv_obj_t * obj)
     lv_async_call(lv_obj_del_async_cb, obj);
 }
 
+#if LV_USE_OBJ_BULK_DEL
+void lv_obj_enable_bulk_del(bool en)
+{
+    bulk_del_en = en;
+}
+#endif
+
 void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -154,24 +198,28 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     for(i = lv_obj_get_index(obj); i <= (int32_t)lv_obj_get_child_cnt(old_parent) - 2; i++) {
         old_parent->spec_attr->children[i] = old_parent->spec_attr->children[i + 1];
     }
-    old_parent->spec_attr->child_cnt--;
-    if(old_parent->spec_attr->child_cnt) {
-        old_parent->spec_attr->children = lv_mem_realloc(old_parent->spec_attr->children,
-                                                         old_parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
-    }
-    else {
-        lv_mem_free(old_parent->spec_attr->children);
-        old_parent->spec_attr->children = NULL;
-    }
+    _lv_obj_resize_children(old_parent, old_parent->spec_attr->child_cnt - 1);
 
     /*Add the child to the new parent as the last (newest child)*/
-    parent->spec_attr->child_cnt++;
-    parent->spec_attr->children = lv_mem_realloc(parent->spec_attr->children,
-                                                 parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
+    _lv_obj_resize_children(parent, parent->spec_attr->child_cnt + 1);
     parent->spec_attr->children[lv_obj_get_child_cnt(parent) - 1] = obj;
 
     obj->parent = parent;
 
+#if LV_USE_INDEV_HIT_INDEX
+    _lv_indev_hit_index_invalidate();
+#endif
+
+#if LV_USE_OBJ_STYLE_CACHE
+    /*The inherited properties come from the new parent*/
+    _lv_style_cache_invalidate();
+#endif
+
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    /*The inherited fonts, spacing, etc might be different*/
+    lv_obj_tree_walk(obj, invalidate_self_size_cb, NULL);
+#endif
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_readjust_scroll(old_parent, LV_ANIM_OFF);
     lv_obj_scrollbar_invalidate(old_parent);
@@ -218,6 +266,9 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+#if LV_USE_INDEV_HIT_INDEX
+    _lv_indev_hit_index_invalidate();
+#endif
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -238,6 +289,9 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
 
     parent->spec_attr->children[index1] = obj2;
     parent2->spec_attr->children[index2] = obj1;
+#if LV_USE_INDEV_HIT_INDEX
+    _lv_indev_hit_index_invalidate();
+#endif
 
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_event_send(parent, LV_EVENT_CHILD_CREATED, obj2);
@@ -343,10 +397,41 @@ void lv_obj_tree_walk(lv_obj_t * start_obj, lv_obj_tree_walk_cb_t cb, void * use
     walk_core(start_obj, cb, user_data);
 }
 
+void _lv_obj_resize_children(lv_obj_t * obj, uint32_t child_cnt)
+{
+    uint32_t cap_old = get_children_cap(obj->spec_attr->child_cnt);
+    uint32_t cap_new = get_children_cap(child_cnt);
+    obj->spec_attr->child_cnt = child_cnt;
+    if(cap_old == cap_new) return;
+
+    if(cap_new == 0) {
+        _lv_obj_mem_free(obj->spec_attr->children);
+        obj->spec_attr->children = NULL;
+    }
+    else {
+        obj->spec_attr->children = _lv_obj_mem_realloc(obj->spec_attr->children, cap_new * sizeof(lv_obj_t *));
+        LV_ASSERT_MALLOC(obj->spec_attr->children);
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the allocated size of the children array for a given number of children
+ * @param child_cnt     number of children
+ * @return              0 or the next power of 2
+ */
+static uint32_t get_children_cap(uint32_t child_cnt)
+{
+    if(child_cnt == 0) return 0;
+
+    uint32_t cap = 1;
+    while(cap < child_cnt) cap <<= 1;
+    return cap;
+}
+
 static void lv_obj_del_async_cb(void * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -360,12 +445,13 @@ static void obj_del_core(lv_obj_t * obj)
     lv_res_t res = lv_event_send(obj, LV_EVENT_DELETE, NULL);
     if(res == LV_RES_INV) return;
 
+#if LV_USE_OBJ_BULK_DEL
+    /*Keep the memory of the object until the end of the bulk deletion to recognize its animations and group*/
+    if(bulk_del.depth && bulk_del_add(obj)) obj->del_pending = 1;
+#endif
+
     /*Recursively delete the children*/
-    lv_obj_t * child = lv_obj_get_child(obj, 0);
-    while(child) {
-        obj_del_core(child);
-        child = lv_obj_get_child(obj, 0);
-    }
+    del_children(obj);
 
     lv_group_t * group = lv_obj_get_group(obj);
 
@@ -390,6 +476,9 @@ static void obj_del_core(lv_obj_t * obj)
 
     /*Remove the screen for the screen list*/
     if(obj->parent == NULL) {
+#if LV_USE_SCR_PRELOAD
+        _lv_disp_scr_preload_deleted(obj);
+#endif
         lv_disp_t * disp = lv_obj_get_disp(obj);
         uint32_t i;
         /*Find the screen in the list*/
@@ -411,15 +500,125 @@ static void obj_del_core(lv_obj_t * obj)
         for(i = id; i < obj->parent->spec_attr->child_cnt - 1; i++) {
             obj->parent->spec_attr->children[i] = obj->parent->spec_attr->children[i + 1];
         }
-        obj->parent->spec_attr->child_cnt--;
-        obj->parent->spec_attr->children = lv_mem_realloc(obj->parent->spec_attr->children,
-                                                          obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
+        _lv_obj_resize_children(obj->parent, obj->parent->spec_attr->child_cnt - 1);
+#if LV_USE_INDEV_HIT_INDEX
+        _lv_indev_hit_index_invalidate();
+#endif
     }
 
+#if LV_USE_OBJ_BULK_DEL
+    if(obj->del_pending) return;    /*Freed in `bulk_del_end()`*/
+#endif
+
     /*Free the object itself*/
-    lv_mem_free(obj);
+    _lv_obj_mem_free(obj);
+}
+
+/**
+ * Delete all the children of an object from the first to the last one
+ */
+static void del_children(lv_obj_t * obj)
+{
+    lv_obj_t * child = lv_obj_get_child(obj, 0);
+    while(child) {
+        obj_del_core(child);
+        child = lv_obj_get_child(obj, 0);
+    }
 }
 
+#if LV_USE_OBJ_BULK_DEL
+static bool bulk_del_begin(void)
+{
+    if(!bulk_del_en) return false;
+    bulk_del.depth++;
+    return true;
+}
+
+/**
+ * Remove the animations and group entries of all the deleted objects and free them
+ * at the end of the outermost `lv_obj_del()` or `lv_obj_clean()`
+ */
+static void bulk_del_end(void)
+{
+    bulk_del.depth--;
+    if(bulk_del.depth > 0 || bulk_del.cnt == 0) return;
+
+    /*Take the list because the callbacks below can delete other objects*/
+    lv_obj_t ** objs = bulk_del.objs;
+    uint32_t cnt = bulk_del.cnt;
+    bulk_del.objs = NULL;
+    bulk_del.cnt = 0;
+    bulk_del.size = 0;
+
+    sort_ptrs(objs, cnt);
+    _lv_anim_del_sorted((void * const *)objs, cnt);
+    _lv_group_remove_deleted_objs();
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        _lv_obj_mem_free(objs[i]);
+    }
+    lv_mem_free(objs);
+}
+
+static bool bulk_del_add(lv_obj_t * obj)
+{
+    if(bulk_del.cnt == bulk_del.size) {
+        uint32_t new_size = bulk_del.size ? bulk_del.size * 2 : 64;
+        lv_obj_t ** new_objs = lv_mem_realloc(bulk_del.objs, new_size * sizeof(lv_obj_t *));
+        /*Not a problem, the object is simply deleted the usual way*/
+        if(new_objs == NULL) return false;
+        bulk_del.objs = new_objs;
+        bulk_del.size = new_size;
+    }
+
+    bulk_del.objs[bulk_del.cnt] = obj;
+    bulk_del.cnt++;
+    return true;
+}
+
+/**
+ * Sort pointers by address with heap sort. It needs no extra memory or recursion.
+ */
+static void sort_ptrs(lv_obj_t ** objs, uint32_t cnt)
+{
+    uint32_t start = cnt / 2;
+    uint32_t end = cnt;
+    while(end > 1) {
+        if(start > 0) {
+            start--;
+        }
+        else {
+            end--;
+            lv_obj_t * tmp = objs[end];
+            objs[end] = objs[0];
+            objs[0] = tmp;
+        }
+
+        /*Sift down the element at `start`*/
+        uint32_t root = start;
+        while(root * 2 + 1 < end) {
+            uint32_t child = root * 2 + 1;
+            if(child + 1 < end && (uintptr_t)objs[child] < (uintptr_t)objs[child + 1]) child++;
+            if((uintptr_t)objs[root] >= (uintptr_t)objs[child]) break;
+            lv_obj_t * tmp = objs[root];
+            objs[root] = objs[child];
+            objs[child] = tmp;
+            root = child;
+        }
+    }
+}
+#endif
+
+
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+static lv_obj_tree_walk_res_t invalidate_self_size_cb(lv_obj_t * obj, void * user_data)
+{
+    LV_UNUSED(user_data);
+    _lv_obj_invalidate_self_size(obj);
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+#endif
 
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data)
 {
@@ -44,6 +44,8 @@ typedef lv_obj_tree_walk_res_t (*lv_obj_tree_walk_cb_t)(struct _lv_obj_t *, void
  * Delete an object and all of its children.
  * Also remove the objects from their group and remove all animations (if any).
  * Send `LV_EVENT_DELETED` to deleted objects.
+ * With `LV_USE_OBJ_BULK_DEL` the animations and group entries are removed together at the end,
+ * so the `deleted_cb` of the animations is called after the objects' destructors.
  * @param obj       pointer to an object
  */
 void lv_obj_del(struct _lv_obj_t * obj);
@@ -52,6 +54,7 @@ void lv_obj_del(struct _lv_obj_t * obj);
  * Delete all children of an object.
  * Also remove the objects from their group and remove all animations (if any).
  * Send `LV_EVENT_DELETED` to deleted objects.
+ * The animations are removed as described at `lv_obj_del()`.
  * @param obj       pointer to an object
  */
 void lv_obj_clean(struct _lv_obj_t * obj);
@@ -77,6 +80,15 @@ void lv_obj_del_anim_ready_cb(lv_anim_t * a);
  */
 void lv_obj_del_async(struct _lv_obj_t * obj);
 
+#if LV_USE_OBJ_BULK_DEL
+/**
+ * Enable or disable the bulk deletion in `lv_obj_del()` and `lv_obj_clean()`. It's enabled by default.
+ * Without it the animations and the group of every deleted object are cleaned up one by one.
+ * @param en        true: delete in bulk; false: delete the objects one by one
+ */
+void lv_obj_enable_bulk_del(bool en);
+#endif
+
 /**
  * Move the parent of an object. The relative coordinates will be kept.
  *
@@ -160,6 +172,15 @@ uint32_t lv_obj_get_index(const struct _lv_obj_t * obj);
  */
 void lv_obj_tree_walk(struct _lv_obj_t * start_obj, lv_obj_tree_walk_cb_t cb, void * user_data);
 
+/**
+ * Set the number of children and resize the children array if required.
+ * The array grows and shrinks in power of 2 steps to not reallocate it for each new child.
+ * Used internally when a child is added or removed.
+ * @param obj           pointer to an object with allocated `spec_attr`
+ * @param child_cnt     the new number of children
+ */
+void _lv_obj_resize_children(struct _lv_obj_t * obj, uint32_t child_cnt);
+
 /**********************
  *      MACROS
  **********************/
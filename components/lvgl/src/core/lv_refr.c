@@ -23,9 +23,22 @@
     #include "../widgets/lv_label.h"
 #endif
 
+#if LV_USE_REFR_CTX
+    #include <pthread.h>
+#endif
+
 /*********************
  *      DEFINES
  *********************/
+#if LV_USE_SCROLL_COPY
+/*With handlers for these events an object might be drawn differently after scrolling*/
+#define SCROLL_COPY_MAIN_EVENTS (LV_EVENT_MASK(LV_EVENT_DRAW_MAIN_BEGIN) | LV_EVENT_MASK(LV_EVENT_DRAW_MAIN) | \
+                                 LV_EVENT_MASK(LV_EVENT_DRAW_MAIN_END) | LV_EVENT_MASK(LV_EVENT_DRAW_PART_BEGIN) | \
+                                 LV_EVENT_MASK(LV_EVENT_DRAW_PART_END))
+/*With handlers for these events the parents might draw on the scrolled object*/
+#define SCROLL_COPY_POST_EVENTS (LV_EVENT_MASK(LV_EVENT_DRAW_POST_BEGIN) | LV_EVENT_MASK(LV_EVENT_DRAW_POST) | \
+                                 LV_EVENT_MASK(LV_EVENT_DRAW_POST_END))
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -58,9 +71,60 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+static void refr_child(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t idx);
+static void send_draw_events(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, const lv_area_t * obj_coords_ext, bool post);
+static void layer_init_draw_dsc(lv_obj_t * obj, lv_opa_t opa, lv_draw_img_dsc_t * draw_dsc, lv_point_t * pivot);
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+static void refr_timer_exec(lv_timer_t * tmr);
+static void refr_disp(lv_disp_t * disp);
+
+#if LV_USE_REFR_REGION
+    static bool region_add(lv_disp_t * disp, const lv_area_t * area_p);
+    static void region_remove(lv_disp_t * disp, uint16_t idx);
+    static int32_t region_join_cost(const lv_area_t * a1_p, const lv_area_t * a2_p);
+#endif
+
+#if LV_USE_REFR_OCCLUSION
+    static bool occlusion_get_clip(lv_obj_t * parent, uint32_t idx, const lv_area_t * clip_area, lv_area_t * res_p);
+#endif
+
+#if LV_USE_REFR_REGION || LV_USE_REFR_OCCLUSION
+    static bool area_cut_covered(lv_area_t * a_p, const lv_area_t * cover_p);
+#endif
+
+#if LV_USE_LAYER_CACHE
+    static bool refr_layer_cache(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+    static bool layer_cache_alloc(lv_obj_t * obj, lv_draw_layer_cache_t * layer, const lv_area_t * obj_coords_ext);
+    static void layer_cache_render_area(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_draw_layer_cache_t * layer,
+                                        const lv_area_t * clip_area);
+    static bool layer_cache_render(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_draw_layer_cache_t * layer,
+                                   const lv_area_t * obj_coords_ext);
+#endif
+
+#if LV_USE_SCROLL_COPY
+    static bool scroll_copy_get_area(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_area_t * vis_p, lv_area_t * move_p);
+    static bool scroll_copy_is_covered(lv_obj_t * obj, const lv_area_t * area_p);
+    static void scroll_copy_apply(lv_disp_t * disp);
+    static void move_px(lv_color_t * dest, const lv_color_t * src, lv_coord_t px_cnt);
+#endif
+
+#if LV_USE_DISP_BUF_RING
+    static bool buf_ring_is_used(lv_disp_t * disp);
+    static void buf_ring_pump(lv_disp_t * disp);
+    static void buf_ring_drain(lv_disp_t * disp);
+#endif
+
+#if LV_USE_FRAME_PACING
+    static bool frame_pacing_wait(lv_disp_t * disp);
+    static void frame_pacing_update(lv_disp_t * disp, uint32_t time);
+#endif
+
+#if LV_USE_REFR_CTX
+    static void ctx_buf_free(_lv_refr_ctx_t * ctx);
+    static void ctx_refr_end(lv_disp_t * disp, _lv_refr_ctx_t * ctx_ori);
+#endif
 
 #if LV_USE_PERF_MONITOR
     static void perf_monitor_init(perf_monitor_t * perf_monitor);
@@ -72,8 +136,28 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
 /**********************
  *  STATIC VARIABLES
  **********************/
-static uint32_t px_num;
-static lv_disp_t * disp_refr; /*Display being refreshed*/
+#if LV_USE_REFR_CTX
+    static _lv_refr_ctx_t ctx_common;                           /*Used when no display is refreshed on the thread*/
+    static LV_REFR_CTX_THREAD_LOCAL _lv_refr_ctx_t * ctx_act;   /*Context of the display refreshed on the thread*/
+    static pthread_mutex_t ctx_shared_mutex = PTHREAD_MUTEX_INITIALIZER;
+    static LV_REFR_CTX_THREAD_LOCAL uint32_t ctx_shared_lock_depth;   /*To allow locking recursively*/
+    static uint32_t ctx_refr_cnt;   /*Number of refreshes running in a display's context, protected by `ctx_shared_mutex`*/
+#else
+    static uint32_t px_num;
+    static lv_disp_t * disp_refr; /*Display being refreshed*/
+#endif
+
+#if LV_USE_REFR_OCCLUSION
+    static bool occlusion_en = true;
+#endif
+
+#if LV_USE_DRAW_LIST
+    static bool draw_list_en = true;
+#endif
+
+#if LV_USE_SCROLL_COPY
+    static bool scroll_copy_en = true;
+#endif
 
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
@@ -92,6 +176,12 @@ static lv_disp_t * disp_refr; /*Display being refreshed*/
     #define REFR_TRACE(...)
 #endif
 
+#if LV_USE_REFR_CTX
+    #define CTX_ACT     (ctx_act ? ctx_act : &ctx_common)
+    #define disp_refr   (CTX_ACT->disp)
+    #define px_num      (CTX_ACT->px_num)
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -114,18 +204,27 @@ void lv_refr_now(lv_disp_t * disp)
     lv_anim_refr_now();
 
     if(disp) {
-        if(disp->refr_timer) _lv_disp_refr_timer(disp->refr_timer);
+        if(disp->refr_timer) refr_timer_exec(disp->refr_timer);
     }
     else {
         lv_disp_t * d;
         d = lv_disp_get_next(NULL);
         while(d) {
-            if(d->refr_timer) _lv_disp_refr_timer(d->refr_timer);
+            if(d->refr_timer) refr_timer_exec(d->refr_timer);
             d = lv_disp_get_next(d);
         }
     }
 }
 
+void lv_refr_disp(lv_disp_t * disp)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) return;
+
+    if(disp->refr_timer) refr_timer_exec(disp->refr_timer);
+    else refr_disp(disp);
+}
+
 void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
     const lv_area_t * clip_area_ori = draw_ctx->clip_area;
@@ -143,9 +242,14 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     if(should_draw) {
         draw_ctx->clip_area = &clip_coords_for_obj;
 
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
+#if LV_USE_REFR_OCCLUSION
+        if(disp_refr && com_clip_res) {
+            disp_refr->draw_stats.draw_cnt++;
+            disp_refr->draw_stats.draw_px_cnt += lv_area_get_size(&clip_coords_for_obj);
+        }
+#endif
+
+        send_draw_events(draw_ctx, obj, &obj_coords_ext, false);
 #if LV_USE_REFR_DEBUG
         lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
         lv_draw_rect_dsc_t draw_dsc;
@@ -177,8 +281,7 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
         for(i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = obj->spec_attr->children[i];
-            refr_obj(draw_ctx, child);
+            refr_child(draw_ctx, obj, i);
         }
     }
 
@@ -187,9 +290,7 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         draw_ctx->clip_area = &clip_coords_for_obj;
 
         /*If all the children are redrawn make 'post draw' draw*/
-        lv_event_send(obj, LV_EVENT_DRAW_POST_BEGIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_POST, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_POST_END, draw_ctx);
+        send_draw_events(draw_ctx, obj, &obj_coords_ext, true);
     }
 
     draw_ctx->clip_area = clip_area_ori;
@@ -241,6 +342,10 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
 
     if(disp->driver->rounder_cb) disp->driver->rounder_cb(disp->driver, &com_area);
 
+#if LV_USE_REFR_REGION
+    if(region_add(disp, &com_area) == false) return;
+    disp->inv_stats.inv_cnt++;
+#else
     /*Save only if this area is not in one of the saved areas*/
     uint16_t i;
     for(i = 0; i < disp->inv_p; i++) {
@@ -256,6 +361,7 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
         lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
     }
     disp->inv_p++;
+#endif
     if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
 }
 
@@ -285,13 +391,344 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
  */
 void _lv_disp_refr_timer(lv_timer_t * tmr)
 {
-    REFR_TRACE("begin");
+#if LV_USE_FRAME_PACING
+    /*Wait for the vsync of the next frame. The forced refreshes (`lv_refr_now()`) are not delayed.*/
+    if(tmr && frame_pacing_wait(tmr->user_data)) return;
+#endif
 
-    uint32_t start = lv_tick_get();
-    volatile uint32_t elaps = 0;
+    refr_timer_exec(tmr);
+}
+
+#if LV_USE_REFR_CTX
+_lv_refr_ctx_t * _lv_refr_ctx_get_act(void)
+{
+    return CTX_ACT;
+}
+
+void _lv_refr_ctx_create(lv_disp_t * disp)
+{
+    disp->refr_ctx = lv_mem_alloc(sizeof(_lv_refr_ctx_t));
+    LV_ASSERT_MALLOC(disp->refr_ctx);
+    if(disp->refr_ctx == NULL) {
+        LV_LOG_WARN("couldn't allocate the render context, the display will use the common one");
+        return;
+    }
+    lv_memset_00(disp->refr_ctx, sizeof(_lv_refr_ctx_t));
+}
+
+void _lv_refr_ctx_delete(lv_disp_t * disp)
+{
+    _lv_refr_ctx_t * ctx = disp->refr_ctx;
+    if(ctx == NULL) return;
+
+    ctx_buf_free(ctx);
+
+    disp->refr_ctx = NULL;
+    lv_mem_free(ctx);
+}
+
+void _lv_refr_ctx_lock(void)
+{
+    /*E.g. an image is drawn while a cached layer is rendered*/
+    if(ctx_shared_lock_depth == 0) pthread_mutex_lock(&ctx_shared_mutex);
+    ctx_shared_lock_depth++;
+}
+
+void _lv_refr_ctx_unlock(void)
+{
+    ctx_shared_lock_depth--;
+    if(ctx_shared_lock_depth == 0) pthread_mutex_unlock(&ctx_shared_mutex);
+}
+#endif
+
+#if LV_USE_REFR_REGION
+const lv_disp_inv_stats_t * lv_refr_get_inv_stats(lv_disp_t * disp)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return NULL;
+
+    return &disp->inv_stats;
+}
 
+void lv_refr_reset_inv_stats(lv_disp_t * disp)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return;
+
+    lv_memset_00(&disp->inv_stats, sizeof(disp->inv_stats));
+}
+#endif
+
+#if LV_USE_FRAME_PACING
+const lv_disp_frame_stats_t * lv_refr_get_frame_stats(lv_disp_t * disp)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return NULL;
+
+    return &disp->frame_stats;
+}
+
+void lv_refr_reset_frame_stats(lv_disp_t * disp)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return;
+
+    uint32_t period = disp->frame_stats.period;
+    lv_memset_00(&disp->frame_stats, sizeof(disp->frame_stats));
+    disp->frame_stats.period = period;
+}
+#endif
+
+#if LV_USE_REFR_OCCLUSION
+void lv_refr_set_occlusion_culling(bool en)
+{
+    occlusion_en = en;
+}
+
+const lv_disp_draw_stats_t * lv_refr_get_draw_stats(lv_disp_t * disp)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return NULL;
+
+    return &disp->draw_stats;
+}
+
+void lv_refr_reset_draw_stats(lv_disp_t * disp)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return;
+
+    lv_memset_00(&disp->draw_stats, sizeof(disp->draw_stats));
+}
+#endif
+
+#if LV_USE_DRAW_LIST
+void lv_refr_set_draw_list(bool en)
+{
+    draw_list_en = en;
+}
+#endif
+
+#if LV_USE_SCROLL_COPY
+void lv_refr_set_scroll_copy(bool en)
+{
+    scroll_copy_en = en;
+}
+
+const lv_disp_scroll_copy_stats_t * lv_refr_get_scroll_copy_stats(lv_disp_t * disp)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return NULL;
+
+    return &disp->scroll_copy_stats;
+}
+
+void lv_refr_reset_scroll_copy_stats(lv_disp_t * disp)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return;
+
+    lv_memset_00(&disp->scroll_copy_stats, sizeof(disp->scroll_copy_stats));
+}
+
+bool _lv_refr_scroll_copy_is_possible(lv_obj_t * obj)
+{
+    if(!scroll_copy_en || !obj->class_p->scroll_copy) return false;
+
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    lv_disp_drv_t * drv = disp->driver;
+    /*The pixels can be moved only in a buffer which holds the whole screen all the time*/
+    if(!drv->direct_mode || drv->full_refresh || drv->rotated != LV_DISP_ROT_NONE || drv->set_px_cb) return false;
+    if(drv->draw_buf->buf2 || drv->draw_buf->size < (uint32_t)drv->hor_res * drv->ver_res) return false;
+    if(disp->rendering_in_progress || !lv_disp_is_invalidation_enabled(disp)) return false;
+
+    /*The drawing might depend on the position*/
+    if(obj->spec_attr && (obj->spec_attr->event_mask & (SCROLL_COPY_MAIN_EVENTS | SCROLL_COPY_POST_EVENTS))) return false;
+
+    /*Only a plain opaque background looks the same after moving it*/
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN) != NULL) return false;
+
+    return true;
+}
+
+bool _lv_refr_scroll_copy(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, const lv_area_t sb_old[2])
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+
+    lv_area_t vis;
+    lv_area_t move_area;
+    if(!scroll_copy_get_area(obj, x, y, &vis, &move_area) || scroll_copy_is_covered(obj, &vis)) {
+        disp->scroll_copy_stats.fallback_cnt++;
+        return false;
+    }
+
+    /*Only one area can be moved in a refresh. The offsets of the same area are summed.*/
+    lv_point_t ofs = {x, y};
+    if(disp->scroll_copy_ofs.x != 0 || disp->scroll_copy_ofs.y != 0) {
+        if(!_lv_area_is_equal(&disp->scroll_copy_area, &move_area)) {
+            disp->scroll_copy_stats.fallback_cnt++;
+            return false;
+        }
+        ofs.x += disp->scroll_copy_ofs.x;
+        ofs.y += disp->scroll_copy_ofs.y;
+    }
+
+    lv_coord_t w = lv_area_get_width(&move_area);
+    lv_coord_t h = lv_area_get_height(&move_area);
+    if(LV_ABS(ofs.x) >= w || LV_ABS(ofs.y) >= h) {
+        disp->scroll_copy_stats.fallback_cnt++;
+        return false;
+    }
+
+    /*The already invalidated parts will be moved too, so invalidate them on the new position as well*/
+    lv_area_t moved[LV_INV_BUF_SIZE];
+    uint32_t moved_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        lv_area_t a;
+        if(!_lv_area_intersect(&a, &disp->inv_areas[i], &move_area)) continue;
+        lv_area_move(&a, x, y);
+        if(_lv_area_intersect(&a, &a, &move_area)) moved[moved_cnt++] = a;
+    }
+
+    disp->scroll_copy_area = move_area;
+    disp->scroll_copy_ofs = ofs;
+    disp->scroll_copy_stats.copy_cnt++;
+
+    for(i = 0; i < moved_cnt; i++) {
+        _lv_inv_area(disp, &moved[i]);
+    }
+
+    /*Redraw the newly visible strips*/
+    lv_area_t a;
+    if(y != 0) {
+        a = move_area;
+        if(y > 0) a.y2 = a.y1 + y - 1;
+        else a.y1 = a.y2 + y + 1;
+        _lv_inv_area(disp, &a);
+    }
+    if(x != 0) {
+        a = move_area;
+        if(x > 0) a.x2 = a.x1 + x - 1;
+        else a.x1 = a.x2 + x + 1;
+        _lv_inv_area(disp, &a);
+    }
+
+    /*The edges (border, rounded corners) are not moved but the children might be drawn there too*/
+    if(vis.y1 < move_area.y1) {
+        lv_area_set(&a, vis.x1, vis.y1, vis.x2, move_area.y1 - 1);
+        _lv_inv_area(disp, &a);
+    }
+    if(vis.y2 > move_area.y2) {
+        lv_area_set(&a, vis.x1, move_area.y2 + 1, vis.x2, vis.y2);
+        _lv_inv_area(disp, &a);
+    }
+    if(vis.x1 < move_area.x1) {
+        lv_area_set(&a, vis.x1, move_area.y1, move_area.x1 - 1, move_area.y2);
+        _lv_inv_area(disp, &a);
+    }
+    if(vis.x2 > move_area.x2) {
+        lv_area_set(&a, move_area.x2 + 1, move_area.y1, vis.x2, move_area.y2);
+        _lv_inv_area(disp, &a);
+    }
+
+    /*The scrollbars are moved with the content but they should stay in place*/
+    for(i = 0; i < 2; i++) {
+        if(lv_area_get_size(&sb_old[i]) == 0) continue;
+        lv_obj_invalidate_area(obj, &sb_old[i]);
+        a = sb_old[i];
+        lv_area_move(&a, x, y);
+        lv_obj_invalidate_area(obj, &a);
+    }
+    lv_obj_scrollbar_invalidate(obj);
+
+    return true;
+}
+#endif
+
+#if LV_USE_LAYER_CACHE
+bool _lv_refr_layer_cache_step(lv_disp_t * disp, lv_obj_t * obj, lv_coord_t row_cnt)
+{
+    /*The layer needs to be rendered into the memory*/
+    lv_draw_ctx_t * draw_ctx = disp->driver->draw_ctx;
+    if(disp->driver->set_px_cb || draw_ctx == NULL) return true;
+    if(obj->spec_attr == NULL || obj->spec_attr->layer_cache == NULL) return true;
+
+    lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_t obj_coords_ext;
+    lv_obj_get_coords(obj, &obj_coords_ext);
+    lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
+
+    /*Start again if the object has changed. The rows rendered so far are valid only at the same position.*/
+    lv_draw_layer_cache_t * layer = obj->spec_attr->layer_cache;
+    bool restart;
+    if(!layer->valid || layer->img.data == NULL) restart = true;
+    else if(layer->partial) restart = !_lv_area_is_equal(&layer->area, &obj_coords_ext);
+    else restart = lv_area_get_width(&layer->area) != lv_area_get_width(&obj_coords_ext) ||
+                       lv_area_get_height(&layer->area) != lv_area_get_height(&obj_coords_ext);
+
+    if(!restart && !layer->partial) return true;
+
+    lv_disp_t * disp_refr_ori = disp_refr;
+    disp_refr = disp;
+
+    if(restart) {
+        if(!layer_cache_alloc(obj, layer, &obj_coords_ext)) {
+            disp_refr = disp_refr_ori;
+            return true;
+        }
+        /*The invalidations clear `valid` while the rows are rendered*/
+        layer->valid = 1;
+        layer->partial = 1;
+        layer->partial_y = layer->area.y1;
+    }
+
+    lv_area_t clip_area = layer->area;
+    clip_area.y1 = layer->partial_y;
+    clip_area.y2 = LV_MIN(clip_area.y1 + LV_MAX(row_cnt, 1) - 1, layer->area.y2);
+    layer_cache_render_area(draw_ctx, obj, layer, &clip_area);
+
+    disp_refr = disp_refr_ori;
+
+    layer->partial_y = clip_area.y2 + 1;
+    if(layer->partial_y > layer->area.y2) layer->partial = 0;
+
+    return layer->partial == 0;
+}
+#endif
+
+#if LV_USE_PERF_MONITOR
+void lv_refr_reset_fps_counter(void)
+{
+    perf_monitor.fps_sum_all = 0;
+    perf_monitor.fps_sum_cnt = 0;
+}
+
+uint32_t lv_refr_get_fps_avg(void)
+{
+    if(perf_monitor.fps_sum_cnt == 0) {
+        return 0;
+    }
+    return perf_monitor.fps_sum_all / perf_monitor.fps_sum_cnt;
+}
+#endif
+
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Refresh the display of a refresh timer now
+ * @param tmr pointer to the refresh timer of a display (NULL: the default display)
+ */
+static void refr_timer_exec(lv_timer_t * tmr)
+{
+    lv_disp_t * disp;
     if(tmr) {
-        disp_refr = tmr->user_data;
+        disp = tmr->user_data;
 #if LV_USE_PERF_MONITOR == 0 && LV_USE_MEM_MONITOR == 0
         /**
          * Ensure the timer does not run again automatically.
@@ -301,8 +738,37 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 #endif
     }
     else {
-        disp_refr = lv_disp_get_default();
+        disp = lv_disp_get_default();
+    }
+
+    refr_disp(disp);
+}
+
+/**
+ * Refresh the invalid areas of a display
+ * @param disp pointer to display to refresh
+ */
+static void refr_disp(lv_disp_t * disp)
+{
+    REFR_TRACE("begin");
+
+    uint32_t start = lv_tick_get();
+    volatile uint32_t elaps = 0;
+
+#if LV_USE_REFR_CTX
+    /*Refresh in the display's own context. `disp_refr` and `px_num` are stored there too.*/
+    _lv_refr_ctx_t * ctx_ori = ctx_act;
+    if(disp->refr_ctx) {
+        ctx_act = disp->refr_ctx;
+        /*Release the buffers taken from the common context since the last refresh
+         *so that the display's buffers can reuse their memory*/
+        _lv_refr_ctx_lock();
+        if(ctx_refr_cnt == 0) ctx_buf_free(NULL);
+        ctx_refr_cnt++;
+        _lv_refr_ctx_unlock();
     }
+#endif
+    disp_refr = disp;
 
     /*Refresh the screen's layout if required*/
     lv_obj_update_layout(disp_refr->act_scr);
@@ -316,6 +782,9 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         disp_refr->inv_p = 0;
         LV_LOG_WARN("there is no active screen");
         REFR_TRACE("finished");
+#if LV_USE_REFR_CTX
+        ctx_refr_end(disp, ctx_ori);
+#endif
         return;
     }
 
@@ -337,8 +806,17 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         if(disp_refr->driver->monitor_cb) {
             disp_refr->driver->monitor_cb(disp_refr->driver, elaps, px_num);
         }
+
+#if LV_USE_FRAME_PACING
+        frame_pacing_update(disp_refr, elaps);
+#endif
     }
 
+#if LV_USE_SCR_PRELOAD
+    /*The loaded screen was drawn from its preloaded layer, it's not needed anymore*/
+    if(disp_refr->preload_release) _lv_disp_release_scr_preload(disp_refr);
+#endif
+
     lv_mem_buf_free_all();
     _lv_font_clean_up_fmt_txt();
 
@@ -434,30 +912,99 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     }
 #endif
 
+#if LV_USE_REFR_CTX
+    ctx_refr_end(disp, ctx_ori);
+#endif
+
     REFR_TRACE("finished");
 }
 
-#if LV_USE_PERF_MONITOR
-void lv_refr_reset_fps_counter(void)
+#if LV_USE_REFR_CTX
+/**
+ * Free the buffers (`lv_mem_buf`, font and mask caches) of a context
+ * @param ctx pointer to a context or NULL for the common context
+ */
+static void ctx_buf_free(_lv_refr_ctx_t * ctx)
 {
-    perf_monitor.fps_sum_all = 0;
-    perf_monitor.fps_sum_cnt = 0;
+    _lv_refr_ctx_t * ctx_ori = ctx_act;
+    ctx_act = ctx;
+    lv_mem_buf_free_all();
+    _lv_font_clean_up_fmt_txt();
+#if LV_DRAW_COMPLEX
+    _lv_draw_mask_cleanup();
+#endif
+    ctx_act = ctx_ori;
 }
 
-uint32_t lv_refr_get_fps_avg(void)
+/**
+ * Leave the display's context at the end of its refresh.
+ * The buffers taken from the common context between the refreshes (e.g. when a screen is preloaded)
+ * are freed too when no other refresh is running.
+ * @param disp      the refreshed display
+ * @param ctx_ori   the context active before the refresh
+ */
+static void ctx_refr_end(lv_disp_t * disp, _lv_refr_ctx_t * ctx_ori)
 {
-    if(perf_monitor.fps_sum_cnt == 0) {
-        return 0;
-    }
-    return perf_monitor.fps_sum_all / perf_monitor.fps_sum_cnt;
+    ctx_act = ctx_ori;
+    if(disp->refr_ctx == NULL) return;     /*The common context was used and cleaned up already*/
+
+    _lv_refr_ctx_lock();
+    ctx_refr_cnt--;
+    if(ctx_refr_cnt == 0) ctx_buf_free(NULL);
+    _lv_refr_ctx_unlock();
 }
 #endif
 
+#if LV_USE_REFR_REGION
+/**
+ * Join the areas which are cheaper to redraw together and
+ * cut the overlapping parts of the others to draw the pixels only once
+ */
+static void lv_refr_join_area(void)
+{
+    lv_area_t * areas = disp_refr->inv_areas;
+    uint8_t * joined = disp_refr->inv_area_joined;
+    uint32_t i;
+    uint32_t j;
+
+    /*Joining two areas can make it worth to join a third one too so repeat until nothing changes*/
+    bool changed = true;
+    while(changed) {
+        changed = false;
+        for(i = 0; i < disp_refr->inv_p; i++) {
+            if(joined[i]) continue;
+            for(j = i + 1; j < disp_refr->inv_p; j++) {
+                if(joined[j]) continue;
+                if(region_join_cost(&areas[i], &areas[j]) >= 0) continue;
+
+                _lv_area_join(&areas[i], &areas[i], &areas[j]);
+                joined[j] = 1;
+                disp_refr->inv_stats.join_cnt++;
+                changed = true;
+            }
+        }
+    }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(joined[i]) continue;
+        for(j = 0; j < disp_refr->inv_p; j++) {
+            if(joined[j] || i == j) continue;
 
+            if(_lv_area_is_in(&areas[i], &areas[j], 0)) {
+                joined[i] = 1;
+                break;
+            }
+
+            uint32_t size_ori = lv_area_get_size(&areas[i]);
+            if(area_cut_covered(&areas[i], &areas[j]) == false) continue;
+
+            /*Keep the alignment required by the display*/
+            if(disp_refr->driver->rounder_cb) disp_refr->driver->rounder_cb(disp_refr->driver, &areas[i]);
+            if(lv_area_get_size(&areas[i]) < size_ori) disp_refr->inv_stats.trim_cnt++;
+        }
+    }
+}
+#else
 /**
  * Join the areas which has got common parts
  */
@@ -494,6 +1041,7 @@ static void lv_refr_join_area(void)
         }
     }
 }
+#endif
 
 /**
  * Refresh the joined areas
@@ -502,6 +1050,10 @@ static void refr_invalid_areas(void)
 {
     px_num = 0;
 
+#if LV_USE_SCROLL_COPY
+    scroll_copy_apply(disp_refr);
+#endif
+
     if(disp_refr->inv_p == 0) return;
 
     /*Find the last area which will be drawn*/
@@ -532,9 +1084,21 @@ static void refr_invalid_areas(void)
             refr_area(&disp_refr->inv_areas[i]);
 
             px_num += lv_area_get_size(&disp_refr->inv_areas[i]);
+#if LV_USE_REFR_REGION
+            disp_refr->inv_stats.area_cnt++;
+#endif
         }
     }
 
+#if LV_USE_REFR_REGION
+    disp_refr->inv_stats.refr_cnt++;
+    disp_refr->inv_stats.px_cnt += px_num;
+#endif
+
+#if LV_USE_DISP_BUF_RING
+    if(buf_ring_is_used(disp_refr)) buf_ring_drain(disp_refr);
+#endif
+
     disp_refr->rendering_in_progress = false;
 }
 
@@ -681,19 +1245,36 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
         }
     }
 
+    bool draw_act_scr = true;
+    bool draw_prev_scr = disp_refr->prev_scr != NULL;
+#if LV_USE_REFR_OCCLUSION
+    /*During screen load animations don't draw the screen which is fully covered by the other one*/
+    if(occlusion_en && disp_refr->prev_scr) {
+        if(disp_refr->draw_prev_over_act) draw_act_scr = top_prev_scr == NULL;
+        else draw_prev_scr = top_act_scr == NULL;
+
+        if(!draw_act_scr || !draw_prev_scr) {
+            disp_refr->draw_stats.cull_cnt++;
+            disp_refr->draw_stats.cull_px_cnt += lv_area_get_size(draw_ctx->buf_area);
+        }
+    }
+#endif
+
     if(disp_refr->draw_prev_over_act) {
-        if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
-        refr_obj_and_children(draw_ctx, top_act_scr);
+        if(draw_act_scr) {
+            if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
+            refr_obj_and_children(draw_ctx, top_act_scr);
+        }
 
         /*Refresh the previous screen if any*/
-        if(disp_refr->prev_scr) {
+        if(draw_prev_scr) {
             if(top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
             refr_obj_and_children(draw_ctx, top_prev_scr);
         }
     }
     else {
         /*Refresh the previous screen if any*/
-        if(disp_refr->prev_scr) {
+        if(draw_prev_scr) {
             if(top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
             refr_obj_and_children(draw_ctx, top_prev_scr);
         }
@@ -784,7 +1365,7 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
             }
             else {
                 /*Refresh the objects*/
-                refr_obj(draw_ctx, child);
+                refr_child(draw_ctx, parent, i);
             }
         }
 
@@ -802,6 +1383,73 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
 }
 
 
+/**
+ * Refresh a child of an object. Skip it if it's covered by its younger siblings.
+ * @param draw_ctx  pointer to the draw context, its clip area is the area to draw
+ * @param parent    pointer to the parent
+ * @param idx       index of the child to refresh
+ */
+static void refr_child(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t idx)
+{
+    lv_obj_t * child = parent->spec_attr->children[idx];
+
+#if LV_USE_REFR_OCCLUSION
+    if(occlusion_en) {
+        const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+        lv_area_t clip_area_visible;
+        if(occlusion_get_clip(parent, idx, clip_area_ori, &clip_area_visible) == false) return;
+
+        draw_ctx->clip_area = &clip_area_visible;
+        refr_obj(draw_ctx, child);
+        draw_ctx->clip_area = clip_area_ori;
+        return;
+    }
+#endif
+
+    refr_obj(draw_ctx, child);
+}
+
+/**
+ * Send the main or post draw events to an object, or replay the draw calls recorded last time.
+ * @param draw_ctx          pointer to the draw context with the clip area set to the object
+ * @param obj               pointer to an object
+ * @param obj_coords_ext    the object's coordinates with the extended draw size
+ * @param post              true: send the `LV_EVENT_DRAW_POST...` events; false: `LV_EVENT_DRAW_MAIN...`
+ */
+static void send_draw_events(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, const lv_area_t * obj_coords_ext, bool post)
+{
+#if LV_USE_DRAW_LIST
+    lv_draw_list_t * list = draw_list_en ? _lv_obj_get_draw_list(obj, post) : NULL;
+    if(list && lv_draw_list_is_valid(list, obj_coords_ext, draw_ctx->clip_area)) {
+        lv_draw_list_replay(draw_ctx, list);
+        return;
+    }
+
+    /*Record only if the whole visible part of the object is drawn now,
+     *else the draw calls out of the clip area might be missing*/
+    bool rec = false;
+    if(list && !list->uncacheable && disp_refr) {
+        lv_area_t scr_area;
+        lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp_refr) - 1, lv_disp_get_ver_res(disp_refr) - 1);
+        lv_area_t obj_visible;
+        if(_lv_area_intersect(&obj_visible, obj_coords_ext, &scr_area)) {
+            rec = _lv_area_is_in(&obj_visible, draw_ctx->clip_area, 0);
+        }
+    }
+    if(rec) lv_draw_list_rec_start(list, obj_coords_ext, draw_ctx->clip_area);
+#else
+    LV_UNUSED(obj_coords_ext);
+#endif
+
+    lv_event_send(obj, post ? LV_EVENT_DRAW_POST_BEGIN : LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
+    lv_event_send(obj, post ? LV_EVENT_DRAW_POST : LV_EVENT_DRAW_MAIN, draw_ctx);
+    lv_event_send(obj, post ? LV_EVENT_DRAW_POST_END : LV_EVENT_DRAW_MAIN_END, draw_ctx);
+
+#if LV_USE_DRAW_LIST
+    if(rec) lv_draw_list_rec_stop();
+#endif
+}
+
 static lv_res_t layer_get_area(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_layer_type_t layer_type,
                                lv_area_t * layer_area_out)
 {
@@ -878,8 +1526,24 @@ static void layer_alpha_test(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, lv_draw_l
 
 void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
+#if LV_USE_DISP_BUF_RING
+    /*Don't let the display idle until the end of the strip if a rendered buffer is waiting*/
+    buf_ring_pump(disp_refr);
+#endif
+
     /*Do not refresh hidden objects*/
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+#if LV_USE_LAYER_CACHE
+    if(obj->spec_attr && obj->spec_attr->layer_cache) {
+        /*The cached layers of all the displays share one memory budget and can evict each other*/
+        _LV_REFR_CTX_LOCK();
+        bool drawn = refr_layer_cache(draw_ctx, obj);
+        _LV_REFR_CTX_UNLOCK();
+        if(drawn) return;
+    }
+#endif
+
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(draw_ctx, obj);
@@ -909,28 +1573,9 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
             LV_LOG_WARN("Couldn't create a new layer context");
             return;
         }
-        lv_point_t pivot = {
-            .x = lv_obj_get_style_transform_pivot_x(obj, 0),
-            .y = lv_obj_get_style_transform_pivot_y(obj, 0)
-        };
-
-        if(LV_COORD_IS_PCT(pivot.x)) {
-            pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
-        }
-        if(LV_COORD_IS_PCT(pivot.y)) {
-            pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
-        }
-
+        lv_point_t pivot;
         lv_draw_img_dsc_t draw_dsc;
-        lv_draw_img_dsc_init(&draw_dsc);
-        draw_dsc.opa = opa;
-        draw_dsc.angle = lv_obj_get_style_transform_angle(obj, 0);
-        if(draw_dsc.angle > 3600) draw_dsc.angle -= 3600;
-        else if(draw_dsc.angle < 0) draw_dsc.angle += 3600;
-
-        draw_dsc.zoom = lv_obj_get_style_transform_zoom(obj, 0);
-        draw_dsc.blend_mode = lv_obj_get_style_blend_mode(obj, 0);
-        draw_dsc.antialias = disp_refr->driver->antialiasing;
+        layer_init_draw_dsc(obj, opa, &draw_dsc, &pivot);
 
         if(flags & LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE) {
             layer_ctx->area_act = layer_ctx->area_full;
@@ -961,6 +1606,165 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     }
 }
 
+/**
+ * Initialize an image descriptor to blend the layer of an object
+ * @param obj       pointer to an object
+ * @param opa       opacity of the object
+ * @param draw_dsc  the descriptor to initialize
+ * @param pivot     store the pivot of the transformation relative to the object's coordinates here
+ */
+static void layer_init_draw_dsc(lv_obj_t * obj, lv_opa_t opa, lv_draw_img_dsc_t * draw_dsc, lv_point_t * pivot)
+{
+    pivot->x = lv_obj_get_style_transform_pivot_x(obj, 0);
+    pivot->y = lv_obj_get_style_transform_pivot_y(obj, 0);
+
+    if(LV_COORD_IS_PCT(pivot->x)) {
+        pivot->x = (LV_COORD_GET_PCT(pivot->x) * lv_area_get_width(&obj->coords)) / 100;
+    }
+    if(LV_COORD_IS_PCT(pivot->y)) {
+        pivot->y = (LV_COORD_GET_PCT(pivot->y) * lv_area_get_height(&obj->coords)) / 100;
+    }
+
+    lv_draw_img_dsc_init(draw_dsc);
+    draw_dsc->opa = opa;
+    draw_dsc->angle = lv_obj_get_style_transform_angle(obj, 0);
+    if(draw_dsc->angle > 3600) draw_dsc->angle -= 3600;
+    else if(draw_dsc->angle < 0) draw_dsc->angle += 3600;
+
+    draw_dsc->zoom = lv_obj_get_style_transform_zoom(obj, 0);
+    draw_dsc->blend_mode = lv_obj_get_style_blend_mode(obj, 0);
+    draw_dsc->antialias = disp_refr->driver->antialiasing;
+}
+
+#if LV_USE_LAYER_CACHE
+/**
+ * Draw an object from its cached layer. Render the object into the layer first if it's outdated.
+ * @param draw_ctx  pointer to a draw context
+ * @param obj       pointer to an object with layer cache
+ * @return          true: the object is handled; false: the layer can't be cached, draw the object normally
+ */
+static bool refr_layer_cache(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
+{
+    /*The layer needs to be rendered into the memory*/
+    if(disp_refr->driver->set_px_cb) return false;
+
+    lv_opa_t opa = lv_obj_get_style_opa(obj, 0);
+    if(opa < LV_OPA_MIN) return true;
+
+    lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_t obj_coords_ext;
+    lv_obj_get_coords(obj, &obj_coords_ext);
+    lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
+
+    /*Nothing to do if the object is not on the area to redraw*/
+    lv_area_t draw_area = obj_coords_ext;
+    if(_lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM) {
+        lv_obj_get_transformed_area(obj, &draw_area, false, false);
+    }
+    if(!_lv_area_is_on(&draw_area, draw_ctx->clip_area)) return true;
+
+    /*Only the size matters. If the object has moved, its layer is drawn at the new position*/
+    lv_draw_layer_cache_t * layer = obj->spec_attr->layer_cache;
+    if(layer->valid && !layer->partial && layer->img.data &&
+       lv_area_get_width(&layer->area) == lv_area_get_width(&obj_coords_ext) &&
+       lv_area_get_height(&layer->area) == lv_area_get_height(&obj_coords_ext)) {
+        lv_draw_layer_cache_touch(layer);
+    }
+    else if(!layer_cache_render(draw_ctx, obj, layer, &obj_coords_ext)) {
+        return false;
+    }
+
+    lv_point_t pivot;
+    lv_draw_img_dsc_t draw_dsc;
+    layer_init_draw_dsc(obj, opa, &draw_dsc, &pivot);
+    draw_dsc.pivot.x = obj->coords.x1 + pivot.x - obj_coords_ext.x1;
+    draw_dsc.pivot.y = obj->coords.y1 + pivot.y - obj_coords_ext.y1;
+
+    lv_draw_img(draw_ctx, &draw_dsc, &obj_coords_ext, &layer->img);
+
+    return true;
+}
+
+/**
+ * Allocate the pixels of a cached layer in the required color format
+ * @param obj               pointer to an object
+ * @param layer             the layer of the object
+ * @param obj_coords_ext    the object's coordinates with the extended draw size
+ * @return                  true: the layer is allocated; false: the layer can't be used
+ */
+static bool layer_cache_alloc(lv_obj_t * obj, lv_draw_layer_cache_t * layer, const lv_area_t * obj_coords_ext)
+{
+    /*If the object covers its whole layer, no alpha channel is required*/
+    bool has_alpha = true;
+    if(_lv_area_is_in(obj_coords_ext, &obj->coords, 0)) {
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = obj_coords_ext;
+        lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+        if(info.res == LV_COVER_RES_COVER) has_alpha = false;
+    }
+
+    /*Rendering with alpha channel needs LV_COLOR_SCREEN_TRANSP*/
+    if(LV_COLOR_SCREEN_TRANSP == 0 && has_alpha) return false;
+
+    lv_img_cf_t cf = has_alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    if(!lv_draw_layer_cache_alloc(layer, obj_coords_ext, cf)) return false;
+    if(has_alpha) lv_memset_00((void *)layer->img.data, layer->img.data_size);
+
+    return true;
+}
+
+/**
+ * Render an area of an object and its children into its allocated layer
+ * @param draw_ctx          pointer to a draw context
+ * @param obj               pointer to an object
+ * @param layer             the layer of the object
+ * @param clip_area         the area to render, inside the layer
+ */
+static void layer_cache_render_area(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_draw_layer_cache_t * layer,
+                                    const lv_area_t * clip_area)
+{
+    /*Redirect the drawing into the layer*/
+    void * buf_ori = draw_ctx->buf;
+    lv_area_t * buf_area_ori = draw_ctx->buf_area;
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    bool screen_transp_ori = disp_refr->driver->screen_transp;
+
+    draw_ctx->buf = (void *)layer->img.data;
+    draw_ctx->buf_area = &layer->area;
+    draw_ctx->clip_area = clip_area;
+    disp_refr->driver->screen_transp = layer->img.header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? 1 : 0;
+
+    /*Don't free the layer if a child needs room for its own layer*/
+    layer->busy = 1;
+    lv_obj_redraw(draw_ctx, obj);
+    lv_draw_wait_for_finish(draw_ctx);
+    layer->busy = 0;
+
+    draw_ctx->buf = buf_ori;
+    draw_ctx->buf_area = buf_area_ori;
+    draw_ctx->clip_area = clip_area_ori;
+    disp_refr->driver->screen_transp = screen_transp_ori ? 1 : 0;
+}
+
+/**
+ * Render an object and its children into its cached layer
+ * @param draw_ctx          pointer to a draw context
+ * @param obj               pointer to an object
+ * @param layer             the layer of the object
+ * @param obj_coords_ext    the object's coordinates with the extended draw size
+ * @return                  true: the layer is rendered; false: the layer can't be used
+ */
+static bool layer_cache_render(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_draw_layer_cache_t * layer,
+                               const lv_area_t * obj_coords_ext)
+{
+    if(!layer_cache_alloc(obj, layer, obj_coords_ext)) return false;
+
+    layer_cache_render_area(draw_ctx, obj, layer, &layer->area);
+    layer->valid = 1;
+    return true;
+}
+#endif
 
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
 {
@@ -1188,6 +1992,28 @@ static void draw_buf_flush(lv_disp_t * disp)
     lv_draw_ctx_t * draw_ctx = disp->driver->draw_ctx;
     if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
 
+#if LV_USE_DISP_BUF_RING
+    if(buf_ring_is_used(disp)) {
+        /*Queue the rendered buffer and send it right away if the display is free*/
+        uint8_t slot = (draw_buf->ring_head + draw_buf->ring_used) % draw_buf->ring_cnt;
+        draw_buf->ring_area[slot] = *draw_ctx->buf_area;
+        draw_buf->ring_last[slot] = draw_buf->last_area && draw_buf->last_part;
+        draw_buf->ring_used++;
+        buf_ring_pump(disp);
+
+        /*Render into the next buffer. Wait only if all buffers are waiting for the display*/
+        if(draw_buf->ring_used == draw_buf->ring_cnt) draw_buf->ring_wait_cnt++;
+        while(draw_buf->ring_used == draw_buf->ring_cnt) {
+            if(disp->driver->wait_cb) disp->driver->wait_cb(disp->driver);
+            buf_ring_pump(disp);
+        }
+
+        slot = (draw_buf->ring_head + draw_buf->ring_used) % draw_buf->ring_cnt;
+        draw_buf->buf_act = draw_buf->ring[slot];
+        return;
+    }
+#endif
+
     /* In partial double buffered mode wait until the other buffer is freed
      * and driver is ready to receive the new buffer */
     bool full_sized = draw_buf->size == (uint32_t)disp_refr->driver->hor_res * disp_refr->driver->ver_res;
@@ -1238,6 +2064,508 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
     drv->flush_cb(drv, &offset_area, color_p);
 }
 
+#if LV_USE_REFR_REGION
+/**
+ * Save an invalidated area. If the buffer is full the cheapest pair of the saved areas and
+ * the new one is joined, so unlike the default algorithm it never falls back to the whole screen.
+ * @param disp      pointer to a display
+ * @param area_p    the area to save, already clipped to the screen and rounded
+ * @return          false: the area was already invalidated
+ */
+static bool region_add(lv_disp_t * disp, const lv_area_t * area_p)
+{
+    lv_area_t * areas = disp->inv_areas;
+    uint16_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(_lv_area_is_in(area_p, &areas[i], 0)) return false;
+    }
+
+    /*Forget the areas covered by the new one*/
+    i = 0;
+    while(i < disp->inv_p) {
+        if(_lv_area_is_in(&areas[i], area_p, 0)) region_remove(disp, i);
+        else i++;
+    }
+
+    if(disp->inv_p < LV_INV_BUF_SIZE) {
+        areas[disp->inv_p] = *area_p;
+        disp->inv_p++;
+        return true;
+    }
+
+    /*No free place: find the pair of areas which is the cheapest to join. Index `inv_p` is the new area.*/
+    uint16_t best_i = 0;
+    uint16_t best_j = 1;
+    int32_t best_cost = INT32_MAX;
+    uint16_t j;
+    for(i = 0; i < disp->inv_p; i++) {
+        for(j = i + 1; j <= disp->inv_p; j++) {
+            int32_t cost = region_join_cost(&areas[i], j < disp->inv_p ? &areas[j] : area_p);
+            if(cost < best_cost) {
+                best_cost = cost;
+                best_i = i;
+                best_j = j;
+            }
+        }
+    }
+
+    disp->inv_stats.overflow_cnt++;
+
+    lv_area_t joined;
+    _lv_area_join(&joined, &areas[best_i], best_j < disp->inv_p ? &areas[best_j] : area_p);
+
+    /*Adding back the joined area can't overflow as 1 or 2 areas were removed*/
+    if(best_j < disp->inv_p) {
+        region_remove(disp, best_j);
+        region_remove(disp, best_i);
+        region_add(disp, &joined);
+        region_add(disp, area_p);
+    }
+    else {
+        region_remove(disp, best_i);
+        region_add(disp, &joined);
+    }
+
+    return true;
+}
+
+/**
+ * Remove a saved invalidated area and keep the order of the others
+ * @param disp      pointer to a display
+ * @param idx       index of the area to remove
+ */
+static void region_remove(lv_disp_t * disp, uint16_t idx)
+{
+    disp->inv_p--;
+    lv_memcpy(&disp->inv_areas[idx], &disp->inv_areas[idx + 1], (disp->inv_p - idx) * sizeof(lv_area_t));
+}
+
+/**
+ * Get how much more it costs to redraw two areas together than separately
+ * @param a1_p      pointer to an area
+ * @param a2_p      pointer to an other area
+ * @return          the extra cost in pixels, negative if joining them is cheaper
+ */
+static int32_t region_join_cost(const lv_area_t * a1_p, const lv_area_t * a2_p)
+{
+    lv_area_t joined;
+    _lv_area_join(&joined, a1_p, a2_p);
+
+    return (int32_t)lv_area_get_size(&joined) - (int32_t)lv_area_get_size(a1_p) - (int32_t)lv_area_get_size(a2_p) -
+           LV_REFR_REGION_AREA_COST;
+}
+
+#endif /*LV_USE_REFR_REGION*/
+
+#if LV_USE_REFR_OCCLUSION
+/**
+ * Get the part of the clip area where a child isn't covered by its younger siblings
+ * @param parent    pointer to the parent
+ * @param idx       index of the child
+ * @param clip_area the area to draw
+ * @param res_p     store the area to draw the child here
+ * @return          false: the child is fully covered
+ */
+static bool occlusion_get_clip(lv_obj_t * parent, uint32_t idx, const lv_area_t * clip_area, lv_area_t * res_p)
+{
+    lv_obj_t * child = parent->spec_attr->children[idx];
+    *res_p = *clip_area;
+
+    /*The children of an object with overflow visible can be anywhere on the clip area
+     *and transformed objects can be out of their coordinates*/
+    if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return true;
+    if(_lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) return true;
+
+    lv_area_t visible;
+    lv_obj_get_coords(child, &visible);
+    lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(child);
+    lv_area_increase(&visible, ext_draw_size, ext_draw_size);
+    if(_lv_area_intersect(&visible, &visible, clip_area) == false) return true;
+
+    uint32_t size_ori = lv_area_get_size(&visible);
+    uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+    uint32_t i;
+    for(i = idx + 1; i < child_cnt; i++) {
+        lv_obj_t * sibling = parent->spec_attr->children[i];
+
+        lv_area_t common;
+        if(_lv_area_intersect(&common, &visible, &sibling->coords) == false) continue;
+        if(lv_obj_has_flag(sibling, LV_OBJ_FLAG_HIDDEN)) continue;
+        if(_lv_obj_get_layer_type(sibling) != LV_LAYER_TYPE_NONE) continue;
+
+        /*Only the common part needs to be covered*/
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = &common;
+        lv_event_send(sibling, LV_EVENT_COVER_CHECK, &info);
+        if(info.res != LV_COVER_RES_COVER) continue;
+
+        if(_lv_area_is_in(&visible, &common, 0)) {
+            disp_refr->draw_stats.cull_cnt++;
+            disp_refr->draw_stats.cull_px_cnt += size_ori;
+            return false;
+        }
+
+        area_cut_covered(&visible, &common);
+    }
+
+    disp_refr->draw_stats.cull_px_cnt += size_ori - lv_area_get_size(&visible);
+    *res_p = visible;
+    return true;
+}
+#endif /*LV_USE_REFR_OCCLUSION*/
+
+#if LV_USE_REFR_REGION || LV_USE_REFR_OCCLUSION
+/**
+ * Cut the part of an area covered by an other one if the rest is still a rectangle
+ * @param a_p       pointer to the area to cut
+ * @param cover_p   pointer to an area which doesn't contain `a_p`
+ * @return          true: `a_p` was changed
+ */
+static bool area_cut_covered(lv_area_t * a_p, const lv_area_t * cover_p)
+{
+    if(_lv_area_is_on(a_p, cover_p) == false) return false;
+
+    /*Covers the full height from the left or right*/
+    if(cover_p->y1 <= a_p->y1 && cover_p->y2 >= a_p->y2) {
+        if(cover_p->x1 <= a_p->x1) {
+            a_p->x1 = cover_p->x2 + 1;
+            return true;
+        }
+        if(cover_p->x2 >= a_p->x2) {
+            a_p->x2 = cover_p->x1 - 1;
+            return true;
+        }
+    }
+
+    /*Covers the full width from the top or bottom*/
+    if(cover_p->x1 <= a_p->x1 && cover_p->x2 >= a_p->x2) {
+        if(cover_p->y1 <= a_p->y1) {
+            a_p->y1 = cover_p->y2 + 1;
+            return true;
+        }
+        if(cover_p->y2 >= a_p->y2) {
+            a_p->y2 = cover_p->y1 - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
+#if LV_USE_SCROLL_COPY
+/**
+ * Get the area of a scrolled object whose pixels can be moved
+ * @param obj       pointer to the scrolled object
+ * @param x         the horizontal scroll offset
+ * @param y         the vertical scroll offset
+ * @param vis_p     store the visible area of the object here
+ * @param move_p    store the area to move here: the visible area without the border and the rounded corners
+ * @return          false: the pixels can't be moved
+ */
+static bool scroll_copy_get_area(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_area_t * vis_p, lv_area_t * move_p)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(disp->prev_scr || lv_obj_get_screen(obj) != disp->act_scr) return false;
+
+    lv_area_set(vis_p, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+
+    /*Objects with layers or masks are drawn differently*/
+    lv_obj_t * parent;
+    for(parent = obj; parent; parent = lv_obj_get_parent(parent)) {
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) return false;
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+        if(_lv_obj_get_layer_type(parent) != LV_LAYER_TYPE_NONE) return false;
+        if(!_lv_area_intersect(vis_p, vis_p, &parent->coords)) return false;
+        if(parent == obj) continue;
+
+        if(lv_obj_get_style_clip_corner(parent, LV_PART_MAIN) && lv_obj_get_style_radius(parent, LV_PART_MAIN) > 0) return false;
+
+        /*The parents shouldn't draw on the object after their children*/
+        if(parent->spec_attr && (parent->spec_attr->event_mask & SCROLL_COPY_POST_EVENTS)) return false;
+        if(lv_obj_get_style_border_post(parent, LV_PART_MAIN)) return false;
+        lv_area_t sb_hor;
+        lv_area_t sb_ver;
+        lv_obj_get_scrollbar_area(parent, &sb_hor, &sb_ver);
+        if(lv_area_get_size(&sb_hor) > 0 && _lv_area_is_on(&sb_hor, &obj->coords)) return false;
+        if(lv_area_get_size(&sb_ver) > 0 && _lv_area_is_on(&sb_ver, &obj->coords)) return false;
+    }
+
+    /*The border, rounded corners and an inner outline are not moved.
+     *The left and right edges look the same in every row (except the corners) so they can be moved vertically
+     *and the top and bottom edges horizontally.*/
+    lv_coord_t w = lv_obj_get_width(obj);
+    lv_coord_t h = lv_obj_get_height(obj);
+    lv_coord_t r = LV_MIN(lv_obj_get_style_radius(obj, LV_PART_MAIN), LV_MIN(w, h) / 2);
+    lv_coord_t edge = LV_MAX(r, lv_obj_get_style_border_width(obj, LV_PART_MAIN));
+    lv_coord_t outline_pad = lv_obj_get_style_outline_pad(obj, LV_PART_MAIN);
+    if(outline_pad < 0 && lv_obj_get_style_outline_width(obj, LV_PART_MAIN) > 0) edge = LV_MAX(edge, -outline_pad);
+
+    lv_area_t inner = obj->coords;
+    lv_area_increase(&inner, x == 0 ? 0 : -edge, y == 0 ? 0 : -edge);
+    return _lv_area_intersect(move_p, &inner, vis_p);
+}
+
+/**
+ * Tell if something which doesn't move with the scrolled content is drawn on an area:
+ * floating children, the later siblings of the object and its parents or the top and system layers.
+ * @param obj       pointer to the scrolled object
+ * @param area_p    the visible area of the object
+ * @return          true: the area is (partially) covered
+ */
+static bool scroll_copy_is_covered(lv_obj_t * obj, const lv_area_t * area_p)
+{
+    lv_area_t a;
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(!lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING) || lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+        lv_obj_get_coords(child, &a);
+        lv_area_increase(&a, _lv_obj_get_ext_draw_size(child), _lv_obj_get_ext_draw_size(child));
+        if(_lv_area_is_on(&a, area_p)) return true;
+    }
+
+    lv_obj_t * child = obj;
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(parent) {
+        child_cnt = lv_obj_get_child_cnt(parent);
+        for(i = lv_obj_get_index(child) + 1; i < child_cnt; i++) {
+            lv_obj_t * sibling = parent->spec_attr->children[i];
+            if(lv_obj_has_flag(sibling, LV_OBJ_FLAG_HIDDEN)) continue;
+            lv_obj_get_coords(sibling, &a);
+            lv_area_increase(&a, _lv_obj_get_ext_draw_size(sibling), _lv_obj_get_ext_draw_size(sibling));
+            if(_lv_area_is_on(&a, area_p)) return true;
+        }
+        child = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    lv_obj_t * layers[2] = {disp->top_layer, disp->sys_layer};
+    uint32_t l;
+    for(l = 0; l < 2; l++) {
+        if(layers[l] == NULL) continue;
+        child_cnt = lv_obj_get_child_cnt(layers[l]);
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * layer_child = layers[l]->spec_attr->children[i];
+            if(lv_obj_has_flag(layer_child, LV_OBJ_FLAG_HIDDEN)) continue;
+            lv_obj_get_coords(layer_child, &a);
+            lv_area_increase(&a, _lv_obj_get_ext_draw_size(layer_child), _lv_obj_get_ext_draw_size(layer_child));
+            if(_lv_area_is_on(&a, area_p)) return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Move the pixels of the scrolled area in the draw buffer before drawing the invalidated areas
+ * @param disp      pointer to the display being refreshed
+ */
+static void scroll_copy_apply(lv_disp_t * disp)
+{
+    lv_point_t ofs = disp->scroll_copy_ofs;
+    if(ofs.x == 0 && ofs.y == 0) return;
+    disp->scroll_copy_ofs.x = 0;
+    disp->scroll_copy_ofs.y = 0;
+
+    /*The mode might have been changed since scrolling*/
+    lv_disp_drv_t * drv = disp->driver;
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+    if(!drv->direct_mode || draw_buf->buf2) return;
+
+    while(draw_buf->flushing) {
+        if(drv->wait_cb) drv->wait_cb(drv);
+    }
+
+    const lv_area_t * area = &disp->scroll_copy_area;
+    lv_color_t * buf = draw_buf->buf_act;
+    int32_t stride = lv_disp_get_hor_res(disp);
+    lv_coord_t w = lv_area_get_width(area) - LV_ABS(ofs.x);
+    lv_coord_t h = lv_area_get_height(area) - LV_ABS(ofs.y);
+    lv_coord_t dest_x = ofs.x > 0 ? area->x1 + ofs.x : area->x1;
+    lv_coord_t dest_y = ofs.y > 0 ? area->y1 + ofs.y : area->y1;
+    disp->scroll_copy_stats.copy_px_cnt += (uint32_t)w * h;
+
+    /*Go against the direction of the move to not overwrite the source rows*/
+    lv_coord_t i;
+    for(i = 0; i < h; i++) {
+        lv_coord_t y = ofs.y > 0 ? dest_y + h - 1 - i : dest_y + i;
+        lv_color_t * dest = buf + y * stride + dest_x;
+        move_px(dest, dest - ofs.y * stride - ofs.x, w);
+    }
+}
+
+/**
+ * Copy pixels to a possibly overlapping destination
+ * @param dest      pointer to the destination
+ * @param src       pointer to the source
+ * @param px_cnt    number of pixels to copy
+ */
+static void move_px(lv_color_t * dest, const lv_color_t * src, lv_coord_t px_cnt)
+{
+    if(dest + px_cnt <= src || src + px_cnt <= dest) {
+        lv_memcpy(dest, src, px_cnt * sizeof(lv_color_t));
+        return;
+    }
+
+    lv_coord_t i;
+    if(dest < src) {
+        for(i = 0; i < px_cnt; i++) dest[i] = src[i];
+    }
+    else {
+        for(i = px_cnt - 1; i >= 0; i--) dest[i] = src[i];
+    }
+}
+#endif
+
+#if LV_USE_DISP_BUF_RING
+/**
+ * Tell if the buffers of the ring are used for the current refresh.
+ * Full screen buffers, direct mode and software rotation need the legacy double buffering.
+ */
+static bool buf_ring_is_used(lv_disp_t * disp)
+{
+    lv_disp_drv_t * drv = disp->driver;
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+
+    if(draw_buf->ring_cnt < 2) return false;
+    if(drv->full_refresh || drv->direct_mode) return false;
+    if(drv->rotated != LV_DISP_ROT_NONE && drv->sw_rotate) return false;
+    if(draw_buf->size == (uint32_t)drv->hor_res * drv->ver_res) return false;
+
+    return true;
+}
+
+/**
+ * Retire the flushed buffer and pass the oldest waiting one to `flush_cb`.
+ * `lv_disp_flush_ready()` only clears the `flushing` flag (it might be called from an interrupt),
+ * so the next buffer is sent from here, i.e. from the rendering thread.
+ */
+static void buf_ring_pump(lv_disp_t * disp)
+{
+    lv_disp_draw_buf_t * draw_buf = disp->driver->draw_buf;
+    if(draw_buf->ring_used == 0 || draw_buf->flushing) return;
+
+    if(draw_buf->ring_sent) {
+        draw_buf->ring_sent = 0;
+        draw_buf->ring_head = (draw_buf->ring_head + 1) % draw_buf->ring_cnt;
+        draw_buf->ring_used--;
+        if(draw_buf->ring_used == 0) return;
+    }
+
+    /*The newest buffer is still being rendered if the queue isn't full*/
+    uint8_t head = draw_buf->ring_head;
+    draw_buf->ring_sent = 1;
+    draw_buf->flushing = 1;
+    draw_buf->flushing_last = draw_buf->ring_last[head];
+    if(disp->driver->flush_cb) call_flush_cb(disp->driver, &draw_buf->ring_area[head], draw_buf->ring[head]);
+    else lv_disp_flush_ready(disp->driver);
+}
+
+/**
+ * Send all rendered buffers at the end of the refresh. The last one is left flushing in the background.
+ */
+static void buf_ring_drain(lv_disp_t * disp)
+{
+    lv_disp_draw_buf_t * draw_buf = disp->driver->draw_buf;
+    buf_ring_pump(disp);
+    while(draw_buf->ring_used > 1 || (draw_buf->ring_used == 1 && !draw_buf->ring_sent)) {
+        if(disp->driver->wait_cb) disp->driver->wait_cb(disp->driver);
+        buf_ring_pump(disp);
+    }
+}
+#endif
+
+#if LV_USE_FRAME_PACING
+/**
+ * Check whether the refreshing of a display has to wait for a vsync.
+ * A frame is started in the first half of a vsync period, i.e. not while the display is being updated.
+ * If there was no vsync for 2 vsync periods the timer is used again until `lv_disp_vsync()` is called again.
+ * @param disp      pointer to a display
+ * @return          true: don't refresh now, the refresh timer checks it again 1 ms later
+ */
+static bool frame_pacing_wait(lv_disp_t * disp)
+{
+    uint32_t vsync_cnt = disp->vsync_cnt;
+    if(vsync_cnt == 0) return false;       /*No vsync signal, only the period of the timer is adapted*/
+    if(disp->inv_p == 0) return false;     /*Nothing to draw, let the timer be paused*/
+
+    /*The vsync signal stopped (e.g. the display was turned off), don't wait for it forever.
+     *Forget it to measure the period again when it restarts.*/
+    uint32_t timeout = disp->vsync_period ? disp->vsync_period * 2 : LV_DISP_DEF_REFR_PERIOD * 16 * 2;
+    if(lv_tick_elaps(disp->vsync_time) * 16 > timeout) {
+        LV_LOG_WARN("no vsync signal, refreshing with the timer");
+        disp->vsync_cnt = 0;
+        disp->vsync_period = 0;
+        if(disp->pacing_base_period == 0) disp->pacing_base_period = LV_DISP_DEF_REFR_PERIOD;
+        return false;
+    }
+
+    bool wait = vsync_cnt - disp->vsync_cnt_refr < disp->pacing_div;
+
+    /*Missed the start of the vsync period (e.g. the previous frame was slow), skip to the next vsync*/
+    if(!wait && disp->vsync_period && lv_tick_elaps(disp->vsync_time) * 16 > disp->vsync_period / 2) wait = true;
+
+    if(wait) {
+        lv_timer_set_period(disp->refr_timer, 1);
+        return true;
+    }
+
+    disp->vsync_cnt_refr = vsync_cnt;
+    return false;
+}
+
+/**
+ * Add the time of a frame to the statistics and adapt the period of the frames to the average frame time.
+ * The period is a multiple of the vsync period (or the base period without vsync) to have a steady frame rate.
+ * @param disp      pointer to the refreshed display
+ * @param time      render and flush time of the frame [ms]
+ */
+static void frame_pacing_update(lv_disp_t * disp, uint32_t time)
+{
+    lv_disp_frame_stats_t * stats = &disp->frame_stats;
+    stats->frame_cnt++;
+    stats->hist[LV_MIN(time, LV_FRAME_PACING_HIST_SIZE - 1)]++;
+    if(time > stats->frame_time_max) stats->frame_time_max = time;
+
+    if(disp->pacing_time_avg == 0) disp->pacing_time_avg = time * 16;
+    else disp->pacing_time_avg = (disp->pacing_time_avg * 7 + time * 16) / 8;
+
+    /*The length of a slot in 1/16 ms*/
+    bool vsync = disp->vsync_cnt && disp->vsync_period;
+    uint32_t slot;
+    if(vsync) {
+        slot = disp->vsync_period;
+    }
+    else {
+        if(disp->pacing_base_period == 0) {
+            disp->pacing_base_period = disp->refr_timer ? disp->refr_timer->period : LV_DISP_DEF_REFR_PERIOD;
+        }
+        slot = LV_MAX(disp->pacing_base_period, 1) * 16;
+    }
+
+    /*The slots missed while this frame was rendered*/
+    uint32_t period = slot * disp->pacing_div;
+    if(time * 16 > period) stats->skip_cnt += (time * 16 - 1) / period;
+
+    /*Use as many slots as a frame needs. Go faster only with a margin to not alternate between two periods.*/
+    uint32_t div = (disp->pacing_time_avg + slot - 1) / slot;
+    if(div == 0) div = 1;
+    if(div < disp->pacing_div && disp->pacing_time_avg * 8 > div * slot * 7) div++;
+    disp->pacing_div = div;
+    stats->period = (slot * div + 8) / 16;
+
+    if(disp->refr_timer == NULL) return;
+
+    /*The timer runs from the start of the frame. With vsync wake up a little earlier and wait for the signal.*/
+    if(vsync) lv_timer_set_period(disp->refr_timer, stats->period > 1 ? stats->period - 1 : 1);
+    else lv_timer_set_period(disp->refr_timer, stats->period);
+}
+#endif
+
 #if LV_USE_PERF_MONITOR
 static void perf_monitor_init(perf_monitor_t * _perf_monitor)
 {
@@ -1259,4 +2587,3 @@ static void mem_monitor_init(mem_monitor_t * _mem_monitor)
     _mem_monitor->mem_label = NULL;
 }
 #endif
-
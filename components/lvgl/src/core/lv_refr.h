@@ -22,10 +22,46 @@ extern "C" {
 
 #define LV_REFR_TASK_PRIO LV_TASK_PRIO_MID
 
+#if LV_USE_REFR_CTX
+    #define _LV_REFR_CTX_LOCK()     _lv_refr_ctx_lock()
+    #define _LV_REFR_CTX_UNLOCK()   _lv_refr_ctx_unlock()
+#else
+    #define _LV_REFR_CTX_LOCK()     do {} while(0)
+    #define _LV_REFR_CTX_UNLOCK()   do {} while(0)
+#endif
+
+/*A global root, or its copy in the render context of the calling thread with `LV_USE_REFR_CTX`*/
+#if LV_USE_REFR_CTX
+    #define _LV_REFR_CTX_ROOT(ctx_field, gc_root)   (_lv_refr_ctx_get_act()->ctx_field)
+#else
+    #define _LV_REFR_CTX_ROOT(ctx_field, gc_root)   LV_GC_ROOT(gc_root)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_REFR_CTX
+/**
+ * The state of refreshing a display which was global without `LV_USE_REFR_CTX`.
+ * Every display has its own, and `lv_refr_disp()` selects it for the calling thread.
+ * Drawing outside of a refresh (e.g. on a canvas) uses a common context.
+ */
+typedef struct _lv_refr_ctx_t {
+    lv_disp_t * disp;               /*The display being refreshed*/
+    uint32_t px_num;                /*Number of pixels refreshed in the current refresh*/
+    lv_mem_buf_arr_t mem_buf;       /*The buffers of `lv_mem_buf_get()`*/
+#if LV_DRAW_COMPLEX
+    _lv_draw_mask_saved_arr_t mask_list;
+    _lv_draw_mask_radius_circle_dsc_arr_t circle_cache;
+#endif
+#if LV_USE_FONT_COMPRESSED
+    uint8_t * font_decompr_buf;
+    uint32_t font_decompr_buf_size;
+#endif
+} _lv_refr_ctx_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -56,6 +92,14 @@ void _lv_refr_init(void);
  */
 void lv_refr_now(lv_disp_t * disp);
 
+/**
+ * Redraw the invalidated areas of a display now without handling the animations and timers.
+ * With `LV_USE_REFR_CTX` different displays can be refreshed concurrently by calling it from different threads,
+ * while the rest of LVGL (e.g. `lv_timer_handler()`) is not running.
+ * @param disp pointer to display to refresh
+ */
+void lv_refr_disp(lv_disp_t * disp);
+
 /**
  * Redrawn on object an all its children using the passed draw context
  * @param draw  pointer to an initialized draw context
@@ -85,6 +129,147 @@ lv_disp_t * _lv_refr_get_disp_refreshing(void);
  */
 void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 
+#if LV_USE_REFR_CTX
+/**
+ * Get the render context of the calling thread
+ * @return the context of the display being refreshed on this thread or the common context
+ */
+_lv_refr_ctx_t * _lv_refr_ctx_get_act(void);
+
+/**
+ * Create the render context of a display
+ * @param disp  pointer to a display
+ */
+void _lv_refr_ctx_create(lv_disp_t * disp);
+
+/**
+ * Free the render context of a display with its buffers
+ * @param disp  pointer to a display
+ */
+void _lv_refr_ctx_delete(lv_disp_t * disp);
+
+/**
+ * Lock the caches shared by the displays (images, gradients, layers). It can be called recursively.
+ */
+void _lv_refr_ctx_lock(void);
+
+/**
+ * Unlock the caches shared by the displays
+ */
+void _lv_refr_ctx_unlock(void);
+#endif
+
+#if LV_USE_REFR_REGION
+/**
+ * Get the statistics about the invalidated and redrawn areas of a display
+ * @param disp  pointer to a display (NULL: the default display)
+ * @return      pointer to the statistics, NULL if there is no display
+ */
+const lv_disp_inv_stats_t * lv_refr_get_inv_stats(lv_disp_t * disp);
+
+/**
+ * Clear the statistics about the invalidated and redrawn areas of a display
+ * @param disp  pointer to a display (NULL: the default display)
+ */
+void lv_refr_reset_inv_stats(lv_disp_t * disp);
+#endif
+
+#if LV_USE_FRAME_PACING
+/**
+ * Get the statistics about the frame times of a display
+ * @param disp  pointer to a display (NULL: the default display)
+ * @return      pointer to the statistics, NULL if there is no display
+ */
+const lv_disp_frame_stats_t * lv_refr_get_frame_stats(lv_disp_t * disp);
+
+/**
+ * Clear the statistics about the frame times of a display. The current period is kept.
+ * @param disp  pointer to a display (NULL: the default display)
+ */
+void lv_refr_reset_frame_stats(lv_disp_t * disp);
+#endif
+
+#if LV_USE_REFR_OCCLUSION
+/**
+ * Enable or disable skipping the covered objects. Useful to compare the statistics with and without it.
+ * @param en        true: skip the covered objects (default); false: draw every object
+ */
+void lv_refr_set_occlusion_culling(bool en);
+
+/**
+ * Get the statistics about the drawn and skipped objects of a display
+ * @param disp  pointer to a display (NULL: the default display)
+ * @return      pointer to the statistics, NULL if there is no display
+ */
+const lv_disp_draw_stats_t * lv_refr_get_draw_stats(lv_disp_t * disp);
+
+/**
+ * Clear the statistics about the drawn and skipped objects of a display
+ * @param disp  pointer to a display (NULL: the default display)
+ */
+void lv_refr_reset_draw_stats(lv_disp_t * disp);
+#endif
+
+#if LV_USE_DRAW_LIST
+/**
+ * Enable or disable replaying the recorded draw calls of the unchanged objects
+ * @param en        true: replay the recorded draw calls (default); false: always send the draw events
+ */
+void lv_refr_set_draw_list(bool en);
+#endif
+
+#if LV_USE_SCROLL_COPY
+/**
+ * Enable or disable drawing the scrolling by moving the rendered pixels
+ * @param en        true: move the pixels when possible (default); false: always redraw the scrolled object
+ */
+void lv_refr_set_scroll_copy(bool en);
+
+/**
+ * Get the statistics about the scroll steps drawn by moving the pixels
+ * @param disp  pointer to a display (NULL: the default display)
+ * @return      pointer to the statistics, NULL if there is no display
+ */
+const lv_disp_scroll_copy_stats_t * lv_refr_get_scroll_copy_stats(lv_disp_t * disp);
+
+/**
+ * Clear the statistics about the scroll steps drawn by moving the pixels
+ * @param disp  pointer to a display (NULL: the default display)
+ */
+void lv_refr_reset_scroll_copy_stats(lv_disp_t * disp);
+
+/**
+ * Check whether the display and the style of an object allow drawing its scrolling by moving the pixels.
+ * Used internally before scrolling.
+ * @param obj       pointer to an object to scroll
+ * @return          true: `_lv_refr_scroll_copy()` can be tried
+ */
+bool _lv_refr_scroll_copy_is_possible(lv_obj_t * obj);
+
+/**
+ * Move the rendered pixels of a scrolled object in the next refresh and invalidate only the newly visible parts.
+ * Used internally after the children were moved.
+ * @param obj       pointer to the scrolled object
+ * @param x         the horizontal scroll offset
+ * @param y         the vertical scroll offset
+ * @param sb_old    the horizontal and vertical scrollbar areas before scrolling
+ * @return          true: the pixels will be moved; false: the object needs to be invalidated
+ */
+bool _lv_refr_scroll_copy(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, const lv_area_t sb_old[2]);
+#endif
+
+#if LV_USE_LAYER_CACHE
+/**
+ * Render the next rows of an object's cached layer outside of the refresh, e.g. to preload a screen.
+ * Start again if the object was changed since the previous step.
+ * @param disp      pointer to the display of the object
+ * @param obj       pointer to an object with layer cache
+ * @param row_cnt   number of rows to render in this step
+ * @return          true: the layer is rendered or it can't be rendered; false: call it again
+ */
+bool _lv_refr_layer_cache_step(lv_disp_t * disp, lv_obj_t * obj, lv_coord_t row_cnt);
+#endif
+
 #if LV_USE_PERF_MONITOR
 /**
  * Reset FPS counter
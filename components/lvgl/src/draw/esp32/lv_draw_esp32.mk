@@ -0,0 +1,6 @@
+CSRCS += lv_gpu_esp32_pie.c
+
+DEPPATH += --dep-path $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/esp32
+VPATH += :$(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/esp32
+
+CFLAGS += "-I$(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/esp32"
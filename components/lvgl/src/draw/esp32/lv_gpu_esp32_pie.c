@@ -0,0 +1,383 @@
+/**
+ * @file lv_gpu_esp32_pie.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_gpu_esp32_pie.h"
+#include "../../core/lv_refr.h"
+
+#if LV_USE_GPU_ESP32_PIE
+
+/*********************
+ *      DEFINES
+ *********************/
+/*16 bit pixels in a 128 bit register*/
+#define PIE_PX_CNT      8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_COLOR_DEPTH == 16
+    LV_ATTRIBUTE_FAST_MEM static void lv_draw_esp32_pie_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+    LV_ATTRIBUTE_FAST_MEM static bool fill_normal(uint16_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
+                                                  lv_color_t color, lv_opa_t opa, const lv_opa_t * mask, lv_coord_t mask_stride);
+    LV_ATTRIBUTE_FAST_MEM static bool map_normal(uint16_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
+                                                 const uint16_t * src_buf, lv_coord_t src_stride, lv_opa_t opa,
+                                                 const lv_opa_t * mask, lv_coord_t mask_stride);
+#endif
+
+LV_ATTRIBUTE_FAST_MEM static void fill_kernel(uint16_t * dest, const uint16_t * color, uint32_t blk_cnt);
+LV_ATTRIBUTE_FAST_MEM static void copy_kernel(uint16_t * dest, const uint16_t * src, uint32_t blk_cnt);
+LV_ATTRIBUTE_FAST_MEM static void mix_kernel(uint16_t * dest, const uint16_t * src, const uint16_t * color,
+                                             const uint16_t * alpha, uint32_t blk_cnt, uint16_t round);
+static inline uint16_t mix_lane(uint16_t fg, uint16_t bg, uint16_t alpha, uint16_t round);
+static inline uint16_t mix_channel(uint16_t fg, uint16_t bg, uint16_t alpha, uint16_t alpha_inv, uint16_t round);
+static inline uint16_t vmul_u16(uint16_t a, uint16_t b, uint32_t sar);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static bool use_reference;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_esp32_pie_ctx_init(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
+{
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+
+#if LV_COLOR_DEPTH == 16
+    lv_draw_esp32_pie_ctx_t * pie_draw_ctx = (lv_draw_sw_ctx_t *)draw_ctx;
+    pie_draw_ctx->blend = lv_draw_esp32_pie_blend;
+#endif
+}
+
+void lv_draw_esp32_pie_ctx_deinit(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
+{
+    lv_draw_sw_deinit_ctx(drv, draw_ctx);
+}
+
+void lv_draw_esp32_pie_set_reference(bool en)
+{
+    use_reference = en;
+}
+
+/**
+ * Fill a row of 16 bit pixels with a color.
+ * @param dest      pointer to the first pixel of the row
+ * @param color     the color as it's stored in the buffer
+ * @param len       number of pixels
+ */
+LV_ATTRIBUTE_FAST_MEM void _lv_esp32_pie_fill_row(uint16_t * dest, uint16_t color, int32_t len)
+{
+    /*The stores need 16 byte aligned addresses*/
+    for(; len > 0 && ((lv_uintptr_t)dest & 0xF); len--) *dest++ = color;
+
+    int32_t blk_cnt = len / PIE_PX_CNT;
+    if(blk_cnt) {
+        fill_kernel(dest, &color, blk_cnt);
+        dest += blk_cnt * PIE_PX_CNT;
+        len -= blk_cnt * PIE_PX_CNT;
+    }
+
+    for(; len > 0; len--) *dest++ = color;
+}
+
+/**
+ * Copy a row of 16 bit pixels.
+ * @param dest      pointer to the first pixel of the destination row
+ * @param src       pointer to the first pixel of the source row
+ * @param len       number of pixels
+ */
+LV_ATTRIBUTE_FAST_MEM void _lv_esp32_pie_copy_row(uint16_t * dest, const uint16_t * src, int32_t len)
+{
+    for(; len > 0 && ((lv_uintptr_t)dest & 0xF); len--) *dest++ = *src++;
+
+    /*The unaligned loads read 16 bytes ahead so leave the last pixels for the C code*/
+    int32_t blk_cnt = len > PIE_PX_CNT ? (len - PIE_PX_CNT) / PIE_PX_CNT : 0;
+    if(blk_cnt) {
+        copy_kernel(dest, src, blk_cnt);
+        dest += blk_cnt * PIE_PX_CNT;
+        src += blk_cnt * PIE_PX_CNT;
+        len -= blk_cnt * PIE_PX_CNT;
+    }
+
+    if(len > 0) lv_memcpy(dest, src, len * sizeof(uint16_t));
+}
+
+/**
+ * Mix a row of byte swapped RGB565 pixels with a color or with an other row,
+ * with the same per channel algorithm as `lv_color_mix()`.
+ * @param dest      pointer to the first pixel of the destination (background) row
+ * @param src       pointer to the first pixel of the source (foreground) row or NULL to mix with `color`
+ * @param color     the foreground color if `src == NULL`
+ * @param alpha     opacity (0..255) of each foreground pixel
+ * @param len       number of pixels
+ * @param round     rounding offset, `LV_COLOR_MIX_ROUND_OFS`
+ */
+LV_ATTRIBUTE_FAST_MEM void _lv_esp32_pie_mix_row(uint16_t * dest, const uint16_t * src, uint16_t color,
+                                                 const uint16_t * alpha, int32_t len, uint16_t round)
+{
+    int32_t blk_cnt;
+    int32_t x = 0;
+
+    for(; x < len && ((lv_uintptr_t)&dest[x] & 0xF); x++) {
+        dest[x] = mix_lane(src ? src[x] : color, dest[x], alpha[x], round);
+    }
+
+    blk_cnt = len - x > PIE_PX_CNT ? (len - x - PIE_PX_CNT) / PIE_PX_CNT : 0;
+    if(blk_cnt) {
+        mix_kernel(&dest[x], src ? &src[x] : NULL, &color, &alpha[x], blk_cnt, round);
+        x += blk_cnt * PIE_PX_CNT;
+    }
+
+    for(; x < len; x++) {
+        dest[x] = mix_lane(src ? src[x] : color, dest[x], alpha[x], round);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_COLOR_DEPTH == 16
+LV_ATTRIBUTE_FAST_MEM static void lv_draw_esp32_pie_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    const lv_opa_t * mask;
+    if(dsc->mask_buf == NULL) mask = NULL;
+    if(dsc->mask_buf && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) return;
+    else if(dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) mask = NULL;
+    else mask = dsc->mask_buf;
+
+    lv_coord_t dest_stride = lv_area_get_width(draw_ctx->buf_area);
+
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) return;
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+
+    bool is_accelerated = false;
+    do {
+        if(!use_reference) break;
+        if(dsc->blend_mode != LV_BLEND_MODE_NORMAL) break;
+        if(disp->driver->set_px_cb || disp->driver->screen_transp) break;
+        /*The software renderer rounds the mask in place without anti-aliasing*/
+        if(mask && disp->driver->antialiasing == 0) break;
+
+        uint16_t * dest_buf = (uint16_t *)draw_ctx->buf;
+        dest_buf += dest_stride * (blend_area.y1 - draw_ctx->buf_area->y1) + (blend_area.x1 - draw_ctx->buf_area->x1);
+
+        const uint16_t * src_buf = (const uint16_t *)dsc->src_buf;
+        lv_coord_t src_stride;
+        if(src_buf) {
+            src_stride = lv_area_get_width(dsc->blend_area);
+            src_buf += src_stride * (blend_area.y1 - dsc->blend_area->y1) + (blend_area.x1 - dsc->blend_area->x1);
+        }
+        else {
+            src_stride = 0;
+        }
+
+        lv_coord_t mask_stride;
+        if(mask) {
+            mask_stride = lv_area_get_width(dsc->mask_area);
+            mask += mask_stride * (blend_area.y1 - dsc->mask_area->y1) + (blend_area.x1 - dsc->mask_area->x1);
+        }
+        else {
+            mask_stride = 0;
+        }
+
+        if(src_buf == NULL) {
+            is_accelerated = fill_normal(dest_buf, &blend_area, dest_stride, dsc->color, dsc->opa, mask, mask_stride);
+        }
+        else {
+            is_accelerated = map_normal(dest_buf, &blend_area, dest_stride, src_buf, src_stride, dsc->opa, mask, mask_stride);
+        }
+    } while(0);
+
+    if(!is_accelerated) lv_draw_sw_blend_basic(draw_ctx, dsc);
+}
+
+/*The `alpha` values below give the same result as the corresponding cases of the software renderer*/
+
+LV_ATTRIBUTE_FAST_MEM static bool fill_normal(uint16_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
+                                              lv_color_t color, lv_opa_t opa, const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    int32_t w = lv_area_get_width(dest_area);
+    int32_t h = lv_area_get_height(dest_area);
+    int32_t x;
+    int32_t y;
+
+    if(mask == NULL && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            _lv_esp32_pie_fill_row(dest_buf, color.full, w);
+            dest_buf += dest_stride;
+        }
+        return true;
+    }
+
+#if LV_COLOR_16_SWAP
+    /*With LV_COLOR_MIX_ROUND_OFS == 0 the software renderer rounds the opacity of not masked fills*/
+    if(mask == NULL && LV_COLOR_MIX_ROUND_OFS == 0) return false;
+
+    uint16_t * alpha = lv_mem_buf_get(w * sizeof(uint16_t));
+    if(alpha == NULL) return false;
+
+    if(mask == NULL) {
+        for(x = 0; x < w; x++) alpha[x] = opa;
+    }
+
+    for(y = 0; y < h; y++) {
+        if(mask) {
+            for(x = 0; x < w; x++) {
+                if(opa >= LV_OPA_MAX) alpha[x] = mask[x];
+                else alpha[x] = mask[x] == LV_OPA_COVER ? opa : ((uint32_t)mask[x] * opa) >> 8;
+            }
+            mask += mask_stride;
+        }
+        _lv_esp32_pie_mix_row(dest_buf, NULL, color.full, alpha, w, LV_COLOR_MIX_ROUND_OFS);
+        dest_buf += dest_stride;
+    }
+
+    lv_mem_buf_release(alpha);
+    return true;
+#else
+    /*lv_color_mix() uses a 32 bit algorithm without swap but PIE has only 8 and 16 bit multiplications*/
+    LV_UNUSED(x);
+    LV_UNUSED(mask_stride);
+    return false;
+#endif
+}
+
+LV_ATTRIBUTE_FAST_MEM static bool map_normal(uint16_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
+                                             const uint16_t * src_buf, lv_coord_t src_stride, lv_opa_t opa,
+                                             const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    int32_t w = lv_area_get_width(dest_area);
+    int32_t h = lv_area_get_height(dest_area);
+    int32_t x;
+    int32_t y;
+
+    if(mask == NULL && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            _lv_esp32_pie_copy_row(dest_buf, src_buf, w);
+            dest_buf += dest_stride;
+            src_buf += src_stride;
+        }
+        return true;
+    }
+
+#if LV_COLOR_16_SWAP
+    uint16_t * alpha = lv_mem_buf_get(w * sizeof(uint16_t));
+    if(alpha == NULL) return false;
+
+    if(mask == NULL) {
+        for(x = 0; x < w; x++) alpha[x] = opa;
+    }
+
+    for(y = 0; y < h; y++) {
+        if(mask) {
+            for(x = 0; x < w; x++) {
+                if(opa > LV_OPA_MAX) alpha[x] = mask[x];
+                else alpha[x] = mask[x] >= LV_OPA_MAX ? opa : ((uint32_t)mask[x] * opa) >> 8;
+            }
+            mask += mask_stride;
+        }
+        _lv_esp32_pie_mix_row(dest_buf, src_buf, 0, alpha, w, LV_COLOR_MIX_ROUND_OFS);
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+
+    lv_mem_buf_release(alpha);
+    return true;
+#else
+    LV_UNUSED(x);
+    LV_UNUSED(mask_stride);
+    return false;
+#endif
+}
+#endif /*LV_COLOR_DEPTH == 16*/
+
+/*The C reference of the PIE kernels. They process the same 128 bit blocks as the PIE code will.*/
+
+LV_ATTRIBUTE_FAST_MEM static void fill_kernel(uint16_t * dest, const uint16_t * color, uint32_t blk_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < blk_cnt * PIE_PX_CNT; i++) dest[i] = *color;
+}
+
+LV_ATTRIBUTE_FAST_MEM static void copy_kernel(uint16_t * dest, const uint16_t * src, uint32_t blk_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < blk_cnt * PIE_PX_CNT; i++) dest[i] = src[i];
+}
+
+LV_ATTRIBUTE_FAST_MEM static void mix_kernel(uint16_t * dest, const uint16_t * src, const uint16_t * color,
+                                             const uint16_t * alpha, uint32_t blk_cnt, uint16_t round)
+{
+    uint32_t i;
+    for(i = 0; i < blk_cnt * PIE_PX_CNT; i++) {
+        dest[i] = mix_lane(src ? src[i] : *color, dest[i], alpha[i], round);
+    }
+}
+
+/**
+ * A lane of the mix kernel with the operations PIE has: 16 bit multiplications shifted by SAR, AND and OR.
+ * The high 3 bits of green are the lowest bits of the pixel, its low 3 bits are the highest.
+ */
+static inline uint16_t mix_lane(uint16_t fg, uint16_t bg, uint16_t alpha, uint16_t round)
+{
+    uint16_t alpha_inv = 255 - alpha;
+    uint16_t fg_ch;
+    uint16_t bg_ch;
+    uint16_t ch;
+    uint16_t res;
+
+    fg_ch = vmul_u16(fg & 0x7, 8, 0) | vmul_u16(fg, 8, 16);
+    bg_ch = vmul_u16(bg & 0x7, 8, 0) | vmul_u16(bg, 8, 16);
+    ch = mix_channel(fg_ch, bg_ch, alpha, alpha_inv, round);
+    res = vmul_u16(ch, 0x2000, 16) | vmul_u16(ch & 0x7, 0x2000, 0);
+
+    fg_ch = vmul_u16(fg, 0x2000, 16) & 0x1F;
+    bg_ch = vmul_u16(bg, 0x2000, 16) & 0x1F;
+    ch = mix_channel(fg_ch, bg_ch, alpha, alpha_inv, round);
+    res |= vmul_u16(ch, 8, 0);
+
+    fg_ch = vmul_u16(fg, 0x100, 16) & 0x1F;
+    bg_ch = vmul_u16(bg, 0x100, 16) & 0x1F;
+    ch = mix_channel(fg_ch, bg_ch, alpha, alpha_inv, round);
+    res |= vmul_u16(ch, 0x100, 0);
+
+    return res;
+}
+
+/**
+ * `LV_UDIV255(fg * alpha + bg * alpha_inv + round)` as two 16 bit multiplications.
+ * The sums are less than 0x8000 so the saturating additions of PIE don't saturate.
+ */
+static inline uint16_t mix_channel(uint16_t fg, uint16_t bg, uint16_t alpha, uint16_t alpha_inv, uint16_t round)
+{
+    uint16_t sum = vmul_u16(fg, alpha, 0) + vmul_u16(bg, alpha_inv, 0) + round;
+    return vmul_u16(vmul_u16(sum, 0x8081, 16), 0x200, 16);
+}
+
+/**
+ * `ee.vmul.u16` on a lane: the product is shifted right by SAR and truncated to 16 bit
+ */
+static inline uint16_t vmul_u16(uint16_t a, uint16_t b, uint32_t sar)
+{
+    return (uint16_t)(((uint32_t)a * b) >> sar);
+}
+
+#endif /*LV_USE_GPU_ESP32_PIE*/
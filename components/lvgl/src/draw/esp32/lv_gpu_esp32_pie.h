@@ -0,0 +1,87 @@
+/**
+ * @file lv_gpu_esp32_pie.h
+ *
+ */
+
+#ifndef LV_GPU_ESP32_PIE_H
+#define LV_GPU_ESP32_PIE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../misc/lv_color.h"
+#include "../../hal/lv_hal_disp.h"
+#include "../sw/lv_draw_sw.h"
+
+#if LV_USE_GPU_ESP32_PIE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef lv_draw_sw_ctx_t lv_draw_esp32_pie_ctx_t;
+
+struct _lv_disp_drv_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+void lv_draw_esp32_pie_ctx_init(struct _lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx);
+
+void lv_draw_esp32_pie_ctx_deinit(struct _lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx);
+
+/**
+ * Blend with the C reference of the PIE kernels, e.g. to test the backend on a PC.
+ * The result is the same as the software renderer's but it's slower.
+ * @param en        true: use the C reference; false: fall back to the software renderer (default)
+ */
+void lv_draw_esp32_pie_set_reference(bool en);
+
+/**
+ * Fill a row of 16 bit pixels with a color.
+ * @param dest      pointer to the first pixel of the row
+ * @param color     the color as it's stored in the buffer
+ * @param len       number of pixels
+ */
+void _lv_esp32_pie_fill_row(uint16_t * dest, uint16_t color, int32_t len);
+
+/**
+ * Copy a row of 16 bit pixels.
+ * @param dest      pointer to the first pixel of the destination row
+ * @param src       pointer to the first pixel of the source row
+ * @param len       number of pixels
+ */
+void _lv_esp32_pie_copy_row(uint16_t * dest, const uint16_t * src, int32_t len);
+
+/**
+ * Mix a row of byte swapped RGB565 pixels with a color or with an other row,
+ * with the same per channel algorithm as `lv_color_mix()`.
+ * @param dest      pointer to the first pixel of the destination (background) row
+ * @param src       pointer to the first pixel of the source (foreground) row or NULL to mix with `color`
+ * @param color     the foreground color if `src == NULL`
+ * @param alpha     opacity (0..255) of each foreground pixel
+ * @param len       number of pixels
+ * @param round     rounding offset, `LV_COLOR_MIX_ROUND_OFS`
+ */
+void _lv_esp32_pie_mix_row(uint16_t * dest, const uint16_t * src, uint16_t color, const uint16_t * alpha,
+                           int32_t len, uint16_t round);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif  /*LV_USE_GPU_ESP32_PIE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_GPU_ESP32_PIE_H*/
@@ -39,7 +39,9 @@
 
 void lv_draw_init(void)
 {
-    /*Nothing to init now*/
+#if LV_USE_LAYER_CACHE
+    _lv_draw_layer_cache_init();
+#endif
 }
 
 void lv_draw_wait_for_finish(lv_draw_ctx_t * draw_ctx)
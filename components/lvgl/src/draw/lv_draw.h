@@ -29,6 +29,10 @@ extern "C" {
 #include "lv_draw_mask.h"
 #include "lv_draw_transform.h"
 #include "lv_draw_layer.h"
+#include "lv_draw_list.h"
+#include "lv_draw_layer_cache.h"
+#include "sw/lv_draw_sw_parallel.h"
+#include "sw/lv_draw_sw_blend_simd.h"
 
 /*********************
  *      DEFINES
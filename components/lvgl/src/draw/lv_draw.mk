@@ -3,10 +3,12 @@ CSRCS += lv_draw.c
 CSRCS += lv_draw_img.c
 CSRCS += lv_draw_label.c
 CSRCS += lv_draw_line.c
+CSRCS += lv_draw_list.c
 CSRCS += lv_draw_mask.c
 CSRCS += lv_draw_rect.c
 CSRCS += lv_draw_transform.c
 CSRCS += lv_draw_layer.c
+CSRCS += lv_draw_layer_cache.c
 CSRCS += lv_draw_triangle.c
 CSRCS += lv_img_buf.c
 CSRCS += lv_img_cache.c
@@ -18,6 +20,7 @@ VPATH += :$(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw
 CFLAGS += "-I$(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw"
 
 include $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/arm2d/lv_draw_arm2d.mk
+include $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/esp32/lv_draw_esp32.mk
 include $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/nxp/lv_draw_nxp.mk
 include $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/sdl/lv_draw_sdl.mk
 include $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/stm32_dma2d/lv_draw_stm32_dma2d.mk
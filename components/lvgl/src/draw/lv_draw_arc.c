@@ -48,8 +48,16 @@ void lv_draw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const
     if(dsc->width == 0) return;
     if(start_angle == end_angle) return;
 
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_arc(draw_ctx, dsc, center, radius, start_angle, end_angle);
+#endif
+
     draw_ctx->draw_arc(draw_ctx, dsc, center, radius, start_angle, end_angle);
 
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_end();
+#endif
+
     //    const lv_draw_backend_t * backend = lv_draw_backend_get();
     //    backend->draw_arc(center_x, center_y, radius, start_angle, end_angle, clip_area, dsc);
 }
@@ -28,6 +28,8 @@
 LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
                                                       const lv_area_t * coords, const void * src);
 
+static void draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const lv_area_t * coords,
+                     const void * src);
 static void show_error(lv_draw_ctx_t * draw_ctx, const lv_area_t * coords, const char * msg);
 static void draw_cleanup(_lv_img_cache_entry_t * cache);
 
@@ -61,27 +63,15 @@ void lv_draw_img_dsc_init(lv_draw_img_dsc_t * dsc)
  */
 void lv_draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const lv_area_t * coords, const void * src)
 {
-    if(src == NULL) {
-        LV_LOG_WARN("Image draw: src is NULL");
-        show_error(draw_ctx, coords, "No\ndata");
-        return;
-    }
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_img(draw_ctx, dsc, coords, src);
+#endif
 
-    if(dsc->opa <= LV_OPA_MIN) return;
+    draw_img(draw_ctx, dsc, coords, src);
 
-    lv_res_t res;
-    if(draw_ctx->draw_img) {
-        res = draw_ctx->draw_img(draw_ctx, dsc, coords, src);
-    }
-    else {
-        res = decode_and_draw(draw_ctx, dsc, coords, src);
-    }
-
-    if(res == LV_RES_INV) {
-        LV_LOG_WARN("Image draw error");
-        show_error(draw_ctx, coords, "No\ndata");
-        return;
-    }
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_end();
+#endif
 }
 
 /**
@@ -220,6 +210,9 @@ void lv_draw_img_decoded(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc
 {
     if(draw_ctx->draw_img_decoded == NULL) return;
 
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_unsupported();
+#endif
     draw_ctx->draw_img_decoded(draw_ctx, dsc, coords, map_p, color_format);
 }
 
@@ -227,6 +220,35 @@ void lv_draw_img_decoded(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc
  *   STATIC FUNCTIONS
  **********************/
 
+static void draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const lv_area_t * coords,
+                     const void * src)
+{
+    if(src == NULL) {
+        LV_LOG_WARN("Image draw: src is NULL");
+        show_error(draw_ctx, coords, "No\ndata");
+        return;
+    }
+
+    if(dsc->opa <= LV_OPA_MIN) return;
+
+    lv_res_t res;
+    if(draw_ctx->draw_img) {
+        res = draw_ctx->draw_img(draw_ctx, dsc, coords, src);
+    }
+    else {
+        /*The image cache is shared by the displays*/
+        _LV_REFR_CTX_LOCK();
+        res = decode_and_draw(draw_ctx, dsc, coords, src);
+        _LV_REFR_CTX_UNLOCK();
+    }
+
+    if(res == LV_RES_INV) {
+        LV_LOG_WARN("Image draw error");
+        show_error(draw_ctx, coords, "No\ndata");
+        return;
+    }
+}
+
 LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
                                                       const lv_area_t * coords, const void * src)
 {
@@ -34,6 +34,8 @@ typedef uint8_t cmd_state_t;
  *  STATIC PROTOTYPES
  **********************/
 
+LV_ATTRIBUTE_FAST_MEM static void draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                              const lv_area_t * coords, const char * txt, lv_draw_label_hint_t * hint);
 static uint8_t hex_char_to_num(char hex);
 
 /**********************
@@ -76,6 +78,34 @@ void lv_draw_label_dsc_init(lv_draw_label_dsc_t * dsc)
  */
 LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                          const lv_area_t * coords, const char * txt, lv_draw_label_hint_t * hint)
+{
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_label(draw_ctx, dsc, coords, txt);
+#endif
+
+    draw_label(draw_ctx, dsc, coords, txt, hint);
+
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_end();
+#endif
+}
+
+void lv_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,  const lv_point_t * pos_p,
+                    uint32_t letter)
+{
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_unsupported();
+#endif
+    draw_ctx->draw_letter(draw_ctx, dsc, pos_p, letter);
+}
+
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+LV_ATTRIBUTE_FAST_MEM static void draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                              const lv_area_t * coords, const char * txt, lv_draw_label_hint_t * hint)
 {
     if(dsc->opa <= LV_OPA_MIN) return;
     if(dsc->font == NULL) {
@@ -361,17 +391,6 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     LV_ASSERT_MEM_INTEGRITY();
 }
 
-void lv_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,  const lv_point_t * pos_p,
-                    uint32_t letter)
-{
-    draw_ctx->draw_letter(draw_ctx, dsc, pos_p, letter);
-}
-
-
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 /**
  * Convert a hexadecimal characters to a number (0..15)
  * @param hex Pointer to a hexadecimal character (0..9, A..F)
@@ -0,0 +1,171 @@
+/**
+ * @file lv_draw_layer_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_layer_cache.h"
+
+#if LV_USE_LAYER_CACHE
+
+#include "lv_img_cache.h"
+#include "../misc/lv_ll.h"
+#include "../misc/lv_gc.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_log.h"
+#include "../misc/lv_printf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _layer_ll LV_GC_ROOT(_lv_layer_cache_ll)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t get_buf_size(const lv_area_t * area, lv_img_cf_t cf);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_draw_layer_cache_stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_draw_layer_cache_init(void)
+{
+    /*The most recently used layer is the head*/
+    _lv_ll_init(&_layer_ll, sizeof(lv_draw_layer_cache_t));
+    lv_memset_00(&stats, sizeof(stats));
+}
+
+lv_draw_layer_cache_t * lv_draw_layer_cache_create(void)
+{
+    lv_draw_layer_cache_t * layer = _lv_ll_ins_head(&_layer_ll);
+    LV_ASSERT_MALLOC(layer);
+    if(layer == NULL) return NULL;
+
+    lv_memset_00(layer, sizeof(lv_draw_layer_cache_t));
+    return layer;
+}
+
+void lv_draw_layer_cache_delete(lv_draw_layer_cache_t * layer)
+{
+    lv_draw_layer_cache_free(layer);
+    _lv_ll_remove(&_layer_ll, layer);
+    lv_mem_free(layer);
+}
+
+bool lv_draw_layer_cache_alloc(lv_draw_layer_cache_t * layer, const lv_area_t * area, lv_img_cf_t cf)
+{
+    lv_draw_layer_cache_free(layer);
+
+    uint32_t size = get_buf_size(area, cf);
+    if(!layer->pinned) {
+        if(size > LV_LAYER_CACHE_SIZE) return false;
+
+        /*Free the least recently used layers until the new one fits*/
+        lv_draw_layer_cache_t * lru = _lv_ll_get_tail(&_layer_ll);
+        while(lru && stats.used_size + size > LV_LAYER_CACHE_SIZE) {
+            lv_draw_layer_cache_t * prev = _lv_ll_get_prev(&_layer_ll, lru);
+            if(lru->img.data && !lru->busy && !lru->pinned) {
+                lv_draw_layer_cache_free(lru);
+                stats.evict_cnt++;
+            }
+            lru = prev;
+        }
+        if(stats.used_size + size > LV_LAYER_CACHE_SIZE) return false;
+    }
+
+    void * buf = lv_mem_alloc(size);
+    if(buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate %"LV_PRIu32" bytes for a cached layer", size);
+        return false;
+    }
+
+    layer->img.data = buf;
+    layer->img.data_size = size;
+    layer->img.header.always_zero = 0;
+    layer->img.header.w = lv_area_get_width(area);
+    layer->img.header.h = lv_area_get_height(area);
+    layer->img.header.cf = cf;
+    layer->area = *area;
+    layer->valid = 0;
+    layer->partial = 0;
+    if(!layer->pinned) stats.used_size += size;
+    stats.render_cnt++;
+
+    _lv_ll_move_before(&_layer_ll, layer, _lv_ll_get_head(&_layer_ll));
+    return true;
+}
+
+void lv_draw_layer_cache_free(lv_draw_layer_cache_t * layer)
+{
+    if(layer->img.data == NULL) return;
+
+    /*The image decoder might have cached it*/
+    lv_img_cache_invalidate_src(&layer->img);
+
+    if(!layer->pinned) stats.used_size -= layer->img.data_size;
+    lv_mem_free((void *)layer->img.data);
+    layer->img.data = NULL;
+    layer->img.data_size = 0;
+    layer->valid = 0;
+    layer->partial = 0;
+}
+
+void lv_draw_layer_cache_set_pinned(lv_draw_layer_cache_t * layer, bool en)
+{
+    if(layer->pinned == en) return;
+
+    /*The pixels are counted in `used_size` only if not pinned.
+     *An unpinned layer might exceed the limit until the next allocation frees the least recently used ones.*/
+    if(layer->img.data) {
+        if(en) stats.used_size -= layer->img.data_size;
+        else stats.used_size += layer->img.data_size;
+    }
+    layer->pinned = en ? 1 : 0;
+}
+
+void lv_draw_layer_cache_touch(lv_draw_layer_cache_t * layer)
+{
+    _lv_ll_move_before(&_layer_ll, layer, _lv_ll_get_head(&_layer_ll));
+    stats.hit_cnt++;
+}
+
+const lv_draw_layer_cache_stats_t * lv_draw_layer_cache_get_stats(void)
+{
+    return &stats;
+}
+
+void lv_draw_layer_cache_reset_stats(void)
+{
+    stats.hit_cnt = 0;
+    stats.render_cnt = 0;
+    stats.evict_cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t get_buf_size(const lv_area_t * area, lv_img_cf_t cf)
+{
+    uint32_t px_size = cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    return lv_area_get_size(area) * px_size;
+}
+
+#endif /*LV_USE_LAYER_CACHE*/
@@ -0,0 +1,125 @@
+/**
+ * @file lv_draw_layer_cache.h
+ *
+ */
+
+#ifndef LV_DRAW_LAYER_CACHE_H
+#define LV_DRAW_LAYER_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_LAYER_CACHE
+
+#include "../misc/lv_area.h"
+#include "lv_img_buf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A rendered layer kept in the layer cache.
+ * The pixels are freed when the least recently used layers need to make room for a new one.
+ */
+typedef struct {
+    lv_img_dsc_t img;               /*The rendered layer. `img.data` is NULL if it was freed*/
+    lv_area_t area;                 /*Coordinates of the layer when it was rendered*/
+    uint8_t valid   : 1;            /*The pixels are up to date*/
+    uint8_t keep    : 1;            /*Ignore invalidations, e.g. while only the position changes*/
+    uint8_t busy    : 1;            /*Being rendered, so it can't be freed*/
+    uint8_t pinned  : 1;            /*Never freed to make room and not limited by `LV_LAYER_CACHE_SIZE`*/
+    uint8_t partial : 1;            /*Being rendered in several steps. Not drawn until it's finished.*/
+    lv_coord_t partial_y;           /*The next row to render if `partial`*/
+} lv_draw_layer_cache_t;
+
+typedef struct {
+    uint32_t hit_cnt;               /*Number of times a layer was drawn from the cache*/
+    uint32_t render_cnt;            /*Number of times a layer was rendered into the cache*/
+    uint32_t evict_cnt;             /*Number of times a layer was freed to make room*/
+    uint32_t used_size;             /*Currently used bytes, without the pinned layers*/
+} lv_draw_layer_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the layer cache
+ */
+void _lv_draw_layer_cache_init(void);
+
+/**
+ * Create a new, empty layer in the cache
+ * @return          pointer to the new layer or NULL if out of memory
+ */
+lv_draw_layer_cache_t * lv_draw_layer_cache_create(void);
+
+/**
+ * Free a layer and its pixels
+ * @param layer     pointer to a layer
+ */
+void lv_draw_layer_cache_delete(lv_draw_layer_cache_t * layer);
+
+/**
+ * Allocate the pixels of a layer. Free the least recently used layers if there is no room for it.
+ * The new pixels are not initialized and the layer is marked invalid.
+ * @param layer     pointer to a layer
+ * @param area      the area of the layer
+ * @param cf        `LV_IMG_CF_TRUE_COLOR` or `LV_IMG_CF_TRUE_COLOR_ALPHA`
+ * @return          true: the pixels are allocated; false: the layer can't fit into the cache
+ */
+bool lv_draw_layer_cache_alloc(lv_draw_layer_cache_t * layer, const lv_area_t * area, lv_img_cf_t cf);
+
+/**
+ * Free the pixels of a layer
+ * @param layer     pointer to a layer
+ */
+void lv_draw_layer_cache_free(lv_draw_layer_cache_t * layer);
+
+/**
+ * Pin a layer to keep its pixels until it's unpinned, e.g. a screen to load soon.
+ * The pinned layers are allocated outside of the `LV_LAYER_CACHE_SIZE` budget.
+ * @param layer     pointer to a layer
+ * @param en        true: pin; false: unpin
+ */
+void lv_draw_layer_cache_set_pinned(lv_draw_layer_cache_t * layer, bool en);
+
+/**
+ * Mark a layer as the most recently used when it's drawn from the cache
+ * @param layer     pointer to a layer
+ */
+void lv_draw_layer_cache_touch(lv_draw_layer_cache_t * layer);
+
+/**
+ * Get the statistics of the layer cache
+ * @return          pointer to the statistics
+ */
+const lv_draw_layer_cache_stats_t * lv_draw_layer_cache_get_stats(void);
+
+/**
+ * Reset the counters of the statistics (`used_size` is kept)
+ */
+void lv_draw_layer_cache_reset_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_LAYER_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_LAYER_CACHE_H*/
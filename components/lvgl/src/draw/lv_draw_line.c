@@ -48,7 +48,15 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_line(struct _lv_draw_ctx_t * draw_ctx, const
     if(dsc->width == 0) return;
     if(dsc->opa <= LV_OPA_MIN) return;
 
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_line(draw_ctx, dsc, point1, point2);
+#endif
+
     draw_ctx->draw_line(draw_ctx, dsc, point1, point2);
+
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_end();
+#endif
 }
 
 /**********************
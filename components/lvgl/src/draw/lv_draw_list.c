@@ -0,0 +1,292 @@
+/**
+ * @file lv_draw_list.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw.h"
+#include "lv_draw_list.h"
+
+#if LV_USE_DRAW_LIST
+
+#include <string.h>
+#include "../misc/lv_mem.h"
+#include "../misc/lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_DRAW_LIST_MAX_CMD < 1
+    #error "LV_DRAW_LIST_MAX_CMD must be at least 1"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_draw_list_cmd_t * rec_add(lv_draw_ctx_t * draw_ctx, lv_draw_list_cmd_type_t type);
+static void rec_fail(void);
+static void free_cmds(lv_draw_list_cmd_t * cmds, uint32_t cnt);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*The commands are collected here and copied to the list only if the recording succeeds*/
+static LV_REFR_CTX_THREAD_LOCAL lv_draw_list_cmd_t rec_cmds[LV_DRAW_LIST_MAX_CMD];
+static LV_REFR_CTX_THREAD_LOCAL uint32_t rec_cnt;
+static LV_REFR_CTX_THREAD_LOCAL lv_draw_list_t * rec_list;
+static LV_REFR_CTX_THREAD_LOCAL uint32_t rec_depth;          /*The draw functions calls each other, record only the outermost call*/
+static LV_REFR_CTX_THREAD_LOCAL uint8_t rec_mask_cnt;
+static LV_REFR_CTX_THREAD_LOCAL bool rec_failed;
+
+static lv_draw_list_stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_list_init(lv_draw_list_t * list)
+{
+    lv_memset_00(list, sizeof(lv_draw_list_t));
+}
+
+void lv_draw_list_clear(lv_draw_list_t * list)
+{
+    free_cmds(list->cmds, list->cnt);
+    lv_mem_free(list->cmds);
+    lv_draw_list_init(list);
+}
+
+void lv_draw_list_rec_start(lv_draw_list_t * list, const lv_area_t * coords, const lv_area_t * clip_area)
+{
+    LV_ASSERT_MSG(rec_list == NULL, "Already recording");
+
+    lv_draw_list_clear(list);
+    list->coords = *coords;
+    list->clip_area = *clip_area;
+    /*Set it now to see if the object is invalidated while it's drawn*/
+    list->valid = 1;
+
+    rec_list = list;
+    rec_cnt = 0;
+    rec_depth = 0;
+    rec_failed = false;
+    rec_mask_cnt = lv_draw_mask_get_cnt();
+}
+
+bool lv_draw_list_rec_stop(void)
+{
+    lv_draw_list_t * list = rec_list;
+    rec_list = NULL;
+    if(list == NULL) return false;
+
+    /*A mask was removed which might have affected the drawing*/
+    if(lv_draw_mask_get_cnt() != rec_mask_cnt) rec_failed = true;
+
+    if(rec_failed) {
+        free_cmds(rec_cmds, rec_cnt);
+        list->valid = 0;
+        list->uncacheable = 1;
+        stats.fail_cnt++;
+        return false;
+    }
+
+    if(rec_cnt) {
+        list->cmds = lv_mem_alloc(rec_cnt * sizeof(lv_draw_list_cmd_t));
+        LV_ASSERT_MALLOC(list->cmds);
+        if(list->cmds == NULL) {
+            free_cmds(rec_cmds, rec_cnt);
+            list->valid = 0;
+            return false;
+        }
+        lv_memcpy(list->cmds, rec_cmds, rec_cnt * sizeof(lv_draw_list_cmd_t));
+        list->cnt = rec_cnt;
+    }
+
+    stats.rec_cnt++;
+    return list->valid;
+}
+
+void lv_draw_list_replay(lv_draw_ctx_t * draw_ctx, const lv_draw_list_t * list)
+{
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    uint32_t i;
+    for(i = 0; i < list->cnt; i++) {
+        const lv_draw_list_cmd_t * cmd = &list->cmds[i];
+        lv_area_t clip_area;
+        if(!_lv_area_intersect(&clip_area, &cmd->clip_area, clip_area_ori)) continue;
+        draw_ctx->clip_area = &clip_area;
+
+        switch(cmd->type) {
+            case LV_DRAW_LIST_CMD_RECT:
+                lv_draw_rect(draw_ctx, &cmd->param.rect.dsc, &cmd->param.rect.coords);
+                break;
+            case LV_DRAW_LIST_CMD_LABEL:
+                lv_draw_label(draw_ctx, &cmd->param.label.dsc, &cmd->param.label.coords, cmd->param.label.txt, NULL);
+                break;
+            case LV_DRAW_LIST_CMD_IMG:
+                lv_draw_img(draw_ctx, &cmd->param.img.dsc, &cmd->param.img.coords, cmd->param.img.src);
+                break;
+            case LV_DRAW_LIST_CMD_LINE:
+                lv_draw_line(draw_ctx, &cmd->param.line.dsc, &cmd->param.line.point1, &cmd->param.line.point2);
+                break;
+            case LV_DRAW_LIST_CMD_ARC:
+                lv_draw_arc(draw_ctx, &cmd->param.arc.dsc, &cmd->param.arc.center, cmd->param.arc.radius,
+                            cmd->param.arc.start_angle, cmd->param.arc.end_angle);
+                break;
+            default:
+                break;
+        }
+    }
+
+    draw_ctx->clip_area = clip_area_ori;
+    stats.replay_cnt++;
+    stats.cmd_cnt += list->cnt;
+}
+
+const lv_draw_list_stats_t * lv_draw_list_get_stats(void)
+{
+    return &stats;
+}
+
+void lv_draw_list_reset_stats(void)
+{
+    lv_memset_00(&stats, sizeof(stats));
+}
+
+void _lv_draw_list_rec_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords)
+{
+    lv_draw_list_cmd_t * cmd = rec_add(draw_ctx, LV_DRAW_LIST_CMD_RECT);
+    if(cmd == NULL) return;
+
+    cmd->param.rect.dsc = *dsc;
+    cmd->param.rect.coords = *coords;
+}
+
+void _lv_draw_list_rec_label(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords,
+                             const char * txt)
+{
+    lv_draw_list_cmd_t * cmd = rec_add(draw_ctx, LV_DRAW_LIST_CMD_LABEL);
+    if(cmd == NULL) return;
+
+    cmd->param.label.dsc = *dsc;
+    cmd->param.label.coords = *coords;
+    cmd->param.label.txt = NULL;
+    if(txt) {
+        size_t len = strlen(txt) + 1;
+        cmd->param.label.txt = lv_mem_alloc(len);
+        LV_ASSERT_MALLOC(cmd->param.label.txt);
+        if(cmd->param.label.txt == NULL) {
+            rec_fail();
+            return;
+        }
+        lv_memcpy(cmd->param.label.txt, txt, len);
+    }
+}
+
+void _lv_draw_list_rec_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const lv_area_t * coords,
+                           const void * src)
+{
+    lv_draw_list_cmd_t * cmd = rec_add(draw_ctx, LV_DRAW_LIST_CMD_IMG);
+    if(cmd == NULL) return;
+
+    cmd->param.img.dsc = *dsc;
+    cmd->param.img.coords = *coords;
+    cmd->param.img.src = src;
+}
+
+void _lv_draw_list_rec_line(lv_draw_ctx_t * draw_ctx, const lv_draw_line_dsc_t * dsc, const lv_point_t * point1,
+                            const lv_point_t * point2)
+{
+    lv_draw_list_cmd_t * cmd = rec_add(draw_ctx, LV_DRAW_LIST_CMD_LINE);
+    if(cmd == NULL) return;
+
+    cmd->param.line.dsc = *dsc;
+    cmd->param.line.point1 = *point1;
+    cmd->param.line.point2 = *point2;
+}
+
+void _lv_draw_list_rec_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const lv_point_t * center,
+                           uint16_t radius, uint16_t start_angle, uint16_t end_angle)
+{
+    lv_draw_list_cmd_t * cmd = rec_add(draw_ctx, LV_DRAW_LIST_CMD_ARC);
+    if(cmd == NULL) return;
+
+    cmd->param.arc.dsc = *dsc;
+    cmd->param.arc.center = *center;
+    cmd->param.arc.radius = radius;
+    cmd->param.arc.start_angle = start_angle;
+    cmd->param.arc.end_angle = end_angle;
+}
+
+void _lv_draw_list_rec_end(void)
+{
+    if(rec_list == NULL) return;
+    rec_depth--;
+}
+
+void _lv_draw_list_rec_unsupported(void)
+{
+    if(rec_list == NULL) return;
+    if(rec_depth > 0) return;   /*Called by a recorded draw function*/
+    rec_fail();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Add a new command to the list being recorded
+ * @param draw_ctx  pointer to the draw context used for drawing
+ * @param type      type of the command
+ * @return          pointer to the new command or NULL if it shouldn't be recorded
+ */
+static lv_draw_list_cmd_t * rec_add(lv_draw_ctx_t * draw_ctx, lv_draw_list_cmd_type_t type)
+{
+    if(rec_list == NULL) return NULL;
+
+    rec_depth++;
+    if(rec_depth > 1) return NULL;
+    if(rec_failed) return NULL;
+
+    if(rec_cnt >= LV_DRAW_LIST_MAX_CMD) {
+        rec_fail();
+        return NULL;
+    }
+
+    lv_draw_list_cmd_t * cmd = &rec_cmds[rec_cnt];
+    rec_cnt++;
+    cmd->type = type;
+    cmd->clip_area = *draw_ctx->clip_area;
+    return cmd;
+}
+
+static void rec_fail(void)
+{
+    rec_failed = true;
+}
+
+/**
+ * Free the memory allocated for the commands, but not the array itself
+ * @param cmds      pointer to an array of commands
+ * @param cnt       number of commands
+ */
+static void free_cmds(lv_draw_list_cmd_t * cmds, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(cmds[i].type == LV_DRAW_LIST_CMD_LABEL) lv_mem_free(cmds[i].param.label.txt);
+    }
+}
+
+#endif /*LV_USE_DRAW_LIST*/
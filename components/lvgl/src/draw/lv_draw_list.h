@@ -0,0 +1,203 @@
+/**
+ * @file lv_draw_list.h
+ *
+ */
+
+#ifndef LV_DRAW_LIST_H
+#define LV_DRAW_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_DRAW_LIST
+
+#include "../misc/lv_area.h"
+#include "lv_draw_rect.h"
+#include "lv_draw_label.h"
+#include "lv_draw_img.h"
+#include "lv_draw_line.h"
+#include "lv_draw_arc.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_DRAW_LIST_CMD_RECT,
+    LV_DRAW_LIST_CMD_LABEL,
+    LV_DRAW_LIST_CMD_IMG,
+    LV_DRAW_LIST_CMD_LINE,
+    LV_DRAW_LIST_CMD_ARC,
+};
+
+typedef uint8_t lv_draw_list_cmd_type_t;
+
+/**
+ * A recorded call of an `lv_draw_...` function with a copy of its parameters
+ */
+typedef struct {
+    lv_area_t clip_area;            /*The clip area at the time of recording*/
+    lv_draw_list_cmd_type_t type;
+    union {
+        struct {
+            lv_draw_rect_dsc_t dsc;
+            lv_area_t coords;
+        } rect;
+        struct {
+            lv_draw_label_dsc_t dsc;
+            lv_area_t coords;
+            char * txt;             /*Copy of the text, the original might be a temporary buffer*/
+        } label;
+        struct {
+            lv_draw_img_dsc_t dsc;
+            lv_area_t coords;
+            const void * src;
+        } img;
+        struct {
+            lv_draw_line_dsc_t dsc;
+            lv_point_t point1;
+            lv_point_t point2;
+        } line;
+        struct {
+            lv_draw_arc_dsc_t dsc;
+            lv_point_t center;
+            uint16_t radius;
+            uint16_t start_angle;
+            uint16_t end_angle;
+        } arc;
+    } param;
+} lv_draw_list_cmd_t;
+
+/**
+ * The draw commands emitted while drawing a part of an object
+ */
+typedef struct _lv_draw_list_t {
+    lv_draw_list_cmd_t * cmds;
+    lv_area_t coords;               /*Coordinates of the object when the commands were recorded*/
+    lv_area_t clip_area;            /*The clip area when the commands were recorded*/
+    uint16_t cnt;
+    uint16_t valid      : 1;        /*The commands can be replayed*/
+    uint16_t uncacheable : 1;       /*Recording failed: draw normally until the next invalidation*/
+} lv_draw_list_t;
+
+typedef struct {
+    uint32_t rec_cnt;               /*Number of successful recordings*/
+    uint32_t fail_cnt;              /*Number of recordings failed because of an unsupported draw call*/
+    uint32_t replay_cnt;            /*Number of replayed command lists*/
+    uint32_t cmd_cnt;               /*Number of replayed commands*/
+} lv_draw_list_stats_t;
+
+struct _lv_draw_ctx_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a draw list
+ * @param list      pointer to a draw list
+ */
+void lv_draw_list_init(lv_draw_list_t * list);
+
+/**
+ * Free the commands of a draw list and mark it invalid
+ * @param list      pointer to a draw list
+ */
+void lv_draw_list_clear(lv_draw_list_t * list);
+
+/**
+ * Mark a draw list invalid to record it again on the next draw
+ * @param list      pointer to a draw list
+ */
+static inline void lv_draw_list_invalidate(lv_draw_list_t * list)
+{
+    list->valid = 0;
+    list->uncacheable = 0;
+}
+
+/**
+ * Tell if a draw list can be replayed instead of drawing an object again
+ * @param list      pointer to a draw list
+ * @param coords    the current coordinates of the object
+ * @param clip_area the area to draw now
+ * @return          true: the list can be replayed
+ */
+static inline bool lv_draw_list_is_valid(const lv_draw_list_t * list, const lv_area_t * coords,
+                                         const lv_area_t * clip_area)
+{
+    return list->valid && _lv_area_is_equal(&list->coords, coords) && _lv_area_is_in(clip_area, &list->clip_area, 0);
+}
+
+/**
+ * Start recording the `lv_draw_...` calls into a draw list.
+ * Only rectangles, labels, images, lines and arcs can be recorded.
+ * Any other draw call or adding a mask makes the list uncacheable.
+ * @param list      pointer to a draw list
+ * @param coords    the coordinates of the object to draw
+ * @param clip_area the area which will be drawn. The list can be replayed only inside this area.
+ */
+void lv_draw_list_rec_start(lv_draw_list_t * list, const lv_area_t * coords, const lv_area_t * clip_area);
+
+/**
+ * Stop recording the draw calls
+ * @return          true: the recorded list is valid
+ */
+bool lv_draw_list_rec_stop(void);
+
+/**
+ * Draw the commands of a draw list again
+ * @param draw_ctx  pointer to a draw context
+ * @param list      pointer to a valid draw list
+ */
+void lv_draw_list_replay(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_list_t * list);
+
+/**
+ * Get the statistics of recording and replaying
+ * @return          pointer to the statistics
+ */
+const lv_draw_list_stats_t * lv_draw_list_get_stats(void);
+
+/**
+ * Reset the statistics of recording and replaying
+ */
+void lv_draw_list_reset_stats(void);
+
+/*Called by the `lv_draw_...` functions. `_lv_draw_list_rec_end()` should follow every `_lv_draw_list_rec_...()`*/
+void _lv_draw_list_rec_rect(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc,
+                            const lv_area_t * coords);
+void _lv_draw_list_rec_label(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                             const lv_area_t * coords, const char * txt);
+void _lv_draw_list_rec_img(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc,
+                           const lv_area_t * coords, const void * src);
+void _lv_draw_list_rec_line(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_line_dsc_t * dsc,
+                            const lv_point_t * point1, const lv_point_t * point2);
+void _lv_draw_list_rec_arc(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc,
+                           const lv_point_t * center, uint16_t radius, uint16_t start_angle, uint16_t end_angle);
+void _lv_draw_list_rec_end(void);
+
+/**
+ * Make the recorded list uncacheable if a draw call can't be recorded, e.g. a mask is added
+ */
+void _lv_draw_list_rec_unsupported(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_LIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_LIST_H*/
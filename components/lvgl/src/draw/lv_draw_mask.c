@@ -12,12 +12,15 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_assert.h"
 #include "../misc/lv_gc.h"
+#include "../core/lv_refr.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define CIRCLE_CACHE_LIFE_MAX   1000
 #define CIRCLE_CACHE_AGING(life, r)   life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
+#define MASK_LIST       _LV_REFR_CTX_ROOT(mask_list, _lv_draw_mask_list)
+#define CIRCLE_CACHE    _LV_REFR_CTX_ROOT(circle_cache, _lv_circle_cache)
 
 /**********************
  *      TYPEDEFS
@@ -83,7 +86,7 @@ int16_t lv_draw_mask_add(void * param, void * custom_id)
     /*Look for a free entry*/
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).param == NULL) break;
+        if(MASK_LIST[i].param == NULL) break;
     }
 
     if(i >= _LV_MASK_MAX_NUM) {
@@ -91,8 +94,13 @@ int16_t lv_draw_mask_add(void * param, void * custom_id)
         return LV_MASK_ID_INV;
     }
 
-    LV_GC_ROOT(_lv_draw_mask_list[i]).param = param;
-    LV_GC_ROOT(_lv_draw_mask_list[i]).custom_id = custom_id;
+    MASK_LIST[i].param = param;
+    MASK_LIST[i].custom_id = custom_id;
+
+#if LV_USE_DRAW_LIST
+    /*The masks are not recorded, so what is drawn with this mask can't be replayed*/
+    _lv_draw_list_rec_unsupported();
+#endif
 
     return i;
 }
@@ -114,7 +122,7 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply(lv_opa_t * mask_buf,
     bool changed = false;
     _lv_draw_mask_common_dsc_t * dsc;
 
-    _lv_draw_mask_saved_t * m = LV_GC_ROOT(_lv_draw_mask_list);
+    _lv_draw_mask_saved_t * m = MASK_LIST;
 
     while(m->param) {
         dsc = m->param;
@@ -151,7 +159,7 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply_ids(lv_opa_t * mask_
     for(int i = 0; i < ids_count; i++) {
         int16_t id = ids[i];
         if(id == LV_MASK_ID_INV) continue;
-        dsc = LV_GC_ROOT(_lv_draw_mask_list[id]).param;
+        dsc = MASK_LIST[id].param;
         if(!dsc) continue;
         lv_draw_mask_res_t res = LV_DRAW_MASK_RES_FULL_COVER;
         res = dsc->cb(mask_buf, abs_x, abs_y, len, dsc);
@@ -173,9 +181,9 @@ void * lv_draw_mask_remove_id(int16_t id)
     _lv_draw_mask_common_dsc_t * p = NULL;
 
     if(id != LV_MASK_ID_INV) {
-        p = LV_GC_ROOT(_lv_draw_mask_list[id]).param;
-        LV_GC_ROOT(_lv_draw_mask_list[id]).param = NULL;
-        LV_GC_ROOT(_lv_draw_mask_list[id]).custom_id = NULL;
+        p = MASK_LIST[id].param;
+        MASK_LIST[id].param = NULL;
+        MASK_LIST[id].custom_id = NULL;
     }
 
     return p;
@@ -192,8 +200,8 @@ void * lv_draw_mask_remove_custom(void * custom_id)
     _lv_draw_mask_common_dsc_t * p = NULL;
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).custom_id == custom_id) {
-            p = LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+        if(MASK_LIST[i].custom_id == custom_id) {
+            p = MASK_LIST[i].param;
             lv_draw_mask_remove_id(i);
         }
     }
@@ -232,10 +240,10 @@ void _lv_draw_mask_cleanup(void)
 {
     uint8_t i;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) {
-            lv_mem_free(LV_GC_ROOT(_lv_circle_cache[i]).buf);
+        if(CIRCLE_CACHE[i].buf) {
+            lv_mem_free(CIRCLE_CACHE[i].buf);
         }
-        lv_memset_00(&LV_GC_ROOT(_lv_circle_cache[i]), sizeof(LV_GC_ROOT(_lv_circle_cache[i])));
+        lv_memset_00(&CIRCLE_CACHE[i], sizeof(CIRCLE_CACHE[i]));
     }
 }
 
@@ -248,21 +256,21 @@ LV_ATTRIBUTE_FAST_MEM uint8_t lv_draw_mask_get_cnt(void)
     uint8_t cnt = 0;
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).param) cnt++;
+        if(MASK_LIST[i].param) cnt++;
     }
     return cnt;
 }
 
 bool lv_draw_mask_is_any(const lv_area_t * a)
 {
-    if(a == NULL) return LV_GC_ROOT(_lv_draw_mask_list[0]).param ? true : false;
+    if(a == NULL) return MASK_LIST[0].param ? true : false;
 
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        _lv_draw_mask_common_dsc_t * comm_param = LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+        _lv_draw_mask_common_dsc_t * comm_param = MASK_LIST[i].param;
         if(comm_param == NULL) continue;
         if(comm_param->type == LV_DRAW_MASK_TYPE_RADIUS) {
-            lv_draw_mask_radius_param_t * radius_param = LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+            lv_draw_mask_radius_param_t * radius_param = MASK_LIST[i].param;
             if(radius_param->cfg.outer) {
                 if(!_lv_area_is_out(a, &radius_param->cfg.rect, radius_param->cfg.radius)) return true;
             }
@@ -494,10 +502,10 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
 
     /*Try to reuse a circle cache entry*/
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).radius == radius) {
-            LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
-            CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
-            param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(CIRCLE_CACHE[i].radius == radius) {
+            CIRCLE_CACHE[i].used_cnt++;
+            CIRCLE_CACHE_AGING(CIRCLE_CACHE[i].life, radius);
+            param->circle = &CIRCLE_CACHE[i];
             return;
         }
     }
@@ -505,9 +513,9 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
     /*If not found find a free entry with lowest life*/
     _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).used_cnt == 0) {
-            if(!entry) entry = &LV_GC_ROOT(_lv_circle_cache[i]);
-            else if(LV_GC_ROOT(_lv_circle_cache[i]).life < entry->life) entry = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(CIRCLE_CACHE[i].used_cnt == 0) {
+            if(!entry) entry = &CIRCLE_CACHE[i];
+            else if(CIRCLE_CACHE[i].life < entry->life) entry = &CIRCLE_CACHE[i];
         }
     }
 
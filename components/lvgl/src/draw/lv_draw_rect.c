@@ -63,8 +63,16 @@ void lv_draw_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, cons
 {
     if(lv_area_get_height(coords) < 1 || lv_area_get_width(coords) < 1) return;
 
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_rect(draw_ctx, dsc, coords);
+#endif
+
     draw_ctx->draw_rect(draw_ctx, dsc, coords);
 
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_end();
+#endif
+
     LV_ASSERT_MEM_INTEGRITY();
 }
 
@@ -38,12 +38,17 @@
 void lv_draw_polygon(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * draw_dsc, const lv_point_t points[],
                      uint16_t point_cnt)
 {
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_unsupported();
+#endif
     draw_ctx->draw_polygon(draw_ctx, draw_dsc, points, point_cnt);
 }
 
 void lv_draw_triangle(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * draw_dsc, const lv_point_t points[])
 {
-
+#if LV_USE_DRAW_LIST
+    _lv_draw_list_rec_unsupported();
+#endif
     draw_ctx->draw_polygon(draw_ctx, draw_dsc, points, 3);
 }
 
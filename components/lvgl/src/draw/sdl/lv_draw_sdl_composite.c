@@ -107,7 +107,7 @@ bool lv_draw_sdl_composite_begin(lv_draw_sdl_ctx_t * ctx, const lv_area_t * coor
     else if(has_mask) {
         /* Fallback mask handling. This will at least make bars looks less bad */
         for(uint8_t i = 0; i < _LV_MASK_MAX_NUM; i++) {
-            _lv_draw_mask_common_dsc_t * comm_param = LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+            _lv_draw_mask_common_dsc_t * comm_param = _LV_REFR_CTX_ROOT(mask_list, _lv_draw_mask_list)[i].param;
             if(comm_param == NULL) continue;
             switch(comm_param->type) {
                 case LV_DRAW_MASK_TYPE_RADIUS: {
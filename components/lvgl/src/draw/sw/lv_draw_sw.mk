@@ -10,6 +10,8 @@ CSRCS += lv_draw_sw_polygon.c
 CSRCS += lv_draw_sw_rect.c
 CSRCS += lv_draw_sw_transform.c
 CSRCS += lv_draw_sw_layer.c
+CSRCS += lv_draw_sw_parallel.c
+CSRCS += lv_draw_sw_blend_simd.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/sw
 VPATH += :$(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/sw
@@ -19,10 +19,26 @@
  *      TYPEDEFS
  **********************/
 
+/*An area to blend with the buffers already offset to its first pixel*/
+typedef struct {
+    lv_color_t * dest_buf;
+    lv_area_t blend_area;       /*Relative to the draw buffer*/
+    lv_coord_t dest_stride;
+    const lv_color_t * src_buf; /*NULL to fill with `color`*/
+    lv_coord_t src_stride;
+    const lv_opa_t * mask;
+    lv_coord_t mask_stride;
+    lv_color_t color;
+    lv_opa_t opa;
+    lv_blend_mode_t blend_mode;
+} blend_job_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+LV_ATTRIBUTE_FAST_MEM static void blend_rows(void * user_data, lv_coord_t y_ofs, lv_coord_t h);
+
 static void fill_set_px(lv_color_t * dest_buf, const lv_area_t * blend_area, lv_coord_t dest_stride,
                         lv_color_t color, lv_opa_t opa, const lv_opa_t * mask, lv_coord_t mask_stide);
 
@@ -179,31 +195,81 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_basic(lv_draw_ctx_t * draw_ctx, cons
         }
     }
 #endif
-    else if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(dsc->src_buf == NULL) {
-            fill_normal(dest_buf, &blend_area, dest_stride, dsc->color, dsc->opa, mask, mask_stride);
+    else {
+        blend_job_t job;
+        job.dest_buf = dest_buf;
+        job.blend_area = blend_area;
+        job.dest_stride = dest_stride;
+        job.src_buf = src_buf;
+        job.src_stride = src_stride;
+        job.mask = mask;
+        job.mask_stride = mask_stride;
+        job.color = dsc->color;
+        job.opa = dsc->opa;
+        job.blend_mode = dsc->blend_mode;
+
+#if LV_USE_DRAW_SW_PARALLEL
+        /*The rows are independent so large areas can be split among the render threads*/
+        if(lv_area_get_size(&blend_area) >= LV_DRAW_SW_PARALLEL_MIN_PX) {
+            lv_draw_sw_parallel_run(blend_rows, &job, lv_area_get_height(&blend_area));
+        }
+        else
+#endif
+        {
+            blend_rows(&job, 0, lv_area_get_height(&blend_area));
+        }
+    }
+}
+
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Blend `h` rows of a job starting from its `y_ofs`th row.
+ * Matches `lv_draw_sw_parallel_cb_t` so it can run on the render threads too.
+ */
+LV_ATTRIBUTE_FAST_MEM static void blend_rows(void * user_data, lv_coord_t y_ofs, lv_coord_t h)
+{
+    const blend_job_t * job = user_data;
+
+    lv_area_t area = job->blend_area;
+    area.y1 += y_ofs;
+    area.y2 = area.y1 + h - 1;
+
+    lv_color_t * dest_buf = job->dest_buf + (int32_t)job->dest_stride * y_ofs;
+    const lv_color_t * src_buf = job->src_buf ? job->src_buf + (int32_t)job->src_stride * y_ofs : NULL;
+    const lv_opa_t * mask = job->mask ? job->mask + (int32_t)job->mask_stride * y_ofs : NULL;
+
+#if LV_USE_DRAW_SW_SIMD
+    if(_lv_draw_sw_simd_blend(dest_buf, &area, job->dest_stride, src_buf, job->src_stride, job->color, job->opa,
+                              mask, job->mask_stride, job->blend_mode)) {
+        return;
+    }
+#endif
+
+    if(job->blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(src_buf == NULL) {
+            fill_normal(dest_buf, &area, job->dest_stride, job->color, job->opa, mask, job->mask_stride);
         }
         else {
-            map_normal(dest_buf, &blend_area, dest_stride, src_buf, src_stride, dsc->opa, mask, mask_stride);
+            map_normal(dest_buf, &area, job->dest_stride, src_buf, job->src_stride, job->opa, mask, job->mask_stride);
         }
     }
     else {
 #if LV_DRAW_COMPLEX
-        if(dsc->src_buf == NULL) {
-            fill_blended(dest_buf, &blend_area, dest_stride, dsc->color, dsc->opa, mask, mask_stride, dsc->blend_mode);
+        if(src_buf == NULL) {
+            fill_blended(dest_buf, &area, job->dest_stride, job->color, job->opa, mask, job->mask_stride, job->blend_mode);
         }
         else {
-            map_blended(dest_buf, &blend_area, dest_stride, src_buf, src_stride, dsc->opa, mask, mask_stride, dsc->blend_mode);
+            map_blended(dest_buf, &area, job->dest_stride, src_buf, job->src_stride, job->opa, mask, job->mask_stride,
+                        job->blend_mode);
         }
 #endif
     }
 }
 
-
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 static void fill_set_px(lv_color_t * dest_buf, const lv_area_t * blend_area, lv_coord_t dest_stride,
                         lv_color_t color, lv_opa_t opa, const lv_opa_t * mask, lv_coord_t mask_stide)
 {
@@ -401,10 +467,10 @@ static inline void set_px_argb(uint8_t * buf, lv_color_t color, lv_opa_t opa)
 static inline void set_px_argb_blend(uint8_t * buf, lv_color_t color, lv_opa_t opa, lv_color_t (*blend_fp)(lv_color_t,
                                                                                                            lv_color_t, lv_opa_t))
 {
-    static lv_color_t last_dest_color;
-    static lv_color_t last_src_color;
-    static lv_color_t last_res_color;
-    static uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
+    static LV_REFR_CTX_THREAD_LOCAL lv_color_t last_dest_color;
+    static LV_REFR_CTX_THREAD_LOCAL lv_color_t last_src_color;
+    static LV_REFR_CTX_THREAD_LOCAL lv_color_t last_res_color;
+    static LV_REFR_CTX_THREAD_LOCAL uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
 
     lv_color_t bg_color;
 
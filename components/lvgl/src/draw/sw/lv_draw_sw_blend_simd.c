@@ -0,0 +1,524 @@
+/**
+ * @file lv_draw_sw_blend_simd.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_simd.h"
+
+#if LV_USE_DRAW_SW_SIMD
+
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The color formats with kernels. `lv_color_mix()` is reproduced with its own algorithm at 16 bit*/
+#if LV_COLOR_DEPTH == 32 || (LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0 && LV_COLOR_MIX_ROUND_OFS == 0)
+    #define SIMD_COLOR_FORMAT   1
+#else
+    #define SIMD_COLOR_FORMAT   0
+#endif
+
+/*The x86 kernels are compiled with target attributes and selected by the CPU features at runtime*/
+#if SIMD_COLOR_FORMAT && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define SIMD_X86    1
+#else
+    #define SIMD_X86    0
+#endif
+
+/*NEON is part of the target (always available on AArch64)*/
+#if SIMD_COLOR_FORMAT && defined(__ARM_NEON)
+    #define SIMD_NEON   1
+#else
+    #define SIMD_NEON   0
+#endif
+
+#if SIMD_X86
+    #include <immintrin.h>
+#endif
+
+#if SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    SIMD_FILL_OPA,          /*Fill with opacity, no mask*/
+    SIMD_FILL_MASK,         /*Fill with mask, only the mask matters*/
+    SIMD_FILL_MASK_OPA,     /*Fill with mask and opacity*/
+    SIMD_MAP_OPA,           /*Copy with opacity, no mask*/
+    SIMD_MAP_MASK,          /*Copy with mask, only the mask matters*/
+    SIMD_MAP_MASK_OPA,      /*Copy with mask and opacity*/
+    SIMD_BLEND,             /*Fill or copy with a blend mode, maybe with mask*/
+} simd_kernel_t;
+
+/*An area to blend with the buffers already offset to its first pixel*/
+typedef struct {
+    lv_color_t * dest_buf;
+    int32_t dest_stride;
+    const lv_color_t * src_buf; /*NULL to fill with `color`*/
+    int32_t src_stride;
+    const lv_opa_t * mask;
+    int32_t mask_stride;
+    int32_t w;
+    int32_t h;
+    lv_color_t color;
+    lv_opa_t opa;
+    lv_opa_t opa_inv;           /*For `SIMD_FILL_OPA`*/
+    uint16_t premult[3];        /*For `SIMD_FILL_OPA`*/
+    simd_kernel_t kernel;
+    lv_blend_mode_t blend_mode;
+} simd_job_t;
+
+typedef void (*simd_blend_cb_t)(const simd_job_t * job);
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+#if SIMD_X86
+    static void sse2_blend(const simd_job_t * job);
+    static void avx2_blend(const simd_job_t * job);
+#endif
+
+#if SIMD_NEON
+    static void neon_blend(const simd_job_t * job);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lv_draw_sw_simd_t simd_act;
+static simd_blend_cb_t blend_cb;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Select the best instruction set supported by the CPU. Called by `lv_init()`.
+ */
+void lv_draw_sw_simd_init(void)
+{
+#if SIMD_X86
+    __builtin_cpu_init();
+#endif
+
+    if(lv_draw_sw_simd_set(LV_DRAW_SW_SIMD_AVX2)) return;
+    if(lv_draw_sw_simd_set(LV_DRAW_SW_SIMD_SSE2)) return;
+    if(lv_draw_sw_simd_set(LV_DRAW_SW_SIMD_NEON)) return;
+    lv_draw_sw_simd_set(LV_DRAW_SW_SIMD_NONE);
+}
+
+/**
+ * Tell whether the kernels of an instruction set are compiled in and the CPU can run them.
+ * @param simd          an instruction set
+ * @return              true: `simd` can be selected with `lv_draw_sw_simd_set()`
+ */
+bool lv_draw_sw_simd_is_supported(lv_draw_sw_simd_t simd)
+{
+    switch(simd) {
+        case LV_DRAW_SW_SIMD_NONE:
+            return true;
+#if SIMD_X86
+        case LV_DRAW_SW_SIMD_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case LV_DRAW_SW_SIMD_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+#if SIMD_NEON
+        case LV_DRAW_SW_SIMD_NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+/**
+ * Select the instruction set to blend with, e.g. to compare the kernels with the C code.
+ * Shouldn't be called while rendering.
+ * @param simd          an instruction set, `LV_DRAW_SW_SIMD_NONE` to use the C code only
+ * @return              true: selected; false: `simd` is not supported and the selection is not changed
+ */
+bool lv_draw_sw_simd_set(lv_draw_sw_simd_t simd)
+{
+    if(!lv_draw_sw_simd_is_supported(simd)) return false;
+
+    switch(simd) {
+#if SIMD_X86
+        case LV_DRAW_SW_SIMD_SSE2:
+            blend_cb = sse2_blend;
+            break;
+        case LV_DRAW_SW_SIMD_AVX2:
+            blend_cb = avx2_blend;
+            break;
+#endif
+#if SIMD_NEON
+        case LV_DRAW_SW_SIMD_NEON:
+            blend_cb = neon_blend;
+            break;
+#endif
+        default:
+            blend_cb = NULL;
+            break;
+    }
+
+    simd_act = simd;
+    return true;
+}
+
+/**
+ * Get the instruction set used to blend.
+ * @return              the instruction set selected by `lv_draw_sw_simd_init()` or `lv_draw_sw_simd_set()`
+ */
+lv_draw_sw_simd_t lv_draw_sw_simd_get(void)
+{
+    return simd_act;
+}
+
+/**
+ * Blend an area with the selected kernels. The arguments are the same as the software blend's.
+ * @param dest_buf      pointer to the first pixel of the area in the destination buffer
+ * @param dest_area     the blended area, only its size is used
+ * @param dest_stride   width of the destination buffer [px]
+ * @param src_buf       pointer to the first pixel of the area in the source buffer or NULL to fill with `color`
+ * @param src_stride    width of the source buffer [px]
+ * @param color         the fill color if `src_buf == NULL`
+ * @param opa           opacity of the whole area
+ * @param mask          pointer to the first pixel of the area in the mask or NULL
+ * @param mask_stride   width of the mask [px]
+ * @param blend_mode    an `LV_BLEND_MODE_...` value
+ * @return              true: blended; false: not handled by the kernels, the C code should be used
+ */
+bool _lv_draw_sw_simd_blend(lv_color_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
+                            const lv_color_t * src_buf, lv_coord_t src_stride, lv_color_t color, lv_opa_t opa,
+                            const lv_opa_t * mask, lv_coord_t mask_stride, lv_blend_mode_t blend_mode)
+{
+    if(blend_cb == NULL) return false;
+
+    simd_job_t job;
+    job.dest_buf = dest_buf;
+    job.dest_stride = dest_stride;
+    job.src_buf = src_buf;
+    job.src_stride = src_stride;
+    job.mask = mask;
+    job.mask_stride = mask_stride;
+    job.w = lv_area_get_width(dest_area);
+    job.h = lv_area_get_height(dest_area);
+    job.color = color;
+    job.opa = opa;
+    job.blend_mode = blend_mode;
+
+    if(blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(mask == NULL) {
+            /*Plain fills and copies are memory bound, `lv_color_fill()` and `lv_memcpy()` are as fast*/
+            if(opa >= LV_OPA_MAX) return false;
+            job.kernel = src_buf ? SIMD_MAP_OPA : SIMD_FILL_OPA;
+        }
+        else if(src_buf == NULL) {
+            job.kernel = opa >= LV_OPA_MAX ? SIMD_FILL_MASK : SIMD_FILL_MASK_OPA;
+        }
+        else {
+            job.kernel = opa > LV_OPA_MAX ? SIMD_MAP_MASK : SIMD_MAP_MASK_OPA;
+        }
+    }
+#if LV_DRAW_COMPLEX
+    else if(blend_mode == LV_BLEND_MODE_ADDITIVE || blend_mode == LV_BLEND_MODE_SUBTRACTIVE ||
+            blend_mode == LV_BLEND_MODE_MULTIPLY) {
+        /*Nothing to do: the blend modes keep the background*/
+        if(opa <= LV_OPA_MIN) return true;
+        job.kernel = SIMD_BLEND;
+    }
+#endif
+    else {
+        return false;
+    }
+
+    if(job.kernel == SIMD_FILL_OPA) {
+        /*Mix like `fill_normal()`: the first black pixels are mixed with the original opacity*/
+        lv_color_t black_res = lv_color_mix(color, lv_color_black(), opa);
+#if LV_COLOR_DEPTH == 16
+        /*Introduce the rounding error of `lv_color_mix()` in the premultiplied color too*/
+        opa = (uint32_t)((uint32_t)opa + 4) >> 3;
+        opa = opa << 3;
+#endif
+        lv_color_premult(color, opa, job.premult);
+        job.opa_inv = 255 - opa;
+
+        /*Differs only in the rounding of 16 bit colors*/
+        if(black_res.full != lv_color_mix_premult(job.premult, lv_color_black(), job.opa_inv).full) {
+            lv_color_t black = lv_color_black();
+            while(job.h > 0) {
+                int32_t x;
+                for(x = 0; x < job.w && job.dest_buf[x].full == black.full; x++) {
+                    job.dest_buf[x] = black_res;
+                }
+
+                /*Blend the rest of the row and the next rows normally*/
+                if(x < job.w) {
+                    if(x > 0) {
+                        simd_job_t row = job;
+                        row.dest_buf += x;
+                        row.w -= x;
+                        row.h = 1;
+                        blend_cb(&row);
+                        job.dest_buf += job.dest_stride;
+                        job.h--;
+                    }
+                    break;
+                }
+                job.dest_buf += job.dest_stride;
+                job.h--;
+            }
+            if(job.h == 0) return true;
+        }
+    }
+
+    blend_cb(&job);
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if SIMD_X86
+
+/*----------------
+ * SSE2
+ *----------------*/
+
+#define V                   __m128i
+#define SIMD_FN(name)       sse2_##name
+#define SIMD_ATTR           __attribute__((target("sse2")))
+#define SIMD_INLINE         static inline SIMD_ATTR
+
+#define V_LOADU(p)          _mm_loadu_si128((const __m128i *)(const void *)(p))
+#define V_STOREU(p, v)      _mm_storeu_si128((__m128i *)(void *)(p), v)
+#define V_ZERO()            _mm_setzero_si128()
+#define V_SET1_8(x)         _mm_set1_epi8((char)(x))
+#define V_SET1_16(x)        _mm_set1_epi16((short)(x))
+#define V_SET1_32(x)        _mm_set1_epi32((int)(x))
+#define V_SET1_64(x)        _mm_set1_epi64x((long long)(x))
+#define V_AND(a, b)         _mm_and_si128(a, b)
+#define V_OR(a, b)          _mm_or_si128(a, b)
+#define V_ANDNOT(a, b)      _mm_andnot_si128(a, b)
+#define V_SEL(m, a, b)      _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b))
+#define V_CMPEQ8(a, b)      _mm_cmpeq_epi8(a, b)
+#define V_CMPEQ16(a, b)     _mm_cmpeq_epi16(a, b)
+#define V_CMPGE_U8(a, b)    _mm_cmpeq_epi8(_mm_max_epu8(a, b), a)
+#define V_CMPLE_U8(a, b)    _mm_cmpeq_epi8(_mm_max_epu8(a, b), b)
+#define V_ADDS_U8(a, b)     _mm_adds_epu8(a, b)
+#define V_SUBS_U8(a, b)     _mm_subs_epu8(a, b)
+#define V_UNPACKLO8(a, b)   _mm_unpacklo_epi8(a, b)
+#define V_UNPACKHI8(a, b)   _mm_unpackhi_epi8(a, b)
+#define V_UNPACKLO16(a, b)  _mm_unpacklo_epi16(a, b)
+#define V_UNPACKHI16(a, b)  _mm_unpackhi_epi16(a, b)
+#define V_PACKUS16(a, b)    _mm_packus_epi16(a, b)
+#define V_PACK32(a, b)      _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), \
+                                            _mm_srai_epi32(_mm_slli_epi32(b, 16), 16))
+#define V_ADD16(a, b)       _mm_add_epi16(a, b)
+#define V_SUB16(a, b)       _mm_sub_epi16(a, b)
+#define V_MULLO16(a, b)     _mm_mullo_epi16(a, b)
+#define V_MULHI_U16(a, b)   _mm_mulhi_epu16(a, b)
+#define V_SRLI16(a, n)      _mm_srli_epi16(a, n)
+#define V_SLLI16(a, n)      _mm_slli_epi16(a, n)
+#define V_MIN_S16(a, b)     _mm_min_epi16(a, b)
+#define V_MAX_S16(a, b)     _mm_max_epi16(a, b)
+#define V_ADD32(a, b)       _mm_add_epi32(a, b)
+#define V_SUB32(a, b)       _mm_sub_epi32(a, b)
+#define V_SRLI32(a, n)      _mm_srli_epi32(a, n)
+#define V_SLLI32(a, n)      _mm_slli_epi32(a, n)
+#define V_MUL32(a, m)       sse2_mul32(a, m)
+#define V_IS_ZERO(a)        (_mm_movemask_epi8(_mm_cmpeq_epi8(a, _mm_setzero_si128())) == 0xFFFF)
+#define V_ALL_ONES(a)       (_mm_movemask_epi8(a) == 0xFFFF)
+#define V_MASK_PX32(p)      sse2_mask_px32(p)
+#define V_MASK_LOAD16(p)    _mm_loadl_epi64((const __m128i *)(const void *)(p))
+#define V_EXPAND16(a)       _mm_unpacklo_epi8(a, _mm_setzero_si128())
+
+/*Low 32 bits of the products with `m < 0x10000` (SSE2 has no 32 bit multiplication)*/
+SIMD_INLINE __m128i sse2_mul32(__m128i a, __m128i m)
+{
+    m = _mm_or_si128(m, _mm_slli_epi32(m, 16));
+    return _mm_add_epi32(_mm_mullo_epi16(a, m), _mm_slli_epi32(_mm_mulhi_epu16(a, m), 16));
+}
+
+/*4 mask values, each repeated in the 4 bytes of a pixel*/
+SIMD_INLINE __m128i sse2_mask_px32(const lv_opa_t * mask)
+{
+    uint32_t m32;
+    lv_memcpy_small(&m32, mask, sizeof(m32));
+    __m128i m = _mm_cvtsi32_si128((int)m32);
+    m = _mm_unpacklo_epi8(m, m);
+    return _mm_unpacklo_epi16(m, m);
+}
+
+#include "lv_draw_sw_blend_simd_kernels.h"
+
+/*----------------
+ * AVX2
+ *----------------*/
+
+#define V                   __m256i
+#define SIMD_FN(name)       avx2_##name
+#define SIMD_ATTR           __attribute__((target("avx2")))
+#define SIMD_INLINE         static inline SIMD_ATTR
+
+/*The 256 bit unpack and pack instructions work in the 128 bit halves, but they are used in pairs*/
+#define V_LOADU(p)          _mm256_loadu_si256((const __m256i *)(const void *)(p))
+#define V_STOREU(p, v)      _mm256_storeu_si256((__m256i *)(void *)(p), v)
+#define V_ZERO()            _mm256_setzero_si256()
+#define V_SET1_8(x)         _mm256_set1_epi8((char)(x))
+#define V_SET1_16(x)        _mm256_set1_epi16((short)(x))
+#define V_SET1_32(x)        _mm256_set1_epi32((int)(x))
+#define V_SET1_64(x)        _mm256_set1_epi64x((long long)(x))
+#define V_AND(a, b)         _mm256_and_si256(a, b)
+#define V_OR(a, b)          _mm256_or_si256(a, b)
+#define V_ANDNOT(a, b)      _mm256_andnot_si256(a, b)
+#define V_SEL(m, a, b)      _mm256_blendv_epi8(b, a, m)
+#define V_CMPEQ8(a, b)      _mm256_cmpeq_epi8(a, b)
+#define V_CMPEQ16(a, b)     _mm256_cmpeq_epi16(a, b)
+#define V_CMPGE_U8(a, b)    _mm256_cmpeq_epi8(_mm256_max_epu8(a, b), a)
+#define V_CMPLE_U8(a, b)    _mm256_cmpeq_epi8(_mm256_max_epu8(a, b), b)
+#define V_ADDS_U8(a, b)     _mm256_adds_epu8(a, b)
+#define V_SUBS_U8(a, b)     _mm256_subs_epu8(a, b)
+#define V_UNPACKLO8(a, b)   _mm256_unpacklo_epi8(a, b)
+#define V_UNPACKHI8(a, b)   _mm256_unpackhi_epi8(a, b)
+#define V_UNPACKLO16(a, b)  _mm256_unpacklo_epi16(a, b)
+#define V_UNPACKHI16(a, b)  _mm256_unpackhi_epi16(a, b)
+#define V_PACKUS16(a, b)    _mm256_packus_epi16(a, b)
+#define V_PACK32(a, b)      _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16), \
+                                               _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16))
+#define V_ADD16(a, b)       _mm256_add_epi16(a, b)
+#define V_SUB16(a, b)       _mm256_sub_epi16(a, b)
+#define V_MULLO16(a, b)     _mm256_mullo_epi16(a, b)
+#define V_MULHI_U16(a, b)   _mm256_mulhi_epu16(a, b)
+#define V_SRLI16(a, n)      _mm256_srli_epi16(a, n)
+#define V_SLLI16(a, n)      _mm256_slli_epi16(a, n)
+#define V_MIN_S16(a, b)     _mm256_min_epi16(a, b)
+#define V_MAX_S16(a, b)     _mm256_max_epi16(a, b)
+#define V_ADD32(a, b)       _mm256_add_epi32(a, b)
+#define V_SUB32(a, b)       _mm256_sub_epi32(a, b)
+#define V_SRLI32(a, n)      _mm256_srli_epi32(a, n)
+#define V_SLLI32(a, n)      _mm256_slli_epi32(a, n)
+#define V_MUL32(a, m)       _mm256_mullo_epi32(a, m)
+#define V_IS_ZERO(a)        _mm256_testz_si256(a, a)
+#define V_ALL_ONES(a)       (_mm256_movemask_epi8(a) == -1)
+#define V_MASK_PX32(p)      avx2_mask_px32(p)
+#define V_MASK_LOAD16(p)    _mm256_inserti128_si256(_mm256_setzero_si256(), \
+                                                    _mm_loadu_si128((const __m128i *)(const void *)(p)), 0)
+#define V_EXPAND16(a)       _mm256_cvtepu8_epi16(_mm256_castsi256_si128(a))
+
+/*8 mask values, each repeated in the 4 bytes of a pixel*/
+SIMD_INLINE __m256i avx2_mask_px32(const lv_opa_t * mask)
+{
+    __m256i m = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(const void *)mask));
+    m = _mm256_or_si256(m, _mm256_slli_epi32(m, 8));
+    return _mm256_or_si256(m, _mm256_slli_epi32(m, 16));
+}
+
+#include "lv_draw_sw_blend_simd_kernels.h"
+
+#endif /*SIMD_X86*/
+
+#if SIMD_NEON
+
+/*----------------
+ * NEON
+ *----------------*/
+
+#define V                   uint8x16_t
+#define SIMD_FN(name)       neon_##name
+#define SIMD_ATTR
+#define SIMD_INLINE         static inline
+
+#define U16(a)              vreinterpretq_u16_u8(a)
+#define U32(a)              vreinterpretq_u32_u8(a)
+#define U8_16(a)            vreinterpretq_u8_u16(a)
+#define U8_32(a)            vreinterpretq_u8_u32(a)
+
+#define V_LOADU(p)          vld1q_u8((const uint8_t *)(const void *)(p))
+#define V_STOREU(p, v)      vst1q_u8((uint8_t *)(void *)(p), v)
+#define V_ZERO()            vdupq_n_u8(0)
+#define V_SET1_8(x)         vdupq_n_u8((uint8_t)(x))
+#define V_SET1_16(x)        U8_16(vdupq_n_u16((uint16_t)(x)))
+#define V_SET1_32(x)        U8_32(vdupq_n_u32((uint32_t)(x)))
+#define V_SET1_64(x)        vreinterpretq_u8_u64(vdupq_n_u64((uint64_t)(x)))
+#define V_AND(a, b)         vandq_u8(a, b)
+#define V_OR(a, b)          vorrq_u8(a, b)
+#define V_ANDNOT(a, b)      vbicq_u8(b, a)
+#define V_SEL(m, a, b)      vbslq_u8(m, a, b)
+#define V_CMPEQ8(a, b)      vceqq_u8(a, b)
+#define V_CMPEQ16(a, b)     U8_16(vceqq_u16(U16(a), U16(b)))
+#define V_CMPGE_U8(a, b)    vcgeq_u8(a, b)
+#define V_CMPLE_U8(a, b)    vcleq_u8(a, b)
+#define V_ADDS_U8(a, b)     vqaddq_u8(a, b)
+#define V_SUBS_U8(a, b)     vqsubq_u8(a, b)
+#define V_UNPACKLO8(a, b)   vzipq_u8(a, b).val[0]
+#define V_UNPACKHI8(a, b)   vzipq_u8(a, b).val[1]
+#define V_UNPACKLO16(a, b)  U8_16(vzipq_u16(U16(a), U16(b)).val[0])
+#define V_UNPACKHI16(a, b)  U8_16(vzipq_u16(U16(a), U16(b)).val[1])
+#define V_PACKUS16(a, b)    vcombine_u8(vqmovun_s16(vreinterpretq_s16_u8(a)), vqmovun_s16(vreinterpretq_s16_u8(b)))
+#define V_PACK32(a, b)      U8_16(vcombine_u16(vmovn_u32(U32(a)), vmovn_u32(U32(b))))
+#define V_ADD16(a, b)       U8_16(vaddq_u16(U16(a), U16(b)))
+#define V_SUB16(a, b)       U8_16(vsubq_u16(U16(a), U16(b)))
+#define V_MULLO16(a, b)     U8_16(vmulq_u16(U16(a), U16(b)))
+#define V_MULHI_U16(a, b)   neon_mulhi_u16(a, b)
+#define V_SRLI16(a, n)      U8_16(vshrq_n_u16(U16(a), n))
+#define V_SLLI16(a, n)      U8_16(vshlq_n_u16(U16(a), n))
+#define V_MIN_S16(a, b)     vreinterpretq_u8_s16(vminq_s16(vreinterpretq_s16_u8(a), vreinterpretq_s16_u8(b)))
+#define V_MAX_S16(a, b)     vreinterpretq_u8_s16(vmaxq_s16(vreinterpretq_s16_u8(a), vreinterpretq_s16_u8(b)))
+#define V_ADD32(a, b)       U8_32(vaddq_u32(U32(a), U32(b)))
+#define V_SUB32(a, b)       U8_32(vsubq_u32(U32(a), U32(b)))
+#define V_SRLI32(a, n)      U8_32(vshrq_n_u32(U32(a), n))
+#define V_SLLI32(a, n)      U8_32(vshlq_n_u32(U32(a), n))
+#define V_MUL32(a, m)       U8_32(vmulq_u32(U32(a), U32(m)))
+#define V_IS_ZERO(a)        neon_all_eq64(a, 0)
+#define V_ALL_ONES(a)       neon_all_eq64(a, UINT64_MAX)
+#define V_MASK_PX32(p)      neon_mask_px32(p)
+#define V_MASK_LOAD16(p)    vcombine_u8(vld1_u8(p), vdup_n_u8(0))
+#define V_EXPAND16(a)       U8_16(vmovl_u8(vget_low_u8(a)))
+
+SIMD_INLINE uint8x16_t neon_mulhi_u16(uint8x16_t a, uint8x16_t b)
+{
+    uint32x4_t lo = vmull_u16(vget_low_u16(U16(a)), vget_low_u16(U16(b)));
+    uint32x4_t hi = vmull_u16(vget_high_u16(U16(a)), vget_high_u16(U16(b)));
+    return U8_16(vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16)));
+}
+
+SIMD_INLINE bool neon_all_eq64(uint8x16_t a, uint64_t v)
+{
+    uint64x2_t a64 = vreinterpretq_u64_u8(a);
+    return vgetq_lane_u64(a64, 0) == v && vgetq_lane_u64(a64, 1) == v;
+}
+
+/*4 mask values, each repeated in the 4 bytes of a pixel*/
+SIMD_INLINE uint8x16_t neon_mask_px32(const lv_opa_t * mask)
+{
+    uint32_t m32;
+    lv_memcpy_small(&m32, mask, sizeof(m32));
+    uint8x8_t m = vreinterpret_u8_u32(vdup_n_u32(m32));
+    uint16x4x2_t m16 = vzip_u16(vreinterpret_u16_u8(vzip_u8(m, m).val[0]),
+                                vreinterpret_u16_u8(vzip_u8(m, m).val[0]));
+    return vcombine_u8(vreinterpret_u8_u16(m16.val[0]), vreinterpret_u8_u16(m16.val[1]));
+}
+
+#include "lv_draw_sw_blend_simd_kernels.h"
+
+#endif /*SIMD_NEON*/
+
+#endif /*LV_USE_DRAW_SW_SIMD*/
@@ -0,0 +1,95 @@
+/**
+ * @file lv_draw_sw_blend_simd.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_SIMD_H
+#define LV_DRAW_SW_BLEND_SIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../misc/lv_area.h"
+#include "../../misc/lv_color.h"
+#include "../../misc/lv_style.h"
+
+#if LV_USE_DRAW_SW_SIMD
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_DRAW_SW_SIMD_NONE,   /**< The C code only*/
+    LV_DRAW_SW_SIMD_SSE2,   /**< 128 bit x86 kernels*/
+    LV_DRAW_SW_SIMD_AVX2,   /**< 256 bit x86 kernels*/
+    LV_DRAW_SW_SIMD_NEON,   /**< 128 bit Arm kernels*/
+} lv_draw_sw_simd_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Select the best instruction set supported by the CPU. Called by `lv_init()`.
+ */
+void lv_draw_sw_simd_init(void);
+
+/**
+ * Tell whether the kernels of an instruction set are compiled in and the CPU can run them.
+ * @param simd          an instruction set
+ * @return              true: `simd` can be selected with `lv_draw_sw_simd_set()`
+ */
+bool lv_draw_sw_simd_is_supported(lv_draw_sw_simd_t simd);
+
+/**
+ * Select the instruction set to blend with, e.g. to compare the kernels with the C code.
+ * Shouldn't be called while rendering.
+ * @param simd          an instruction set, `LV_DRAW_SW_SIMD_NONE` to use the C code only
+ * @return              true: selected; false: `simd` is not supported and the selection is not changed
+ */
+bool lv_draw_sw_simd_set(lv_draw_sw_simd_t simd);
+
+/**
+ * Get the instruction set used to blend.
+ * @return              the instruction set selected by `lv_draw_sw_simd_init()` or `lv_draw_sw_simd_set()`
+ */
+lv_draw_sw_simd_t lv_draw_sw_simd_get(void);
+
+/**
+ * Blend an area with the selected kernels. The arguments are the same as the software blend's.
+ * @param dest_buf      pointer to the first pixel of the area in the destination buffer
+ * @param dest_area     the blended area, only its size is used
+ * @param dest_stride   width of the destination buffer [px]
+ * @param src_buf       pointer to the first pixel of the area in the source buffer or NULL to fill with `color`
+ * @param src_stride    width of the source buffer [px]
+ * @param color         the fill color if `src_buf == NULL`
+ * @param opa           opacity of the whole area
+ * @param mask          pointer to the first pixel of the area in the mask or NULL
+ * @param mask_stride   width of the mask [px]
+ * @param blend_mode    an `LV_BLEND_MODE_...` value
+ * @return              true: blended; false: not handled by the kernels, the C code should be used
+ */
+bool _lv_draw_sw_simd_blend(lv_color_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
+                            const lv_color_t * src_buf, lv_coord_t src_stride, lv_color_t color, lv_opa_t opa,
+                            const lv_opa_t * mask, lv_coord_t mask_stride, lv_blend_mode_t blend_mode);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW_SIMD*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_SIMD_H*/
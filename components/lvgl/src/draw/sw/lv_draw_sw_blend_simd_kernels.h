@@ -0,0 +1,400 @@
+/**
+ * @file lv_draw_sw_blend_simd_kernels.h
+ *
+ * The blend kernels written with generic vector operations.
+ * Included once per instruction set by `lv_draw_sw_blend_simd.c` after defining
+ * - `V`: the vector type
+ * - `SIMD_FN(name)`: to give instruction set specific names to the functions
+ * - `SIMD_ATTR`: the attributes of the functions (e.g. the target instruction set)
+ * - `SIMD_INLINE`: to declare the helper functions
+ * - `V_...`: the vector operations
+ * and undefines them at the end.
+ *
+ * Every kernel reproduces its C counterpart in `lv_draw_sw_blend.c` bit by bit.
+ */
+
+/*No include guard: included more times*/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Pixels in a vector*/
+#define SIMD_PX ((int32_t)(sizeof(V) / sizeof(lv_color_t)))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*The values used by the kernels broadcast to every lane*/
+typedef struct {
+    V zero;
+    V color;        /*The fill color*/
+    V opa8;         /*Opacity in every byte*/
+    V opa16;        /*Opacity in every 16 bit lane*/
+    V opa_inv16;    /*255 - opacity in every 16 bit lane*/
+    V cover8;       /*LV_OPA_COVER in every byte*/
+    V max8;         /*LV_OPA_MAX in every byte*/
+    V min8;         /*LV_OPA_MIN in every byte*/
+    V k8081;        /*To divide by 255 like `LV_UDIV255()`*/
+#if LV_COLOR_DEPTH == 32
+    V round16;      /*LV_COLOR_MIX_ROUND_OFS in every 16 bit lane*/
+    V alpha32;      /*The alpha channel of the pixels*/
+    V premult;      /*The premultiplied fill color in the order of the channels*/
+#else
+    V mask565;      /*To spread the channels of a pixel to 32 bits like `lv_color_mix()`*/
+    V four16;
+    V r5;           /*Maximal value of the 5 bit channels*/
+    V g6;           /*Maximal value of the 6 bit channel*/
+    V premult_r;
+    V premult_g;
+    V premult_b;
+#endif
+} SIMD_FN(consts_t);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*`LV_UDIV255()` on 16 bit lanes*/
+SIMD_INLINE V SIMD_FN(udiv255)(V x, const SIMD_FN(consts_t) * c)
+{
+    return V_SRLI16(V_MULHI_U16(x, c->k8081), 7);
+}
+
+/*`(m * opa) >> 8` on bytes*/
+SIMD_INLINE V SIMD_FN(mul_opa)(V m, const SIMD_FN(consts_t) * c)
+{
+    V lo = V_SRLI16(V_MULLO16(V_UNPACKLO8(m, c->zero), c->opa16), 8);
+    V hi = V_SRLI16(V_MULLO16(V_UNPACKHI8(m, c->zero), c->opa16), 8);
+    return V_PACKUS16(lo, hi);
+}
+
+/*The mix ratio of the pixels from the mask values (on bytes)*/
+SIMD_INLINE V SIMD_FN(get_alpha)(V m, const SIMD_FN(consts_t) * c, simd_kernel_t kernel)
+{
+    V a;
+    switch(kernel) {
+        case SIMD_FILL_MASK:
+        case SIMD_MAP_MASK:
+            return m;
+        case SIMD_FILL_MASK_OPA:
+            /*mask == LV_OPA_COVER ? opa : (mask * opa) >> 8*/
+            return V_SEL(V_CMPEQ8(m, c->cover8), c->opa8, SIMD_FN(mul_opa)(m, c));
+        default:
+            /*mask >= LV_OPA_MAX ? opa : (mask * opa) >> 8*/
+            a = V_SEL(V_CMPGE_U8(m, c->max8), c->opa8, SIMD_FN(mul_opa)(m, c));
+            if(kernel == SIMD_BLEND) {
+                /*The blend modes keep the background if the opacity is <= LV_OPA_MIN*/
+                a = V_ANDNOT(V_CMPLE_U8(a, c->min8), a);
+            }
+            return a;
+    }
+}
+
+#if LV_COLOR_DEPTH == 32
+
+/*`lv_color_mix()` on the channels of two pixels widened to 16 bit lanes*/
+SIMD_INLINE V SIMD_FN(mix_u16)(V f, V b, V a, V a_inv, const SIMD_FN(consts_t) * c)
+{
+    V x = V_ADD16(V_ADD16(V_MULLO16(f, a), V_MULLO16(b, a_inv)), c->round16);
+    return SIMD_FN(udiv255)(x, c);
+}
+
+/*`lv_color_mix(fg, bg, a)` where `a` has the ratio of every pixel in its 4 bytes*/
+SIMD_INLINE V SIMD_FN(mix)(V fg, V bg, V a, const SIMD_FN(consts_t) * c)
+{
+    V a_inv = V_ANDNOT(a, c->cover8);
+    V lo = SIMD_FN(mix_u16)(V_UNPACKLO8(fg, c->zero), V_UNPACKLO8(bg, c->zero), V_UNPACKLO8(a, c->zero),
+                            V_UNPACKLO8(a_inv, c->zero), c);
+    V hi = SIMD_FN(mix_u16)(V_UNPACKHI8(fg, c->zero), V_UNPACKHI8(bg, c->zero), V_UNPACKHI8(a, c->zero),
+                            V_UNPACKHI8(a_inv, c->zero), c);
+    V res = V_PACKUS16(lo, hi);
+
+    /*The ratios 0 and 255 give exactly `bg` and `fg` (with their alpha), the others an opaque pixel*/
+    V mixed = V_ANDNOT(V_OR(V_CMPEQ8(a, c->zero), V_CMPEQ8(a, c->cover8)), c->alpha32);
+    return V_OR(res, mixed);
+}
+
+/*`lv_color_mix_premult()` with the premultiplied fill color*/
+SIMD_INLINE V SIMD_FN(mix_premult)(V bg, const SIMD_FN(consts_t) * c)
+{
+    V lo = V_ADD16(V_ADD16(c->premult, V_MULLO16(V_UNPACKLO8(bg, c->zero), c->opa_inv16)), c->round16);
+    V hi = V_ADD16(V_ADD16(c->premult, V_MULLO16(V_UNPACKHI8(bg, c->zero), c->opa_inv16)), c->round16);
+    V res = V_PACKUS16(SIMD_FN(udiv255)(lo, c), SIMD_FN(udiv255)(hi, c));
+    return V_OR(res, c->alpha32);
+}
+
+/*The color channels of `color_blend_true_color_...()`*/
+SIMD_INLINE V SIMD_FN(blend_op)(V fg, V bg, lv_blend_mode_t blend_mode, const SIMD_FN(consts_t) * c)
+{
+    V res;
+    if(blend_mode == LV_BLEND_MODE_ADDITIVE) {
+        res = V_ADDS_U8(fg, bg);
+    }
+    else if(blend_mode == LV_BLEND_MODE_SUBTRACTIVE) {
+        res = V_SUBS_U8(bg, fg);
+    }
+    else {
+        V lo = V_SRLI16(V_MULLO16(V_UNPACKLO8(fg, c->zero), V_UNPACKLO8(bg, c->zero)), 8);
+        V hi = V_SRLI16(V_MULLO16(V_UNPACKHI8(fg, c->zero), V_UNPACKHI8(bg, c->zero)), 8);
+        res = V_PACKUS16(lo, hi);
+    }
+
+    /*The alpha channel of the foreground is kept*/
+    return V_SEL(c->alpha32, fg, res);
+}
+
+#else /*LV_COLOR_DEPTH == 16*/
+
+/*`lv_color_mix()`'s trick on pixels in 32 bit lanes: the channels are spread to have room for the products*/
+SIMD_INLINE V SIMD_FN(mix_u32)(V f, V b, V m, const SIMD_FN(consts_t) * c)
+{
+    f = V_AND(V_OR(f, V_SLLI32(f, 16)), c->mask565);
+    b = V_AND(V_OR(b, V_SLLI32(b, 16)), c->mask565);
+    V r = V_AND(V_ADD32(V_SRLI32(V_MUL32(V_SUB32(f, b), m), 5), b), c->mask565);
+    return V_OR(r, V_SRLI32(r, 16));
+}
+
+/*`lv_color_mix(fg, bg, a)` where `a` has the ratio of every pixel in a 16 bit lane*/
+SIMD_INLINE V SIMD_FN(mix)(V fg, V bg, V a, const SIMD_FN(consts_t) * c)
+{
+    V m = V_SRLI16(V_ADD16(a, c->four16), 3);
+    V lo = SIMD_FN(mix_u32)(V_UNPACKLO16(fg, c->zero), V_UNPACKLO16(bg, c->zero), V_UNPACKLO16(m, c->zero), c);
+    V hi = SIMD_FN(mix_u32)(V_UNPACKHI16(fg, c->zero), V_UNPACKHI16(bg, c->zero), V_UNPACKHI16(m, c->zero), c);
+    return V_PACK32(lo, hi);
+}
+
+/*`lv_color_mix_premult()` with the premultiplied fill color*/
+SIMD_INLINE V SIMD_FN(mix_premult)(V bg, const SIMD_FN(consts_t) * c)
+{
+    V r = V_SRLI16(bg, 11);
+    V g = V_AND(V_SRLI16(bg, 5), c->g6);
+    V b = V_AND(bg, c->r5);
+    r = SIMD_FN(udiv255)(V_ADD16(c->premult_r, V_MULLO16(r, c->opa_inv16)), c);
+    g = SIMD_FN(udiv255)(V_ADD16(c->premult_g, V_MULLO16(g, c->opa_inv16)), c);
+    b = SIMD_FN(udiv255)(V_ADD16(c->premult_b, V_MULLO16(b, c->opa_inv16)), c);
+    return V_OR(V_OR(V_SLLI16(r, 11), V_SLLI16(g, 5)), b);
+}
+
+/*`color_blend_true_color_...()` without the mixing*/
+SIMD_INLINE V SIMD_FN(blend_op)(V fg, V bg, lv_blend_mode_t blend_mode, const SIMD_FN(consts_t) * c)
+{
+    V fr = V_SRLI16(fg, 11);
+    V fgr = V_AND(V_SRLI16(fg, 5), c->g6);
+    V fb = V_AND(fg, c->r5);
+    V br = V_SRLI16(bg, 11);
+    V bgr = V_AND(V_SRLI16(bg, 5), c->g6);
+    V bb = V_AND(bg, c->r5);
+
+    V r;
+    V g;
+    V b;
+    if(blend_mode == LV_BLEND_MODE_ADDITIVE) {
+        r = V_MIN_S16(V_ADD16(fr, br), c->r5);
+        g = V_MIN_S16(V_ADD16(fgr, bgr), c->g6);
+        b = V_MIN_S16(V_ADD16(fb, bb), c->r5);
+    }
+    else if(blend_mode == LV_BLEND_MODE_SUBTRACTIVE) {
+        r = V_MAX_S16(V_SUB16(br, fr), c->zero);
+        g = V_MAX_S16(V_SUB16(bgr, fgr), c->zero);
+        b = V_MAX_S16(V_SUB16(bb, fb), c->zero);
+    }
+    else {
+        r = V_SRLI16(V_MULLO16(fr, br), 5);
+        g = V_SRLI16(V_MULLO16(fgr, bgr), 6);
+        b = V_SRLI16(V_MULLO16(fb, bb), 5);
+    }
+    return V_OR(V_OR(V_SLLI16(r, 11), V_SLLI16(g, 5)), b);
+}
+
+#endif /*LV_COLOR_DEPTH*/
+
+/*Blend a vector of pixels*/
+SIMD_INLINE void SIMD_FN(blend_px)(lv_color_t * dest, const lv_color_t * src, const lv_opa_t * mask,
+                                   const SIMD_FN(consts_t) * c, simd_kernel_t kernel, lv_blend_mode_t blend_mode)
+{
+    V bg = V_LOADU(dest);
+    if(kernel == SIMD_FILL_OPA) {
+        V_STOREU(dest, SIMD_FN(mix_premult)(bg, c));
+        return;
+    }
+
+    V fg = src ? V_LOADU(src) : c->color;
+    V a;
+    if(mask) {
+#if LV_COLOR_DEPTH == 32
+        V m = V_MASK_PX32(mask);
+#else
+        V m = V_MASK_LOAD16(mask);
+#endif
+        if(V_IS_ZERO(m)) return;
+
+        a = SIMD_FN(get_alpha)(m, c, kernel);
+#if LV_COLOR_DEPTH == 16
+        a = V_EXPAND16(a);
+#endif
+        /*Fully covered by the mask: only the color matters*/
+        if((kernel == SIMD_FILL_MASK || kernel == SIMD_MAP_MASK) &&
+#if LV_COLOR_DEPTH == 32
+           V_ALL_ONES(V_CMPEQ8(a, c->cover8))) {
+#else
+           V_ALL_ONES(V_CMPEQ16(a, V_SRLI16(c->cover8, 8)))) {
+#endif
+            V_STOREU(dest, fg);
+            return;
+        }
+    }
+    else {
+#if LV_COLOR_DEPTH == 32
+        a = c->opa8;
+#else
+        a = c->opa16;
+#endif
+    }
+
+    if(kernel == SIMD_BLEND) fg = SIMD_FN(blend_op)(fg, bg, blend_mode, c);
+
+    V_STOREU(dest, SIMD_FN(mix)(fg, bg, a, c));
+}
+
+/*Blend the rows of a job with a kernel*/
+SIMD_INLINE void SIMD_FN(blend_area)(const simd_job_t * job, const SIMD_FN(consts_t) * c, simd_kernel_t kernel)
+{
+    lv_color_t * dest = job->dest_buf;
+    const lv_color_t * src = job->src_buf;
+    const lv_opa_t * mask = job->mask;
+    int32_t w = job->w;
+    int32_t y;
+    for(y = 0; y < job->h; y++) {
+        int32_t x;
+        for(x = 0; x + SIMD_PX <= w; x += SIMD_PX) {
+            SIMD_FN(blend_px)(dest + x, src ? src + x : NULL, mask ? mask + x : NULL, c, kernel, job->blend_mode);
+        }
+
+        /*Blend the remaining pixels in a vector sized buffer*/
+        if(x < w) {
+            lv_color_t dest_tmp[SIMD_PX];
+            lv_color_t src_tmp[SIMD_PX];
+            lv_opa_t mask_tmp[SIMD_PX];
+            int32_t i;
+            for(i = 0; i < SIMD_PX; i++) {
+                bool in = x + i < w;
+                dest_tmp[i].full = in ? dest[x + i].full : 0;
+                src_tmp[i].full = in && src ? src[x + i].full : 0;
+                mask_tmp[i] = in && mask ? mask[x + i] : 0;
+            }
+
+            SIMD_FN(blend_px)(dest_tmp, src ? src_tmp : NULL, mask ? mask_tmp : NULL, c, kernel, job->blend_mode);
+
+            for(i = 0; x + i < w; i++) dest[x + i] = dest_tmp[i];
+        }
+
+        dest += job->dest_stride;
+        if(src) src += job->src_stride;
+        if(mask) mask += job->mask_stride;
+    }
+}
+
+/*Blend a job with the kernels of the instruction set*/
+static SIMD_ATTR void SIMD_FN(blend)(const simd_job_t * job)
+{
+    SIMD_FN(consts_t) c;
+    c.zero = V_ZERO();
+    c.opa8 = V_SET1_8(job->opa);
+    c.opa16 = V_SET1_16(job->opa);
+    c.opa_inv16 = V_SET1_16(job->opa_inv);
+    c.cover8 = V_SET1_8(LV_OPA_COVER);
+    c.max8 = V_SET1_8(LV_OPA_MAX);
+    c.min8 = V_SET1_8(LV_OPA_MIN);
+    c.k8081 = V_SET1_16(0x8081);
+#if LV_COLOR_DEPTH == 32
+    c.color = V_SET1_32(job->color.full);
+    c.round16 = V_SET1_16(LV_COLOR_MIX_ROUND_OFS);
+    c.alpha32 = V_SET1_32(0xFF000000);
+    c.premult = V_SET1_64((uint64_t)job->premult[2] | ((uint64_t)job->premult[1] << 16) |
+                          ((uint64_t)job->premult[0] << 32));
+#else
+    c.color = V_SET1_16(job->color.full);
+    c.mask565 = V_SET1_32(0x07E0F81F);
+    c.four16 = V_SET1_16(4);
+    c.r5 = V_SET1_16(0x1F);
+    c.g6 = V_SET1_16(0x3F);
+    c.premult_r = V_SET1_16(job->premult[0]);
+    c.premult_g = V_SET1_16(job->premult[1]);
+    c.premult_b = V_SET1_16(job->premult[2]);
+#endif
+
+    /*Constant kernels to let the compiler drop the unused code from the loops*/
+    switch(job->kernel) {
+        case SIMD_FILL_OPA:
+            SIMD_FN(blend_area)(job, &c, SIMD_FILL_OPA);
+            break;
+        case SIMD_FILL_MASK:
+            SIMD_FN(blend_area)(job, &c, SIMD_FILL_MASK);
+            break;
+        case SIMD_FILL_MASK_OPA:
+            SIMD_FN(blend_area)(job, &c, SIMD_FILL_MASK_OPA);
+            break;
+        case SIMD_MAP_OPA:
+            SIMD_FN(blend_area)(job, &c, SIMD_MAP_OPA);
+            break;
+        case SIMD_MAP_MASK:
+            SIMD_FN(blend_area)(job, &c, SIMD_MAP_MASK);
+            break;
+        case SIMD_MAP_MASK_OPA:
+            SIMD_FN(blend_area)(job, &c, SIMD_MAP_MASK_OPA);
+            break;
+        case SIMD_BLEND:
+            SIMD_FN(blend_area)(job, &c, SIMD_BLEND);
+            break;
+    }
+}
+
+/*Let the next instruction set define its own*/
+#undef SIMD_PX
+#undef V
+#undef SIMD_FN
+#undef SIMD_ATTR
+#undef SIMD_INLINE
+#undef V_ADD16
+#undef V_ADD32
+#undef V_ADDS_U8
+#undef V_ALL_ONES
+#undef V_AND
+#undef V_ANDNOT
+#undef V_CMPEQ16
+#undef V_CMPEQ8
+#undef V_CMPGE_U8
+#undef V_CMPLE_U8
+#undef V_EXPAND16
+#undef V_IS_ZERO
+#undef V_LOADU
+#undef V_MASK_LOAD16
+#undef V_MASK_PX32
+#undef V_MAX_S16
+#undef V_MIN_S16
+#undef V_MUL32
+#undef V_MULHI_U16
+#undef V_MULLO16
+#undef V_OR
+#undef V_PACK32
+#undef V_PACKUS16
+#undef V_SEL
+#undef V_SET1_16
+#undef V_SET1_32
+#undef V_SET1_64
+#undef V_SET1_8
+#undef V_SLLI16
+#undef V_SLLI32
+#undef V_SRLI16
+#undef V_SRLI32
+#undef V_STOREU
+#undef V_SUB16
+#undef V_SUB32
+#undef V_SUBS_U8
+#undef V_UNPACKHI16
+#undef V_UNPACKHI8
+#undef V_UNPACKLO16
+#undef V_UNPACKLO8
+#undef V_ZERO
@@ -218,9 +218,9 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
             return; /*Invalid bpp. Can't render the letter*/
     }
 
-    static lv_opa_t opa_table[256];
-    static lv_opa_t prev_opa = LV_OPA_TRANSP;
-    static uint32_t prev_bpp = 0;
+    static LV_REFR_CTX_THREAD_LOCAL lv_opa_t opa_table[256];
+    static LV_REFR_CTX_THREAD_LOCAL lv_opa_t prev_opa = LV_OPA_TRANSP;
+    static LV_REFR_CTX_THREAD_LOCAL uint32_t prev_bpp = 0;
     if(opa < LV_OPA_MAX) {
         if(prev_opa != opa || prev_bpp != bpp) {
             uint32_t i;
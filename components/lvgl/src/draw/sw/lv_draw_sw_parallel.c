@@ -0,0 +1,239 @@
+/**
+ * @file lv_draw_sw_parallel.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_parallel.h"
+
+#if LV_USE_DRAW_SW_PARALLEL
+
+#include <pthread.h>
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_log.h"
+
+#ifdef ESP_PLATFORM
+    #include "esp_pthread.h"
+    #include "freertos/FreeRTOS.h"
+    #include "freertos/task.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_DRAW_SW_PARALLEL_THREAD_CNT < 1
+    #error "LV_DRAW_SW_PARALLEL_THREAD_CNT must be at least 1"
+#endif
+
+/*The calling thread renders the first band, the workers the others*/
+#define WORKER_MAX  (LV_DRAW_SW_PARALLEL_THREAD_CNT - 1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_draw_sw_parallel_cb_t cb;
+    void * user_data;
+    lv_coord_t h;
+    uint32_t band_cnt;
+} job_t;
+
+typedef struct {
+    pthread_t thread;
+    uint32_t band;          /*Index of the band rendered by this worker*/
+    uint32_t job_id;        /*ID of the last job seen by this worker*/
+} worker_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void pool_start(void);
+static void * worker_thread(void * arg);
+static void run_band(const job_t * job, uint32_t band);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t start_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+
+#if WORKER_MAX > 0
+    static worker_t workers[WORKER_MAX];
+#endif
+static uint32_t worker_cnt;
+static uint32_t thread_cnt = LV_DRAW_SW_PARALLEL_THREAD_CNT;
+
+/*Protected by `lock`*/
+static job_t job_act;
+static uint32_t job_id;
+static uint32_t pending;
+static bool exit_req;
+#if LV_USE_REFR_CTX
+    static bool busy;       /*A display refreshed on a thread is using the workers*/
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_parallel_run(lv_draw_sw_parallel_cb_t cb, void * user_data, lv_coord_t h)
+{
+    if(h <= 0) return;
+
+#if LV_USE_REFR_CTX
+    /*Only one display can use the workers at a time, the others draw on their own thread*/
+    pthread_mutex_lock(&lock);
+    bool busy_ori = busy;
+    busy = true;
+    pthread_mutex_unlock(&lock);
+    if(busy_ori) {
+        cb(user_data, 0, h);
+        return;
+    }
+#endif
+
+    if(worker_cnt + 1 < thread_cnt) pool_start();
+
+    uint32_t band_cnt = LV_MIN(worker_cnt + 1, thread_cnt);
+    if((lv_coord_t)band_cnt > h) band_cnt = h;
+
+    job_t job;
+    job.cb = cb;
+    job.user_data = user_data;
+    job.h = h;
+    job.band_cnt = band_cnt;
+
+    if(band_cnt <= 1) {
+        cb(user_data, 0, h);
+#if LV_USE_REFR_CTX
+        pthread_mutex_lock(&lock);
+        busy = false;
+        pthread_mutex_unlock(&lock);
+#endif
+        return;
+    }
+
+    pthread_mutex_lock(&lock);
+    job_act = job;
+    pending = band_cnt - 1;
+    job_id++;
+    pthread_cond_broadcast(&start_cond);
+    pthread_mutex_unlock(&lock);
+
+    run_band(&job, 0);
+
+    pthread_mutex_lock(&lock);
+    while(pending) pthread_cond_wait(&done_cond, &lock);
+#if LV_USE_REFR_CTX
+    busy = false;
+#endif
+    pthread_mutex_unlock(&lock);
+}
+
+void lv_draw_sw_parallel_set_thread_cnt(uint32_t cnt)
+{
+    if(cnt < 1) cnt = 1;
+    if(cnt > LV_DRAW_SW_PARALLEL_THREAD_CNT) cnt = LV_DRAW_SW_PARALLEL_THREAD_CNT;
+    thread_cnt = cnt;
+}
+
+uint32_t lv_draw_sw_parallel_get_thread_cnt(void)
+{
+    return thread_cnt;
+}
+
+void lv_draw_sw_parallel_deinit(void)
+{
+    if(worker_cnt == 0) return;
+
+    pthread_mutex_lock(&lock);
+    exit_req = true;
+    pthread_cond_broadcast(&start_cond);
+    pthread_mutex_unlock(&lock);
+
+#if WORKER_MAX > 0
+    uint32_t i;
+    for(i = 0; i < worker_cnt; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+#endif
+
+    worker_cnt = 0;
+    exit_req = false;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void pool_start(void)
+{
+#if WORKER_MAX > 0
+    while(worker_cnt < WORKER_MAX && worker_cnt + 1 < thread_cnt) {
+        worker_t * w = &workers[worker_cnt];
+        w->band = worker_cnt + 1;
+        /*Only the calling thread changes `job_id`, so it can be read without locking here*/
+        w->job_id = job_id;
+
+#ifdef ESP_PLATFORM
+        /*Spread the workers over the cores, starting with the one not running LVGL*/
+        esp_pthread_cfg_t cfg = esp_pthread_get_default_config();
+        cfg.pin_to_core = (xPortGetCoreID() + w->band) % portNUM_PROCESSORS;
+        cfg.prio = uxTaskPriorityGet(NULL);
+        cfg.thread_name = "lv_draw_sw";
+        esp_pthread_set_cfg(&cfg);
+#endif
+
+        if(pthread_create(&w->thread, NULL, worker_thread, w) != 0) {
+            LV_LOG_WARN("couldn't start render worker %d, rendering with %d threads",
+                        (int)w->band, (int)(worker_cnt + 1));
+            /*Don't try again on every blend*/
+            thread_cnt = worker_cnt + 1;
+            break;
+        }
+        worker_cnt++;
+    }
+#endif
+}
+
+static void * worker_thread(void * arg)
+{
+    worker_t * w = arg;
+
+    pthread_mutex_lock(&lock);
+    while(1) {
+        while(w->job_id == job_id && !exit_req) pthread_cond_wait(&start_cond, &lock);
+        if(exit_req) break;
+
+        w->job_id = job_id;
+        job_t job = job_act;
+        if(w->band >= job.band_cnt) continue;
+
+        pthread_mutex_unlock(&lock);
+        run_band(&job, w->band);
+        pthread_mutex_lock(&lock);
+
+        pending--;
+        if(pending == 0) pthread_cond_signal(&done_cond);
+    }
+    pthread_mutex_unlock(&lock);
+
+    return NULL;
+}
+
+static void run_band(const job_t * job, uint32_t band)
+{
+    lv_coord_t y1 = (lv_coord_t)(((int32_t)job->h * (int32_t)band) / (int32_t)job->band_cnt);
+    lv_coord_t y2 = (lv_coord_t)(((int32_t)job->h * (int32_t)(band + 1)) / (int32_t)job->band_cnt);
+    if(y2 > y1) job->cb(job->user_data, y1, y2 - y1);
+}
+
+#endif /*LV_USE_DRAW_SW_PARALLEL*/
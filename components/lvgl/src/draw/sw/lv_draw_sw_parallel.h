@@ -0,0 +1,77 @@
+/**
+ * @file lv_draw_sw_parallel.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_PARALLEL_H
+#define LV_DRAW_SW_PARALLEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../misc/lv_area.h"
+
+#if LV_USE_DRAW_SW_PARALLEL
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Render a band of rows of a job.
+ * @param user_data     the job passed to `lv_draw_sw_parallel_run()`
+ * @param y_ofs         index of the first row of the band
+ * @param h             number of rows in the band
+ */
+typedef void (*lv_draw_sw_parallel_cb_t)(void * user_data, lv_coord_t y_ofs, lv_coord_t h);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Split `h` rows into bands and render them concurrently on the worker pool and the calling thread.
+ * Returns when all bands are ready. The worker threads are started on the first call.
+ * @param cb            called once per band, must only touch the rows of its own band
+ * @param user_data     passed to `cb`
+ * @param h             number of rows to render
+ */
+void lv_draw_sw_parallel_run(lv_draw_sw_parallel_cb_t cb, void * user_data, lv_coord_t h);
+
+/**
+ * Set how many threads (including the caller of `lv_timer_handler()`) render a job.
+ * Useful to measure how the rendering scales with the number of cores.
+ * @param cnt           1 .. `LV_DRAW_SW_PARALLEL_THREAD_CNT`, 1 renders everything on the calling thread
+ */
+void lv_draw_sw_parallel_set_thread_cnt(uint32_t cnt);
+
+/**
+ * Get the number of threads rendering a job.
+ * @return              the value set by `lv_draw_sw_parallel_set_thread_cnt()`
+ */
+uint32_t lv_draw_sw_parallel_get_thread_cnt(void);
+
+/**
+ * Stop the worker threads. They are started again by the next `lv_draw_sw_parallel_run()`.
+ */
+void lv_draw_sw_parallel_deinit(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW_PARALLEL*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_PARALLEL_H*/
@@ -167,8 +167,10 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
     blend_dsc.opa = LV_OPA_COVER;
 
 
-    /*Get gradient if appropriate*/
+    /*Get gradient if appropriate. The gradient cache is shared by the displays.*/
+    _LV_REFR_CTX_LOCK();
     lv_grad_t * grad = lv_gradient_get(&dsc->bg_grad, coords_bg_w, coords_bg_h);
+    if(grad == NULL) _LV_REFR_CTX_UNLOCK();
     if(grad && grad_dir == LV_GRAD_DIR_HOR) {
         blend_dsc.src_buf = grad->map + clipped_coords.x1 - bg_coords.x1;
     }
@@ -322,6 +324,7 @@ bg_clean_up:
     }
     if(grad) {
         lv_gradient_cleanup(grad);
+        _LV_REFR_CTX_UNLOCK();
     }
 
 #endif
@@ -486,6 +489,8 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
     lv_opa_t * sh_buf;
 
 #if LV_SHADOW_CACHE_SIZE
+    /*The cache is shared by the displays*/
+    _LV_REFR_CTX_LOCK();
     if(sh_cache_size == corner_size && sh_cache_r == r_sh) {
         /*Use the cache if available*/
         sh_buf = lv_mem_buf_get(corner_size * corner_size);
@@ -503,6 +508,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
             sh_cache_r = r_sh;
         }
     }
+    _LV_REFR_CTX_UNLOCK();
 #else
     sh_buf = lv_mem_buf_get(corner_size * corner_size * sizeof(uint16_t));
     shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->shadow_width, r_sh);
@@ -571,7 +577,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
                 }
@@ -614,7 +620,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
                 }
@@ -854,7 +860,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
                 }
@@ -898,7 +904,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
                 blend_area.y2 = y;
 
                 if(!simple_sub) {
-                    lv_memcpy(mask_buf, sh_buf_tmp, corner_size);
+                    lv_memcpy(mask_buf, sh_buf_tmp, w);
                     blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, clip_area_sub.x1, y, w);
                     if(blend_dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
                 }
@@ -37,6 +37,12 @@
 #define PAD_SMALL   (disp_size == DISP_LARGE ? lv_disp_dpx(theme.disp, 14) : disp_size == DISP_MEDIUM ? lv_disp_dpx(theme.disp, 12) : lv_disp_dpx(theme.disp, 10))
 #define PAD_TINY   (disp_size == DISP_LARGE ? lv_disp_dpx(theme.disp, 8) : disp_size == DISP_MEDIUM ? lv_disp_dpx(theme.disp, 6) : lv_disp_dpx(theme.disp, 2))
 
+#define DISP_SIZE_OF(hor_res) ((hor_res) <= 320 ? DISP_SMALL : (hor_res) < 720 ? DISP_MEDIUM : DISP_LARGE)
+
+/*Reference a member of `my_theme_styles_t` in the style lists*/
+#define STYLE(name, selector) {offsetof(my_theme_styles_t, name), selector}
+#define STYLE_LIST(refs) {refs, sizeof(refs) / sizeof((refs)[0])}
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -161,11 +167,45 @@ typedef enum {
     DISP_LARGE = 1,
 } disp_size_t;
 
+typedef struct {
+    uint16_t style;                 /*Offset of the style in `my_theme_styles_t`*/
+    lv_style_selector_t selector;
+} style_ref_t;
+
+typedef struct {
+    const style_ref_t * refs;
+    uint32_t cnt;
+} style_list_t;
+
+typedef struct {
+    const lv_obj_class_t * class_p;
+    style_list_t list;
+    /*Add the styles in a special way, e.g. depending on the parent. NULL: just add `list`*/
+    void (*apply_cb)(lv_obj_t * obj, const style_list_t * list);
+} class_styles_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
+static void add_styles(lv_obj_t * obj, const style_ref_t * refs, uint32_t cnt);
+static void obj_apply(lv_obj_t * obj, const style_list_t * list);
+#if LV_USE_BTN && LV_USE_MENU
+    static void btn_apply(lv_obj_t * obj, const style_list_t * list);
+#endif
+#if LV_USE_BTNMATRIX
+    static void btnmatrix_apply(lv_obj_t * obj, const style_list_t * list);
+#endif
+#if LV_USE_KEYBOARD
+    static void keyboard_apply(lv_obj_t * obj, const style_list_t * list);
+#endif
+#if LV_THEME_DEFAULT_CONST
+    static void styles_move(my_theme_styles_t * old_styles);
+    static lv_obj_tree_walk_res_t styles_move_cb(lv_obj_t * obj, void * user_data);
+#endif
 static void style_init_reset(lv_style_t * style);
+static lv_color_t dark_color_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t c, lv_opa_t opa);
+static lv_color_t grey_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t color, lv_opa_t opa);
 
 /**********************
  *  STATIC VARIABLES
@@ -179,6 +219,604 @@ static lv_color_t color_card;
 static lv_color_t color_grey;
 static bool inited = false;
 
+#if TRANSITION_TIME
+static const lv_style_prop_t trans_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
+    LV_STYLE_TRANSFORM_WIDTH, LV_STYLE_TRANSFORM_HEIGHT,
+    LV_STYLE_TRANSLATE_Y, LV_STYLE_TRANSLATE_X,
+    LV_STYLE_TRANSFORM_ZOOM, LV_STYLE_TRANSFORM_ANGLE,
+    LV_STYLE_COLOR_FILTER_OPA, LV_STYLE_COLOR_FILTER_DSC,
+    0
+};
+
+static const lv_style_transition_dsc_t trans_delayed = {
+    .props = trans_props, .path_xcb = lv_anim_path_linear, .time = TRANSITION_TIME, .delay = 70
+};
+
+static const lv_style_transition_dsc_t trans_normal = {
+    .props = trans_props, .path_xcb = lv_anim_path_linear, .time = TRANSITION_TIME, .delay = 0
+};
+#endif
+
+static const lv_color_filter_dsc_t dark_filter = {.filter_cb = dark_color_filter_cb};
+static const lv_color_filter_dsc_t grey_filter = {.filter_cb = grey_filter_cb};
+
+/*The styles of the widgets in the order they are added*/
+static const style_ref_t scr_styles[] = {
+    STYLE(scr, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+
+static const style_ref_t obj_styles[] = {
+    STYLE(card, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+
+#if LV_USE_TABVIEW
+static const style_ref_t tabview_page_styles[] = {
+    STYLE(pad_normal, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+#endif
+
+#if LV_USE_WIN
+static const style_ref_t win_header_styles[] = {
+    STYLE(bg_color_grey, 0),
+    STYLE(pad_tiny, 0),
+};
+
+static const style_ref_t win_content_styles[] = {
+    STYLE(scr, 0),
+    STYLE(pad_normal, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+#endif
+
+#if LV_USE_BTN
+static const style_ref_t btn_styles[] = {
+    STYLE(btn, 0),
+    STYLE(bg_color_primary, 0),
+    STYLE(transition_delayed, 0),
+    STYLE(pressed, LV_STATE_PRESSED),
+    STYLE(transition_normal, LV_STATE_PRESSED),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+#if LV_THEME_DEFAULT_GROW
+    STYLE(grow, LV_STATE_PRESSED),
+#endif
+    STYLE(bg_color_secondary, LV_STATE_CHECKED),
+    STYLE(disabled, LV_STATE_DISABLED),
+};
+
+#if LV_USE_MENU
+static const style_ref_t btn_menu_header_styles[] = {
+    STYLE(menu_header_btn, 0),
+    STYLE(menu_pressed, LV_STATE_PRESSED),
+};
+#endif
+#endif
+
+#if LV_USE_LINE
+static const style_ref_t line_styles[] = {
+    STYLE(line, 0),
+};
+#endif
+
+#if LV_USE_BTNMATRIX
+static const style_ref_t btnmatrix_styles[] = {
+    STYLE(card, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(btn, LV_PART_ITEMS),
+    STYLE(disabled, LV_PART_ITEMS | LV_STATE_DISABLED),
+    STYLE(pressed, LV_PART_ITEMS | LV_STATE_PRESSED),
+    STYLE(bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED),
+    STYLE(outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED),
+};
+
+#if LV_USE_MSGBOX
+static const style_ref_t msgbox_btnmatrix_styles[] = {
+    STYLE(msgbox_btn_bg, 0),
+    STYLE(pad_gap, 0),
+    STYLE(btn, LV_PART_ITEMS),
+    STYLE(pressed, LV_PART_ITEMS | LV_STATE_PRESSED),
+    STYLE(disabled, LV_PART_ITEMS | LV_STATE_DISABLED),
+    STYLE(bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED),
+    STYLE(bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY),
+    STYLE(bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED),
+};
+#endif
+
+#if LV_USE_TABVIEW
+static const style_ref_t tabview_btnmatrix_styles[] = {
+    STYLE(bg_color_white, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(tab_bg_focus, LV_STATE_FOCUS_KEY),
+    STYLE(pressed, LV_PART_ITEMS | LV_STATE_PRESSED),
+    STYLE(bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_CHECKED),
+    STYLE(tab_btn, LV_PART_ITEMS | LV_STATE_CHECKED),
+    STYLE(outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED),
+    STYLE(tab_bg_focus, LV_PART_ITEMS | LV_STATE_FOCUS_KEY),
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const style_ref_t calendar_btnmatrix_styles[] = {
+    STYLE(calendar_btnm_bg, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(calendar_btnm_day, LV_PART_ITEMS),
+    STYLE(pressed, LV_PART_ITEMS | LV_STATE_PRESSED),
+    STYLE(disabled, LV_PART_ITEMS | LV_STATE_DISABLED),
+    STYLE(outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED),
+};
+#endif
+#endif
+
+#if LV_USE_BAR
+static const style_ref_t bar_styles[] = {
+    STYLE(bg_color_primary_muted, 0),
+    STYLE(circle, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(bg_color_primary, LV_PART_INDICATOR),
+    STYLE(circle, LV_PART_INDICATOR),
+};
+#endif
+
+#if LV_USE_SLIDER
+static const style_ref_t slider_styles[] = {
+    STYLE(bg_color_primary_muted, 0),
+    STYLE(circle, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(bg_color_primary, LV_PART_INDICATOR),
+    STYLE(circle, LV_PART_INDICATOR),
+    STYLE(knob, LV_PART_KNOB),
+#if LV_THEME_DEFAULT_GROW
+    STYLE(grow, LV_PART_KNOB | LV_STATE_PRESSED),
+#endif
+    STYLE(transition_delayed, LV_PART_KNOB),
+    STYLE(transition_normal, LV_PART_KNOB | LV_STATE_PRESSED),
+};
+#endif
+
+#if LV_USE_TABLE
+static const style_ref_t table_styles[] = {
+    STYLE(card, 0),
+    STYLE(pad_zero, 0),
+    STYLE(no_radius, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+    STYLE(bg_color_white, LV_PART_ITEMS),
+    STYLE(table_cell, LV_PART_ITEMS),
+    STYLE(pad_normal, LV_PART_ITEMS),
+    STYLE(pressed, LV_PART_ITEMS | LV_STATE_PRESSED),
+    STYLE(bg_color_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY),
+    STYLE(bg_color_secondary, LV_PART_ITEMS | LV_STATE_EDITED),
+};
+#endif
+
+#if LV_USE_CHECKBOX
+static const style_ref_t checkbox_styles[] = {
+    STYLE(pad_gap, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(disabled, LV_PART_INDICATOR | LV_STATE_DISABLED),
+    STYLE(cb_marker, LV_PART_INDICATOR),
+    STYLE(bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED),
+    STYLE(cb_marker_checked, LV_PART_INDICATOR | LV_STATE_CHECKED),
+    STYLE(pressed, LV_PART_INDICATOR | LV_STATE_PRESSED),
+#if LV_THEME_DEFAULT_GROW
+    STYLE(grow, LV_PART_INDICATOR | LV_STATE_PRESSED),
+#endif
+    STYLE(transition_normal, LV_PART_INDICATOR | LV_STATE_PRESSED),
+    STYLE(transition_delayed, LV_PART_INDICATOR),
+};
+#endif
+
+#if LV_USE_SWITCH
+static const style_ref_t switch_styles[] = {
+    STYLE(bg_color_grey, 0),
+    STYLE(circle, 0),
+    STYLE(anim_fast, 0),
+    STYLE(disabled, LV_STATE_DISABLED),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED),
+    STYLE(circle, LV_PART_INDICATOR),
+    STYLE(disabled, LV_PART_INDICATOR | LV_STATE_DISABLED),
+    STYLE(knob, LV_PART_KNOB),
+    STYLE(bg_color_white, LV_PART_KNOB),
+    STYLE(switch_knob, LV_PART_KNOB),
+    STYLE(disabled, LV_PART_KNOB | LV_STATE_DISABLED),
+    STYLE(transition_normal, LV_PART_INDICATOR | LV_STATE_CHECKED),
+    STYLE(transition_normal, LV_PART_INDICATOR),
+};
+#endif
+
+#if LV_USE_CHART
+static const style_ref_t chart_styles[] = {
+    STYLE(card, 0),
+    STYLE(pad_small, 0),
+    STYLE(chart_bg, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+    STYLE(chart_series, LV_PART_ITEMS),
+    STYLE(chart_indic, LV_PART_INDICATOR),
+    STYLE(chart_ticks, LV_PART_TICKS),
+    STYLE(chart_series, LV_PART_CURSOR),
+};
+#endif
+
+#if LV_USE_ROLLER
+static const style_ref_t roller_styles[] = {
+    STYLE(card, 0),
+    STYLE(anim, 0),
+    STYLE(line_space_large, 0),
+    STYLE(text_align_center, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(bg_color_primary, LV_PART_SELECTED),
+};
+#endif
+
+#if LV_USE_DROPDOWN
+static const style_ref_t dropdown_styles[] = {
+    STYLE(card, 0),
+    STYLE(pad_small, 0),
+    STYLE(transition_delayed, 0),
+    STYLE(transition_normal, LV_STATE_PRESSED),
+    STYLE(pressed, LV_STATE_PRESSED),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(transition_normal, LV_PART_INDICATOR),
+};
+
+static const style_ref_t dropdownlist_styles[] = {
+    STYLE(card, 0),
+    STYLE(clip_corner, 0),
+    STYLE(line_space_large, 0),
+    STYLE(dropdown_list, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+    STYLE(bg_color_white, LV_PART_SELECTED),
+    STYLE(bg_color_primary, LV_PART_SELECTED | LV_STATE_CHECKED),
+    STYLE(pressed, LV_PART_SELECTED | LV_STATE_PRESSED),
+};
+#endif
+
+#if LV_USE_ARC
+static const style_ref_t arc_styles[] = {
+    STYLE(arc_indic, 0),
+    STYLE(arc_indic, LV_PART_INDICATOR),
+    STYLE(arc_indic_primary, LV_PART_INDICATOR),
+    STYLE(knob, LV_PART_KNOB),
+};
+#endif
+
+#if LV_USE_SPINNER
+static const style_ref_t spinner_styles[] = {
+    STYLE(arc_indic, 0),
+    STYLE(arc_indic, LV_PART_INDICATOR),
+    STYLE(arc_indic_primary, LV_PART_INDICATOR),
+};
+#endif
+
+#if LV_USE_METER
+static const style_ref_t meter_styles[] = {
+    STYLE(card, 0),
+    STYLE(circle, 0),
+    STYLE(meter_indic, LV_PART_INDICATOR),
+};
+#endif
+
+#if LV_USE_TEXTAREA
+static const style_ref_t textarea_styles[] = {
+    STYLE(card, 0),
+    STYLE(pad_small, 0),
+    STYLE(disabled, LV_STATE_DISABLED),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+    STYLE(ta_cursor, LV_PART_CURSOR | LV_STATE_FOCUSED),
+    STYLE(ta_placeholder, LV_PART_TEXTAREA_PLACEHOLDER),
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const style_ref_t calendar_styles[] = {
+    STYLE(card, 0),
+    STYLE(pad_zero, 0),
+};
+
+static const style_ref_t calendar_header_styles[] = {
+    STYLE(calendar_header, 0),
+};
+#endif
+
+#if LV_USE_KEYBOARD
+/*The padding is added after the first style by `keyboard_apply`*/
+static const style_ref_t keyboard_styles[] = {
+    STYLE(scr, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(btn, LV_PART_ITEMS),
+    STYLE(disabled, LV_PART_ITEMS | LV_STATE_DISABLED),
+    STYLE(bg_color_white, LV_PART_ITEMS),
+    STYLE(keyboard_btn_bg, LV_PART_ITEMS),
+    STYLE(pressed, LV_PART_ITEMS | LV_STATE_PRESSED),
+    STYLE(bg_color_grey, LV_PART_ITEMS | LV_STATE_CHECKED),
+    STYLE(bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY),
+    STYLE(bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED),
+};
+#endif
+
+#if LV_USE_LIST
+static const style_ref_t list_styles[] = {
+    STYLE(card, 0),
+    STYLE(list_bg, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+
+static const style_ref_t list_text_styles[] = {
+    STYLE(bg_color_grey, 0),
+    STYLE(list_item_grow, 0),
+};
+
+static const style_ref_t list_btn_styles[] = {
+    STYLE(bg_color_white, 0),
+    STYLE(list_btn, 0),
+    STYLE(bg_color_primary, LV_STATE_FOCUS_KEY),
+    STYLE(list_item_grow, LV_STATE_FOCUS_KEY),
+    STYLE(list_item_grow, LV_STATE_PRESSED),
+    STYLE(pressed, LV_STATE_PRESSED),
+};
+#endif
+
+#if LV_USE_MENU
+static const style_ref_t menu_styles[] = {
+    STYLE(card, 0),
+    STYLE(menu_bg, 0),
+};
+
+static const style_ref_t menu_sidebar_cont_styles[] = {
+    STYLE(menu_sidebar_cont, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+
+static const style_ref_t menu_main_cont_styles[] = {
+    STYLE(menu_main_cont, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+
+static const style_ref_t menu_cont_styles[] = {
+    STYLE(menu_cont, 0),
+    STYLE(menu_pressed, LV_STATE_PRESSED),
+    STYLE(bg_color_primary_muted, LV_STATE_PRESSED | LV_STATE_CHECKED),
+    STYLE(bg_color_primary_muted, LV_STATE_CHECKED),
+    STYLE(bg_color_primary, LV_STATE_FOCUS_KEY),
+};
+
+static const style_ref_t menu_header_cont_styles[] = {
+    STYLE(menu_header_cont, 0),
+};
+
+static const style_ref_t menu_page_styles[] = {
+    STYLE(menu_page, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+
+static const style_ref_t menu_section_styles[] = {
+    STYLE(menu_section, 0),
+};
+
+static const style_ref_t menu_separator_styles[] = {
+    STYLE(menu_separator, 0),
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const style_ref_t msgbox_styles[] = {
+    STYLE(card, 0),
+    STYLE(msgbox_bg, 0),
+};
+
+static const style_ref_t msgbox_backdrop_styles[] = {
+    STYLE(msgbox_backdrop_bg, 0),
+};
+#endif
+
+#if LV_USE_SPINBOX
+static const style_ref_t spinbox_styles[] = {
+    STYLE(card, 0),
+    STYLE(pad_small, 0),
+    STYLE(outline_primary, LV_STATE_FOCUS_KEY),
+    STYLE(outline_secondary, LV_STATE_EDITED),
+    STYLE(bg_color_primary, LV_PART_CURSOR),
+};
+#endif
+
+#if LV_USE_VLIST
+static const style_ref_t vlist_styles[] = {
+    STYLE(card, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+
+static const style_ref_t vlist_row_styles[] = {
+    STYLE(pressed, LV_STATE_PRESSED),
+};
+#endif
+
+#if LV_USE_TILEVIEW
+static const style_ref_t tileview_styles[] = {
+    STYLE(scr, 0),
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+
+static const style_ref_t tileview_tile_styles[] = {
+    STYLE(scrollbar, LV_PART_SCROLLBAR),
+    STYLE(scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED),
+};
+#endif
+
+#if LV_USE_TABVIEW
+static const style_ref_t tabview_styles[] = {
+    STYLE(scr, 0),
+    STYLE(pad_zero, 0),
+};
+#endif
+
+#if LV_USE_WIN
+static const style_ref_t win_styles[] = {
+    STYLE(clip_corner, 0),
+};
+#endif
+
+#if LV_USE_COLORWHEEL
+static const style_ref_t colorwheel_styles[] = {
+    STYLE(colorwheel_main, 0),
+    STYLE(pad_normal, 0),
+    STYLE(bg_color_white, LV_PART_KNOB),
+    STYLE(pad_normal, LV_PART_KNOB),
+};
+#endif
+
+#if LV_USE_LED
+static const style_ref_t led_styles[] = {
+    STYLE(led, 0),
+};
+#endif
+
+/*The styles of the widget classes. Looked up by the exact class of the object*/
+static const class_styles_t class_styles[] = {
+    {&lv_obj_class, STYLE_LIST(obj_styles), obj_apply},
+#if LV_USE_BTN
+#if LV_USE_MENU
+    {&lv_btn_class, STYLE_LIST(btn_styles), btn_apply},
+#else
+    {&lv_btn_class, STYLE_LIST(btn_styles), NULL},
+#endif
+#endif
+#if LV_USE_LINE
+    {&lv_line_class, STYLE_LIST(line_styles), NULL},
+#endif
+#if LV_USE_BTNMATRIX
+    {&lv_btnmatrix_class, STYLE_LIST(btnmatrix_styles), btnmatrix_apply},
+#endif
+#if LV_USE_BAR
+    {&lv_bar_class, STYLE_LIST(bar_styles), NULL},
+#endif
+#if LV_USE_SLIDER
+    {&lv_slider_class, STYLE_LIST(slider_styles), NULL},
+#endif
+#if LV_USE_TABLE
+    {&lv_table_class, STYLE_LIST(table_styles), NULL},
+#endif
+#if LV_USE_CHECKBOX
+    {&lv_checkbox_class, STYLE_LIST(checkbox_styles), NULL},
+#endif
+#if LV_USE_SWITCH
+    {&lv_switch_class, STYLE_LIST(switch_styles), NULL},
+#endif
+#if LV_USE_CHART
+    {&lv_chart_class, STYLE_LIST(chart_styles), NULL},
+#endif
+#if LV_USE_ROLLER
+    {&lv_roller_class, STYLE_LIST(roller_styles), NULL},
+#endif
+#if LV_USE_DROPDOWN
+    {&lv_dropdown_class, STYLE_LIST(dropdown_styles), NULL},
+    {&lv_dropdownlist_class, STYLE_LIST(dropdownlist_styles), NULL},
+#endif
+#if LV_USE_ARC
+    {&lv_arc_class, STYLE_LIST(arc_styles), NULL},
+#endif
+#if LV_USE_SPINNER
+    {&lv_spinner_class, STYLE_LIST(spinner_styles), NULL},
+#endif
+#if LV_USE_METER
+    {&lv_meter_class, STYLE_LIST(meter_styles), NULL},
+#endif
+#if LV_USE_TEXTAREA
+    {&lv_textarea_class, STYLE_LIST(textarea_styles), NULL},
+#endif
+#if LV_USE_CALENDAR
+    {&lv_calendar_class, STYLE_LIST(calendar_styles), NULL},
+#endif
+#if LV_USE_CALENDAR_HEADER_ARROW
+    {&lv_calendar_header_arrow_class, STYLE_LIST(calendar_header_styles), NULL},
+#endif
+#if LV_USE_CALENDAR_HEADER_DROPDOWN
+    {&lv_calendar_header_dropdown_class, STYLE_LIST(calendar_header_styles), NULL},
+#endif
+#if LV_USE_KEYBOARD
+    {&lv_keyboard_class, STYLE_LIST(keyboard_styles), keyboard_apply},
+#endif
+#if LV_USE_LIST
+    {&lv_list_class, STYLE_LIST(list_styles), NULL},
+    {&lv_list_text_class, STYLE_LIST(list_text_styles), NULL},
+    {&lv_list_btn_class, STYLE_LIST(list_btn_styles), NULL},
+#endif
+#if LV_USE_MENU
+    {&lv_menu_class, STYLE_LIST(menu_styles), NULL},
+    {&lv_menu_sidebar_cont_class, STYLE_LIST(menu_sidebar_cont_styles), NULL},
+    {&lv_menu_main_cont_class, STYLE_LIST(menu_main_cont_styles), NULL},
+    {&lv_menu_cont_class, STYLE_LIST(menu_cont_styles), NULL},
+    {&lv_menu_sidebar_header_cont_class, STYLE_LIST(menu_header_cont_styles), NULL},
+    {&lv_menu_main_header_cont_class, STYLE_LIST(menu_header_cont_styles), NULL},
+    {&lv_menu_page_class, STYLE_LIST(menu_page_styles), NULL},
+    {&lv_menu_section_class, STYLE_LIST(menu_section_styles), NULL},
+    {&lv_menu_separator_class, STYLE_LIST(menu_separator_styles), NULL},
+#endif
+#if LV_USE_MSGBOX
+    {&lv_msgbox_class, STYLE_LIST(msgbox_styles), NULL},
+    {&lv_msgbox_backdrop_class, STYLE_LIST(msgbox_backdrop_styles), NULL},
+#endif
+#if LV_USE_SPINBOX
+    {&lv_spinbox_class, STYLE_LIST(spinbox_styles), NULL},
+#endif
+#if LV_USE_VLIST
+    {&lv_vlist_class, STYLE_LIST(vlist_styles), NULL},
+    {&lv_vlist_row_class, STYLE_LIST(vlist_row_styles), NULL},
+#endif
+#if LV_USE_TILEVIEW
+    {&lv_tileview_class, STYLE_LIST(tileview_styles), NULL},
+    {&lv_tileview_tile_class, STYLE_LIST(tileview_tile_styles), NULL},
+#endif
+#if LV_USE_TABVIEW
+    {&lv_tabview_class, STYLE_LIST(tabview_styles), NULL},
+#endif
+#if LV_USE_WIN
+    {&lv_win_class, STYLE_LIST(win_styles), NULL},
+#endif
+#if LV_USE_COLORWHEEL
+    {&lv_colorwheel_class, STYLE_LIST(colorwheel_styles), NULL},
+#endif
+#if LV_USE_LED
+    {&lv_led_class, STYLE_LIST(led_styles), NULL},
+#endif
+};
+
+#if LV_THEME_DEFAULT_CONST
+static bool const_enabled = true;
+
+#include "lv_theme_default_const.h"
+#endif
+
 
 /**********************
  *      MACROS
@@ -202,17 +840,10 @@ static lv_color_t grey_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t col
     else return lv_color_mix(lv_palette_lighten(LV_PALETTE_GREY, 2), color, opa);
 }
 
+/*Also the source of the constant tables in `lv_theme_default_const.h`.
+ *Run `scripts/theme_default_gen.py` after changing it.*/
 static void style_init(void)
 {
-    static const lv_style_prop_t trans_props[] = {
-        LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
-        LV_STYLE_TRANSFORM_WIDTH, LV_STYLE_TRANSFORM_HEIGHT,
-        LV_STYLE_TRANSLATE_Y, LV_STYLE_TRANSLATE_X,
-        LV_STYLE_TRANSFORM_ZOOM, LV_STYLE_TRANSFORM_ANGLE,
-        LV_STYLE_COLOR_FILTER_OPA, LV_STYLE_COLOR_FILTER_DSC,
-        0
-    };
-
     color_scr = theme.flags & MODE_DARK ? DARK_COLOR_SCR : LIGHT_COLOR_SCR;
     color_text = theme.flags & MODE_DARK ? DARK_COLOR_TEXT : LIGHT_COLOR_TEXT;
     color_card = theme.flags & MODE_DARK ? DARK_COLOR_CARD : LIGHT_COLOR_CARD;
@@ -221,21 +852,14 @@ static void style_init(void)
     style_init_reset(&styles->transition_delayed);
     style_init_reset(&styles->transition_normal);
 #if TRANSITION_TIME
-    static lv_style_transition_dsc_t trans_delayed;
-    lv_style_transition_dsc_init(&trans_delayed, trans_props, lv_anim_path_linear, TRANSITION_TIME, 70, NULL);
-
-    static lv_style_transition_dsc_t trans_normal;
-    lv_style_transition_dsc_init(&trans_normal, trans_props, lv_anim_path_linear, TRANSITION_TIME, 0, NULL);
-
     lv_style_set_transition(&styles->transition_delayed, &trans_delayed); /*Go back to default state with delay*/
 
     lv_style_set_transition(&styles->transition_normal, &trans_normal); /*Go back to default state with delay*/
 #endif
 
     style_init_reset(&styles->scrollbar);
-    lv_color_t sb_color = (theme.flags & MODE_DARK) ? lv_palette_darken(LV_PALETTE_GREY,
-                                                                        2) : lv_palette_main(LV_PALETTE_GREY);
-    lv_style_set_bg_color(&styles->scrollbar, sb_color);
+    lv_style_set_bg_color(&styles->scrollbar, (theme.flags & MODE_DARK) ? lv_palette_darken(LV_PALETTE_GREY,
+                                                                                          2) : lv_palette_main(LV_PALETTE_GREY));
 
     lv_style_set_radius(&styles->scrollbar, LV_RADIUS_CIRCLE);
     lv_style_set_pad_all(&styles->scrollbar, lv_disp_dpx(theme.disp, 7));
@@ -297,12 +921,6 @@ static void style_init(void)
     lv_style_set_pad_column(&styles->btn, lv_disp_dpx(theme.disp, 5));
     lv_style_set_pad_row(&styles->btn, lv_disp_dpx(theme.disp, 5));
 
-    static lv_color_filter_dsc_t dark_filter;
-    lv_color_filter_dsc_init(&dark_filter, dark_color_filter_cb);
-
-    static lv_color_filter_dsc_t grey_filter;
-    lv_color_filter_dsc_init(&grey_filter, grey_filter_cb);
-
     style_init_reset(&styles->pressed);
     lv_style_set_color_filter_dsc(&styles->pressed, &dark_filter);
     lv_style_set_color_filter_opa(&styles->pressed, 35);
@@ -648,19 +1266,7 @@ static void style_init(void)
 lv_theme_t * lv_theme_default_init(lv_disp_t * disp, lv_color_t color_primary, lv_color_t color_secondary, bool dark,
                                    const lv_font_t * font)
 {
-
-    /*This trick is required only to avoid the garbage collection of
-     *styles' data if LVGL is used in a binding (e.g. Micropython)
-     *In a general case styles could be in simple `static lv_style_t my_style...` variables*/
-    if(!lv_theme_default_is_inited()) {
-        inited = false;
-        LV_GC_ROOT(_lv_theme_default_styles) = lv_mem_alloc(sizeof(my_theme_styles_t));
-        styles = (my_theme_styles_t *)LV_GC_ROOT(_lv_theme_default_styles);
-    }
-
-    if(LV_HOR_RES <= 320) disp_size = DISP_SMALL;
-    else if(LV_HOR_RES < 720) disp_size = DISP_MEDIUM;
-    else disp_size = DISP_LARGE;
+    disp_size = DISP_SIZE_OF(LV_HOR_RES);
 
     theme.disp = disp;
     theme.color_primary = color_primary;
@@ -671,7 +1277,40 @@ lv_theme_t * lv_theme_default_init(lv_disp_t * disp, lv_color_t color_primary, l
     theme.apply_cb = theme_apply;
     theme.flags = dark ? MODE_DARK : 0;
 
-    style_init();
+#if LV_THEME_DEFAULT_CONST
+    my_theme_styles_t * old_styles = LV_GC_ROOT(_lv_theme_default_styles);
+
+    /*The tables are generated for these parameters. Only the colors and the font are set at runtime.*/
+    if(const_enabled && dark == LV_THEME_DEFAULT_DARK && disp_size == DISP_SIZE_OF(LV_THEME_DEFAULT_CONST_HOR_RES) &&
+       lv_disp_get_dpi(disp) == LV_DPI_DEF && lv_disp_get_dpi(NULL) == LV_DPI_DEF) {
+        LV_GC_ROOT(_lv_theme_default_styles) = (my_theme_styles_t *)&const_styles;
+        styles = (my_theme_styles_t *)&const_styles;
+        const_styles_update();
+#if LV_USE_OBJ_STYLE_CACHE
+        _lv_style_cache_invalidate();
+#endif
+    }
+    else
+#endif
+    {
+        /*This trick is required only to avoid the garbage collection of
+         *styles' data if LVGL is used in a binding (e.g. Micropython)
+         *In a general case styles could be in simple `static lv_style_t my_style...` variables*/
+        if(!lv_theme_default_is_inited() || lv_theme_default_is_const()) {
+            inited = false;
+            LV_GC_ROOT(_lv_theme_default_styles) = lv_mem_alloc(sizeof(my_theme_styles_t));
+            styles = (my_theme_styles_t *)LV_GC_ROOT(_lv_theme_default_styles);
+            /*A few styles are not initialized by `style_init()` but all of them are reset when freed*/
+            lv_memset_00(styles, sizeof(my_theme_styles_t));
+        }
+
+        style_init();
+    }
+
+#if LV_THEME_DEFAULT_CONST
+    /*Switched between the constant tables and RAM*/
+    if(old_styles && old_styles != styles) styles_move(old_styles);
+#endif
 
     if(disp == NULL || lv_disp_get_theme(disp) == &theme) lv_obj_report_style_change(NULL);
 
@@ -694,479 +1333,186 @@ bool lv_theme_default_is_inited(void)
     return  LV_GC_ROOT(_lv_theme_default_styles) == NULL ? false : true;
 }
 
+void lv_theme_default_enable_const(bool en)
+{
+#if LV_THEME_DEFAULT_CONST
+    const_enabled = en;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
+bool lv_theme_default_is_const(void)
+{
+#if LV_THEME_DEFAULT_CONST
+    return LV_GC_ROOT(_lv_theme_default_styles) == &const_styles;
+#else
+    return false;
+#endif
+}
+
 
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 {
     LV_UNUSED(th);
 
     if(lv_obj_get_parent(obj) == NULL) {
-        lv_obj_add_style(obj, &styles->scr, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_styles(obj, scr_styles, sizeof(scr_styles) / sizeof(scr_styles[0]));
         return;
     }
 
-    if(lv_obj_check_type(obj, &lv_obj_class)) {
-#if LV_USE_TABVIEW
-        lv_obj_t * parent = lv_obj_get_parent(obj);
-        /*Tabview content area*/
-        if(lv_obj_check_type(parent, &lv_tabview_class)) {
-            return;
-        }
-        /*Tabview pages*/
-        else if(lv_obj_check_type(lv_obj_get_parent(parent), &lv_tabview_class)) {
-            lv_obj_add_style(obj, &styles->pad_normal, 0);
-            lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-            lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-            return;
-        }
-#endif
-
-#if LV_USE_WIN
-        /*Header*/
-        if(lv_obj_get_index(obj) == 0 && lv_obj_check_type(lv_obj_get_parent(obj), &lv_win_class)) {
-            lv_obj_add_style(obj, &styles->bg_color_grey, 0);
-            lv_obj_add_style(obj, &styles->pad_tiny, 0);
-            return;
-        }
-        /*Content*/
-        else if(lv_obj_get_index(obj) == 1 && lv_obj_check_type(lv_obj_get_parent(obj), &lv_win_class)) {
-            lv_obj_add_style(obj, &styles->scr, 0);
-            lv_obj_add_style(obj, &styles->pad_normal, 0);
-            lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-            lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-            return;
-        }
-#endif
+    uint32_t i;
+    for(i = 0; i < sizeof(class_styles) / sizeof(class_styles[0]); i++) {
+        const class_styles_t * cs = &class_styles[i];
+        if(cs->class_p != obj->class_p) continue;
 
+        if(cs->apply_cb) cs->apply_cb(obj, &cs->list);
+        else add_styles(obj, cs->list.refs, cs->list.cnt);
+        return;
+    }
+}
 
-#if LV_USE_CALENDAR
-        if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_calendar_class)) {
-            /*No style*/
-            return;
-        }
-#endif
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
 
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+static void add_styles(lv_obj_t * obj, const style_ref_t * refs, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_add_style(obj, (lv_style_t *)((uint8_t *)styles + refs[i].style), refs[i].selector);
     }
-#if LV_USE_BTN
-    else if(lv_obj_check_type(obj, &lv_btn_class)) {
-        lv_obj_add_style(obj, &styles->btn, 0);
-        lv_obj_add_style(obj, &styles->bg_color_primary, 0);
-        lv_obj_add_style(obj, &styles->transition_delayed, 0);
-        lv_obj_add_style(obj, &styles->pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-#if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &styles->grow, LV_STATE_PRESSED);
-#endif
-        lv_obj_add_style(obj, &styles->bg_color_secondary, LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->disabled, LV_STATE_DISABLED);
+}
 
-#if LV_USE_MENU
-        if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_menu_sidebar_header_cont_class) ||
-           lv_obj_check_type(lv_obj_get_parent(obj), &lv_menu_main_header_cont_class)) {
-            lv_obj_add_style(obj, &styles->menu_header_btn, 0);
-            lv_obj_add_style(obj, &styles->menu_pressed, LV_STATE_PRESSED);
-        }
-#endif
-    }
-#endif
+static void obj_apply(lv_obj_t * obj, const style_list_t * list)
+{
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    LV_UNUSED(parent);
 
-#if LV_USE_LINE
-    else if(lv_obj_check_type(obj, &lv_line_class)) {
-        lv_obj_add_style(obj, &styles->line, 0);
+#if LV_USE_TABVIEW
+    /*Tabview content area*/
+    if(lv_obj_check_type(parent, &lv_tabview_class)) {
+        return;
+    }
+    /*Tabview pages*/
+    else if(lv_obj_check_type(lv_obj_get_parent(parent), &lv_tabview_class)) {
+        add_styles(obj, tabview_page_styles, sizeof(tabview_page_styles) / sizeof(tabview_page_styles[0]));
+        return;
     }
 #endif
 
-#if LV_USE_BTNMATRIX
-    else if(lv_obj_check_type(obj, &lv_btnmatrix_class)) {
-#if LV_USE_MSGBOX
-        if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_msgbox_class)) {
-            lv_obj_add_style(obj, &styles->msgbox_btn_bg, 0);
-            lv_obj_add_style(obj, &styles->pad_gap, 0);
-            lv_obj_add_style(obj, &styles->btn, LV_PART_ITEMS);
-            lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-            lv_obj_add_style(obj, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-            lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED);
-            lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED);
-            return;
-        }
-#endif
-#if LV_USE_TABVIEW
-        if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_tabview_class)) {
-            lv_obj_add_style(obj, &styles->bg_color_white, 0);
-            lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->tab_bg_focus, LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-            lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_CHECKED);
-            lv_obj_add_style(obj, &styles->tab_btn, LV_PART_ITEMS | LV_STATE_CHECKED);
-            lv_obj_add_style(obj, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
-            lv_obj_add_style(obj, &styles->tab_bg_focus, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+#if LV_USE_WIN
+    if(lv_obj_check_type(parent, &lv_win_class)) {
+        /*Header*/
+        if(lv_obj_get_index(obj) == 0) {
+            add_styles(obj, win_header_styles, sizeof(win_header_styles) / sizeof(win_header_styles[0]));
             return;
         }
-#endif
-
-#if LV_USE_CALENDAR
-        if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_calendar_class)) {
-            lv_obj_add_style(obj, &styles->calendar_btnm_bg, 0);
-            lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-            lv_obj_add_style(obj, &styles->calendar_btnm_day, LV_PART_ITEMS);
-            lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-            lv_obj_add_style(obj, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-            lv_obj_add_style(obj, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
+        /*Content*/
+        else if(lv_obj_get_index(obj) == 1) {
+            add_styles(obj, win_content_styles, sizeof(win_content_styles) / sizeof(win_content_styles[0]));
             return;
         }
-#endif
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->btn, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
-    }
-#endif
-
-#if LV_USE_BAR
-    else if(lv_obj_check_type(obj, &lv_bar_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, 0);
-        lv_obj_add_style(obj, &styles->circle, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->circle, LV_PART_INDICATOR);
-    }
-#endif
-
-#if LV_USE_SLIDER
-    else if(lv_obj_check_type(obj, &lv_slider_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, 0);
-        lv_obj_add_style(obj, &styles->circle, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->circle, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->knob, LV_PART_KNOB);
-#if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &styles->grow, LV_PART_KNOB | LV_STATE_PRESSED);
-#endif
-        lv_obj_add_style(obj, &styles->transition_delayed, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_KNOB | LV_STATE_PRESSED);
-    }
-#endif
-
-#if LV_USE_TABLE
-    else if(lv_obj_check_type(obj, &lv_table_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_zero, 0);
-        lv_obj_add_style(obj, &styles->no_radius, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->table_cell, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->pad_normal, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->bg_color_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
-    }
-#endif
-
-#if LV_USE_CHECKBOX
-    else if(lv_obj_check_type(obj, &lv_checkbox_class)) {
-        lv_obj_add_style(obj, &styles->pad_gap, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_INDICATOR | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->cb_marker, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->cb_marker_checked, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_INDICATOR | LV_STATE_PRESSED);
-#if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &styles->grow, LV_PART_INDICATOR | LV_STATE_PRESSED);
-#endif
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_INDICATOR | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->transition_delayed, LV_PART_INDICATOR);
-    }
-#endif
-
-#if LV_USE_SWITCH
-    else if(lv_obj_check_type(obj, &lv_switch_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_grey, 0);
-        lv_obj_add_style(obj, &styles->circle, 0);
-        lv_obj_add_style(obj, &styles->anim_fast, 0);
-        lv_obj_add_style(obj, &styles->disabled, LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->circle, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_INDICATOR | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->knob, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->switch_knob, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_KNOB | LV_STATE_DISABLED);
-
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_INDICATOR);
     }
 #endif
 
-#if LV_USE_CHART
-    else if(lv_obj_check_type(obj, &lv_chart_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_small, 0);
-        lv_obj_add_style(obj, &styles->chart_bg, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &styles->chart_series, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->chart_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->chart_ticks, LV_PART_TICKS);
-        lv_obj_add_style(obj, &styles->chart_series, LV_PART_CURSOR);
+#if LV_USE_CALENDAR
+    if(lv_obj_check_type(parent, &lv_calendar_class)) {
+        /*No style*/
+        return;
     }
 #endif
 
-#if LV_USE_ROLLER
-    else if(lv_obj_check_type(obj, &lv_roller_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->anim, 0);
-        lv_obj_add_style(obj, &styles->line_space_large, 0);
-        lv_obj_add_style(obj, &styles->text_align_center, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_SELECTED);
-    }
-#endif
+    add_styles(obj, list->refs, list->cnt);
+}
 
-#if LV_USE_DROPDOWN
-    else if(lv_obj_check_type(obj, &lv_dropdown_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_small, 0);
-        lv_obj_add_style(obj, &styles->transition_delayed, 0);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_INDICATOR);
-    }
-    else if(lv_obj_check_type(obj, &lv_dropdownlist_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->clip_corner, 0);
-        lv_obj_add_style(obj, &styles->line_space_large, 0);
-        lv_obj_add_style(obj, &styles->dropdown_list, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_SELECTED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_SELECTED | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_SELECTED | LV_STATE_PRESSED);
-    }
-#endif
+#if LV_USE_BTN && LV_USE_MENU
+static void btn_apply(lv_obj_t * obj, const style_list_t * list)
+{
+    add_styles(obj, list->refs, list->cnt);
 
-#if LV_USE_ARC
-    else if(lv_obj_check_type(obj, &lv_arc_class)) {
-        lv_obj_add_style(obj, &styles->arc_indic, 0);
-        lv_obj_add_style(obj, &styles->arc_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->arc_indic_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->knob, LV_PART_KNOB);
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    if(lv_obj_check_type(parent, &lv_menu_sidebar_header_cont_class) ||
+       lv_obj_check_type(parent, &lv_menu_main_header_cont_class)) {
+        add_styles(obj, btn_menu_header_styles, sizeof(btn_menu_header_styles) / sizeof(btn_menu_header_styles[0]));
     }
+}
 #endif
 
+#if LV_USE_BTNMATRIX
+static void btnmatrix_apply(lv_obj_t * obj, const style_list_t * list)
+{
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    LV_UNUSED(parent);
 
-#if LV_USE_SPINNER
-    else if(lv_obj_check_type(obj, &lv_spinner_class)) {
-        lv_obj_add_style(obj, &styles->arc_indic, 0);
-        lv_obj_add_style(obj, &styles->arc_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->arc_indic_primary, LV_PART_INDICATOR);
-    }
-#endif
-
-#if LV_USE_METER
-    else if(lv_obj_check_type(obj, &lv_meter_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->circle, 0);
-        lv_obj_add_style(obj, &styles->meter_indic, LV_PART_INDICATOR);
+#if LV_USE_MSGBOX
+    if(lv_obj_check_type(parent, &lv_msgbox_class)) {
+        add_styles(obj, msgbox_btnmatrix_styles, sizeof(msgbox_btnmatrix_styles) / sizeof(msgbox_btnmatrix_styles[0]));
+        return;
     }
 #endif
-
-#if LV_USE_TEXTAREA
-    else if(lv_obj_check_type(obj, &lv_textarea_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_small, 0);
-        lv_obj_add_style(obj, &styles->disabled, LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &styles->ta_cursor, LV_PART_CURSOR | LV_STATE_FOCUSED);
-        lv_obj_add_style(obj, &styles->ta_placeholder, LV_PART_TEXTAREA_PLACEHOLDER);
+#if LV_USE_TABVIEW
+    if(lv_obj_check_type(parent, &lv_tabview_class)) {
+        add_styles(obj, tabview_btnmatrix_styles, sizeof(tabview_btnmatrix_styles) / sizeof(tabview_btnmatrix_styles[0]));
+        return;
     }
 #endif
-
 #if LV_USE_CALENDAR
-    else if(lv_obj_check_type(obj, &lv_calendar_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_zero, 0);
-    }
-#endif
-
-#if LV_USE_CALENDAR_HEADER_ARROW
-    else if(lv_obj_check_type(obj, &lv_calendar_header_arrow_class)) {
-        lv_obj_add_style(obj, &styles->calendar_header, 0);
+    if(lv_obj_check_type(parent, &lv_calendar_class)) {
+        add_styles(obj, calendar_btnmatrix_styles, sizeof(calendar_btnmatrix_styles) / sizeof(calendar_btnmatrix_styles[0]));
+        return;
     }
 #endif
 
-#if LV_USE_CALENDAR_HEADER_DROPDOWN
-    else if(lv_obj_check_type(obj, &lv_calendar_header_dropdown_class)) {
-        lv_obj_add_style(obj, &styles->calendar_header, 0);
-    }
+    add_styles(obj, list->refs, list->cnt);
+}
 #endif
 
 #if LV_USE_KEYBOARD
-    else if(lv_obj_check_type(obj, &lv_keyboard_class)) {
-        lv_obj_add_style(obj, &styles->scr, 0);
-        lv_obj_add_style(obj, disp_size == DISP_LARGE ? &styles->pad_small : &styles->pad_tiny, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->btn, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->keyboard_btn_bg, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->bg_color_grey, LV_PART_ITEMS | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED);
-    }
+static void keyboard_apply(lv_obj_t * obj, const style_list_t * list)
+{
+    add_styles(obj, list->refs, 1);
+    lv_obj_add_style(obj, disp_size == DISP_LARGE ? &styles->pad_small : &styles->pad_tiny, 0);
+    add_styles(obj, list->refs + 1, list->cnt - 1);
+}
 #endif
-#if LV_USE_LIST
-    else if(lv_obj_check_type(obj, &lv_list_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->list_bg, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        return;
-    }
-    else if(lv_obj_check_type(obj, &lv_list_text_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_grey, 0);
-        lv_obj_add_style(obj, &styles->list_item_grow, 0);
-    }
-    else if(lv_obj_check_type(obj, &lv_list_btn_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_white, 0);
-        lv_obj_add_style(obj, &styles->list_btn, 0);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->list_item_grow, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->list_item_grow, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->pressed, LV_STATE_PRESSED);
 
+#if LV_THEME_DEFAULT_CONST
+/*Move the objects from `old_styles` to the current styles and free `old_styles` if it was in RAM*/
+static void styles_move(my_theme_styles_t * old_styles)
+{
+    lv_obj_tree_walk(NULL, styles_move_cb, old_styles);
+    lv_disp_t * disp = lv_disp_get_next(NULL);
+    while(disp) {
+        lv_obj_tree_walk(disp->top_layer, styles_move_cb, old_styles);
+        lv_obj_tree_walk(disp->sys_layer, styles_move_cb, old_styles);
+        disp = lv_disp_get_next(disp);
     }
-#endif
-#if LV_USE_MENU
-    else if(lv_obj_check_type(obj, &lv_menu_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->menu_bg, 0);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_sidebar_cont_class)) {
-        lv_obj_add_style(obj, &styles->menu_sidebar_cont, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_main_cont_class)) {
-        lv_obj_add_style(obj, &styles->menu_main_cont, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_cont_class)) {
-        lv_obj_add_style(obj, &styles->menu_cont, 0);
-        lv_obj_add_style(obj, &styles->menu_pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_STATE_PRESSED | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_STATE_FOCUS_KEY);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_sidebar_header_cont_class) ||
-            lv_obj_check_type(obj, &lv_menu_main_header_cont_class)) {
-        lv_obj_add_style(obj, &styles->menu_header_cont, 0);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_page_class)) {
-        lv_obj_add_style(obj, &styles->menu_page, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_section_class)) {
-        lv_obj_add_style(obj, &styles->menu_section, 0);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_separator_class)) {
-        lv_obj_add_style(obj, &styles->menu_separator, 0);
-    }
-#endif
-#if LV_USE_MSGBOX
-    else if(lv_obj_check_type(obj, &lv_msgbox_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->msgbox_bg, 0);
-        return;
-    }
-    else if(lv_obj_check_type(obj, &lv_msgbox_backdrop_class)) {
-        lv_obj_add_style(obj, &styles->msgbox_backdrop_bg, 0);
-    }
-#endif
-#if LV_USE_SPINBOX
-    else if(lv_obj_check_type(obj, &lv_spinbox_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_small, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_CURSOR);
-    }
-#endif
-#if LV_USE_TILEVIEW
-    else if(lv_obj_check_type(obj, &lv_tileview_class)) {
-        lv_obj_add_style(obj, &styles->scr, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_tileview_tile_class)) {
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-#endif
 
-#if LV_USE_TABVIEW
-    else if(lv_obj_check_type(obj, &lv_tabview_class)) {
-        lv_obj_add_style(obj, &styles->scr, 0);
-        lv_obj_add_style(obj, &styles->pad_zero, 0);
-    }
-#endif
+    if(old_styles == &const_styles) return;
 
-#if LV_USE_WIN
-    else if(lv_obj_check_type(obj, &lv_win_class)) {
-        lv_obj_add_style(obj, &styles->clip_corner, 0);
+    lv_style_t * old = (lv_style_t *)old_styles;
+    uint32_t i;
+    for(i = 0; i < sizeof(my_theme_styles_t) / sizeof(lv_style_t); i++) {
+        lv_style_reset(&old[i]);
     }
-#endif
+    lv_mem_free(old_styles);
+}
 
-#if LV_USE_COLORWHEEL
-    else if(lv_obj_check_type(obj, &lv_colorwheel_class)) {
-        lv_obj_add_style(obj, &styles->colorwheel_main, 0);
-        lv_obj_add_style(obj, &styles->pad_normal, 0);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->pad_normal, LV_PART_KNOB);
+static lv_obj_tree_walk_res_t styles_move_cb(lv_obj_t * obj, void * user_data)
+{
+    uint8_t * old_styles = user_data;
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        uint8_t * style = (uint8_t *)obj->styles[i].style;
+        if(style >= old_styles && style < old_styles + sizeof(my_theme_styles_t)) {
+            obj->styles[i].style = (lv_style_t *)((uint8_t *)styles + (style - old_styles));
+        }
     }
-#endif
 
-#if LV_USE_LED
-    else if(lv_obj_check_type(obj, &lv_led_class)) {
-        lv_obj_add_style(obj, &styles->led, 0);
-    }
-#endif
+    return LV_OBJ_TREE_WALK_NEXT;
 }
-
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+#endif
 
 static void style_init_reset(lv_style_t * style)
 {
@@ -51,6 +51,19 @@ lv_theme_t * lv_theme_default_get(void);
  */
 bool lv_theme_default_is_inited(void);
 
+/**
+ * Enable or disable using the constant style tables (`LV_THEME_DEFAULT_CONST`).
+ * It's applied by the next `lv_theme_default_init()`.
+ * @param en    true: use the constant tables if the parameters match (default); false: always create the styles in RAM
+ */
+void lv_theme_default_enable_const(bool en);
+
+/**
+ * Check if the theme uses the constant style tables
+ * @return true: the styles are in the constant tables; false: the styles are in RAM or the theme is not initialized
+ */
+bool lv_theme_default_is_const(void);
+
 /**********************
  *      MACROS
  **********************/
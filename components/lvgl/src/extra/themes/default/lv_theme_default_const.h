@@ -0,0 +1,894 @@
+/**
+ * GENERATED FILE, DO NOT EDIT IT!
+ * @file lv_theme_default_const.h
+ * The styles of the default theme in constant tables.
+ * Generated by scripts/theme_default_gen.py from style_init() of lv_theme_default.c
+ * Included only by lv_theme_default.c
+ */
+
+/* clang-format off */
+
+#define CONST_DPX(n)        _LV_DPX_CALC(LV_DPI_DEF, n)
+#define CONST_DISP_SIZE     DISP_SIZE_OF(LV_THEME_DEFAULT_CONST_HOR_RES)
+#define CONST_COLOR(c)      LV_COLOR_MAKE((((c) >> 16) & 0xFF), (((c) >> 8) & 0xFF), ((c) & 0xFF))
+
+#define CONST_COLOR_SCR     (LV_THEME_DEFAULT_DARK ? 0x15171A : 0xF5F5F5)
+#define CONST_COLOR_TEXT    (LV_THEME_DEFAULT_DARK ? 0xFAFAFA : 0x212121)
+#define CONST_COLOR_CARD    (LV_THEME_DEFAULT_DARK ? 0x282b30 : 0xFFFFFF)
+#define CONST_COLOR_GREY    (LV_THEME_DEFAULT_DARK ? 0x2f3237 : 0xE0E0E0)
+
+#if LV_USE_ASSERT_STYLE
+#define CONST_STYLE(props, groups)                                      \
+    {                                                                   \
+        .sentinel = LV_STYLE_SENTINEL_VALUE,                            \
+        .v_p = { .const_props = props },                                \
+        .prop1 = LV_STYLE_PROP_ANY,                                     \
+        .has_group = groups,                                            \
+        .prop_cnt = sizeof(props) / sizeof((props)[0]) - 1,             \
+    }
+#else
+#define CONST_STYLE(props, groups)                                      \
+    {                                                                   \
+        .v_p = { .const_props = props },                                \
+        .prop1 = LV_STYLE_PROP_ANY,                                     \
+        .has_group = groups,                                            \
+        .prop_cnt = sizeof(props) / sizeof((props)[0]) - 1,             \
+    }
+#endif
+
+#define CONST_GROUP(prop)   (1 << _LV_STYLE_PROP_GROUP(prop))
+
+static const lv_style_const_prop_t transition_delayed_props[] = {
+#if TRANSITION_TIME
+    LV_STYLE_CONST_TRANSITION(&trans_delayed),
+#endif
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t transition_normal_props[] = {
+#if TRANSITION_TIME
+    LV_STYLE_CONST_TRANSITION(&trans_normal),
+#endif
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t scrollbar_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR((LV_THEME_DEFAULT_DARK) ? 0x616161 : 0x9E9E9E)),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_PAD_TOP(CONST_DPX(7)),
+    LV_STYLE_CONST_PAD_BOTTOM(CONST_DPX(7)),
+    LV_STYLE_CONST_PAD_LEFT(CONST_DPX(7)),
+    LV_STYLE_CONST_PAD_RIGHT(CONST_DPX(7)),
+    LV_STYLE_CONST_WIDTH(CONST_DPX(5)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_40),
+#if TRANSITION_TIME
+    LV_STYLE_CONST_TRANSITION(&trans_normal),
+#endif
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t scrollbar_scrolled_props[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t scr_props[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_SCR)),
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t card_props[] = {
+    LV_STYLE_CONST_RADIUS((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(12) : CONST_DPX(8))),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_CARD)),
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(CONST_COLOR_GREY)),
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(2)),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_LINE_COLOR(CONST_COLOR(0x9E9E9E)),
+    LV_STYLE_CONST_LINE_WIDTH(CONST_DPX(1)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static lv_style_const_prop_t outline_primary_props[] = {
+    LV_STYLE_CONST_OUTLINE_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_OUTLINE_WIDTH(CONST_DPX(3)),
+    LV_STYLE_CONST_OUTLINE_PAD(CONST_DPX(3)),
+    LV_STYLE_CONST_OUTLINE_OPA(LV_OPA_50),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static lv_style_const_prop_t outline_secondary_props[] = {
+    LV_STYLE_CONST_OUTLINE_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_OUTLINE_WIDTH(CONST_DPX(3)),
+    LV_STYLE_CONST_OUTLINE_OPA(LV_OPA_50),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t btn_props[] = {
+    LV_STYLE_CONST_RADIUS((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(16) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(8))),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_GREY)),
+#if !(LV_THEME_DEFAULT_DARK)
+    LV_STYLE_CONST_SHADOW_COLOR(CONST_COLOR(0x9E9E9E)),
+    LV_STYLE_CONST_SHADOW_WIDTH(CONST_DPX(3)),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_50),
+    LV_STYLE_CONST_SHADOW_OFS_Y(CONST_DPX(CONST_DPX(4))),
+#endif
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_COLUMN(CONST_DPX(5)),
+    LV_STYLE_CONST_PAD_ROW(CONST_DPX(5)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t pressed_props[] = {
+    LV_STYLE_CONST_COLOR_FILTER_DSC(&dark_filter),
+    LV_STYLE_CONST_COLOR_FILTER_OPA(35),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t disabled_props[] = {
+    LV_STYLE_CONST_COLOR_FILTER_DSC(&grey_filter),
+    LV_STYLE_CONST_COLOR_FILTER_OPA(LV_OPA_50),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t clip_corner_props[] = {
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_BORDER_POST(true),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t pad_normal_props[] = {
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t pad_small_props[] = {
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t pad_gap_props[] = {
+    LV_STYLE_CONST_PAD_ROW(CONST_DPX(10)),
+    LV_STYLE_CONST_PAD_COLUMN(CONST_DPX(10)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t line_space_large_props[] = {
+    LV_STYLE_CONST_TEXT_LINE_SPACE(CONST_DPX(20)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t text_align_center_props[] = {
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t pad_zero_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t pad_tiny_props[] = {
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static lv_style_const_prop_t bg_color_primary_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(0xFFFFFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static lv_style_const_prop_t bg_color_primary_muted_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static lv_style_const_prop_t bg_color_secondary_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(0xFFFFFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static lv_style_const_prop_t bg_color_secondary_muted_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t bg_color_grey_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_GREY)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t bg_color_white_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_CARD)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t circle_props[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t no_radius_props[] = {
+    LV_STYLE_CONST_RADIUS(0),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+#if LV_THEME_DEFAULT_GROW
+static const lv_style_const_prop_t grow_props[] = {
+    LV_STYLE_CONST_TRANSFORM_WIDTH(CONST_DPX(3)),
+    LV_STYLE_CONST_TRANSFORM_HEIGHT(CONST_DPX(3)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+static lv_style_const_prop_t knob_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PAD_TOP(CONST_DPX(6)),
+    LV_STYLE_CONST_PAD_BOTTOM(CONST_DPX(6)),
+    LV_STYLE_CONST_PAD_LEFT(CONST_DPX(6)),
+    LV_STYLE_CONST_PAD_RIGHT(CONST_DPX(6)),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t anim_props[] = {
+    LV_STYLE_CONST_ANIM_TIME(200),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+static const lv_style_const_prop_t anim_fast_props[] = {
+    LV_STYLE_CONST_ANIM_TIME(120),
+    {.prop = LV_STYLE_PROP_INV}
+};
+
+#if LV_USE_ARC
+static const lv_style_const_prop_t arc_indic_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(CONST_COLOR(CONST_COLOR_GREY)),
+    LV_STYLE_CONST_ARC_WIDTH(CONST_DPX(15)),
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_ARC
+static lv_style_const_prop_t arc_indic_primary_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_DROPDOWN
+static const lv_style_const_prop_t dropdown_list_props[] = {
+    LV_STYLE_CONST_MAX_HEIGHT(LV_DPI_DEF * 2),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CHECKBOX
+static lv_style_const_prop_t cb_marker_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_PAD_TOP(CONST_DPX(3)),
+    LV_STYLE_CONST_PAD_BOTTOM(CONST_DPX(3)),
+    LV_STYLE_CONST_PAD_LEFT(CONST_DPX(3)),
+    LV_STYLE_CONST_PAD_RIGHT(CONST_DPX(3)),
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(2)),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_CARD)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_RADIUS((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(12) : CONST_DPX(8)) / 2),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CHECKBOX
+static lv_style_const_prop_t cb_marker_checked_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(NULL),    /*Set at runtime*/
+    LV_STYLE_CONST_BG_IMG_SRC(LV_SYMBOL_OK),
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(0xFFFFFF)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_SWITCH
+static const lv_style_const_prop_t switch_knob_props[] = {
+    LV_STYLE_CONST_PAD_TOP(- CONST_DPX(4)),
+    LV_STYLE_CONST_PAD_BOTTOM(- CONST_DPX(4)),
+    LV_STYLE_CONST_PAD_LEFT(- CONST_DPX(4)),
+    LV_STYLE_CONST_PAD_RIGHT(- CONST_DPX(4)),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0xFFFFFF)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_LINE
+static const lv_style_const_prop_t line_props[] = {
+    LV_STYLE_CONST_LINE_WIDTH(1),
+    LV_STYLE_CONST_LINE_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t chart_bg_props[] = {
+    LV_STYLE_CONST_BORDER_POST(false),
+    LV_STYLE_CONST_PAD_COLUMN(CONST_DPX(10)),
+    LV_STYLE_CONST_LINE_COLOR(CONST_COLOR(CONST_COLOR_GREY)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t chart_series_props[] = {
+    LV_STYLE_CONST_LINE_WIDTH(CONST_DPX(3)),
+    LV_STYLE_CONST_RADIUS(CONST_DPX(3)),
+    LV_STYLE_CONST_WIDTH(CONST_DPX(8)),
+    LV_STYLE_CONST_HEIGHT(CONST_DPX(8)),
+    LV_STYLE_CONST_PAD_COLUMN(CONST_DPX(2)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CHART
+static lv_style_const_prop_t chart_indic_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_WIDTH(CONST_DPX(8)),
+    LV_STYLE_CONST_HEIGHT(CONST_DPX(8)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t chart_ticks_props[] = {
+    LV_STYLE_CONST_LINE_WIDTH(CONST_DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_PAD_TOP(CONST_DPX(2)),
+    LV_STYLE_CONST_PAD_BOTTOM(CONST_DPX(2)),
+    LV_STYLE_CONST_PAD_LEFT(CONST_DPX(2)),
+    LV_STYLE_CONST_PAD_RIGHT(CONST_DPX(2)),
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(0x9E9E9E)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_bg_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_NONE),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_section_props[] = {
+    LV_STYLE_CONST_RADIUS((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(12) : CONST_DPX(8))),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_CARD)),
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_cont_props[] = {
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(1)),
+    LV_STYLE_CONST_BORDER_OPA(LV_OPA_10),
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_NONE),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_sidebar_cont_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(1)),
+    LV_STYLE_CONST_BORDER_OPA(LV_OPA_10),
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_RIGHT),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_main_cont_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_header_cont_props[] = {
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_header_btn_props[] = {
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_TRANSP),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_TRANSP),
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_page_props[] = {
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_pressed_props[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0x9E9E9E)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t menu_separator_props[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_TRANSP),
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_METER
+static const lv_style_const_prop_t meter_marker_props[] = {
+    LV_STYLE_CONST_LINE_WIDTH(CONST_DPX(5)),
+    LV_STYLE_CONST_LINE_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_WIDTH(CONST_DPX(20)),
+    LV_STYLE_CONST_HEIGHT(CONST_DPX(20)),
+    LV_STYLE_CONST_PAD_LEFT(CONST_DPX(15)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_METER
+static const lv_style_const_prop_t meter_indic_props[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_WIDTH(CONST_DPX(15)),
+    LV_STYLE_CONST_HEIGHT(CONST_DPX(15)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_TABLE
+static const lv_style_const_prop_t table_cell_props[] = {
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(1)),
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(CONST_COLOR_GREY)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_TOP | LV_BORDER_SIDE_BOTTOM),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_TEXTAREA
+static const lv_style_const_prop_t ta_cursor_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(CONST_COLOR_TEXT)),
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(2)),
+    LV_STYLE_CONST_PAD_LEFT(- CONST_DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_LEFT),
+    LV_STYLE_CONST_ANIM_TIME(400),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_TEXTAREA
+static const lv_style_const_prop_t ta_placeholder_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(CONST_COLOR((LV_THEME_DEFAULT_DARK) ? 0x616161 : 0xBDBDBD)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t calendar_btnm_bg_props[] = {
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10)) / 2),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10)) / 2),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t calendar_btnm_day_props[] = {
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(1)),
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(CONST_COLOR_GREY)),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(CONST_COLOR_CARD)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t calendar_header_props[] = {
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(8) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(6) : CONST_DPX(2))),
+    LV_STYLE_CONST_PAD_ROW((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_COLORWHEEL
+static const lv_style_const_prop_t colorwheel_main_props[] = {
+    LV_STYLE_CONST_ARC_WIDTH(CONST_DPX(10)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t msgbox_btn_bg_props[] = {
+    LV_STYLE_CONST_PAD_TOP(CONST_DPX(4)),
+    LV_STYLE_CONST_PAD_BOTTOM(CONST_DPX(4)),
+    LV_STYLE_CONST_PAD_LEFT(CONST_DPX(4)),
+    LV_STYLE_CONST_PAD_RIGHT(CONST_DPX(4)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t msgbox_bg_props[] = {
+    LV_STYLE_CONST_MAX_WIDTH(LV_PCT(100)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t msgbox_backdrop_bg_props[] = {
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0x9E9E9E)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_50),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_KEYBOARD
+static const lv_style_const_prop_t keyboard_btn_bg_props[] = {
+    LV_STYLE_CONST_SHADOW_WIDTH(0),
+    LV_STYLE_CONST_RADIUS(CONST_DISP_SIZE == DISP_SMALL ? (CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(12) : CONST_DPX(8)) / 2 : (CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(12) : CONST_DPX(8))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_TABVIEW
+static lv_style_const_prop_t tab_btn_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(0)),    /*Set at runtime*/
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(2) * 2),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_TABVIEW
+static const lv_style_const_prop_t tab_bg_focus_props[] = {
+    LV_STYLE_CONST_OUTLINE_PAD(-CONST_DPX(2)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t list_bg_props[] = {
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t list_btn_props[] = {
+    LV_STYLE_CONST_BORDER_WIDTH(CONST_DPX(1)),
+    LV_STYLE_CONST_BORDER_COLOR(CONST_COLOR(CONST_COLOR_GREY)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_PAD_TOP((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_BOTTOM((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_LEFT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_RIGHT((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    LV_STYLE_CONST_PAD_COLUMN((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(14) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(12) : CONST_DPX(10))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t list_item_grow_props[] = {
+    LV_STYLE_CONST_TRANSFORM_WIDTH((CONST_DISP_SIZE == DISP_LARGE ? CONST_DPX(24) : CONST_DISP_SIZE == DISP_MEDIUM ? CONST_DPX(20) : CONST_DPX(16))),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+#if LV_USE_LED
+static const lv_style_const_prop_t led_props[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BG_COLOR(CONST_COLOR(0xFFFFFF)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(CONST_COLOR(0x9E9E9E)),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_SHADOW_WIDTH(CONST_DPX(15)),
+    LV_STYLE_CONST_SHADOW_COLOR(CONST_COLOR(0xFFFFFF)),
+    LV_STYLE_CONST_SHADOW_SPREAD(CONST_DPX(5)),
+    {.prop = LV_STYLE_PROP_INV}
+};
+#endif
+
+static const my_theme_styles_t const_styles = {
+    .transition_delayed = CONST_STYLE(transition_delayed_props, CONST_GROUP(LV_STYLE_TRANSITION)),
+    .transition_normal = CONST_STYLE(transition_normal_props, CONST_GROUP(LV_STYLE_TRANSITION)),
+    .scrollbar = CONST_STYLE(scrollbar_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_WIDTH) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_TRANSITION)),
+    .scrollbar_scrolled = CONST_STYLE(scrollbar_scrolled_props, CONST_GROUP(LV_STYLE_BG_OPA)),
+    .scr = CONST_STYLE(scr_props, CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_TEXT_COLOR) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+    .card = CONST_STYLE(card_props, CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_BORDER_POST) | CONST_GROUP(LV_STYLE_TEXT_COLOR) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN) | CONST_GROUP(LV_STYLE_LINE_COLOR) | CONST_GROUP(LV_STYLE_LINE_WIDTH)),
+    .outline_primary = CONST_STYLE(outline_primary_props, CONST_GROUP(LV_STYLE_OUTLINE_COLOR) | CONST_GROUP(LV_STYLE_OUTLINE_WIDTH) | CONST_GROUP(LV_STYLE_OUTLINE_PAD) | CONST_GROUP(LV_STYLE_OUTLINE_OPA)),
+    .outline_secondary = CONST_STYLE(outline_secondary_props, CONST_GROUP(LV_STYLE_OUTLINE_COLOR) | CONST_GROUP(LV_STYLE_OUTLINE_WIDTH) | CONST_GROUP(LV_STYLE_OUTLINE_OPA)),
+    .btn = CONST_STYLE(btn_props, CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_SHADOW_COLOR) | CONST_GROUP(LV_STYLE_SHADOW_WIDTH) | CONST_GROUP(LV_STYLE_SHADOW_OPA) | CONST_GROUP(LV_STYLE_SHADOW_OFS_Y) | CONST_GROUP(LV_STYLE_TEXT_COLOR) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_COLUMN) | CONST_GROUP(LV_STYLE_PAD_ROW)),
+    .pressed = CONST_STYLE(pressed_props, CONST_GROUP(LV_STYLE_COLOR_FILTER_DSC) | CONST_GROUP(LV_STYLE_COLOR_FILTER_OPA)),
+    .disabled = CONST_STYLE(disabled_props, CONST_GROUP(LV_STYLE_COLOR_FILTER_DSC) | CONST_GROUP(LV_STYLE_COLOR_FILTER_OPA)),
+    .clip_corner = CONST_STYLE(clip_corner_props, CONST_GROUP(LV_STYLE_CLIP_CORNER) | CONST_GROUP(LV_STYLE_BORDER_POST)),
+    .pad_normal = CONST_STYLE(pad_normal_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+    .pad_small = CONST_STYLE(pad_small_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+    .pad_gap = CONST_STYLE(pad_gap_props, CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+    .line_space_large = CONST_STYLE(line_space_large_props, CONST_GROUP(LV_STYLE_TEXT_LINE_SPACE)),
+    .text_align_center = CONST_STYLE(text_align_center_props, CONST_GROUP(LV_STYLE_TEXT_ALIGN)),
+    .pad_zero = CONST_STYLE(pad_zero_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+    .pad_tiny = CONST_STYLE(pad_tiny_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+    .bg_color_primary = CONST_STYLE(bg_color_primary_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_TEXT_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA)),
+    .bg_color_primary_muted = CONST_STYLE(bg_color_primary_muted_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_TEXT_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA)),
+    .bg_color_secondary = CONST_STYLE(bg_color_secondary_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_TEXT_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA)),
+    .bg_color_secondary_muted = CONST_STYLE(bg_color_secondary_muted_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_TEXT_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA)),
+    .bg_color_grey = CONST_STYLE(bg_color_grey_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_TEXT_COLOR)),
+    .bg_color_white = CONST_STYLE(bg_color_white_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_TEXT_COLOR)),
+    .circle = CONST_STYLE(circle_props, CONST_GROUP(LV_STYLE_RADIUS)),
+    .no_radius = CONST_STYLE(no_radius_props, CONST_GROUP(LV_STYLE_RADIUS)),
+#if LV_THEME_DEFAULT_GROW
+    .grow = CONST_STYLE(grow_props, CONST_GROUP(LV_STYLE_TRANSFORM_WIDTH) | CONST_GROUP(LV_STYLE_TRANSFORM_HEIGHT)),
+#endif
+    .knob = CONST_STYLE(knob_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_RADIUS)),
+    .anim = CONST_STYLE(anim_props, CONST_GROUP(LV_STYLE_ANIM_TIME)),
+    .anim_fast = CONST_STYLE(anim_fast_props, CONST_GROUP(LV_STYLE_ANIM_TIME)),
+#if LV_USE_ARC
+    .arc_indic = CONST_STYLE(arc_indic_props, CONST_GROUP(LV_STYLE_ARC_COLOR) | CONST_GROUP(LV_STYLE_ARC_WIDTH) | CONST_GROUP(LV_STYLE_ARC_ROUNDED)),
+#endif
+#if LV_USE_ARC
+    .arc_indic_primary = CONST_STYLE(arc_indic_primary_props, CONST_GROUP(LV_STYLE_ARC_COLOR)),
+#endif
+#if LV_USE_DROPDOWN
+    .dropdown_list = CONST_STYLE(dropdown_list_props, CONST_GROUP(LV_STYLE_MAX_HEIGHT)),
+#endif
+#if LV_USE_CHECKBOX
+    .cb_marker = CONST_STYLE(cb_marker_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_RADIUS)),
+#endif
+#if LV_USE_CHECKBOX
+    .cb_marker_checked = CONST_STYLE(cb_marker_checked_props, CONST_GROUP(LV_STYLE_BG_IMG_SRC) | CONST_GROUP(LV_STYLE_TEXT_COLOR) | CONST_GROUP(LV_STYLE_TEXT_FONT)),
+#endif
+#if LV_USE_SWITCH
+    .switch_knob = CONST_STYLE(switch_knob_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_BG_COLOR)),
+#endif
+#if LV_USE_LINE
+    .line = CONST_STYLE(line_props, CONST_GROUP(LV_STYLE_LINE_WIDTH) | CONST_GROUP(LV_STYLE_LINE_COLOR)),
+#endif
+#if LV_USE_CHART
+    .chart_bg = CONST_STYLE(chart_bg_props, CONST_GROUP(LV_STYLE_BORDER_POST) | CONST_GROUP(LV_STYLE_PAD_COLUMN) | CONST_GROUP(LV_STYLE_LINE_COLOR)),
+#endif
+#if LV_USE_CHART
+    .chart_series = CONST_STYLE(chart_series_props, CONST_GROUP(LV_STYLE_LINE_WIDTH) | CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_WIDTH) | CONST_GROUP(LV_STYLE_HEIGHT) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+#endif
+#if LV_USE_CHART
+    .chart_indic = CONST_STYLE(chart_indic_props, CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_WIDTH) | CONST_GROUP(LV_STYLE_HEIGHT) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA)),
+#endif
+#if LV_USE_CHART
+    .chart_ticks = CONST_STYLE(chart_ticks_props, CONST_GROUP(LV_STYLE_LINE_WIDTH) | CONST_GROUP(LV_STYLE_LINE_COLOR) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_TEXT_COLOR)),
+#endif
+#if LV_USE_MENU
+    .menu_bg = CONST_STYLE(menu_bg_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN) | CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_CLIP_CORNER) | CONST_GROUP(LV_STYLE_BORDER_SIDE)),
+#endif
+#if LV_USE_MENU
+    .menu_section = CONST_STYLE(menu_section_props, CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_CLIP_CORNER) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_TEXT_COLOR)),
+#endif
+#if LV_USE_MENU
+    .menu_cont = CONST_STYLE(menu_cont_props, CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN) | CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_BORDER_OPA) | CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BORDER_SIDE)),
+#endif
+#if LV_USE_MENU
+    .menu_sidebar_cont = CONST_STYLE(menu_sidebar_cont_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN) | CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_BORDER_OPA) | CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BORDER_SIDE)),
+#endif
+#if LV_USE_MENU
+    .menu_main_cont = CONST_STYLE(menu_main_cont_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+#endif
+#if LV_USE_MENU
+    .menu_header_cont = CONST_STYLE(menu_header_cont_props, CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+#endif
+#if LV_USE_MENU
+    .menu_header_btn = CONST_STYLE(menu_header_btn_props, CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_SHADOW_OPA) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_TEXT_COLOR)),
+#endif
+#if LV_USE_MENU
+    .menu_page = CONST_STYLE(menu_page_props, CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+#endif
+#if LV_USE_MENU
+    .menu_pressed = CONST_STYLE(menu_pressed_props, CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_BG_COLOR)),
+#endif
+#if LV_USE_MENU
+    .menu_separator = CONST_STYLE(menu_separator_props, CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM)),
+#endif
+#if LV_USE_METER
+    .meter_marker = CONST_STYLE(meter_marker_props, CONST_GROUP(LV_STYLE_LINE_WIDTH) | CONST_GROUP(LV_STYLE_LINE_COLOR) | CONST_GROUP(LV_STYLE_WIDTH) | CONST_GROUP(LV_STYLE_HEIGHT) | CONST_GROUP(LV_STYLE_PAD_LEFT)),
+#endif
+#if LV_USE_METER
+    .meter_indic = CONST_STYLE(meter_indic_props, CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_WIDTH) | CONST_GROUP(LV_STYLE_HEIGHT)),
+#endif
+#if LV_USE_TABLE
+    .table_cell = CONST_STYLE(table_cell_props, CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BORDER_SIDE)),
+#endif
+#if LV_USE_TEXTAREA
+    .ta_cursor = CONST_STYLE(ta_cursor_props, CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_BORDER_SIDE) | CONST_GROUP(LV_STYLE_ANIM_TIME)),
+#endif
+#if LV_USE_TEXTAREA
+    .ta_placeholder = CONST_STYLE(ta_placeholder_props, CONST_GROUP(LV_STYLE_TEXT_COLOR)),
+#endif
+#if LV_USE_CALENDAR
+    .calendar_btnm_bg = CONST_STYLE(calendar_btnm_bg_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+#endif
+#if LV_USE_CALENDAR
+    .calendar_btnm_day = CONST_STYLE(calendar_btnm_day_props, CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA)),
+#endif
+#if LV_USE_CALENDAR
+    .calendar_header = CONST_STYLE(calendar_header_props, CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+#endif
+#if LV_USE_COLORWHEEL
+    .colorwheel_main = CONST_STYLE(colorwheel_main_props, CONST_GROUP(LV_STYLE_ARC_WIDTH)),
+#endif
+#if LV_USE_MSGBOX
+    .msgbox_btn_bg = CONST_STYLE(msgbox_btn_bg_props, CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT)),
+#endif
+#if LV_USE_MSGBOX
+    .msgbox_bg = CONST_STYLE(msgbox_bg_props, CONST_GROUP(LV_STYLE_MAX_WIDTH)),
+#endif
+#if LV_USE_MSGBOX
+    .msgbox_backdrop_bg = CONST_STYLE(msgbox_backdrop_bg_props, CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_OPA)),
+#endif
+#if LV_USE_KEYBOARD
+    .keyboard_btn_bg = CONST_STYLE(keyboard_btn_bg_props, CONST_GROUP(LV_STYLE_SHADOW_WIDTH) | CONST_GROUP(LV_STYLE_RADIUS)),
+#endif
+#if LV_USE_TABVIEW
+    .tab_btn = CONST_STYLE(tab_btn_props, CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_BORDER_SIDE)),
+#endif
+#if LV_USE_TABVIEW
+    .tab_bg_focus = CONST_STYLE(tab_bg_focus_props, CONST_GROUP(LV_STYLE_OUTLINE_PAD)),
+#endif
+#if LV_USE_LIST
+    .list_bg = CONST_STYLE(list_bg_props, CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_ROW) | CONST_GROUP(LV_STYLE_PAD_COLUMN) | CONST_GROUP(LV_STYLE_CLIP_CORNER)),
+#endif
+#if LV_USE_LIST
+    .list_btn = CONST_STYLE(list_btn_props, CONST_GROUP(LV_STYLE_BORDER_WIDTH) | CONST_GROUP(LV_STYLE_BORDER_COLOR) | CONST_GROUP(LV_STYLE_BORDER_SIDE) | CONST_GROUP(LV_STYLE_PAD_TOP) | CONST_GROUP(LV_STYLE_PAD_BOTTOM) | CONST_GROUP(LV_STYLE_PAD_LEFT) | CONST_GROUP(LV_STYLE_PAD_RIGHT) | CONST_GROUP(LV_STYLE_PAD_COLUMN)),
+#endif
+#if LV_USE_LIST
+    .list_item_grow = CONST_STYLE(list_item_grow_props, CONST_GROUP(LV_STYLE_TRANSFORM_WIDTH)),
+#endif
+#if LV_USE_LED
+    .led = CONST_STYLE(led_props, CONST_GROUP(LV_STYLE_BG_OPA) | CONST_GROUP(LV_STYLE_BG_COLOR) | CONST_GROUP(LV_STYLE_BG_GRAD_COLOR) | CONST_GROUP(LV_STYLE_RADIUS) | CONST_GROUP(LV_STYLE_SHADOW_WIDTH) | CONST_GROUP(LV_STYLE_SHADOW_COLOR) | CONST_GROUP(LV_STYLE_SHADOW_SPREAD)),
+#endif
+};
+
+/*Set the values depending on the parameters of `lv_theme_default_init()`*/
+static void const_styles_update(void)
+{
+    outline_primary_props[0].value.color = theme.color_primary;
+    outline_secondary_props[0].value.color = theme.color_secondary;
+    bg_color_primary_props[0].value.color = theme.color_primary;
+    bg_color_primary_muted_props[0].value.color = theme.color_primary;
+    bg_color_primary_muted_props[1].value.color = theme.color_primary;
+    bg_color_secondary_props[0].value.color = theme.color_secondary;
+    bg_color_secondary_muted_props[0].value.color = theme.color_secondary;
+    bg_color_secondary_muted_props[1].value.color = theme.color_secondary;
+    knob_props[0].value.color = theme.color_primary;
+#if LV_USE_ARC
+    arc_indic_primary_props[0].value.color = theme.color_primary;
+#endif
+#if LV_USE_CHECKBOX
+    cb_marker_props[0].value.color = theme.color_primary;
+#endif
+#if LV_USE_CHECKBOX
+    cb_marker_checked_props[0].value.ptr = theme.font_small;
+#endif
+#if LV_USE_CHART
+    chart_indic_props[0].value.color = theme.color_primary;
+#endif
+#if LV_USE_TABVIEW
+    tab_btn_props[0].value.color = theme.color_primary;
+#endif
+}
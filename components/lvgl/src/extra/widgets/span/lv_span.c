@@ -66,7 +66,7 @@ static lv_coord_t convert_indent_pct(lv_obj_t * spans, lv_coord_t width);
 /**********************
  *  STATIC VARIABLES
  **********************/
-static struct _snippet_stack snippet_stack;
+static LV_REFR_CTX_THREAD_LOCAL struct _snippet_stack snippet_stack;
 
 const lv_obj_class_t lv_spangroup_class  = {
     .base_class = &lv_obj_class,
@@ -0,0 +1,537 @@
+/**
+ * @file lv_vlist.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_vlist.h"
+#if LV_USE_VLIST
+
+#include "../../../misc/lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS    &lv_vlist_class
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void lv_vlist_row_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void update_rows(lv_obj_t * obj);
+static void reset_row_ids(lv_obj_t * obj);
+static void rebuild_rows(lv_obj_t * obj);
+static void bind_row(lv_obj_t * obj, uint32_t slot, uint32_t index);
+static lv_coord_t get_content_w(lv_obj_t * obj);
+static lv_coord_t get_row_y(lv_obj_t * obj, uint32_t index);
+static lv_obj_t * default_create_row(lv_obj_t * obj);
+static void default_update_row(lv_obj_t * obj, lv_obj_t * row, uint32_t index);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+const lv_obj_class_t lv_vlist_class = {
+    .constructor_cb = lv_vlist_constructor,
+    .destructor_cb = lv_vlist_destructor,
+    .event_cb = lv_vlist_event,
+    .width_def = (LV_DPI_DEF * 3) / 2,
+    .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_vlist_t),
+    .scroll_copy = 1,
+    .base_class = &lv_obj_class
+};
+
+const lv_obj_class_t lv_vlist_row_class = {
+    .constructor_cb = lv_vlist_row_constructor,
+    .width_def = LV_PCT(100),
+    .base_class = &lv_obj_class
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_vlist_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_vlist_set_row_cnt(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_cnt == cnt) return;
+
+    if(vlist->row_h > 0 && cnt > (uint32_t)(LV_COORD_MAX / vlist->row_h)) {
+        LV_LOG_WARN("%"LV_PRIu32" rows don't fit into lv_coord_t. Enable LV_USE_LARGE_COORD.", cnt);
+    }
+
+    vlist->row_cnt = cnt;
+    /*Hide the rows after the end first to not count them in the scroll area*/
+    lv_obj_refresh_self_size(obj);
+    update_rows(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+    lv_obj_invalidate(obj);
+}
+
+void lv_vlist_set_row_height(lv_obj_t * obj, lv_coord_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_h == h) return;
+
+    vlist->row_h = h;
+
+    /*Every row goes to a new position, so simply rebind them*/
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        lv_obj_set_height(lv_obj_get_child(obj, i), h);
+    }
+    reset_row_ids(obj);
+
+    /*Hide the rows after the end first to not count them in the scroll area*/
+    lv_obj_refresh_self_size(obj);
+    update_rows(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+    lv_obj_invalidate(obj);
+}
+
+void lv_vlist_set_overscan(lv_obj_t * obj, uint16_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->overscan = cnt;
+    update_rows(obj);
+}
+
+void lv_vlist_set_row_cb(lv_obj_t * obj, lv_vlist_create_row_cb_t create_cb, lv_vlist_update_row_cb_t update_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->create_row_cb = create_cb;
+    vlist->update_row_cb = update_cb;
+    rebuild_rows(obj);
+}
+
+void lv_vlist_set_text_cb(lv_obj_t * obj, lv_vlist_get_text_cb_t get_text_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->get_text_cb = get_text_cb;
+    lv_vlist_refresh(obj);
+}
+
+void lv_vlist_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(col_cnt == 0) col_cnt = 1;
+    if(vlist->col_cnt == col_cnt) return;
+
+    lv_coord_t * new_col_w = lv_mem_realloc(vlist->col_w, col_cnt * sizeof(lv_coord_t));
+    LV_ASSERT_MALLOC(new_col_w);
+    if(new_col_w == NULL) return;
+    vlist->col_w = new_col_w;
+
+    /*Initialize the new columns*/
+    uint16_t i;
+    for(i = vlist->col_cnt; i < col_cnt; i++) {
+        vlist->col_w[i] = LV_DPI_DEF;
+    }
+    if(col_cnt > 1 && LV_COORD_IS_PCT(vlist->col_w[0])) vlist->col_w[0] = LV_DPI_DEF;
+
+    vlist->col_cnt = col_cnt;
+    lv_obj_refresh_self_size(obj);
+    rebuild_rows(obj);
+}
+
+void lv_vlist_set_col_width(lv_obj_t * obj, uint16_t col, lv_coord_t w)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(col >= vlist->col_cnt) {
+        LV_LOG_WARN("invalid column: %d", col);
+        return;
+    }
+
+    vlist->col_w[col] = w;
+    lv_obj_refresh_self_size(obj);
+    rebuild_rows(obj);
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+uint32_t lv_vlist_get_row_cnt(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    return vlist->row_cnt;
+}
+
+lv_coord_t lv_vlist_get_row_height(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    return vlist->row_h;
+}
+
+lv_obj_t * lv_vlist_get_row(lv_obj_t * obj, uint32_t index)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_id_cnt != lv_obj_get_child_cnt(obj)) return NULL;
+
+    uint32_t i;
+    for(i = 0; i < vlist->row_id_cnt; i++) {
+        if(vlist->row_ids[i] == index) return lv_obj_get_child(obj, i);
+    }
+
+    return NULL;
+}
+
+uint32_t lv_vlist_get_row_index(lv_obj_t * obj, lv_obj_t * row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(lv_obj_get_parent(row) != obj) return LV_VLIST_ROW_NONE;
+
+    uint32_t slot = lv_obj_get_index(row);
+    if(slot >= vlist->row_id_cnt) return LV_VLIST_ROW_NONE;
+
+    return vlist->row_ids[slot];
+}
+
+/*=====================
+ * Other functions
+ *====================*/
+
+void lv_vlist_refresh(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    reset_row_ids(obj);
+    update_rows(obj);
+}
+
+void lv_vlist_scroll_to_row(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(index >= vlist->row_cnt) return;
+
+    lv_coord_t y = get_row_y(obj, index);
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(obj);
+    lv_coord_t view_h = lv_obj_get_content_height(obj);
+
+    if(y < scroll_y) lv_obj_scroll_to_y(obj, y, anim_en);
+    else if(y + vlist->row_h > scroll_y + view_h) lv_obj_scroll_to_y(obj, y + vlist->row_h - view_h, anim_en);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->row_cnt = 0;
+    vlist->row_ids = NULL;
+    vlist->row_id_cnt = 0;
+    vlist->create_row_cb = NULL;
+    vlist->update_row_cb = NULL;
+    vlist->get_text_cb = NULL;
+    vlist->row_h = LV_DPX(40);
+    vlist->overscan = 2;
+    vlist->col_cnt = 1;
+    vlist->col_w = lv_mem_alloc(sizeof(lv_coord_t));
+    LV_ASSERT_MALLOC(vlist->col_w);
+    vlist->col_w[0] = LV_PCT(100);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_vlist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    lv_mem_free(vlist->row_ids);
+    vlist->row_ids = NULL;
+    lv_mem_free(vlist->col_w);
+    vlist->col_w = NULL;
+}
+
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_res_t res;
+
+    /*Call the ancestor's event handler*/
+    res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RES_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        update_rows(obj);
+    }
+    else if(code == LV_EVENT_GET_SELF_SIZE) {
+        lv_point_t * p = lv_event_get_param(e);
+        p->y = LV_MAX(p->y, get_row_y(obj, vlist->row_cnt));
+
+        lv_coord_t w = get_content_w(obj);
+        if(!LV_COORD_IS_PCT(w)) p->x = LV_MAX(p->x, w);
+    }
+    else if(code == LV_EVENT_CHILD_DELETED) {
+        /*Don't know which row was deleted, so forget all bindings. `lv_vlist_refresh` will create the rows again*/
+        reset_row_ids(obj);
+    }
+}
+
+static void lv_vlist_row_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_EVENT_BUBBLE);
+}
+
+/**
+ * Create, bind and hide the row objects to cover the visible area (plus the overscan).
+ * Rows which are still on the visible area are not touched.
+ * @param obj       pointer to a virtual list
+ */
+static void update_rows(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_id_cnt != lv_obj_get_child_cnt(obj)) reset_row_ids(obj);
+
+    /*Find the range of rows to show. `last` is exclusive.*/
+    uint32_t first = 0;
+    uint32_t last = 0;
+    if(vlist->row_cnt > 0 && vlist->row_h > 0) {
+        int32_t scroll_y = LV_MAX(lv_obj_get_scroll_y(obj), 0);
+        int32_t view_h = lv_obj_get_content_height(obj);
+        int32_t f = scroll_y / vlist->row_h - vlist->overscan;
+        int32_t l = (scroll_y + view_h + vlist->row_h - 1) / vlist->row_h + vlist->overscan;
+        first = LV_MAX(f, 0);
+        last = LV_MIN((uint32_t)LV_MAX(l, 0), vlist->row_cnt);
+        if(first > last) first = last;
+    }
+
+    /*Release the rows which are scrolled out*/
+    uint32_t used_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < vlist->row_id_cnt; i++) {
+        uint32_t id = vlist->row_ids[i];
+        if(id == LV_VLIST_ROW_NONE) continue;
+        if(id < first || id >= last) vlist->row_ids[i] = LV_VLIST_ROW_NONE;
+        else used_cnt++;
+    }
+
+    /*Create new row objects only if there are not enough to reuse*/
+    while(vlist->row_id_cnt < last - first) {
+        uint32_t * new_ids = lv_mem_realloc(vlist->row_ids, (vlist->row_id_cnt + 1) * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(new_ids);
+        if(new_ids == NULL) return;
+        vlist->row_ids = new_ids;
+
+        lv_obj_t * row = vlist->create_row_cb ? vlist->create_row_cb(obj) : default_create_row(obj);
+        if(row == NULL || lv_obj_get_parent(row) != obj) {
+            LV_LOG_WARN("the rows needs to be created on the virtual list");
+            return;
+        }
+        lv_obj_set_height(row, vlist->row_h);
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        vlist->row_ids[vlist->row_id_cnt] = LV_VLIST_ROW_NONE;
+        vlist->row_id_cnt++;
+    }
+
+    /*Bind the rows which are not shown yet to the free row objects.
+     *Only a few rows at the edges are bound in a scroll step.*/
+    if(used_cnt < last - first) {
+        uint32_t slot = 0;
+        uint32_t id;
+        for(id = first; id < last; id++) {
+            bool shown = false;
+            for(i = 0; i < vlist->row_id_cnt; i++) {
+                if(vlist->row_ids[i] == id) {
+                    shown = true;
+                    break;
+                }
+            }
+            if(shown) continue;
+
+            while(vlist->row_ids[slot] != LV_VLIST_ROW_NONE) slot++;
+            bind_row(obj, slot, id);
+        }
+    }
+
+    /*Hide the unused rows*/
+    for(i = 0; i < vlist->row_id_cnt; i++) {
+        if(vlist->row_ids[i] != LV_VLIST_ROW_NONE) continue;
+        lv_obj_t * row = lv_obj_get_child(obj, i);
+        if(!lv_obj_has_flag(row, LV_OBJ_FLAG_HIDDEN)) lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * Forget which data is shown on the row objects. The objects are kept.
+ * @param obj       pointer to a virtual list
+ */
+static void reset_row_ids(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    if(child_cnt != vlist->row_id_cnt) {
+        lv_mem_free(vlist->row_ids);
+        vlist->row_ids = NULL;
+        vlist->row_id_cnt = 0;
+        if(child_cnt) {
+            vlist->row_ids = lv_mem_alloc(child_cnt * sizeof(uint32_t));
+            LV_ASSERT_MALLOC(vlist->row_ids);
+            if(vlist->row_ids == NULL) return;
+            vlist->row_id_cnt = child_cnt;
+        }
+    }
+
+    uint32_t i;
+    for(i = 0; i < vlist->row_id_cnt; i++) {
+        vlist->row_ids[i] = LV_VLIST_ROW_NONE;
+    }
+}
+
+/**
+ * Delete all the row objects and create new ones. Used when the layout of the rows changes.
+ * @param obj       pointer to a virtual list
+ */
+static void rebuild_rows(lv_obj_t * obj)
+{
+    while(lv_obj_get_child_cnt(obj)) {
+        lv_obj_del(lv_obj_get_child(obj, 0));
+    }
+    update_rows(obj);
+}
+
+static void bind_row(lv_obj_t * obj, uint32_t slot, uint32_t index)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    lv_obj_t * row = lv_obj_get_child(obj, slot);
+
+    vlist->row_ids[slot] = index;
+    lv_obj_set_y(row, get_row_y(obj, index));
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+
+    if(vlist->update_row_cb) vlist->update_row_cb(obj, row, index);
+    else default_update_row(obj, row, index);
+}
+
+/**
+ * Get the width of the default rows
+ * @param obj       pointer to a virtual list
+ * @return          sum of the column widths or `LV_PCT(100)` if a column has a percentage width
+ */
+static lv_coord_t get_content_w(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    lv_coord_t w = 0;
+    uint16_t i;
+    for(i = 0; i < vlist->col_cnt; i++) {
+        if(LV_COORD_IS_PCT(vlist->col_w[i])) return LV_PCT(100);
+        w += vlist->col_w[i];
+    }
+
+    return w;
+}
+
+/*Y coordinate of a row, limited to `LV_COORD_MAX` instead of overflowing with many rows*/
+static lv_coord_t get_row_y(lv_obj_t * obj, uint32_t index)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_h <= 0) return 0;
+    if(index > (uint32_t)(LV_COORD_MAX / vlist->row_h)) return LV_COORD_MAX;
+    return (lv_coord_t)(index * (uint32_t)vlist->row_h);
+}
+
+static lv_obj_t * default_create_row(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    lv_obj_t * row = lv_obj_class_create_obj(&lv_vlist_row_class, obj);
+    lv_obj_class_init_obj(row);
+    lv_obj_set_width(row, get_content_w(obj));
+
+    lv_coord_t x = 0;
+    uint16_t i;
+    for(i = 0; i < vlist->col_cnt; i++) {
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+        lv_label_set_text_static(label, "");
+        lv_obj_set_width(label, vlist->col_w[i]);
+        lv_obj_align(label, LV_ALIGN_LEFT_MID, x, 0);
+        if(!LV_COORD_IS_PCT(vlist->col_w[i])) x += vlist->col_w[i];
+    }
+
+    return row;
+}
+
+static void default_update_row(lv_obj_t * obj, lv_obj_t * row, uint32_t index)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    uint16_t i;
+    for(i = 0; i < vlist->col_cnt; i++) {
+        lv_obj_t * label = lv_obj_get_child(row, i);
+        if(label == NULL) break;
+
+        const char * txt = vlist->get_text_cb ? vlist->get_text_cb(obj, index, i) : NULL;
+        lv_label_set_text(label, txt ? txt : "");
+    }
+}
+
+#endif /*LV_USE_VLIST*/
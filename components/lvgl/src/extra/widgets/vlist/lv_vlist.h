@@ -0,0 +1,199 @@
+/**
+ * @file lv_vlist.h
+ * Virtual list: a scrollable list or table of many rows with fixed height.
+ * Only the rows on the visible area (and a few around it) are created as objects.
+ * While scrolling these objects are reused and filled from a callback.
+ */
+
+#ifndef LV_VLIST_H
+#define LV_VLIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+
+#if LV_USE_VLIST
+
+/*Testing of dependencies*/
+#if LV_USE_LABEL == 0
+#error "lv_vlist: lv_label is required. Enable it in lv_conf.h (LV_USE_LABEL  1) "
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_VLIST_ROW_NONE   UINT32_MAX
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Create a new row object. It has to be created as a child of the virtual list.
+ * Its height and position are set by the virtual list.
+ */
+typedef lv_obj_t * (*lv_vlist_create_row_cb_t)(lv_obj_t * vlist);
+
+/**
+ * Show the data of the `index`th row on a (reused) row object
+ */
+typedef void (*lv_vlist_update_row_cb_t)(lv_obj_t * vlist, lv_obj_t * row, uint32_t index);
+
+/**
+ * Get the text of a cell for the default rows. The text is copied, so it can be in a temporary buffer.
+ */
+typedef const char * (*lv_vlist_get_text_cb_t)(lv_obj_t * vlist, uint32_t row, uint16_t col);
+
+/*Data of virtual list*/
+typedef struct {
+    lv_obj_t obj;
+    uint32_t row_cnt;                   /*Number of rows in the data source*/
+    uint32_t * row_ids;                 /*Index of the data shown by each child or `LV_VLIST_ROW_NONE`*/
+    uint32_t row_id_cnt;                /*Number of elements in `row_ids`*/
+    lv_coord_t * col_w;
+    lv_vlist_create_row_cb_t create_row_cb;
+    lv_vlist_update_row_cb_t update_row_cb;
+    lv_vlist_get_text_cb_t get_text_cb;
+    lv_coord_t row_h;
+    uint16_t col_cnt;
+    uint16_t overscan;                  /*Number of extra rows above and below the visible area*/
+} lv_vlist_t;
+
+extern const lv_obj_class_t lv_vlist_class;
+extern const lv_obj_class_t lv_vlist_row_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a virtual list object
+ * @param parent    pointer to an object, it will be the parent of the new virtual list
+ * @return          pointer to the created virtual list
+ */
+lv_obj_t * lv_vlist_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set the number of rows in the data source. Only the visible rows are created as objects.
+ * @param obj       pointer to a virtual list
+ * @param cnt       number of rows
+ */
+void lv_vlist_set_row_cnt(lv_obj_t * obj, uint32_t cnt);
+
+/**
+ * Set the height of the rows
+ * @param obj       pointer to a virtual list
+ * @param h         height of a row in pixels
+ */
+void lv_vlist_set_row_height(lv_obj_t * obj, lv_coord_t h);
+
+/**
+ * Set how many rows to keep ready above and below the visible area
+ * @param obj       pointer to a virtual list
+ * @param cnt       number of extra rows on each side (default 2)
+ */
+void lv_vlist_set_overscan(lv_obj_t * obj, uint16_t cnt);
+
+/**
+ * Set the callbacks to create custom row objects and to show the data on them.
+ * With `NULL` callbacks the default rows are used: a label in each column filled by the `get_text_cb`.
+ * @param obj       pointer to a virtual list
+ * @param create_cb called when a new row object is required
+ * @param update_cb called when a row object is bound to a data row
+ */
+void lv_vlist_set_row_cb(lv_obj_t * obj, lv_vlist_create_row_cb_t create_cb, lv_vlist_update_row_cb_t update_cb);
+
+/**
+ * Set the callback which gives the text of the cells on the default rows
+ * @param obj       pointer to a virtual list
+ * @param get_text_cb   the callback
+ */
+void lv_vlist_set_text_cb(lv_obj_t * obj, lv_vlist_get_text_cb_t get_text_cb);
+
+/**
+ * Set the number of columns of the default rows
+ * @param obj       pointer to a virtual list
+ * @param col_cnt   number of columns
+ */
+void lv_vlist_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt);
+
+/**
+ * Set the width of a column of the default rows
+ * @param obj       pointer to a virtual list
+ * @param col       index of the column [0 .. col_cnt -1]
+ * @param w         width of the column
+ */
+void lv_vlist_set_col_width(lv_obj_t * obj, uint16_t col, lv_coord_t w);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the number of rows in the data source
+ * @param obj       pointer to a virtual list
+ * @return          number of rows
+ */
+uint32_t lv_vlist_get_row_cnt(lv_obj_t * obj);
+
+/**
+ * Get the height of the rows
+ * @param obj       pointer to a virtual list
+ * @return          height of a row
+ */
+lv_coord_t lv_vlist_get_row_height(lv_obj_t * obj);
+
+/**
+ * Get the object showing a row
+ * @param obj       pointer to a virtual list
+ * @param index     index of the row in the data source
+ * @return          the row object or `NULL` if the row is not created now
+ */
+lv_obj_t * lv_vlist_get_row(lv_obj_t * obj, uint32_t index);
+
+/**
+ * Get the index of the data shown on a row object. Useful in the event handlers of the rows.
+ * @param obj       pointer to a virtual list
+ * @param row       a row object (a child of the virtual list)
+ * @return          index of the row in the data source or `LV_VLIST_ROW_NONE` if it's not used
+ */
+uint32_t lv_vlist_get_row_index(lv_obj_t * obj, lv_obj_t * row);
+
+/*=====================
+ * Other functions
+ *====================*/
+
+/**
+ * Show the new data on all the created rows. Call it when the data source has changed.
+ * @param obj       pointer to a virtual list
+ */
+void lv_vlist_refresh(lv_obj_t * obj);
+
+/**
+ * Scroll to a row to make it visible
+ * @param obj       pointer to a virtual list
+ * @param index     index of the row
+ * @param anim_en   LV_ANIM_ON: scroll with animation
+ */
+void lv_vlist_scroll_to_row(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_VLIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VLIST_H*/
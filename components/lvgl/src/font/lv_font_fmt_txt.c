@@ -14,6 +14,7 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
 #include "../misc/lv_mem.h"
+#include "../core/lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -50,12 +51,12 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
  *  STATIC VARIABLES
  **********************/
 #if LV_USE_FONT_COMPRESSED
-    static uint32_t rle_rdp;
-    static const uint8_t * rle_in;
-    static uint8_t rle_bpp;
-    static uint8_t rle_prev_v;
-    static uint8_t rle_cnt;
-    static rle_state_t rle_state;
+    static LV_REFR_CTX_THREAD_LOCAL uint32_t rle_rdp;
+    static LV_REFR_CTX_THREAD_LOCAL const uint8_t * rle_in;
+    static LV_REFR_CTX_THREAD_LOCAL uint8_t rle_bpp;
+    static LV_REFR_CTX_THREAD_LOCAL uint8_t rle_prev_v;
+    static LV_REFR_CTX_THREAD_LOCAL uint8_t rle_cnt;
+    static LV_REFR_CTX_THREAD_LOCAL rle_state_t rle_state;
 #endif /*LV_USE_FONT_COMPRESSED*/
 
 /**********************
@@ -65,6 +66,7 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
 /**********************
  *      MACROS
  **********************/
+#define DECOMPR_BUF     _LV_REFR_CTX_ROOT(font_decompr_buf, _lv_font_decompr_buf)
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -92,8 +94,17 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
     /*Handle compressed bitmap*/
     else {
 #if LV_USE_FONT_COMPRESSED
-        static size_t last_buf_size = 0;
-        if(LV_GC_ROOT(_lv_font_decompr_buf) == NULL) last_buf_size = 0;
+#if LV_USE_REFR_CTX
+        /*Every display being refreshed decompresses into its own buffer*/
+        _lv_refr_ctx_t * ctx = _lv_refr_ctx_get_act();
+        uint8_t ** decompr_buf = &ctx->font_decompr_buf;
+        uint32_t * last_buf_size = &ctx->font_decompr_buf_size;
+#else
+        static uint32_t last_buf_size_common = 0;
+        uint8_t ** decompr_buf = &LV_GC_ROOT(_lv_font_decompr_buf);
+        uint32_t * last_buf_size = &last_buf_size_common;
+#endif
+        if(*decompr_buf == NULL) *last_buf_size = 0;
 
         uint32_t gsize = gdsc->box_w * gdsc->box_h;
         if(gsize == 0) return NULL;
@@ -115,18 +126,18 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
                 break;
         }
 
-        if(last_buf_size < buf_size) {
-            uint8_t * tmp = lv_mem_realloc(LV_GC_ROOT(_lv_font_decompr_buf), buf_size);
+        if(*last_buf_size < buf_size) {
+            uint8_t * tmp = lv_mem_realloc(*decompr_buf, buf_size);
             LV_ASSERT_MALLOC(tmp);
             if(tmp == NULL) return NULL;
-            LV_GC_ROOT(_lv_font_decompr_buf) = tmp;
-            last_buf_size = buf_size;
+            *decompr_buf = tmp;
+            *last_buf_size = buf_size;
         }
 
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], LV_GC_ROOT(_lv_font_decompr_buf), gdsc->box_w, gdsc->box_h,
+        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], *decompr_buf, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
-        return LV_GC_ROOT(_lv_font_decompr_buf);
+        return *decompr_buf;
 #else /*!LV_USE_FONT_COMPRESSED*/
         LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
         return NULL;
@@ -195,9 +206,9 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
 void _lv_font_clean_up_fmt_txt(void)
 {
 #if LV_USE_FONT_COMPRESSED
-    if(LV_GC_ROOT(_lv_font_decompr_buf)) {
-        lv_mem_free(LV_GC_ROOT(_lv_font_decompr_buf));
-        LV_GC_ROOT(_lv_font_decompr_buf) = NULL;
+    if(DECOMPR_BUF) {
+        lv_mem_free(DECOMPR_BUF);
+        DECOMPR_BUF = NULL;
     }
 #endif
 }
@@ -212,8 +223,15 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
+#if LV_USE_REFR_CTX
+    /*The cache is shared by the displays refreshed concurrently and its 2 fields can't be updated atomically*/
+    lv_font_fmt_txt_glyph_cache_t * cache = NULL;
+#else
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+#endif
+
     /*Check the cache first*/
-    if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+    if(cache && letter == cache->last_letter) return cache->last_glyph_id;
 
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
@@ -252,16 +270,16 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
         }
 
         /*Update the cache*/
-        if(fdsc->cache) {
-            fdsc->cache->last_letter = letter;
-            fdsc->cache->last_glyph_id = glyph_id;
+        if(cache) {
+            cache->last_letter = letter;
+            cache->last_glyph_id = glyph_id;
         }
         return glyph_id;
     }
 
-    if(fdsc->cache) {
-        fdsc->cache->last_letter = letter;
-        fdsc->cache->last_glyph_id = 0;
+    if(cache) {
+        cache->last_letter = letter;
+        cache->last_glyph_id = 0;
     }
     return 0;
 
@@ -23,6 +23,7 @@
 #include "../draw/stm32_dma2d/lv_gpu_stm32_dma2d.h"
 #include "../draw/swm341_dma2d/lv_gpu_swm341_dma2d.h"
 #include "../draw/arm2d/lv_gpu_arm2d.h"
+#include "../draw/esp32/lv_gpu_esp32_pie.h"
 #if LV_USE_GPU_NXP_PXP || LV_USE_GPU_NXP_VG_LITE
     #include "../draw/nxp/lv_gpu_nxp.h"
 #endif
@@ -117,6 +118,10 @@ void lv_disp_drv_init(lv_disp_drv_t * driver)
     driver->draw_ctx_init = lv_draw_arm2d_ctx_init;
     driver->draw_ctx_deinit = lv_draw_arm2d_ctx_init;
     driver->draw_ctx_size = sizeof(lv_draw_arm2d_ctx_t);
+#elif LV_USE_GPU_ESP32_PIE
+    driver->draw_ctx_init = lv_draw_esp32_pie_ctx_init;
+    driver->draw_ctx_deinit = lv_draw_esp32_pie_ctx_deinit;
+    driver->draw_ctx_size = sizeof(lv_draw_esp32_pie_ctx_t);
 #else
     driver->draw_ctx_init = lv_draw_sw_init_ctx;
     driver->draw_ctx_deinit = lv_draw_sw_init_ctx;
@@ -150,6 +155,24 @@ void lv_disp_draw_buf_init(lv_disp_draw_buf_t * draw_buf, void * buf1, void * bu
     draw_buf->size    = size_in_px_cnt;
 }
 
+#if LV_USE_DISP_BUF_RING
+void lv_disp_draw_buf_init_ring(lv_disp_draw_buf_t * draw_buf, void * bufs[], uint32_t buf_cnt,
+                                uint32_t size_in_px_cnt)
+{
+    LV_ASSERT_NULL(bufs);
+    LV_ASSERT(buf_cnt >= 1 && buf_cnt <= LV_DISP_BUF_RING_MAX);
+    if(buf_cnt > LV_DISP_BUF_RING_MAX) buf_cnt = LV_DISP_BUF_RING_MAX;
+
+    lv_disp_draw_buf_init(draw_buf, bufs[0], buf_cnt > 1 ? bufs[1] : NULL, size_in_px_cnt);
+
+    uint32_t i;
+    for(i = 0; i < buf_cnt; i++) {
+        draw_buf->ring[i] = bufs[i];
+    }
+    draw_buf->ring_cnt = buf_cnt;
+}
+#endif
+
 /**
  * Register an initialized display driver.
  * Automatically set the first display as active.
@@ -190,6 +213,14 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t * driver)
         return NULL;
     }
 
+#if LV_USE_REFR_CTX
+    _lv_refr_ctx_create(disp);
+#endif
+
+#if LV_USE_FRAME_PACING
+    disp->pacing_div = 1;
+#endif
+
     if(driver->full_refresh && driver->draw_buf->size < (uint32_t)driver->hor_res * driver->ver_res) {
         driver->full_refresh = 0;
         LV_LOG_WARN("full_refresh requires at least screen sized draw buffer(s)");
@@ -310,6 +341,9 @@ void lv_disp_remove(lv_disp_t * disp)
 
     _lv_ll_remove(&LV_GC_ROOT(_lv_disp_ll), disp);
     if(disp->refr_timer) lv_timer_del(disp->refr_timer);
+#if LV_USE_REFR_CTX
+    _lv_refr_ctx_delete(disp);
+#endif
     lv_mem_free(disp);
 
     if(was_default) lv_disp_set_default(_lv_ll_get_head(&LV_GC_ROOT(_lv_disp_ll)));
@@ -523,6 +557,27 @@ LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_last(lv_disp_drv_t * disp_drv)
     return disp_drv->draw_buf->flushing_last;
 }
 
+#if LV_USE_FRAME_PACING
+/**
+ * Tell that the display started to show a new frame (vsync or tearing effect signal).
+ * After the first call the refreshing of the display is started only right after a vsync.
+ * Can be called from an interrupt.
+ * @param disp      pointer to a display
+ */
+LV_ATTRIBUTE_FLUSH_READY void lv_disp_vsync(lv_disp_t * disp)
+{
+    uint32_t t = lv_tick_get();
+    if(disp->vsync_cnt) {
+        /*Average the period in 1/16 ms to know the fraction of the ms too (e.g. 16.67 ms at 60 Hz)*/
+        uint32_t period = (t - disp->vsync_time) * 16;
+        disp->vsync_period = disp->vsync_period ? (disp->vsync_period * 7 + period) / 8 : period;
+    }
+    disp->vsync_time = t;
+    disp->vsync_cnt++;
+    if(disp->vsync_cnt == 0) disp->vsync_cnt = 1;   /*0 means there is no vsync signal*/
+}
+#endif
+
 /**
  * Get the next display.
  * @param disp pointer to the current display. NULL to initialize.
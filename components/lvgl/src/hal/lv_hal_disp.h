@@ -60,6 +60,19 @@ typedef struct _lv_disp_draw_buf_t {
     volatile int flushing_last;
     volatile uint32_t last_area         : 1; /*1: the last area is being rendered*/
     volatile uint32_t last_part         : 1; /*1: the last part of the current area is being rendered*/
+
+#if LV_USE_DISP_BUF_RING
+    /*Set by `lv_disp_draw_buf_init_ring()`. The buffers are used in order: one is being rendered,
+     *the ones rendered before it wait in a queue and the oldest one is being flushed.*/
+    void * ring[LV_DISP_BUF_RING_MAX];
+    lv_area_t ring_area[LV_DISP_BUF_RING_MAX];  /*Area rendered into the buffer*/
+    uint8_t ring_last[LV_DISP_BUF_RING_MAX];    /*1: it's the last part of the refresh*/
+    uint8_t ring_cnt;                           /*Number of buffers, 0: the ring is not used*/
+    uint8_t ring_head;                          /*Index of the oldest rendered buffer*/
+    uint8_t ring_used;                          /*Number of rendered buffers not flushed yet*/
+    uint8_t ring_sent;                          /*1: the oldest buffer was passed to `flush_cb`*/
+    uint32_t ring_wait_cnt;                     /*Number of times rendering waited for a free buffer*/
+#endif
 } lv_disp_draw_buf_t;
 
 typedef enum {
@@ -151,6 +164,57 @@ typedef struct _lv_disp_drv_t {
 
 } lv_disp_drv_t;
 
+#if LV_USE_REFR_REGION
+/**
+ * Statistics about the invalidated areas of a display. See `lv_refr_get_inv_stats()`.
+ */
+typedef struct {
+    uint32_t inv_cnt;       /**< Number of areas invalidated on the screen*/
+    uint32_t join_cnt;      /**< Number of areas joined into an other to save redraw*/
+    uint32_t overflow_cnt;  /**< Number of areas joined because the invalidated area buffer was full*/
+    uint32_t trim_cnt;      /**< Number of areas made smaller to not redraw the overlap with an other area*/
+    uint32_t refr_cnt;      /**< Number of refreshes*/
+    uint32_t area_cnt;      /**< Number of areas redrawn*/
+    uint32_t px_cnt;        /**< Number of pixels redrawn*/
+} lv_disp_inv_stats_t;
+#endif
+
+#if LV_USE_REFR_OCCLUSION
+/**
+ * Statistics about the drawn and culled objects of a display. See `lv_refr_get_draw_stats()`.
+ */
+typedef struct {
+    uint32_t draw_cnt;      /**< Number of times an object was drawn*/
+    uint32_t draw_px_cnt;   /**< Number of pixels covered by the drawn objects (with overdraw)*/
+    uint32_t cull_cnt;      /**< Number of times an object wasn't drawn because it was covered*/
+    uint32_t cull_px_cnt;   /**< Number of pixels not drawn because they were covered*/
+} lv_disp_draw_stats_t;
+#endif
+
+#if LV_USE_SCROLL_COPY
+/**
+ * Statistics about the scroll steps drawn by moving the rendered pixels. See `lv_refr_get_scroll_copy_stats()`.
+ */
+typedef struct {
+    uint32_t copy_cnt;      /**< Number of scroll steps drawn by moving the pixels*/
+    uint32_t copy_px_cnt;   /**< Number of moved pixels*/
+    uint32_t fallback_cnt;  /**< Number of scroll steps when the whole object had to be redrawn*/
+} lv_disp_scroll_copy_stats_t;
+#endif
+
+#if LV_USE_FRAME_PACING
+/**
+ * Statistics about the frame times of a display. See `lv_refr_get_frame_stats()`.
+ */
+typedef struct {
+    uint32_t frame_cnt;         /**< Number of rendered frames*/
+    uint32_t skip_cnt;          /**< Number of frames missed because rendering took longer than the period*/
+    uint32_t frame_time_max;    /**< The longest render and flush time [ms]*/
+    uint32_t period;            /**< The current period of the frames [ms]*/
+    uint32_t hist[LV_FRAME_PACING_HIST_SIZE];  /**< Number of frames rendered in `index` ms. The last counts the longer too.*/
+} lv_disp_frame_stats_t;
+#endif
+
 /**
  * Display structure.
  * @note `lv_disp_drv_t` should be the first member of the structure.
@@ -188,6 +252,44 @@ uint8_t del_prev  :
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint16_t inv_p;
     int32_t inv_en_cnt;
+#if LV_USE_REFR_REGION
+    lv_disp_inv_stats_t inv_stats;
+#endif
+#if LV_USE_REFR_OCCLUSION
+    lv_disp_draw_stats_t draw_stats;
+#endif
+
+#if LV_USE_SCROLL_COPY
+    lv_area_t scroll_copy_area;         /**< Area to move in the draw buffer before the next refresh*/
+    lv_point_t scroll_copy_ofs;         /**< Offset of the move. (0;0): nothing to move*/
+    lv_disp_scroll_copy_stats_t scroll_copy_stats;
+#endif
+
+#if LV_USE_SCR_PRELOAD
+    struct _lv_obj_t * preload_scr;         /**< The screen being preloaded or loaded from its preloaded layer*/
+    struct _lv_obj_t * preload_prev_scr;    /**< The screen cached while the preloaded screen is loaded with animation*/
+    lv_timer_t * preload_timer;             /**< Runs the preloading steps. NULL if the screen is being loaded.*/
+    uint8_t preload_render : 1;             /**< 1: Render the screen into its cached layer too*/
+    uint8_t preload_ready : 1;              /**< 1: `LV_EVENT_READY` was sent and nothing has changed since then*/
+    uint8_t preload_own_cache : 1;          /**< 1: The layer cache of `preload_scr` was enabled for preloading*/
+    uint8_t preload_own_prev_cache : 1;     /**< 1: The layer cache of `preload_prev_scr` was enabled for the transition*/
+    uint8_t preload_release : 1;            /**< 1: Free the cached layers after the next refresh*/
+#endif
+
+#if LV_USE_REFR_CTX
+    struct _lv_refr_ctx_t * refr_ctx;       /**< The state of refreshing this display. See `lv_refr_disp()`*/
+#endif
+
+#if LV_USE_FRAME_PACING
+    lv_disp_frame_stats_t frame_stats;
+    volatile uint32_t vsync_cnt;            /**< Number of vsync signals. 0: the driver doesn't call `lv_disp_vsync()`*/
+    volatile uint32_t vsync_time;           /**< Time of the last vsync signal*/
+    volatile uint32_t vsync_period;         /**< Measured time between two vsync signals [1/16 ms]*/
+    uint32_t vsync_cnt_refr;                /**< `vsync_cnt` when the last frame was started*/
+    uint32_t pacing_base_period;            /**< Period of the frames without load [ms]. 0: not known yet*/
+    uint32_t pacing_time_avg;               /**< Moving average of the render and flush time [1/16 ms]*/
+    uint32_t pacing_div;                    /**< Render only in every `pacing_div`th vsync or base period*/
+#endif
 
     /*Miscellaneous data*/
     uint32_t last_activity_time;        /**< Last time when there was activity on this display*/
@@ -222,6 +324,23 @@ void lv_disp_drv_init(lv_disp_drv_t * driver);
  */
 void lv_disp_draw_buf_init(lv_disp_draw_buf_t * draw_buf, void * buf1, void * buf2, uint32_t size_in_px_cnt);
 
+#if LV_USE_DISP_BUF_RING
+/**
+ * Initialize a display buffer with more than two buffers.
+ * While the display receives a buffer in `flush_cb` LVGL can render into all the others,
+ * so rendering is stalled only if all of them are waiting to be flushed.
+ * Only used with partial refresh, i.e. if the buffers are smaller than the screen,
+ * and neither `direct_mode`, `full_refresh` nor `sw_rotate` is set. Else `bufs[0]` and `bufs[1]` are used as
+ * with `lv_disp_draw_buf_init()`.
+ * @param draw_buf pointer `lv_disp_draw_buf_t` variable to initialize
+ * @param bufs array of `buf_cnt` buffers, all of the same size
+ * @param buf_cnt number of buffers: 1 .. `LV_DISP_BUF_RING_MAX`
+ * @param size_in_px_cnt size of one buffer in pixel count.
+ */
+void lv_disp_draw_buf_init_ring(lv_disp_draw_buf_t * draw_buf, void * bufs[], uint32_t buf_cnt,
+                                uint32_t size_in_px_cnt);
+#endif
+
 /**
  * Register an initialized display driver.
  * Automatically set the first display as active.
@@ -342,6 +461,16 @@ LV_ATTRIBUTE_FLUSH_READY void lv_disp_flush_ready(lv_disp_drv_t * disp_drv);
  */
 LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_last(lv_disp_drv_t * disp_drv);
 
+#if LV_USE_FRAME_PACING
+/**
+ * Tell that the display started to show a new frame (vsync or tearing effect signal).
+ * After the first call the refreshing of the display is started only right after a vsync.
+ * Can be called from an interrupt.
+ * @param disp      pointer to a display
+ */
+LV_ATTRIBUTE_FLUSH_READY void lv_disp_vsync(lv_disp_t * disp);
+#endif
+
 //! @endcond
 
 /**
@@ -146,8 +146,14 @@ typedef struct _lv_indev_proc_t {
             lv_point_t last_raw_point; /**< Last point read from read_cb. */
             lv_point_t vect; /**< Difference between `act_point` and `last_point`.*/
             lv_point_t scroll_sum; /*Count the dragged pixels to check LV_INDEV_DEF_SCROLL_LIMIT*/
-            lv_point_t scroll_throw_vect;
+            lv_point_t scroll_throw_vect; /*Throw velocity in px per `LV_INDEV_DEF_READ_PERIOD` ms*/
             lv_point_t scroll_throw_vect_ori;
+#if LV_USE_SCROLL_COPY
+            int32_t scroll_throw_v;       /*The throw velocity in 1/65536 px per `LV_INDEV_DEF_READ_PERIOD` ms*/
+            int32_t scroll_throw_rem;     /*Sub-pixel part of the thrown distance in 1/65536 px*/
+            uint32_t scroll_throw_timestamp; /*Time of the last throw step*/
+            uint32_t vect_timestamp;      /*Time when `vect` was measured*/
+#endif
             struct _lv_obj_t * act_obj;      /*The object being pressed*/
             struct _lv_obj_t * last_obj;     /*The last object which was pressed*/
             struct _lv_obj_t * scroll_obj;   /*The object being scrolled*/
@@ -220,6 +220,159 @@
     #endif
 #endif
 
+/*Allow more than two draw buffers with `lv_disp_draw_buf_init_ring()`.
+ *Rendering can go on while several rendered buffers wait for the display, so a slow or bursty
+ *`flush_cb` (e.g. DMA over SPI) stalls the rendering less.*/
+#ifndef LV_USE_DISP_BUF_RING
+    #ifdef CONFIG_LV_USE_DISP_BUF_RING
+        #define LV_USE_DISP_BUF_RING CONFIG_LV_USE_DISP_BUF_RING
+    #else
+        #define LV_USE_DISP_BUF_RING 0
+    #endif
+#endif
+#if LV_USE_DISP_BUF_RING
+    /*Maximal number of buffers in a ring*/
+    #ifndef LV_DISP_BUF_RING_MAX
+        #ifdef CONFIG_LV_DISP_BUF_RING_MAX
+            #define LV_DISP_BUF_RING_MAX CONFIG_LV_DISP_BUF_RING_MAX
+        #else
+            #define LV_DISP_BUF_RING_MAX 4
+        #endif
+    #endif
+#endif
+
+/*Merge the invalidated areas by the cost of redrawing them instead of joining only overlapping ones,
+ *and merge the cheapest areas instead of redrawing the whole screen when there are too many.
+ *See `lv_refr_get_inv_stats()`*/
+#ifndef LV_USE_REFR_REGION
+    #ifdef CONFIG_LV_USE_REFR_REGION
+        #define LV_USE_REFR_REGION CONFIG_LV_USE_REFR_REGION
+    #else
+        #define LV_USE_REFR_REGION 0
+    #endif
+#endif
+#if LV_USE_REFR_REGION
+    /*Overhead of refreshing an area in pixels, i.e. two areas are joined if it saves more than this*/
+    #ifndef LV_REFR_REGION_AREA_COST
+        #ifdef CONFIG_LV_REFR_REGION_AREA_COST
+            #define LV_REFR_REGION_AREA_COST CONFIG_LV_REFR_REGION_AREA_COST
+        #else
+            #define LV_REFR_REGION_AREA_COST 1024
+        #endif
+    #endif
+#endif
+
+/*Don't draw the objects, or the parts of them, which are covered by an opaque younger sibling.
+ *Also skip the previous screen during screen load animations where the new screen covers it.
+ *See `lv_refr_get_draw_stats()`*/
+#ifndef LV_USE_REFR_OCCLUSION
+    #ifdef CONFIG_LV_USE_REFR_OCCLUSION
+        #define LV_USE_REFR_OCCLUSION CONFIG_LV_USE_REFR_OCCLUSION
+    #else
+        #define LV_USE_REFR_OCCLUSION 0
+    #endif
+#endif
+
+/*Retained mode: record the rectangles, labels, images, lines and arcs drawn by the objects and
+ *replay them until the object is invalidated or moved instead of sending the draw events again.
+ *Objects drawing anything else or using masks (e.g. clip corner) are drawn normally.
+ *Costs memory for the recorded draw descriptors of every visible object.
+ *See `lv_refr_set_draw_list()` and `lv_draw_list_get_stats()`*/
+#ifndef LV_USE_DRAW_LIST
+    #ifdef CONFIG_LV_USE_DRAW_LIST
+        #define LV_USE_DRAW_LIST CONFIG_LV_USE_DRAW_LIST
+    #else
+        #define LV_USE_DRAW_LIST 0
+    #endif
+#endif
+#if LV_USE_DRAW_LIST
+    /*Maximum number of draw calls recorded per object part (main and post). Objects drawing more are not cached*/
+    #ifndef LV_DRAW_LIST_MAX_CMD
+        #ifdef CONFIG_LV_DRAW_LIST_MAX_CMD
+            #define LV_DRAW_LIST_MAX_CMD CONFIG_LV_DRAW_LIST_MAX_CMD
+        #else
+            #define LV_DRAW_LIST_MAX_CMD 16
+        #endif
+    #endif
+#endif
+
+/*Allow keeping the rendered image of an object and its children with `lv_obj_set_layer_cache()`.
+ *The image is drawn (with the object's opacity and transformations) while the object and its children don't change.
+ *Layers with transparent parts need LV_COLOR_SCREEN_TRANSP 1, else the object is drawn normally.
+ *See `lv_draw_layer_cache_get_stats()`*/
+#ifndef LV_USE_LAYER_CACHE
+    #ifdef CONFIG_LV_USE_LAYER_CACHE
+        #define LV_USE_LAYER_CACHE CONFIG_LV_USE_LAYER_CACHE
+    #else
+        #define LV_USE_LAYER_CACHE 0
+    #endif
+#endif
+#if LV_USE_LAYER_CACHE
+    /*Memory used for the cached layers [bytes]. The least recently used layers are freed if it's full.*/
+    #ifndef LV_LAYER_CACHE_SIZE
+        #ifdef CONFIG_LV_LAYER_CACHE_SIZE
+            #define LV_LAYER_CACHE_SIZE CONFIG_LV_LAYER_CACHE_SIZE
+        #else
+            #define LV_LAYER_CACHE_SIZE (256 * 1024)
+        #endif
+    #endif
+#endif
+
+/*Draw the scrolling of opaque containers by moving the already rendered pixels and redrawing only the newly visible part.
+ *Works only with `direct_mode` and a single, screen-sized draw buffer. See `lv_refr_get_scroll_copy_stats()`
+ *The scroll throw also slows down by the elapsed time instead of per read period, so it doesn't depend on the frame rate.*/
+#ifndef LV_USE_SCROLL_COPY
+    #ifdef CONFIG_LV_USE_SCROLL_COPY
+        #define LV_USE_SCROLL_COPY CONFIG_LV_USE_SCROLL_COPY
+    #else
+        #define LV_USE_SCROLL_COPY 0
+    #endif
+#endif
+
+/*Give every display its own render context (the display being refreshed, draw masks, temporary buffers, etc.)
+ *so different displays can be refreshed concurrently on different threads/cores with `lv_refr_disp()`,
+ *while the rest of LVGL is not running. The shared caches (images, gradients, layers) are locked.
+ *Requires pthreads. The performance and memory monitors are not supported with concurrent refreshing.*/
+#ifndef LV_USE_REFR_CTX
+    #ifdef CONFIG_LV_USE_REFR_CTX
+        #define LV_USE_REFR_CTX CONFIG_LV_USE_REFR_CTX
+    #else
+        #define LV_USE_REFR_CTX 0
+    #endif
+#endif
+#if LV_USE_REFR_CTX
+    /*Keyword of thread local variables, e.g. `_Thread_local` (C11) or `__thread` (GCC, Clang)*/
+    #ifndef LV_REFR_CTX_THREAD_LOCAL
+        #ifdef CONFIG_LV_REFR_CTX_THREAD_LOCAL
+            #define LV_REFR_CTX_THREAD_LOCAL CONFIG_LV_REFR_CTX_THREAD_LOCAL
+        #else
+            #define LV_REFR_CTX_THREAD_LOCAL __thread
+        #endif
+    #endif
+#endif
+
+/*Pace the refreshing of the displays: adapt the refresh period to the measured render and flush time
+ *to keep a steady frame rate under load instead of alternating between two periods.
+ *If the driver calls `lv_disp_vsync()` on the vsync/tearing effect signal, rendering starts only at a vsync.
+ *See `lv_refr_get_frame_stats()`*/
+#ifndef LV_USE_FRAME_PACING
+    #ifdef CONFIG_LV_USE_FRAME_PACING
+        #define LV_USE_FRAME_PACING CONFIG_LV_USE_FRAME_PACING
+    #else
+        #define LV_USE_FRAME_PACING 0
+    #endif
+#endif
+#if LV_USE_FRAME_PACING
+    /*Number of 1 ms wide bins in the frame time histogram. The last bin counts the longer frames too.*/
+    #ifndef LV_FRAME_PACING_HIST_SIZE
+        #ifdef CONFIG_LV_FRAME_PACING_HIST_SIZE
+            #define LV_FRAME_PACING_HIST_SIZE CONFIG_LV_FRAME_PACING_HIST_SIZE
+        #else
+            #define LV_FRAME_PACING_HIST_SIZE 64
+        #endif
+    #endif
+#endif
+
 /*Input device read period in milliseconds*/
 #ifndef LV_INDEV_DEF_READ_PERIOD
     #ifdef CONFIG_LV_INDEV_DEF_READ_PERIOD
@@ -229,6 +382,27 @@
     #endif
 #endif
 
+/*Index the children of objects with many children (e.g. lists, tables built from objects) by their position
+ *to not check all of them when searching the pressed object. Scrolling doesn't outdate the index,
+ *but moving, resizing, adding or removing objects does. See `lv_indev_enable_hit_index()`*/
+#ifndef LV_USE_INDEV_HIT_INDEX
+    #ifdef CONFIG_LV_USE_INDEV_HIT_INDEX
+        #define LV_USE_INDEV_HIT_INDEX CONFIG_LV_USE_INDEV_HIT_INDEX
+    #else
+        #define LV_USE_INDEV_HIT_INDEX 0
+    #endif
+#endif
+#if LV_USE_INDEV_HIT_INDEX
+    /*Index only the children of objects having at least this many children*/
+    #ifndef LV_INDEV_HIT_INDEX_MIN_CHILD_CNT
+        #ifdef CONFIG_LV_INDEV_HIT_INDEX_MIN_CHILD_CNT
+            #define LV_INDEV_HIT_INDEX_MIN_CHILD_CNT CONFIG_LV_INDEV_HIT_INDEX_MIN_CHILD_CNT
+        #else
+            #define LV_INDEV_HIT_INDEX_MIN_CHILD_CNT 16
+        #endif
+    #endif
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #ifndef LV_TICK_CUSTOM
@@ -409,6 +583,49 @@
     #endif
 #endif
 
+/*Render large software blends on a pool of worker threads.
+ *The blended area is split into horizontal bands, one band per thread, and the threads are joined
+ *before the blend returns, so the result is identical to single threaded rendering.
+ *Requires pthreads (ESP-IDF provides them on top of FreeRTOS).*/
+#ifndef LV_USE_DRAW_SW_PARALLEL
+    #ifdef CONFIG_LV_USE_DRAW_SW_PARALLEL
+        #define LV_USE_DRAW_SW_PARALLEL CONFIG_LV_USE_DRAW_SW_PARALLEL
+    #else
+        #define LV_USE_DRAW_SW_PARALLEL 0
+    #endif
+#endif
+#if LV_USE_DRAW_SW_PARALLEL
+    /*Number of render threads including the one calling `lv_timer_handler()`. Typically the number of cores.*/
+    #ifndef LV_DRAW_SW_PARALLEL_THREAD_CNT
+        #ifdef CONFIG_LV_DRAW_SW_PARALLEL_THREAD_CNT
+            #define LV_DRAW_SW_PARALLEL_THREAD_CNT CONFIG_LV_DRAW_SW_PARALLEL_THREAD_CNT
+        #else
+            #define LV_DRAW_SW_PARALLEL_THREAD_CNT 2
+        #endif
+    #endif
+
+    /*Blends smaller than this [px] are rendered on the calling thread as splitting them costs more than it gains*/
+    #ifndef LV_DRAW_SW_PARALLEL_MIN_PX
+        #ifdef CONFIG_LV_DRAW_SW_PARALLEL_MIN_PX
+            #define LV_DRAW_SW_PARALLEL_MIN_PX CONFIG_LV_DRAW_SW_PARALLEL_MIN_PX
+        #else
+            #define LV_DRAW_SW_PARALLEL_MIN_PX (8 * 1024)
+        #endif
+    #endif
+#endif
+
+/*Blend with SSE2/AVX2 (x86) or NEON (Arm) kernels, e.g. to speed up simulators on a PC.
+ *The best instruction set supported by the CPU is selected in `lv_init()`.
+ *The result is identical to the C code. Used with 32 bit colors and with 16 bit colors
+ *if LV_COLOR_16_SWAP and LV_COLOR_MIX_ROUND_OFS are 0, otherwise the C code runs.*/
+#ifndef LV_USE_DRAW_SW_SIMD
+    #ifdef CONFIG_LV_USE_DRAW_SW_SIMD
+        #define LV_USE_DRAW_SW_SIMD CONFIG_LV_USE_DRAW_SW_SIMD
+    #else
+        #define LV_USE_DRAW_SW_SIMD 0
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -526,6 +743,16 @@
     #endif
 #endif
 
+/*Draw context for the PIE (128 bit SIMD) instructions of ESP32-S3 to fill, copy and mix 16 bit colors.
+ *The PIE kernels are not added yet, so the blends still run on the software renderer.*/
+#ifndef LV_USE_GPU_ESP32_PIE
+    #ifdef CONFIG_LV_USE_GPU_ESP32_PIE
+        #define LV_USE_GPU_ESP32_PIE CONFIG_LV_USE_GPU_ESP32_PIE
+    #else
+        #define LV_USE_GPU_ESP32_PIE 0
+    #endif
+#endif
+
 /*-------------
  * Logging
  *-----------*/
@@ -813,6 +1040,71 @@
     #endif
 #endif  /*LV_SPRINTF_CUSTOM*/
 
+/*Cache the resolved values of the most frequently used style properties (paddings, background, border, text, etc)
+ *of the objects' main part, so `lv_obj_get_style_...()` doesn't need to search the styles of the object
+ *and its parents every time. Any style, state or parent change outdates the caches.
+ *Costs 32 style values per object. See `lv_obj_enable_style_cache()`*/
+#ifndef LV_USE_OBJ_STYLE_CACHE
+    #ifdef CONFIG_LV_USE_OBJ_STYLE_CACHE
+        #define LV_USE_OBJ_STYLE_CACHE CONFIG_LV_USE_OBJ_STYLE_CACHE
+    #else
+        #define LV_USE_OBJ_STYLE_CACHE 0
+    #endif
+#endif
+
+/*Cache the self size of the objects (e.g. the size of a label's text) reported in `LV_EVENT_GET_SELF_SIZE`
+ *to not measure the content again in each layout update. Changing the content, style or content size outdates it.
+ *Costs 4 coordinates per object.*/
+#ifndef LV_USE_OBJ_SELF_SIZE_CACHE
+    #ifdef CONFIG_LV_USE_OBJ_SELF_SIZE_CACHE
+        #define LV_USE_OBJ_SELF_SIZE_CACHE CONFIG_LV_USE_OBJ_SELF_SIZE_CACHE
+    #else
+        #define LV_USE_OBJ_SELF_SIZE_CACHE 0
+    #endif
+#endif
+
+/*Count the events dispatched to the objects and the ones skipped because
+ *neither the object's callbacks nor its class handle them. See `lv_event_get_stats()`*/
+#ifndef LV_USE_EVENT_STATS
+    #ifdef CONFIG_LV_USE_EVENT_STATS
+        #define LV_USE_EVENT_STATS CONFIG_LV_USE_EVENT_STATS
+    #else
+        #define LV_USE_EVENT_STATS 0
+    #endif
+#endif
+
+/*Allocate the objects, their special attributes, style and children arrays up to 256 bytes from pools of
+ *8 byte size classes instead of one by one from the heap. It's faster, fragments the heap less and saves the
+ *heap's per allocation header if there are many objects. See `lv_slab_get_stats()`*/
+#ifndef LV_USE_OBJ_POOL
+    #ifdef CONFIG_LV_USE_OBJ_POOL
+        #define LV_USE_OBJ_POOL CONFIG_LV_USE_OBJ_POOL
+    #else
+        #define LV_USE_OBJ_POOL 0
+    #endif
+#endif
+
+/*Delete the objects of `lv_obj_del()` and `lv_obj_clean()` in bulk: the animations and group members of all the deleted
+ *objects are removed in one pass at the end, the focus moves only once and the dying parents get no events about
+ *their deleted children. See `lv_obj_enable_bulk_del()`*/
+#ifndef LV_USE_OBJ_BULK_DEL
+    #ifdef CONFIG_LV_USE_OBJ_BULK_DEL
+        #define LV_USE_OBJ_BULK_DEL CONFIG_LV_USE_OBJ_BULK_DEL
+    #else
+        #define LV_USE_OBJ_BULK_DEL 0
+    #endif
+#endif
+
+/*Prepare a screen in idle time before loading it: update its layout step by step and, with `LV_USE_LAYER_CACHE`,
+ *render it into a pinned layer band by band. The transition then only draws the cached layers. See `lv_scr_preload()`*/
+#ifndef LV_USE_SCR_PRELOAD
+    #ifdef CONFIG_LV_USE_SCR_PRELOAD
+        #define LV_USE_SCR_PRELOAD CONFIG_LV_USE_SCR_PRELOAD
+    #else
+        #define LV_USE_SCR_PRELOAD 0
+    #endif
+#endif
+
 #ifndef LV_USE_USER_DATA
     #ifdef _LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_USER_DATA
@@ -1831,6 +2123,18 @@
     #endif
 #endif
 
+#ifndef LV_USE_VLIST
+    #ifdef _LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_USE_VLIST
+            #define LV_USE_VLIST CONFIG_LV_USE_VLIST
+        #else
+            #define LV_USE_VLIST 0
+        #endif
+    #else
+        #define LV_USE_VLIST      1
+    #endif
+#endif
+
 #ifndef LV_USE_WIN
     #ifdef _LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_WIN
@@ -1891,6 +2195,26 @@
             #define LV_THEME_DEFAULT_TRANSITION_TIME 80
         #endif
     #endif
+
+    /*1: Keep the styles in constant tables (generated by scripts/theme_default_gen.py) instead of RAM.
+     *The tables are used if the theme is initialized in LV_THEME_DEFAULT_DARK mode with LV_DPI_DEF
+     *on a display of LV_THEME_DEFAULT_CONST_HOR_RES width, else the styles are still created in RAM*/
+    #ifndef LV_THEME_DEFAULT_CONST
+        #ifdef CONFIG_LV_THEME_DEFAULT_CONST
+            #define LV_THEME_DEFAULT_CONST CONFIG_LV_THEME_DEFAULT_CONST
+        #else
+            #define LV_THEME_DEFAULT_CONST 0
+        #endif
+    #endif
+    #if LV_THEME_DEFAULT_CONST
+        #ifndef LV_THEME_DEFAULT_CONST_HOR_RES
+            #ifdef CONFIG_LV_THEME_DEFAULT_CONST_HOR_RES
+                #define LV_THEME_DEFAULT_CONST_HOR_RES CONFIG_LV_THEME_DEFAULT_CONST_HOR_RES
+            #else
+                #define LV_THEME_DEFAULT_CONST_HOR_RES 800
+            #endif
+        #endif
+    #endif
 #endif /*LV_USE_THEME_DEFAULT*/
 
 /*A very simple theme that is a good starting point for a custom theme*/
@@ -2458,6 +2782,10 @@ LV_EXPORT_CONST_INT(LV_DPI_DEF);
     #define LV_LOG_TRACE_ANIM       0
 #endif  /*LV_USE_LOG*/
 
+#if LV_USE_REFR_CTX == 0
+    #define LV_REFR_CTX_THREAD_LOCAL
+#endif  /*LV_USE_REFR_CTX*/
+
 
 /*If running without lv_conf.h add typedefs with default value*/
 #ifdef LV_CONF_SKIP
@@ -160,6 +160,48 @@ bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb)
     return del;
 }
 
+bool _lv_anim_del_sorted(void * const * vars, uint32_t cnt)
+{
+    if(cnt == 0) return false;
+
+    uintptr_t min = (uintptr_t)vars[0];
+    uintptr_t max = (uintptr_t)vars[cnt - 1];
+    lv_anim_t * a;
+    lv_anim_t * a_next;
+    bool del = false;
+    a        = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+    while(a != NULL) {
+        /*'a' might be deleted, so get the next object while 'a' is valid*/
+        a_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+
+        uintptr_t var = (uintptr_t)a->var;
+        if(var >= min && var <= max) {
+            /*Binary search the variable*/
+            uint32_t first = 0;
+            uint32_t last = cnt;
+            while(first < last) {
+                uint32_t middle = first + (last - first) / 2;
+                if((uintptr_t)vars[middle] < var) first = middle + 1;
+                else last = middle;
+            }
+
+            if(first < cnt && (uintptr_t)vars[first] == var) {
+                _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
+                if(a->deleted_cb != NULL) a->deleted_cb(a);
+                lv_mem_free(a);
+                del = true;
+            }
+        }
+
+        a = a_next;
+    }
+
+    /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
+    if(del) anim_mark_list_change();
+
+    return del;
+}
+
 void lv_anim_del_all(void)
 {
     _lv_ll_clear(&LV_GC_ROOT(_lv_anim_ll));
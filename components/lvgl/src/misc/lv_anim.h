@@ -347,6 +347,14 @@ static inline void * lv_anim_get_user_data(lv_anim_t * a)
  */
 bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb);
 
+/**
+ * Delete all the animations of many variables in one pass
+ * @param vars      pointer to the variables, sorted by their address in increasing order
+ * @param cnt       number of variables in `vars`
+ * @return          true: at least 1 animation is deleted, false: no animation is deleted
+ */
+bool _lv_anim_del_sorted(void * const * vars, uint32_t cnt);
+
 /**
  * Delete all the animations
  */
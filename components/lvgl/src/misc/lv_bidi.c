@@ -56,8 +56,8 @@ static uint32_t get_txt_len(const char * txt, uint32_t max_len);
  **********************/
 static const uint8_t bracket_left[] = {"<({["};
 static const uint8_t bracket_right[] = {">)}]"};
-static bracket_stack_t br_stack[LV_BIDI_BRACKLET_DEPTH];
-static uint8_t br_stack_p;
+static LV_REFR_CTX_THREAD_LOCAL bracket_stack_t br_stack[LV_BIDI_BRACKLET_DEPTH];
+static LV_REFR_CTX_THREAD_LOCAL uint8_t br_stack_p;
 
 /**********************
  *      MACROS
@@ -16,6 +16,7 @@ extern "C" {
 #include "../lv_conf_internal.h"
 #include <stdint.h>
 #include "lv_mem.h"
+#include "lv_slab.h"
 #include "lv_ll.h"
 #include "lv_timer.h"
 #include "lv_types.h"
@@ -49,11 +50,13 @@ extern "C" {
     LV_DISPATCH(f, lv_ll_t, _lv_group_ll)                                                              \
     LV_DISPATCH(f, lv_ll_t, _lv_img_decoder_ll)                                                        \
     LV_DISPATCH(f, lv_ll_t, _lv_obj_style_trans_ll)                                                    \
+    LV_DISPATCH_COND(f, lv_ll_t, _lv_layer_cache_ll, LV_USE_LAYER_CACHE, 1)                            \
     LV_DISPATCH(f, lv_layout_dsc_t *, _lv_layout_list)                                                 \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t*, _lv_img_cache_array, LV_IMG_CACHE_DEF, 1)              \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)              \
     LV_DISPATCH(f, lv_timer_t*, _lv_timer_act)                                                         \
     LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                                      \
+    LV_DISPATCH(f, lv_slab_pools_t, _lv_slab_pools)                                                    \
     LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
     LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                                  \
@@ -21,6 +21,11 @@
     #include LV_MEM_POOL_INCLUDE
 #endif
 
+#if LV_USE_REFR_CTX
+    #include "../core/lv_refr.h"
+    #include <pthread.h>
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -59,6 +64,10 @@
     static uint32_t max_used;
 #endif
 
+#if LV_MEM_CUSTOM == 0 && LV_USE_REFR_CTX
+    static pthread_mutex_t tlsf_mutex = PTHREAD_MUTEX_INITIALIZER;  /*The displays can be refreshed concurrently*/
+#endif
+
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
 /**********************
@@ -76,6 +85,20 @@ static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variabl
 #define SET8(x) *d8 = x; d8++;
 #define REPEAT8(expr) expr expr expr expr expr expr expr expr
 
+#if LV_USE_REFR_CTX
+    #define MEM_BUF     (_lv_refr_ctx_get_act()->mem_buf)
+#else
+    #define MEM_BUF     LV_GC_ROOT(lv_mem_buf)
+#endif
+
+#if LV_MEM_CUSTOM == 0 && LV_USE_REFR_CTX
+    #define TLSF_LOCK()     pthread_mutex_lock(&tlsf_mutex)
+    #define TLSF_UNLOCK()   pthread_mutex_unlock(&tlsf_mutex)
+#else
+    #define TLSF_LOCK()
+    #define TLSF_UNLOCK()
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -131,7 +154,13 @@ void * lv_mem_alloc(size_t size)
     }
 
 #if LV_MEM_CUSTOM == 0
+    TLSF_LOCK();
     void * alloc = lv_tlsf_malloc(tlsf, size);
+    if(alloc) {
+        cur_used += size;
+        max_used = LV_MAX(cur_used, max_used);
+    }
+    TLSF_UNLOCK();
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
@@ -153,10 +182,6 @@ void * lv_mem_alloc(size_t size)
 #endif
 
     if(alloc) {
-#if LV_MEM_CUSTOM == 0
-        cur_used += size;
-        max_used = LV_MAX(cur_used, max_used);
-#endif
         MEM_TRACE("allocated at %p", alloc);
     }
     return alloc;
@@ -176,9 +201,11 @@ void lv_mem_free(void * data)
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
+    TLSF_LOCK();
     size_t size = lv_tlsf_free(tlsf, data);
     if(cur_used > size) cur_used -= size;
     else cur_used = 0;
+    TLSF_UNLOCK();
 #else
     LV_MEM_CUSTOM_FREE(data);
 #endif
@@ -203,7 +230,9 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
 #if LV_MEM_CUSTOM == 0
+    TLSF_LOCK();
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+    TLSF_UNLOCK();
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
@@ -250,7 +279,9 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #if LV_MEM_CUSTOM == 0
     MEM_TRACE("begin");
 
+    TLSF_LOCK();
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
+    TLSF_UNLOCK();
 
     mon_p->total_size = LV_MEM_SIZE;
     mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
@@ -275,6 +306,7 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
  */
 void * lv_mem_buf_get(uint32_t size)
 {
+    lv_mem_buf_t * bufs = MEM_BUF;
     if(size == 0) return NULL;
 
     MEM_TRACE("begin, getting %d bytes", size);
@@ -282,41 +314,41 @@ void * lv_mem_buf_get(uint32_t size)
     /*Try to find a free buffer with suitable size*/
     int8_t i_guess = -1;
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0 && LV_GC_ROOT(lv_mem_buf[i]).size >= size) {
-            if(LV_GC_ROOT(lv_mem_buf[i]).size == size) {
-                LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-                return LV_GC_ROOT(lv_mem_buf[i]).p;
+        if(bufs[i].used == 0 && bufs[i].size >= size) {
+            if(bufs[i].size == size) {
+                bufs[i].used = 1;
+                return bufs[i].p;
             }
             else if(i_guess < 0) {
                 i_guess = i;
             }
             /*If size of `i` is closer to `size` prefer it*/
-            else if(LV_GC_ROOT(lv_mem_buf[i]).size < LV_GC_ROOT(lv_mem_buf[i_guess]).size) {
+            else if(bufs[i].size < bufs[i_guess].size) {
                 i_guess = i;
             }
         }
     }
 
     if(i_guess >= 0) {
-        LV_GC_ROOT(lv_mem_buf[i_guess]).used = 1;
+        bufs[i_guess].used = 1;
         MEM_TRACE("returning already allocated buffer (buffer id: %d, address: %p)", i_guess,
-                  LV_GC_ROOT(lv_mem_buf[i_guess]).p);
-        return LV_GC_ROOT(lv_mem_buf[i_guess]).p;
+                  bufs[i_guess].p);
+        return bufs[i_guess].p;
     }
 
     /*Reallocate a free buffer*/
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
+        if(bufs[i].used == 0) {
             /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
-            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
+            void * buf = lv_mem_realloc(bufs[i].p, size);
             LV_ASSERT_MSG(buf != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
             if(buf == NULL) return NULL;
 
-            LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-            LV_GC_ROOT(lv_mem_buf[i]).size = size;
-            LV_GC_ROOT(lv_mem_buf[i]).p    = buf;
-            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, LV_GC_ROOT(lv_mem_buf[i]).p);
-            return LV_GC_ROOT(lv_mem_buf[i]).p;
+            bufs[i].used = 1;
+            bufs[i].size = size;
+            bufs[i].p    = buf;
+            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, bufs[i].p);
+            return bufs[i].p;
         }
     }
 
@@ -331,11 +363,12 @@ void * lv_mem_buf_get(uint32_t size)
  */
 void lv_mem_buf_release(void * p)
 {
+    lv_mem_buf_t * bufs = MEM_BUF;
     MEM_TRACE("begin (address: %p)", p);
 
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
+        if(bufs[i].p == p) {
+            bufs[i].used = 0;
             return;
         }
     }
@@ -348,12 +381,13 @@ void lv_mem_buf_release(void * p)
  */
 void lv_mem_buf_free_all(void)
 {
+    lv_mem_buf_t * bufs = MEM_BUF;
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p) {
-            lv_mem_free(LV_GC_ROOT(lv_mem_buf[i]).p);
-            LV_GC_ROOT(lv_mem_buf[i]).p = NULL;
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
-            LV_GC_ROOT(lv_mem_buf[i]).size = 0;
+        if(bufs[i].p) {
+            lv_mem_free(bufs[i].p);
+            bufs[i].p = NULL;
+            bufs[i].used = 0;
+            bufs[i].size = 0;
         }
     }
 }
@@ -12,6 +12,7 @@ CSRCS += lv_lru.c
 CSRCS += lv_math.c
 CSRCS += lv_mem.c
 CSRCS += lv_printf.c
+CSRCS += lv_slab.c
 CSRCS += lv_style.c
 CSRCS += lv_style_gen.c
 CSRCS += lv_timer.c
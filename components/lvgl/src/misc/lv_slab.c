@@ -0,0 +1,350 @@
+/**
+ * @file lv_slab.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_slab.h"
+#include "lv_mem.h"
+#include "lv_gc.h"
+#include "lv_assert.h"
+#include "lv_math.h"
+
+#if LV_USE_REFR_CTX
+    #include <pthread.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Aim for this size when allocating a chunk of items from the heap*/
+#define CHUNK_SIZE          2048
+
+/*Keep the items aligned to 8*/
+#define CHUNK_HEADER_SIZE   ((sizeof(lv_slab_chunk_t) + 7) & ~((size_t)7))
+
+#define CHUNK_GET_ITEMS(c)  ((uint8_t *)(c) + CHUNK_HEADER_SIZE)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct _lv_slab_chunk_t {
+    lv_slab_t * slab;
+    struct _lv_slab_chunk_t * prev;
+    struct _lv_slab_chunk_t * next;
+    void * free_items;          /*Linked list of the free items, the next pointer is stored in the item's data*/
+    uint16_t used_cnt;
+    uint16_t item_cnt;
+    uint16_t item_size;
+} lv_slab_chunk_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static int32_t get_class_id(size_t size);
+static lv_slab_chunk_t * chunk_create(lv_slab_t * slab, uint16_t item_size);
+static void chunk_delete(lv_slab_chunk_t * chunk);
+static lv_slab_chunk_t * chunk_find(const void * p);
+static uint32_t chunk_index_search(const void * p);
+static void chunk_unlink(lv_slab_chunk_t ** list, lv_slab_chunk_t * chunk);
+static void chunk_link(lv_slab_chunk_t ** list, lv_slab_chunk_t * chunk);
+static void * heap_alloc(size_t size);
+static void * slab_alloc(size_t size);
+static void slab_free(void * p);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_slab_stats_t stats;
+static bool slab_en = true;
+
+#if LV_USE_REFR_CTX
+    static pthread_mutex_t slab_mutex = PTHREAD_MUTEX_INITIALIZER;  /*E.g. style caches are allocated while drawing*/
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+#define CLASS_GET_SIZE(id)  ((uint16_t)(((id) + 1) * 8))
+
+#if LV_USE_REFR_CTX
+    #define SLAB_LOCK()     pthread_mutex_lock(&slab_mutex)
+    #define SLAB_UNLOCK()   pthread_mutex_unlock(&slab_mutex)
+#else
+    #define SLAB_LOCK()
+    #define SLAB_UNLOCK()
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void * lv_slab_alloc(size_t size)
+{
+    SLAB_LOCK();
+    void * p = slab_alloc(size);
+    SLAB_UNLOCK();
+    return p;
+}
+
+void lv_slab_free(void * p)
+{
+    if(p == NULL) return;
+
+    SLAB_LOCK();
+    slab_free(p);
+    SLAB_UNLOCK();
+}
+
+void * lv_slab_realloc(void * p, size_t new_size)
+{
+    if(p == NULL) return lv_slab_alloc(new_size);
+    if(new_size == 0) {
+        lv_slab_free(p);
+        return NULL;
+    }
+
+    SLAB_LOCK();
+    lv_slab_chunk_t * chunk = chunk_find(p);
+    int32_t class_id = slab_en ? get_class_id(new_size) : -1;
+    void * new_p;
+
+    if(chunk == NULL) {
+        /*Items from the heap are reallocated there, their size is not known to copy them*/
+        stats.alloc_cnt++;
+        stats.heap_alloc_cnt++;
+        new_p = lv_mem_realloc(p, new_size);
+    }
+    else if(class_id >= 0 && chunk->item_size == CLASS_GET_SIZE(class_id)) {
+        /*Still in the same size class*/
+        new_p = p;
+    }
+    else {
+        new_p = slab_alloc(new_size);
+        if(new_p) {
+            lv_memcpy(new_p, p, LV_MIN(chunk->item_size, new_size));
+            slab_free(p);
+        }
+    }
+    SLAB_UNLOCK();
+
+    return new_p;
+}
+
+void lv_slab_enable(bool en)
+{
+    slab_en = en;
+}
+
+const lv_slab_stats_t * lv_slab_get_stats(void)
+{
+    return &stats;
+}
+
+void lv_slab_reset_stats(void)
+{
+    stats.alloc_cnt = 0;
+    stats.heap_alloc_cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * slab_alloc(size_t size)
+{
+    stats.alloc_cnt++;
+
+    int32_t class_id = slab_en ? get_class_id(size) : -1;
+    if(class_id < 0) return heap_alloc(size);
+
+    lv_slab_t * slab = &LV_GC_ROOT(_lv_slab_pools).classes[class_id];
+    lv_slab_chunk_t * chunk = slab->chunks;
+    if(chunk == NULL) {
+        chunk = chunk_create(slab, CLASS_GET_SIZE(class_id));
+        if(chunk == NULL) return NULL;
+        chunk_link(&slab->chunks, chunk);
+    }
+
+    uint8_t * item = chunk->free_items;
+    chunk->free_items = *(void **)item;
+    chunk->used_cnt++;
+
+    /*Full chunks are not interesting for the next allocations*/
+    if(chunk->free_items == NULL) {
+        chunk_unlink(&slab->chunks, chunk);
+        chunk_link(&slab->full_chunks, chunk);
+    }
+
+    return item;
+}
+
+static void slab_free(void * p)
+{
+    lv_slab_chunk_t * chunk = chunk_find(p);
+    if(chunk == NULL) {
+        lv_mem_free(p);
+        return;
+    }
+
+    lv_slab_t * slab = chunk->slab;
+    if(chunk->free_items == NULL) {
+        chunk_unlink(&slab->full_chunks, chunk);
+        chunk_link(&slab->chunks, chunk);
+    }
+
+    *(void **)p = chunk->free_items;
+    chunk->free_items = p;
+    chunk->used_cnt--;
+
+    /*Give the empty chunk back to the heap, but keep the last one to not allocate it again immediately*/
+    if(chunk->used_cnt == 0 && (slab->chunks != chunk || chunk->next != NULL)) {
+        chunk_unlink(&slab->chunks, chunk);
+        chunk_delete(chunk);
+    }
+}
+
+/**
+ * Get the smallest size class for a size
+ * @param size      size in bytes
+ * @return          index of the size class or -1 if it doesn't fit into any
+ */
+static int32_t get_class_id(size_t size)
+{
+    if(size > _LV_SLAB_MAX_SIZE) return -1;
+    if(size == 0) return 0;
+    return (int32_t)((size - 1) / 8);
+}
+
+static lv_slab_chunk_t * chunk_create(lv_slab_t * slab, uint16_t item_size)
+{
+    uint32_t item_cnt = (CHUNK_SIZE - CHUNK_HEADER_SIZE) / item_size;
+    if(item_cnt < 4) item_cnt = 4;
+
+    lv_slab_pools_t * pools = &LV_GC_ROOT(_lv_slab_pools);
+    if(pools->chunk_cnt == pools->chunk_cap) {
+        uint32_t new_cap = pools->chunk_cap ? pools->chunk_cap * 2 : 16;
+        lv_slab_chunk_t ** new_chunks = lv_mem_realloc(pools->chunks, new_cap * sizeof(lv_slab_chunk_t *));
+        LV_ASSERT_MALLOC(new_chunks);
+        if(new_chunks == NULL) return NULL;
+        pools->chunks = new_chunks;
+        pools->chunk_cap = new_cap;
+    }
+
+    lv_slab_chunk_t * chunk = lv_mem_alloc(CHUNK_HEADER_SIZE + item_cnt * item_size);
+    LV_ASSERT_MALLOC(chunk);
+    if(chunk == NULL) return NULL;
+
+    stats.heap_alloc_cnt++;
+    stats.chunk_cnt++;
+
+    /*Insert into the index keeping the address order*/
+    uint32_t idx = chunk_index_search(chunk);
+    uint32_t j;
+    for(j = pools->chunk_cnt; j > idx; j--) pools->chunks[j] = pools->chunks[j - 1];
+    pools->chunks[idx] = chunk;
+    pools->chunk_cnt++;
+
+    chunk->slab = slab;
+    chunk->prev = NULL;
+    chunk->next = NULL;
+    chunk->used_cnt = 0;
+    chunk->item_cnt = item_cnt;
+    chunk->item_size = item_size;
+
+    /*Link the items in address order to allocate them sequentially*/
+    uint8_t * items = CHUNK_GET_ITEMS(chunk);
+    chunk->free_items = NULL;
+    int32_t i;
+    for(i = item_cnt - 1; i >= 0; i--) {
+        uint8_t * item = items + i * item_size;
+        *(void **)item = chunk->free_items;
+        chunk->free_items = item;
+    }
+
+    return chunk;
+}
+
+static void chunk_delete(lv_slab_chunk_t * chunk)
+{
+    lv_slab_pools_t * pools = &LV_GC_ROOT(_lv_slab_pools);
+    uint32_t idx = chunk_index_search(chunk);
+    LV_ASSERT(idx < pools->chunk_cnt && pools->chunks[idx] == chunk);
+
+    pools->chunk_cnt--;
+    uint32_t i;
+    for(i = idx; i < pools->chunk_cnt; i++) pools->chunks[i] = pools->chunks[i + 1];
+    if(pools->chunk_cnt == 0) {
+        lv_mem_free(pools->chunks);
+        pools->chunks = NULL;
+        pools->chunk_cap = 0;
+    }
+
+    lv_mem_free(chunk);
+    stats.chunk_cnt--;
+}
+
+/**
+ * Find the chunk an item belongs to
+ * @param p         pointer to an item
+ * @return          the chunk or NULL if the item was allocated from the heap
+ */
+static lv_slab_chunk_t * chunk_find(const void * p)
+{
+    lv_slab_pools_t * pools = &LV_GC_ROOT(_lv_slab_pools);
+    uint32_t idx = chunk_index_search(p);
+    if(idx == 0) return NULL;
+
+    /*The last chunk starting before the item*/
+    lv_slab_chunk_t * chunk = pools->chunks[idx - 1];
+    uintptr_t items = (uintptr_t)CHUNK_GET_ITEMS(chunk);
+    if((uintptr_t)p < items || (uintptr_t)p >= items + (uintptr_t)chunk->item_cnt * chunk->item_size) return NULL;
+    return chunk;
+}
+
+/**
+ * Binary search in the chunk index
+ * @param p         an address
+ * @return          index of the first chunk not below `p`, or the number of chunks if there is none
+ */
+static uint32_t chunk_index_search(const void * p)
+{
+    lv_slab_pools_t * pools = &LV_GC_ROOT(_lv_slab_pools);
+    uint32_t lo = 0;
+    uint32_t hi = pools->chunk_cnt;
+    while(lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if((uintptr_t)pools->chunks[mid] < (uintptr_t)p) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static void chunk_unlink(lv_slab_chunk_t ** list, lv_slab_chunk_t * chunk)
+{
+    if(chunk->prev) chunk->prev->next = chunk->next;
+    else *list = chunk->next;
+    if(chunk->next) chunk->next->prev = chunk->prev;
+    chunk->prev = NULL;
+    chunk->next = NULL;
+}
+
+static void chunk_link(lv_slab_chunk_t ** list, lv_slab_chunk_t * chunk)
+{
+    chunk->prev = NULL;
+    chunk->next = *list;
+    if(*list) (*list)->prev = chunk;
+    *list = chunk;
+}
+
+static void * heap_alloc(size_t size)
+{
+    void * p = lv_mem_alloc(size);
+    LV_ASSERT_MALLOC(p);
+    if(p == NULL) return NULL;
+
+    stats.heap_alloc_cnt++;
+    return p;
+}
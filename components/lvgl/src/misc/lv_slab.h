@@ -0,0 +1,111 @@
+/**
+ * @file lv_slab.h
+ * Pools of small, fixed size items in a few size classes.
+ * Many small items (e.g. objects) can be allocated with only a few allocations from the heap
+ * and without fragmenting it.
+ */
+
+#ifndef LV_SLAB_H
+#define LV_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Items up to this size are allocated from the pools, larger items from the heap*/
+#define _LV_SLAB_MAX_SIZE   256
+
+/*The size classes are 8 bytes apart, so no more than the alignment is wasted on rounding*/
+#define _LV_SLAB_CLASS_CNT  (_LV_SLAB_MAX_SIZE / 8)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A pool of items of the same size.
+ */
+typedef struct {
+    struct _lv_slab_chunk_t * chunks;       /*Chunks having free items*/
+    struct _lv_slab_chunk_t * full_chunks;  /*Chunks without free items*/
+} lv_slab_t;
+
+typedef struct {
+    lv_slab_t classes[_LV_SLAB_CLASS_CNT];
+    struct _lv_slab_chunk_t ** chunks;      /*All chunks sorted by address to find the chunk of an item*/
+    uint32_t chunk_cnt;
+    uint32_t chunk_cap;
+} lv_slab_pools_t;
+
+typedef struct {
+    uint32_t alloc_cnt;         /*Number of allocations*/
+    uint32_t heap_alloc_cnt;    /*Number of allocations from the heap (new chunks, large items)*/
+    uint32_t chunk_cnt;         /*Number of currently allocated chunks*/
+} lv_slab_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Allocate memory from the pool of the smallest fitting size class
+ * @param size      size of the memory to allocate in bytes
+ * @return          pointer to the allocated memory or NULL on error
+ */
+void * lv_slab_alloc(size_t size);
+
+/**
+ * Free a memory allocated by `lv_slab_alloc()` or `lv_slab_realloc()`.
+ * The chunk of the item is looked up by the address, so the items don't need a header.
+ * The chunks are given back to the heap when all their items are free.
+ * @param p         pointer to the memory to free. Can be NULL.
+ */
+void lv_slab_free(void * p);
+
+/**
+ * Resize a memory allocated by `lv_slab_alloc()`. Nothing is copied if the new size is in the same size class.
+ * @param p         pointer to the memory to resize or NULL to allocate a new one
+ * @param new_size  the new size in bytes. 0 frees the memory.
+ * @return          pointer to the resized memory or NULL on error (the original memory is kept)
+ */
+void * lv_slab_realloc(void * p, size_t new_size);
+
+/**
+ * Enable or disable the pools. If disabled every allocation is forwarded to the heap.
+ * Useful to compare the memory usage and performance with and without the pools.
+ * @param en        true: use the pools (default); false: use the heap
+ */
+void lv_slab_enable(bool en);
+
+/**
+ * Get the statistics of the pools
+ * @return          pointer to the statistics
+ */
+const lv_slab_stats_t * lv_slab_get_stats(void);
+
+/**
+ * Reset the counters in the statistics
+ */
+void lv_slab_reset_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SLAB_H*/
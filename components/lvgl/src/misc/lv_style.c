@@ -138,6 +138,9 @@ uint32_t _lv_style_custom_prop_flag_lookup_table_size = 0;
 
 static uint16_t last_custom_prop_id = (uint16_t)_LV_STYLE_LAST_BUILT_IN_PROP;
 static const lv_style_value_t null_style_value = { .num = 0 };
+#if LV_USE_OBJ_STYLE_CACHE
+    static uint32_t style_cache_gen;
+#endif
 
 /**********************
  *      MACROS
@@ -159,6 +162,10 @@ void lv_style_init(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+
+#if LV_USE_OBJ_STYLE_CACHE
+    _lv_style_cache_invalidate();
+#endif
 }
 
 void lv_style_reset(lv_style_t * style)
@@ -175,6 +182,10 @@ void lv_style_reset(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+
+#if LV_USE_OBJ_STYLE_CACHE
+    _lv_style_cache_invalidate();
+#endif
 }
 
 lv_style_prop_t lv_style_register_prop(uint8_t flag)
@@ -229,6 +240,10 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+#if LV_USE_OBJ_STYLE_CACHE
+    _lv_style_cache_invalidate();
+#endif
+
     if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop) {
             style->prop1 = LV_STYLE_PROP_INV;
@@ -238,45 +253,44 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
         return false;
     }
 
-    uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-    uint16_t * old_props = (uint16_t *)tmp;
+    uint32_t cap = _LV_STYLE_PROP_CAP(style->prop_cnt);
+    uint8_t * tmp = style->v_p.values_and_props + cap * sizeof(lv_style_value_t);
+    uint16_t * props = (uint16_t *)tmp;
+    lv_style_value_t * values = (lv_style_value_t *)style->v_p.values_and_props;
     uint32_t i;
-    for(i = 0; i < style->prop_cnt; i++) {
-        if(LV_STYLE_PROP_ID_MASK(old_props[i]) == prop) {
-            lv_style_value_t * old_values = (lv_style_value_t *)style->v_p.values_and_props;
-
-            if(style->prop_cnt == 2) {
-                style->prop_cnt = 1;
-                style->prop1 = i == 0 ? old_props[1] : old_props[0];
-                style->v_p.value1 = i == 0 ? old_values[1] : old_values[0];
-            }
-            else {
-                size_t size = (style->prop_cnt - 1) * (sizeof(lv_style_value_t) + sizeof(uint16_t));
-                uint8_t * new_values_and_props = lv_mem_alloc(size);
-                if(new_values_and_props == NULL) return false;
-                style->v_p.values_and_props = new_values_and_props;
-                style->prop_cnt--;
-
-                tmp = new_values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-                uint16_t * new_props = (uint16_t *)tmp;
-                lv_style_value_t * new_values = (lv_style_value_t *)new_values_and_props;
-
-                uint32_t j;
-                for(i = j = 0; j <= style->prop_cnt;
-                    j++) { /*<=: because prop_cnt already reduced but all the old props. needs to be checked.*/
-                    if(old_props[j] != prop) {
-                        new_values[i] = old_values[j];
-                        new_props[i++] = old_props[j];
-                    }
-                }
-            }
+    if(!_lv_style_find_prop(props, style->prop_cnt, prop, &i)) return false;
 
-            lv_mem_free(old_values);
-            return true;
+    if(style->prop_cnt == 2) {
+        style->prop_cnt = 1;
+        style->prop1 = i == 0 ? props[1] : props[0];
+        style->v_p.value1 = i == 0 ? values[1] : values[0];
+        lv_mem_free(values);
+        return true;
+    }
+
+    /*Close the gap to keep the properties sorted*/
+    style->prop_cnt--;
+    for(; i < style->prop_cnt; i++) {
+        values[i] = values[i + 1];
+        props[i] = props[i + 1];
+    }
+
+    uint32_t new_cap = _LV_STYLE_PROP_CAP(style->prop_cnt);
+    if(new_cap != cap) {
+        /*Move the props right after the shrunk value array. Moving them down is safe in forward order.*/
+        tmp = style->v_p.values_and_props + new_cap * sizeof(lv_style_value_t);
+        uint16_t * new_props = (uint16_t *)tmp;
+        for(i = 0; i < style->prop_cnt; i++) {
+            new_props[i] = props[i];
         }
+
+        /*If shrinking fails the larger buffer is still usable*/
+        size_t size = new_cap * (sizeof(lv_style_value_t) + sizeof(uint16_t));
+        uint8_t * values_and_props = lv_mem_realloc(style->v_p.values_and_props, size);
+        if(values_and_props) style->v_p.values_and_props = values_and_props;
     }
 
-    return false;
+    return true;
 }
 
 void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
@@ -371,9 +385,7 @@ bool lv_style_is_empty(const lv_style_t * style)
 
 uint8_t _lv_style_get_prop_group(lv_style_prop_t prop)
 {
-    uint16_t group = (prop & 0x1FF) >> 4;
-    if(group > 7) group = 7;    /*The MSB marks all the custom properties*/
-    return (uint8_t)group;
+    return (uint8_t)_LV_STYLE_PROP_GROUP(prop);
 }
 
 uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop)
@@ -391,6 +403,18 @@ uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop)
     return 0;
 }
 
+#if LV_USE_OBJ_STYLE_CACHE
+void _lv_style_cache_invalidate(void)
+{
+    style_cache_gen++;
+}
+
+uint32_t _lv_style_cache_get_gen(void)
+{
+    return style_cache_gen;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -420,59 +444,74 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
         return;
     }
 
+#if LV_USE_OBJ_STYLE_CACHE
+    _lv_style_cache_invalidate();
+#endif
+
     lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(prop_and_meta);
 
     if(style->prop_cnt > 1) {
-        uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+        uint32_t cap = _LV_STYLE_PROP_CAP(style->prop_cnt);
+        uint8_t * tmp = style->v_p.values_and_props + cap * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
-        int32_t i;
-        for(i = style->prop_cnt - 1; i >= 0; i--) {
-            if(LV_STYLE_PROP_ID_MASK(props[i]) == prop_id) {
-                lv_style_value_t * values = (lv_style_value_t *)style->v_p.values_and_props;
-                value_adjustment_helper(prop_and_meta, value, &props[i], &values[i]);
-                return;
-            }
+        lv_style_value_t * values = (lv_style_value_t *)style->v_p.values_and_props;
+        uint32_t i;
+        if(_lv_style_find_prop(props, style->prop_cnt, prop_id, &i)) {
+            value_adjustment_helper(prop_and_meta, value, &props[i], &values[i]);
+            return;
         }
 
-        size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(uint16_t));
-        uint8_t * values_and_props = lv_mem_realloc(style->v_p.values_and_props, size);
-        if(values_and_props == NULL) return;
-        style->v_p.values_and_props = values_and_props;
+        uint32_t new_cap = _LV_STYLE_PROP_CAP(style->prop_cnt + 1);
+        if(new_cap != cap) {
+            size_t size = new_cap * (sizeof(lv_style_value_t) + sizeof(uint16_t));
+            uint8_t * values_and_props = lv_mem_realloc(style->v_p.values_and_props, size);
+            if(values_and_props == NULL) return;
+            style->v_p.values_and_props = values_and_props;
+            values = (lv_style_value_t *)values_and_props;
+
+            /*Move the props after the grown value array. They might overlap so go backwards.*/
+            tmp = values_and_props + cap * sizeof(lv_style_value_t);
+            uint16_t * old_props = (uint16_t *)tmp;
+            tmp = values_and_props + new_cap * sizeof(lv_style_value_t);
+            props = (uint16_t *)tmp;
+            uint32_t j;
+            for(j = style->prop_cnt; j > 0; j--) {
+                props[j - 1] = old_props[j - 1];
+            }
+        }
 
-        tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        props = (uint16_t *)tmp;
-        /*Shift all props to make place for the value before them*/
-        for(i = style->prop_cnt - 1; i >= 0; i--) {
-            props[i + sizeof(lv_style_value_t) / sizeof(uint16_t)] = props[i];
+        /*Make place for the new property to keep them sorted*/
+        uint32_t j;
+        for(j = style->prop_cnt; j > i; j--) {
+            values[j] = values[j - 1];
+            props[j] = props[j - 1];
         }
         style->prop_cnt++;
 
-        /*Go to the new position wit the props*/
-        tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        props = (uint16_t *)tmp;
-        lv_style_value_t * values = (lv_style_value_t *)values_and_props;
-
         /*Set the new property and value*/
-        value_adjustment_helper(prop_and_meta, value, &props[style->prop_cnt - 1], &values[style->prop_cnt - 1]);
+        value_adjustment_helper(prop_and_meta, value, &props[i], &values[i]);
     }
     else if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop_id) {
             value_adjustment_helper(prop_and_meta, value, &style->prop1, &style->v_p.value1);
             return;
         }
-        size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(uint16_t));
+        uint32_t cap = _LV_STYLE_PROP_CAP(2);
+        size_t size = cap * (sizeof(lv_style_value_t) + sizeof(uint16_t));
         uint8_t * values_and_props = lv_mem_alloc(size);
         if(values_and_props == NULL) return;
         lv_style_value_t value_tmp = style->v_p.value1;
         style->v_p.values_and_props = values_and_props;
         style->prop_cnt++;
 
-        uint8_t * tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+        uint8_t * tmp = values_and_props + cap * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
         lv_style_value_t * values = (lv_style_value_t *)values_and_props;
-        props[0] = style->prop1;
-        values[0] = value_tmp;
-        value_adjustment_helper(prop_and_meta, value, &props[1], &values[1]);
+        /*Keep the properties sorted*/
+        uint32_t i = LV_STYLE_PROP_ID_MASK(style->prop1) < prop_id ? 0 : 1;
+        props[i] = style->prop1;
+        values[i] = value_tmp;
+        value_adjustment_helper(prop_and_meta, value, &props[1 - i], &values[1 - i]);
     }
     else {
         style->prop_cnt = 1;
@@ -74,8 +74,15 @@ LV_EXPORT_CONST_INT(LV_IMG_ZOOM_NONE);
 #define LV_STYLE_PROP_META_INITIAL 0x4000
 #define LV_STYLE_PROP_META_MASK (LV_STYLE_PROP_META_INHERIT | LV_STYLE_PROP_META_INITIAL)
 
+/*Number of slots allocated for `cnt` properties. Growing in steps of 4 avoids a realloc on every new property.*/
+#define _LV_STYLE_PROP_CAP(cnt) (((uint32_t)(cnt) + 3) & ~((uint32_t)3))
+
 #define LV_STYLE_PROP_ID_MASK(prop) ((lv_style_prop_t)((prop) & ~LV_STYLE_PROP_META_MASK))
 
+/*The group of a property (see `_lv_style_get_prop_group()`) in a form usable in constant expressions too.
+ *The MSB marks all the custom properties*/
+#define _LV_STYLE_PROP_GROUP(prop) ((((prop) & 0x1FF) >> 4) > 7 ? 7 : (((prop) & 0x1FF) >> 4))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -322,7 +329,8 @@ typedef struct {
 #endif
 
     /*If there is only one property store it directly.
-     *For more properties allocate an array*/
+     *For more properties allocate an array with room for `_LV_STYLE_PROP_CAP(prop_cnt)` values
+     *followed by the same number of property IDs. The IDs are sorted to allow binary search.*/
     union {
         lv_style_value_t value1;
         uint8_t * values_and_props;
@@ -435,6 +443,33 @@ void lv_style_transition_dsc_init(lv_style_transition_dsc_t * tr, const lv_style
  */
 lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop);
 
+/**
+ * Find a property in the sorted property array of a style with binary search
+ * @param props     the property IDs (with meta bits) in ascending order of their masked IDs
+ * @param cnt       number of properties in `props`
+ * @param prop      the ID of the property to find (without meta bits)
+ * @param index     store the index of the property here, or the index where it should be inserted if not found
+ * @return          true: the property was found
+ */
+static inline bool _lv_style_find_prop(const uint16_t * props, uint32_t cnt, lv_style_prop_t prop, uint32_t * index)
+{
+    uint32_t first = 0;
+    uint32_t last = cnt;
+    while(first < last) {
+        uint32_t mid = (first + last) >> 1;
+        lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(props[mid]);
+        if(prop_id < prop) first = mid + 1;
+        else if(prop_id > prop) last = mid;
+        else {
+            *index = mid;
+            return true;
+        }
+    }
+
+    *index = first;
+    return false;
+}
+
 /**
  * Get the value of a property
  * @param style pointer to a style
@@ -467,22 +502,19 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
     if(style->prop_cnt == 0) return LV_STYLE_RES_NOT_FOUND;
 
     if(style->prop_cnt > 1) {
-        uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+        uint8_t * tmp = style->v_p.values_and_props + _LV_STYLE_PROP_CAP(style->prop_cnt) * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
         uint32_t i;
-        for(i = 0; i < style->prop_cnt; i++) {
-            lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(props[i]);
-            if(prop_id == prop) {
-                if(props[i] & LV_STYLE_PROP_META_INHERIT)
-                    return LV_STYLE_RES_INHERIT;
-                if(props[i] & LV_STYLE_PROP_META_INITIAL)
-                    *value = lv_style_prop_get_default(prop_id);
-                else {
-                    lv_style_value_t * values = (lv_style_value_t *)style->v_p.values_and_props;
-                    *value = values[i];
-                }
-                return LV_STYLE_RES_FOUND;
+        if(_lv_style_find_prop(props, style->prop_cnt, prop, &i)) {
+            if(props[i] & LV_STYLE_PROP_META_INHERIT)
+                return LV_STYLE_RES_INHERIT;
+            if(props[i] & LV_STYLE_PROP_META_INITIAL)
+                *value = lv_style_prop_get_default(prop);
+            else {
+                lv_style_value_t * values = (lv_style_value_t *)style->v_p.values_and_props;
+                *value = values[i];
             }
+            return LV_STYLE_RES_FOUND;
         }
     }
     else if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop) {
@@ -518,6 +550,20 @@ uint8_t _lv_style_get_prop_group(lv_style_prop_t prop);
  */
 uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop);
 
+#if LV_USE_OBJ_STYLE_CACHE
+/**
+ * Outdate the resolved style properties cached by the objects.
+ * Called when a style, or the way the styles apply to the objects, changes.
+ */
+void _lv_style_cache_invalidate(void);
+
+/**
+ * Get the counter which is incremented by every `_lv_style_cache_invalidate()`
+ * @return the current value of the counter
+ */
+uint32_t _lv_style_cache_get_gen(void);
+#endif
+
 #include "lv_style_gen.h"
 
 static inline void lv_style_set_size(lv_style_t * style, lv_coord_t value)
@@ -38,6 +38,8 @@ const lv_obj_class_t lv_checkbox_class = {
     .constructor_cb = lv_checkbox_constructor,
     .destructor_cb = lv_checkbox_destructor,
     .event_cb = lv_checkbox_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
@@ -41,6 +41,10 @@ const lv_obj_class_t lv_img_class = {
     .constructor_cb = lv_img_constructor,
     .destructor_cb = lv_img_destructor,
     .event_cb = lv_img_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_HIT_TEST) | LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) |
+                  LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_COVER_CHECK) | LV_EVENT_MASK(LV_EVENT_DRAW_MAIN) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_POST),
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_img_t),
@@ -56,6 +56,9 @@ const lv_obj_class_t lv_label_class = {
     .constructor_cb = lv_label_constructor,
     .destructor_cb = lv_label_destructor,
     .event_cb = lv_label_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) | LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) |
+                  LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_label_t),
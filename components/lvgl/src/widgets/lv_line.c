@@ -37,6 +37,8 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e);
 const lv_obj_class_t lv_line_class = {
     .constructor_cb = lv_line_constructor,
     .event_cb = lv_line_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_line_t),
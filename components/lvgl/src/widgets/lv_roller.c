@@ -48,6 +48,12 @@ static void set_y_anim(void * obj, int32_t v);
 const lv_obj_class_t lv_roller_class = {
     .constructor_cb = lv_roller_constructor,
     .event_cb = lv_roller_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_PRESSED) | LV_EVENT_MASK(LV_EVENT_PRESSING) |
+                  LV_EVENT_MASK(LV_EVENT_PRESS_LOST) | LV_EVENT_MASK(LV_EVENT_RELEASED) | LV_EVENT_MASK(LV_EVENT_KEY) |
+                  LV_EVENT_MASK(LV_EVENT_FOCUSED) | LV_EVENT_MASK(LV_EVENT_DEFOCUSED) |
+                  LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) | LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) |
+                  LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN) | LV_EVENT_MASK(LV_EVENT_DRAW_POST),
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_DPI_DEF,
     .instance_size = sizeof(lv_roller_t),
@@ -58,6 +64,8 @@ const lv_obj_class_t lv_roller_class = {
 
 const lv_obj_class_t lv_roller_label_class  = {
     .event_cb = lv_roller_label_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
     .instance_size = sizeof(lv_label_t),
     .base_class = &lv_label_class
 };
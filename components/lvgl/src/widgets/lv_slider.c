@@ -43,6 +43,11 @@ static bool is_slider_horizontal(lv_obj_t * obj);
 const lv_obj_class_t lv_slider_class = {
     .constructor_cb = lv_slider_constructor,
     .event_cb = lv_slider_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_PRESSED) | LV_EVENT_MASK(LV_EVENT_PRESSING) |
+                  LV_EVENT_MASK(LV_EVENT_PRESS_LOST) | LV_EVENT_MASK(LV_EVENT_RELEASED) |
+                  LV_EVENT_MASK(LV_EVENT_HIT_TEST) | LV_EVENT_MASK(LV_EVENT_KEY) | LV_EVENT_MASK(LV_EVENT_FOCUSED) |
+                  LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
     .instance_size = sizeof(lv_slider_t),
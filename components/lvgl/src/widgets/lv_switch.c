@@ -55,6 +55,8 @@ const lv_obj_class_t lv_switch_class = {
     .constructor_cb = lv_switch_constructor,
     .destructor_cb = lv_switch_destructor,
     .event_cb = lv_switch_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_VALUE_CHANGED) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
     .width_def = (4 * LV_DPI_DEF) / 10,
     .height_def = (4 * LV_DPI_DEF) / 17,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
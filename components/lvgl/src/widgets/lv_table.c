@@ -56,6 +56,10 @@ const lv_obj_class_t lv_table_class  = {
     .constructor_cb = lv_table_constructor,
     .destructor_cb = lv_table_destructor,
     .event_cb = lv_table_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_PRESSED) | LV_EVENT_MASK(LV_EVENT_PRESSING) |
+                  LV_EVENT_MASK(LV_EVENT_RELEASED) | LV_EVENT_MASK(LV_EVENT_KEY) | LV_EVENT_MASK(LV_EVENT_FOCUSED) |
+                  LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) | LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .base_class = &lv_obj_class,
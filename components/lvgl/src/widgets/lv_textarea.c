@@ -68,6 +68,11 @@ const lv_obj_class_t lv_textarea_class = {
     .constructor_cb = lv_textarea_constructor,
     .destructor_cb = lv_textarea_destructor,
     .event_cb = lv_textarea_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_PRESSED) | LV_EVENT_MASK(LV_EVENT_PRESSING) |
+                  LV_EVENT_MASK(LV_EVENT_PRESS_LOST) | LV_EVENT_MASK(LV_EVENT_RELEASED) | LV_EVENT_MASK(LV_EVENT_KEY) |
+                  LV_EVENT_MASK(LV_EVENT_FOCUSED) | LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) |
+                  LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) | LV_EVENT_MASK(LV_EVENT_DRAW_MAIN) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_POST),
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
     .width_def = LV_DPI_DEF * 2,
     .height_def = LV_DPI_DEF,
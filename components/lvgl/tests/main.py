@@ -22,6 +22,9 @@ build_only_options = {
 test_options = {
     'OPTIONS_TEST_SYSHEAP': 'Test config, system heap, 32 bit color depth',
     'OPTIONS_TEST_DEFHEAP': 'Test config, LVGL heap, 32 bit color depth',
+    'OPTIONS_TEST_FEATURES': 'Test config, LVGL heap, 32 bit color depth, optional features',
+    'OPTIONS_TEST_16BIT': 'Minimal config, 16 bit color depth, optional features',
+    'OPTIONS_TEST_16BIT_SWAP': 'Normal config, 16 bit color depth swapped, optional features',
 }
 
 
@@ -0,0 +1,228 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <pthread.h>
+
+#define RING_HOR_RES    320
+#define RING_VER_RES    240
+#define RING_BUF_ROWS   20
+#define RING_BUF_CNT    4
+#define RING_MAX_FLUSH  64
+
+static lv_color_t bufs_mem[RING_BUF_CNT][RING_HOR_RES * RING_BUF_ROWS];
+static lv_color_t ring_fb[RING_HOR_RES * RING_VER_RES];
+static lv_color_t ref_fb[RING_HOR_RES * RING_VER_RES];
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_disp_t * disp;
+static lv_disp_t * disp_ori;
+
+/*Flushes are queued in `flush_cb` and finished in `wait_cb` or on the DMA thread*/
+static lv_area_t flush_areas[RING_MAX_FLUSH];
+static bool flush_last[RING_MAX_FLUSH];
+static uint32_t flush_cnt;
+static bool pending;
+static lv_area_t pending_area;  /*`flush_cb` gets a temporary area, so copy it*/
+static const lv_color_t * pending_buf;
+
+static bool dma_used;
+static pthread_t dma_thread;
+static pthread_mutex_t dma_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t dma_cond = PTHREAD_COND_INITIALIZER;
+static bool dma_exit;
+
+static void copy_to_fb(const lv_area_t * area, const lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&ring_fb[y * RING_HOR_RES + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+}
+
+static void finish_pending_flush(void)
+{
+    if(!pending) return;
+    copy_to_fb(&pending_area, pending_buf);
+    pending = false;
+    lv_disp_flush_ready(&disp_drv);
+}
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    if(flush_cnt < RING_MAX_FLUSH) {
+        flush_areas[flush_cnt] = *area;
+        flush_last[flush_cnt] = lv_disp_flush_is_last(drv);
+    }
+    flush_cnt++;
+
+    if(dma_used) pthread_mutex_lock(&dma_lock);
+    TEST_ASSERT_FALSE(pending);
+    pending = true;
+    pending_area = *area;
+    pending_buf = color_p;
+    if(dma_used) {
+        pthread_cond_signal(&dma_cond);
+        pthread_mutex_unlock(&dma_lock);
+    }
+}
+
+static void wait_cb(lv_disp_drv_t * drv)
+{
+    LV_UNUSED(drv);
+    if(!dma_used) finish_pending_flush();
+}
+
+static void * dma_thread_cb(void * arg)
+{
+    LV_UNUSED(arg);
+    pthread_mutex_lock(&dma_lock);
+    while(1) {
+        while(!pending && !dma_exit) pthread_cond_wait(&dma_cond, &dma_lock);
+        if(dma_exit) break;
+
+        copy_to_fb(&pending_area, pending_buf);
+        pending = false;
+        lv_disp_flush_ready(&disp_drv);
+    }
+    pthread_mutex_unlock(&dma_lock);
+    return NULL;
+}
+
+static void init_bufs(uint32_t buf_cnt)
+{
+    void * bufs[RING_BUF_CNT];
+    uint32_t i;
+    for(i = 0; i < RING_BUF_CNT; i++) bufs[i] = bufs_mem[i];
+
+    if(buf_cnt == 0) lv_disp_draw_buf_init(&draw_buf, bufs[0], bufs[1], RING_HOR_RES * RING_BUF_ROWS);
+    else lv_disp_draw_buf_init_ring(&draw_buf, bufs, buf_cnt, RING_HOR_RES * RING_BUF_ROWS);
+}
+
+static void render(void)
+{
+    flush_cnt = 0;
+    lv_memset_00(ring_fb, sizeof(ring_fb));
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(disp);
+
+    /*Wait for the last buffer*/
+    while(draw_buf.flushing) {
+        if(!dma_used) finish_pending_flush();
+    }
+}
+
+static void create_scene(void)
+{
+    lv_obj_t * scr = lv_scr_act();
+    lv_obj_set_style_bg_color(scr, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+
+    lv_obj_t * label = lv_label_create(scr);
+    lv_label_set_text(label, "Ring");
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 10);
+
+    /*Make the bottom strips much slower to render than the top ones.
+     *This is when a deeper ring helps: the fast strips are queued while the slow ones are rendered.*/
+    lv_obj_t * btn = lv_btn_create(scr);
+    lv_obj_set_size(btn, 260, 90);
+    lv_obj_align(btn, LV_ALIGN_BOTTOM_MID, 0, -20);
+    lv_obj_set_style_radius(btn, 40, 0);
+    lv_obj_set_style_shadow_width(btn, 50, 0);
+    lv_obj_set_style_shadow_spread(btn, 10, 0);
+}
+
+void setUp(void)
+{
+    disp_ori = lv_disp_get_default();
+
+    init_bufs(RING_BUF_CNT);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.wait_cb = wait_cb;
+    disp_drv.hor_res = RING_HOR_RES;
+    disp_drv.ver_res = RING_VER_RES;
+    disp = lv_disp_drv_register(&disp_drv);
+    lv_disp_set_default(disp);
+
+    create_scene();
+}
+
+void tearDown(void)
+{
+    lv_disp_remove(disp);
+    lv_disp_set_default(disp_ori);
+
+    /*`lv_disp_remove()` leaves the draw context to the driver*/
+    disp_drv.draw_ctx_deinit(&disp_drv, disp_drv.draw_ctx);
+    lv_mem_free(disp_drv.draw_ctx);
+}
+
+void test_disp_buf_ring_should_match_double_buffering(void)
+{
+    init_bufs(0);
+    render();
+    lv_memcpy(ref_fb, ring_fb, sizeof(ref_fb));
+
+    uint32_t buf_cnt;
+    for(buf_cnt = 2; buf_cnt <= RING_BUF_CNT; buf_cnt++) {
+        init_bufs(buf_cnt);
+        render();
+        TEST_ASSERT_EQUAL_MEMORY(ref_fb, ring_fb, sizeof(ref_fb));
+    }
+}
+
+void test_disp_buf_ring_should_flush_strips_in_order(void)
+{
+    render();
+
+    TEST_ASSERT_EQUAL_UINT32(RING_VER_RES / RING_BUF_ROWS, flush_cnt);
+
+    uint32_t i;
+    for(i = 0; i < flush_cnt; i++) {
+        TEST_ASSERT_EQUAL_INT(i * RING_BUF_ROWS, flush_areas[i].y1);
+        TEST_ASSERT_EQUAL_INT((i + 1) * RING_BUF_ROWS - 1, flush_areas[i].y2);
+        TEST_ASSERT_EQUAL(i == flush_cnt - 1, flush_last[i]);
+    }
+}
+
+void test_disp_buf_ring_should_wait_only_if_all_buffers_are_busy(void)
+{
+    /*Flushes are finished only in `wait_cb` so rendering has to stall once the ring is full*/
+    draw_buf.ring_wait_cnt = 0;
+    render();
+    TEST_ASSERT_EQUAL_UINT32(flush_cnt - (RING_BUF_CNT - 1), draw_buf.ring_wait_cnt);
+}
+
+void test_disp_buf_ring_should_render_with_flushes_finished_on_an_other_thread(void)
+{
+    init_bufs(0);
+    render();
+    lv_memcpy(ref_fb, ring_fb, sizeof(ref_fb));
+
+    dma_used = true;
+    dma_exit = false;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&dma_thread, NULL, dma_thread_cb, NULL));
+
+    uint32_t buf_cnt;
+    for(buf_cnt = 1; buf_cnt <= RING_BUF_CNT; buf_cnt++) {
+        init_bufs(buf_cnt);
+        render();
+        TEST_ASSERT_EQUAL_MEMORY(ref_fb, ring_fb, sizeof(ref_fb));
+    }
+
+    pthread_mutex_lock(&dma_lock);
+    dma_exit = true;
+    pthread_cond_signal(&dma_cond);
+    pthread_mutex_unlock(&dma_lock);
+    pthread_join(dma_thread, NULL);
+    dma_used = false;
+}
+
+#endif
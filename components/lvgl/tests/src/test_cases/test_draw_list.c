@@ -0,0 +1,147 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define TEST_HOR_RES 800
+#define TEST_VER_RES 480
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[TEST_HOR_RES * TEST_VER_RES];
+
+void setUp(void)
+{
+    lv_refr_set_draw_list(true);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_refr_set_draw_list(true);
+}
+
+static void create_scene(void)
+{
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        lv_obj_t * btn = lv_btn_create(lv_scr_act());
+        lv_obj_set_size(btn, 180, 60);
+        lv_obj_set_pos(btn, 10 + (i % 4) * 195, 10 + (i / 4) * 80);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %"LV_PRIu32, i);
+        lv_obj_center(label);
+    }
+
+    lv_obj_t * slider = lv_slider_create(lv_scr_act());
+    lv_obj_set_width(slider, 300);
+    lv_obj_set_pos(slider, 20, 280);
+    lv_slider_set_value(slider, 40, LV_ANIM_OFF);
+
+    lv_obj_t * arc = lv_arc_create(lv_scr_act());
+    lv_obj_set_size(arc, 120, 120);
+    lv_obj_set_pos(arc, 400, 260);
+
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, LV_SYMBOL_OK " Retained mode\nSecond line");
+    lv_obj_set_pos(label, 600, 300);
+}
+
+/*Redraw the display without invalidating any object*/
+static void render(void)
+{
+    lv_area_t a = {0, 0, TEST_HOR_RES - 1, TEST_VER_RES - 1};
+    _lv_inv_area(NULL, &a);
+    lv_refr_now(NULL);
+}
+
+void test_draw_list_should_replay_unchanged_objects(void)
+{
+    create_scene();
+
+    lv_refr_set_draw_list(false);
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*The first draw records, the second replays*/
+    lv_refr_set_draw_list(true);
+    lv_draw_list_reset_stats();
+    render();
+    const lv_draw_list_stats_t * stats = lv_draw_list_get_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->rec_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->replay_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    uint32_t rec_cnt = stats->rec_cnt;
+    lv_draw_list_reset_stats();
+    render();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->rec_cnt);
+    TEST_ASSERT_EQUAL_UINT32(rec_cnt, stats->replay_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_draw_list_should_record_again_if_invalidated(void)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "Hello");
+    render();
+
+    lv_draw_list_reset_stats();
+    lv_label_set_text(label, "Hello world");
+    render();
+    const lv_draw_list_stats_t * stats = lv_draw_list_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(2, stats->rec_cnt);    /*Main and post of the label*/
+
+    /*Moving an object draws it at new coordinates so it's recorded again too*/
+    lv_draw_list_reset_stats();
+    lv_obj_set_x(label, 100);
+    render();
+    TEST_ASSERT_EQUAL_UINT32(2, stats->rec_cnt);
+
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    lv_refr_set_draw_list(false);
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_draw_list_should_not_record_masked_drawing(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_clip_corner(obj, true, 0);
+    lv_obj_set_style_radius(obj, 20, 0);
+    render();
+
+    lv_draw_list_reset_stats();
+    render();
+    render();
+
+    /*The clip corner mask is added in the main and removed in the post draw event*/
+    const lv_draw_list_stats_t * stats = lv_draw_list_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->rec_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->fail_cnt);
+    /*Only the main and post of the screen and the top and system layers*/
+    TEST_ASSERT_EQUAL_UINT32(2 * 3 * 2, stats->replay_cnt);
+}
+
+void test_draw_list_should_not_record_clipped_objects(void)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "Partially invalidated");
+    lv_refr_now(NULL);
+
+    lv_draw_list_reset_stats();
+    lv_area_t a = {0, 0, 10, 10};
+    lv_obj_invalidate_area(label, &a);
+    lv_refr_now(NULL);
+
+    /*Only the screen and the layers are replayed*/
+    const lv_draw_list_stats_t * stats = lv_draw_list_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->rec_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3 * 2, stats->replay_cnt);
+
+    lv_draw_list_reset_stats();
+    render();
+    TEST_ASSERT_EQUAL_UINT32(2, stats->rec_cnt);
+}
+
+#endif
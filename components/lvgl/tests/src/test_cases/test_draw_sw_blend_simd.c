@@ -0,0 +1,245 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "../../../src/draw/sw/lv_draw_sw.h"
+
+/*Odd sizes to have partial vectors at the end of the rows*/
+#define BUF_W 67
+#define BUF_H 9
+
+typedef enum {
+    MASK_NONE,
+    MASK_RANDOM,
+    MASK_RUNS,      /*Runs of 0, 255 and random values*/
+    MASK_COVER,
+    _MASK_LAST
+} mask_type_t;
+
+static const lv_opa_t opas[] = {LV_OPA_COVER, 254, LV_OPA_MAX, 252, 200, LV_OPA_50, 3, LV_OPA_MIN};
+static const lv_blend_mode_t blend_modes[] = {LV_BLEND_MODE_NORMAL, LV_BLEND_MODE_ADDITIVE, LV_BLEND_MODE_SUBTRACTIVE,
+                                              LV_BLEND_MODE_MULTIPLY
+                                             };
+static const lv_draw_sw_simd_t simds[] = {LV_DRAW_SW_SIMD_SSE2, LV_DRAW_SW_SIMD_AVX2, LV_DRAW_SW_SIMD_NEON};
+
+static lv_color_t dest_buf[BUF_W * BUF_H];
+static lv_color_t ref_buf[BUF_W * BUF_H];
+static lv_color_t src_buf[BUF_W * BUF_H];
+static lv_opa_t mask_buf[BUF_W * BUF_H];
+static lv_opa_t mask_ref_buf[BUF_W * BUF_H];
+
+static uint32_t rnd_seed;
+static lv_draw_sw_simd_t simd_ori;
+static lv_disp_t * disp_refr_ori;
+
+static uint32_t rnd(void)
+{
+    /*xorshift32*/
+    rnd_seed ^= rnd_seed << 13;
+    rnd_seed ^= rnd_seed >> 17;
+    rnd_seed ^= rnd_seed << 5;
+    return rnd_seed;
+}
+
+/*Runs of random colors and black as the C code handles the black pixels specially*/
+static void fill_colors(lv_color_t * buf, uint32_t px_cnt)
+{
+    uint32_t i = 0;
+    while(i < px_cnt) {
+        lv_color_t c;
+        if(rnd() % 4 == 0) c = lv_color_black();
+        else c.full = rnd();
+#if LV_COLOR_DEPTH == 32
+        /*The C code sets the alpha byte of a few untouched pixels depending on the alignment of the mask.
+         *Keep it opaque to compare the colors only*/
+        c.ch.alpha = 0xFF;
+#endif
+        uint32_t run = 1 + rnd() % 8;
+        while(run && i < px_cnt) {
+            buf[i] = c;
+            i++;
+            run--;
+        }
+    }
+}
+
+static void fill_mask(lv_opa_t * buf, uint32_t px_cnt, mask_type_t type)
+{
+    uint32_t i = 0;
+    while(i < px_cnt) {
+        lv_opa_t v;
+        uint32_t run;
+        if(type == MASK_COVER) {
+            v = LV_OPA_COVER;
+            run = px_cnt;
+        }
+        else if(type == MASK_RANDOM) {
+            v = rnd();
+            run = 1;
+        }
+        else {
+            uint32_t r = rnd() % 3;
+            v = r == 0 ? LV_OPA_TRANSP : r == 1 ? LV_OPA_COVER : rnd();
+            run = 1 + rnd() % 24;
+        }
+
+        while(run && i < px_cnt) {
+            buf[i] = v;
+            i++;
+            run--;
+        }
+    }
+}
+
+static void blend(lv_color_t * buf, lv_coord_t buf_w, lv_coord_t buf_h, const lv_area_t * area,
+                  const lv_color_t * src, lv_color_t color, lv_opa_t opa, lv_opa_t * mask, lv_blend_mode_t blend_mode)
+{
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, 0, 0, buf_w - 1, buf_h - 1);
+
+    lv_draw_sw_ctx_t draw_ctx;
+    lv_memset_00(&draw_ctx, sizeof(draw_ctx));
+    draw_ctx.base_draw.buf = buf;
+    draw_ctx.base_draw.buf_area = &buf_area;
+    draw_ctx.base_draw.clip_area = &buf_area;
+
+    lv_draw_sw_blend_dsc_t dsc;
+    lv_memset_00(&dsc, sizeof(dsc));
+    dsc.blend_area = area;
+    dsc.src_buf = src;
+    dsc.color = color;
+    dsc.opa = opa;
+    dsc.mask_buf = mask;
+    dsc.mask_res = mask ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+    dsc.mask_area = area;
+    dsc.blend_mode = blend_mode;
+
+    lv_draw_sw_blend_basic((lv_draw_ctx_t *)&draw_ctx, &dsc);
+}
+
+/*Blend the same random data with the C code and with `simd` and compare the results*/
+static void test_blend(lv_draw_sw_simd_t simd, bool map, mask_type_t mask_type, lv_opa_t opa,
+                       lv_blend_mode_t blend_mode, const lv_area_t * area)
+{
+    fill_colors(ref_buf, BUF_W * BUF_H);
+    fill_colors(src_buf, BUF_W * BUF_H);
+    fill_mask(mask_ref_buf, BUF_W * BUF_H, mask_type);
+    lv_memcpy(dest_buf, ref_buf, sizeof(ref_buf));
+    lv_memcpy(mask_buf, mask_ref_buf, sizeof(mask_buf));
+
+    lv_color_t color;
+    fill_colors(&color, 1);
+    const lv_color_t * src = map ? src_buf : NULL;
+
+    TEST_ASSERT_TRUE(lv_draw_sw_simd_set(LV_DRAW_SW_SIMD_NONE));
+    blend(ref_buf, BUF_W, BUF_H, area, src, color, opa, mask_type == MASK_NONE ? NULL : mask_ref_buf, blend_mode);
+
+    TEST_ASSERT_TRUE(lv_draw_sw_simd_set(simd));
+    blend(dest_buf, BUF_W, BUF_H, area, src, color, opa, mask_type == MASK_NONE ? NULL : mask_buf, blend_mode);
+
+    char msg[128];
+    lv_snprintf(msg, sizeof(msg), "simd: %d, map: %d, mask: %d, opa: %d, blend mode: %d, x1: %d, w: %d",
+                simd, map, mask_type, opa, blend_mode, area->x1, lv_area_get_width(area));
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(ref_buf, dest_buf, sizeof(ref_buf), msg);
+}
+
+void setUp(void)
+{
+    rnd_seed = 0x12345678;
+    simd_ori = lv_draw_sw_simd_get();
+    disp_refr_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(lv_disp_get_default());
+}
+
+void tearDown(void)
+{
+    lv_draw_sw_simd_set(simd_ori);
+    _lv_refr_set_disp_refreshing(disp_refr_ori);
+}
+
+void test_draw_sw_blend_simd_should_select_a_supported_instruction_set(void)
+{
+    TEST_ASSERT_TRUE(lv_draw_sw_simd_is_supported(LV_DRAW_SW_SIMD_NONE));
+    TEST_ASSERT_TRUE(lv_draw_sw_simd_is_supported(lv_draw_sw_simd_get()));
+
+#if defined(__x86_64__) && LV_COLOR_DEPTH == 32
+    /*SSE2 is part of x86-64*/
+    TEST_ASSERT_TRUE(lv_draw_sw_simd_is_supported(LV_DRAW_SW_SIMD_SSE2));
+    TEST_ASSERT_NOT_EQUAL(LV_DRAW_SW_SIMD_NONE, lv_draw_sw_simd_get());
+#endif
+
+    /*An unsupported instruction set doesn't change the selection*/
+    uint32_t i;
+    for(i = 0; i < sizeof(simds) / sizeof(simds[0]); i++) {
+        if(lv_draw_sw_simd_is_supported(simds[i])) continue;
+        lv_draw_sw_simd_t act = lv_draw_sw_simd_get();
+        TEST_ASSERT_FALSE(lv_draw_sw_simd_set(simds[i]));
+        TEST_ASSERT_EQUAL(act, lv_draw_sw_simd_get());
+    }
+}
+
+void test_draw_sw_blend_simd_should_blend_as_the_c_code(void)
+{
+    /*Areas with different alignments and widths shorter and longer than a vector*/
+    lv_area_t areas[4];
+    lv_area_set(&areas[0], 0, 0, BUF_W - 1, BUF_H - 1);
+    lv_area_set(&areas[1], 3, 1, BUF_W - 2, BUF_H - 3);
+    lv_area_set(&areas[2], 5, 2, 11, 6);
+    lv_area_set(&areas[3], 1, 0, 2, BUF_H - 1);
+
+    uint32_t s;
+    for(s = 0; s < sizeof(simds) / sizeof(simds[0]); s++) {
+        if(!lv_draw_sw_simd_is_supported(simds[s])) continue;
+
+        uint32_t map;
+        for(map = 0; map < 2; map++) {
+            mask_type_t mask_type;
+            for(mask_type = MASK_NONE; mask_type < _MASK_LAST; mask_type++) {
+                uint32_t o;
+                for(o = 0; o < sizeof(opas) / sizeof(opas[0]); o++) {
+                    uint32_t b;
+                    for(b = 0; b < sizeof(blend_modes) / sizeof(blend_modes[0]); b++) {
+                        uint32_t a;
+                        for(a = 0; a < sizeof(areas) / sizeof(areas[0]); a++) {
+                            test_blend(simds[s], map, mask_type, opas[o], blend_modes[b], &areas[a]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void test_draw_sw_blend_simd_should_mix_the_black_pixels_as_the_c_code(void)
+{
+    /*The C code mixes the black pixels before the first other one with the original opacity*/
+    lv_area_t area;
+    lv_area_set(&area, 2, 1, BUF_W - 3, BUF_H - 2);
+
+    uint32_t s;
+    for(s = 0; s < sizeof(simds) / sizeof(simds[0]); s++) {
+        if(!lv_draw_sw_simd_is_supported(simds[s])) continue;
+
+        uint32_t first;
+        for(first = 0; first < 3 * BUF_W; first += 29) {
+            uint32_t o;
+            for(o = 0; o < sizeof(opas) / sizeof(opas[0]); o++) {
+                fill_colors(ref_buf, BUF_W * BUF_H);
+                uint32_t i;
+                for(i = 0; i < BUF_W + first; i++) ref_buf[i] = lv_color_black();
+                lv_memcpy(dest_buf, ref_buf, sizeof(ref_buf));
+
+                lv_color_t color = lv_color_hex(0x3080f0);
+                TEST_ASSERT_TRUE(lv_draw_sw_simd_set(LV_DRAW_SW_SIMD_NONE));
+                blend(ref_buf, BUF_W, BUF_H, &area, NULL, color, opas[o], NULL, LV_BLEND_MODE_NORMAL);
+                TEST_ASSERT_TRUE(lv_draw_sw_simd_set(simds[s]));
+                blend(dest_buf, BUF_W, BUF_H, &area, NULL, color, opas[o], NULL, LV_BLEND_MODE_NORMAL);
+
+                TEST_ASSERT_EQUAL_MEMORY(ref_buf, dest_buf, sizeof(ref_buf));
+            }
+        }
+    }
+}
+
+#endif
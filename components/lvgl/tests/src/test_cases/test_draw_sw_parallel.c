@@ -0,0 +1,118 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define TEST_HOR_RES 800
+#define TEST_VER_RES 480
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[TEST_HOR_RES * TEST_VER_RES];
+static uint8_t row_hits[TEST_VER_RES];
+
+void setUp(void)
+{
+    lv_draw_sw_parallel_set_thread_cnt(LV_DRAW_SW_PARALLEL_THREAD_CNT);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_draw_sw_parallel_set_thread_cnt(LV_DRAW_SW_PARALLEL_THREAD_CNT);
+}
+
+static void count_rows_cb(void * user_data, lv_coord_t y_ofs, lv_coord_t h)
+{
+    uint8_t * hits = user_data;
+    lv_coord_t y;
+    for(y = y_ofs; y < y_ofs + h; y++) hits[y]++;
+}
+
+static void create_scene(void)
+{
+    lv_obj_t * scr = lv_scr_act();
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 3), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+
+    /*Large rounded and semi transparent areas to get masked and opa blends above the threshold*/
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 600, 300);
+    lv_obj_set_pos(obj, 30, 40);
+    lv_obj_set_style_radius(obj, 60, 0);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_70, 0);
+    lv_obj_set_style_border_width(obj, 12, 0);
+    lv_obj_set_style_shadow_width(obj, 30, 0);
+
+    obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 400, 400);
+    lv_obj_set_pos(obj, 350, 60);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_GREEN), 0);
+    lv_obj_set_style_blend_mode(obj, LV_BLEND_MODE_ADDITIVE, 0);
+
+    lv_obj_t * label = lv_label_create(scr);
+    lv_label_set_text(label, "Parallel rendering");
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_48, 0);
+    lv_obj_center(label);
+}
+
+static void render(uint32_t thread_cnt)
+{
+    lv_draw_sw_parallel_set_thread_cnt(thread_cnt);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+void test_draw_sw_parallel_should_render_every_row_once(void)
+{
+    static const lv_coord_t heights[] = {1, 2, 3, 7, 64, TEST_VER_RES};
+    uint32_t i;
+    for(i = 0; i < sizeof(heights) / sizeof(heights[0]); i++) {
+        lv_memset_00(row_hits, sizeof(row_hits));
+        lv_draw_sw_parallel_run(count_rows_cb, row_hits, heights[i]);
+
+        lv_coord_t y;
+        for(y = 0; y < TEST_VER_RES; y++) {
+            TEST_ASSERT_EQUAL_UINT8(y < heights[i] ? 1 : 0, row_hits[y]);
+        }
+    }
+}
+
+void test_draw_sw_parallel_should_clamp_thread_cnt(void)
+{
+    lv_draw_sw_parallel_set_thread_cnt(0);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_draw_sw_parallel_get_thread_cnt());
+
+    lv_draw_sw_parallel_set_thread_cnt(LV_DRAW_SW_PARALLEL_THREAD_CNT + 1);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_SW_PARALLEL_THREAD_CNT, lv_draw_sw_parallel_get_thread_cnt());
+}
+
+void test_draw_sw_parallel_should_match_single_threaded_rendering(void)
+{
+    create_scene();
+
+    render(1);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    uint32_t thread_cnt;
+    for(thread_cnt = 2; thread_cnt <= LV_DRAW_SW_PARALLEL_THREAD_CNT; thread_cnt++) {
+        render(thread_cnt);
+        TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    }
+}
+
+void test_draw_sw_parallel_should_restart_after_deinit(void)
+{
+    create_scene();
+
+    render(1);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_draw_sw_parallel_deinit();
+    render(LV_DRAW_SW_PARALLEL_THREAD_CNT);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+#endif
@@ -3,6 +3,39 @@
 
 #include "unity/unity.h"
 
+static uint32_t event_cnt;
+static uint32_t class_event_cnt;
+
+void setUp(void)
+{
+    event_cnt = 0;
+    class_event_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+static void event_cnt_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    event_cnt++;
+}
+
+static void class_event_cnt_cb(const lv_obj_class_t * cls, lv_event_t * e)
+{
+    LV_UNUSED(cls);
+    if(lv_obj_event_base(cls, e) != LV_RES_OK) return;
+    if(lv_event_get_code(e) == LV_EVENT_VALUE_CHANGED) class_event_cnt++;
+}
+
+static const lv_obj_class_t event_mask_class = {
+    .event_cb = class_event_cnt_cb,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_VALUE_CHANGED),
+    .base_class = &lv_obj_class
+};
+
 static void event_object_deletion_cb(const lv_obj_class_t * cls, lv_event_t * e)
 {
     LV_UNUSED(cls);
@@ -24,4 +57,71 @@ void test_event_object_deletion(void)
     lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+void test_event_should_follow_the_added_and_removed_callbacks(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_add_event_cb(obj, event_cnt_cb, LV_EVENT_CLICKED, NULL);
+    lv_event_send(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, event_cnt);
+    lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, event_cnt);
+
+    lv_obj_add_event_cb(obj, event_cnt_cb, LV_EVENT_DRAW_PART_BEGIN | LV_EVENT_PREPROCESS, NULL);
+    lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, event_cnt);
+
+    /*Removes the first one only*/
+    lv_obj_remove_event_cb(obj, event_cnt_cb);
+    lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+    lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, event_cnt);
+
+    lv_obj_remove_event_cb(obj, event_cnt_cb);
+    lv_obj_add_event_cb(obj, event_cnt_cb, LV_EVENT_ALL, NULL);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    lv_event_send(obj, LV_EVENT_READY, NULL);
+    TEST_ASSERT_EQUAL_UINT32(5, event_cnt);
+}
+
+void test_event_should_send_custom_events(void)
+{
+    uint32_t code1 = lv_event_register_id();
+    uint32_t code2 = lv_event_register_id();
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_add_event_cb(obj, event_cnt_cb, code1, NULL);
+    lv_event_send(obj, code1, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, event_cnt);
+
+    /*The custom codes share a bit so the callbacks filter them*/
+    lv_event_send(obj, code2, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, event_cnt);
+}
+
+void test_event_should_call_the_class_for_the_handled_events_only(void)
+{
+    lv_obj_t * obj = lv_obj_class_create_obj(&event_mask_class, lv_scr_act());
+    lv_obj_class_init_obj(obj);
+
+    lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, class_event_cnt);
+
+    /*The base class still handles its own events*/
+    lv_event_send(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_TRUE(lv_obj_has_state(obj, LV_STATE_PRESSED));
+}
+
+void test_event_should_bubble_through_the_skipped_objects(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_t * child = lv_obj_create(obj);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_EVENT_BUBBLE);
+    lv_obj_add_flag(child, LV_OBJ_FLAG_EVENT_BUBBLE);
+    lv_obj_add_event_cb(parent, event_cnt_cb, LV_EVENT_READY, NULL);
+
+    lv_event_send(child, LV_EVENT_READY, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, event_cnt);
+}
+
 #endif
@@ -0,0 +1,87 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+static void event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+void test_event_stats_should_count_the_events(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_event_reset_stats();
+
+    /*Neither the object nor its class handles it*/
+    lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    const lv_event_stats_t * stats = lv_event_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->dispatched_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->skipped_cnt);
+
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->dispatched_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->skipped_cnt);
+
+    lv_event_reset_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->dispatched_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->skipped_cnt);
+}
+
+/*Redraw the whole screen and return the number of sent events*/
+static uint32_t render(uint32_t * skipped_cnt)
+{
+    lv_event_reset_stats();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    const lv_event_stats_t * stats = lv_event_get_stats();
+    *skipped_cnt = stats->skipped_cnt;
+    return stats->dispatched_cnt + stats->skipped_cnt;
+}
+
+void test_event_stats_should_skip_the_unhandled_drawing_events_of_the_widgets_demo(void)
+{
+#if LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+#if LV_USE_DRAW_LIST
+    /*Replaying the draw lists would skip the drawing events*/
+    lv_refr_set_draw_list(false);
+#endif
+    lv_refr_now(NULL);
+
+    uint32_t skipped_cnt1;
+    uint32_t skipped_cnt2;
+    uint32_t sent_cnt1 = render(&skipped_cnt1);
+    uint32_t sent_cnt2 = render(&skipped_cnt2);
+
+    /*Many objects have no handler for the drawing events of their parts*/
+    TEST_ASSERT_GREATER_THAN_UINT32(0, skipped_cnt1);
+    TEST_ASSERT_LESS_THAN_UINT32(sent_cnt1, skipped_cnt1);
+
+    /*Nothing has changed so the same events are sent again*/
+    TEST_ASSERT_EQUAL_UINT32(sent_cnt1, sent_cnt2);
+    TEST_ASSERT_EQUAL_UINT32(skipped_cnt1, skipped_cnt2);
+
+#if LV_USE_DRAW_LIST
+    lv_refr_set_draw_list(true);
+#endif
+    /*The demo's animations would keep running on the next screen*/
+    lv_anim_del_all();
+#else
+    TEST_IGNORE_MESSAGE("Needs LV_USE_DEMO_WIDGETS");
+#endif
+}
+
+#endif
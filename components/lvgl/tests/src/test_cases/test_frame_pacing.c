@@ -0,0 +1,217 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define VSYNC_PERIOD    10      /*[ms]*/
+
+static lv_disp_t * disp;
+static lv_obj_t * load_obj;
+static uint32_t load_time;
+
+/*Simulate a scene which takes `load_time` ms to render*/
+static void load_draw_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    lv_tick_inc(load_time);
+}
+
+static void set_load(uint32_t ms)
+{
+    load_time = ms;
+    if(load_obj == NULL) {
+        load_obj = lv_obj_create(lv_scr_act());
+        lv_obj_set_size(load_obj, 20, 20);
+        lv_obj_add_event_cb(load_obj, load_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    }
+}
+
+static void refr_frames(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        if(load_obj) lv_obj_invalidate(load_obj);   /*Not to replay its recorded draw calls*/
+        lv_refr_now(disp);
+    }
+}
+
+/*Call `lv_disp_vsync()` a few times to measure the vsync period*/
+static void start_vsync(void)
+{
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_disp_vsync(disp);
+        lv_tick_inc(VSYNC_PERIOD);
+    }
+    lv_disp_vsync(disp);
+}
+
+void setUp(void)
+{
+    disp = lv_disp_get_default();
+    load_obj = NULL;
+    load_time = 0;
+
+    /*Forget the vsync signal and the measured frame times of the previous test*/
+    disp->vsync_cnt = 0;
+    disp->vsync_period = 0;
+    disp->vsync_cnt_refr = 0;
+    disp->pacing_time_avg = 0;
+    disp->pacing_div = 1;
+    lv_timer_set_period(disp->refr_timer, LV_DISP_DEF_REFR_PERIOD);
+    lv_refr_reset_frame_stats(disp);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_refr_now(disp);
+}
+
+void test_frame_pacing_should_record_the_frame_times(void)
+{
+    refr_frames(5);
+
+    const lv_disp_frame_stats_t * stats = lv_refr_get_frame_stats(disp);
+    TEST_ASSERT_EQUAL_UINT32(5, stats->frame_cnt);
+
+    uint32_t hist_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < LV_FRAME_PACING_HIST_SIZE; i++) hist_cnt += stats->hist[i];
+    TEST_ASSERT_EQUAL_UINT32(5, hist_cnt);
+
+    /*Fast frames keep the default period*/
+    TEST_ASSERT_EQUAL_UINT32(LV_DISP_DEF_REFR_PERIOD, stats->period);
+    TEST_ASSERT_EQUAL_UINT32(LV_DISP_DEF_REFR_PERIOD, disp->refr_timer->period);
+
+    lv_refr_reset_frame_stats(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_DISP_DEF_REFR_PERIOD, stats->period);
+}
+
+void test_frame_pacing_should_use_a_multiple_of_the_period_under_load(void)
+{
+    set_load(LV_DISP_DEF_REFR_PERIOD + 10);
+    refr_frames(3);
+
+    const lv_disp_frame_stats_t * stats = lv_refr_get_frame_stats(disp);
+    TEST_ASSERT_EQUAL_UINT32(2 * LV_DISP_DEF_REFR_PERIOD, stats->period);
+    TEST_ASSERT_EQUAL_UINT32(2 * LV_DISP_DEF_REFR_PERIOD, disp->refr_timer->period);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(LV_DISP_DEF_REFR_PERIOD + 10, stats->frame_time_max);
+
+    /*The first slow frame was longer than the period*/
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats->skip_cnt);
+    uint32_t skip_cnt = stats->skip_cnt;
+
+    /*With the longer period no more frames are missed*/
+    refr_frames(3);
+    TEST_ASSERT_EQUAL_UINT32(skip_cnt, stats->skip_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * LV_DISP_DEF_REFR_PERIOD, stats->period);
+}
+
+void test_frame_pacing_should_speed_up_again_without_load(void)
+{
+    set_load(LV_DISP_DEF_REFR_PERIOD + 10);
+    refr_frames(3);
+    TEST_ASSERT_EQUAL_UINT32(2 * LV_DISP_DEF_REFR_PERIOD, lv_refr_get_frame_stats(disp)->period);
+
+    /*A single fast frame doesn't change the period*/
+    set_load(0);
+    refr_frames(1);
+    TEST_ASSERT_EQUAL_UINT32(2 * LV_DISP_DEF_REFR_PERIOD, lv_refr_get_frame_stats(disp)->period);
+
+    refr_frames(10);
+    TEST_ASSERT_EQUAL_UINT32(LV_DISP_DEF_REFR_PERIOD, lv_refr_get_frame_stats(disp)->period);
+    TEST_ASSERT_EQUAL_UINT32(LV_DISP_DEF_REFR_PERIOD, disp->refr_timer->period);
+}
+
+void test_frame_pacing_should_start_rendering_at_vsync(void)
+{
+    lv_disp_vsync(disp);
+    lv_obj_invalidate(lv_scr_act());
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+
+    /*No vsync since the last frame: wait for it*/
+    lv_obj_invalidate(lv_scr_act());
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_NOT_EQUAL(0, disp->inv_p);
+    TEST_ASSERT_EQUAL_UINT32(1, disp->refr_timer->period);
+
+    lv_disp_vsync(disp);
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+
+    /*The forced refreshes don't wait*/
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+}
+
+void test_frame_pacing_should_skip_to_the_next_vsync_if_late(void)
+{
+    start_vsync();
+    TEST_ASSERT_EQUAL_UINT32(VSYNC_PERIOD * 16, disp->vsync_period);
+
+    /*Too late in the vsync period: the display is being updated*/
+    lv_tick_inc(VSYNC_PERIOD * 3 / 4);
+    lv_obj_invalidate(lv_scr_act());
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_NOT_EQUAL(0, disp->inv_p);
+
+    lv_disp_vsync(disp);
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+}
+
+void test_frame_pacing_should_use_more_vsync_periods_under_load(void)
+{
+    start_vsync();
+
+    set_load(VSYNC_PERIOD * 3 / 2);
+    refr_frames(3);
+
+    /*Render in every second vsync period, wake up a little earlier to wait for the vsync*/
+    const lv_disp_frame_stats_t * stats = lv_refr_get_frame_stats(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, disp->pacing_div);
+    TEST_ASSERT_EQUAL_UINT32(2 * VSYNC_PERIOD, stats->period);
+    TEST_ASSERT_EQUAL_UINT32(stats->period - 1, disp->refr_timer->period);
+}
+
+void test_frame_pacing_should_fall_back_to_the_timer_if_vsync_stops(void)
+{
+    start_vsync();
+    lv_obj_invalidate(lv_scr_act());
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+
+    /*The vsync stops: wait for it for 2 vsync periods*/
+    lv_obj_invalidate(lv_scr_act());
+    lv_tick_inc(VSYNC_PERIOD);
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_NOT_EQUAL(0, disp->inv_p);
+
+    lv_tick_inc(VSYNC_PERIOD + 1);
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->vsync_cnt);
+
+    /*Refresh with the timer's period*/
+    lv_obj_invalidate(lv_scr_act());
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+    TEST_ASSERT_EQUAL_UINT32(LV_DISP_DEF_REFR_PERIOD, disp->refr_timer->period);
+
+    /*Wait for the vsync again when it restarts*/
+    lv_disp_vsync(disp);
+    lv_obj_invalidate(lv_scr_act());
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+
+    lv_obj_invalidate(lv_scr_act());
+    _lv_disp_refr_timer(disp->refr_timer);
+    TEST_ASSERT_NOT_EQUAL(0, disp->inv_p);
+}
+
+#endif
@@ -0,0 +1,210 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "../../../src/draw/esp32/lv_gpu_esp32_pie.h"
+
+/*Longer than a few 128 bit blocks and odd to have partial blocks at both ends*/
+#define ROW_LEN         67
+/*Room for the offsets and a guard area after the rows*/
+#define BUF_LEN         (ROW_LEN + 32)
+#define BUF_W           53
+#define BUF_H           7
+
+static uint16_t dest_buf[BUF_LEN];
+static uint16_t ref_buf[BUF_LEN];
+static uint16_t src_buf[BUF_LEN];
+static uint16_t alpha_buf[BUF_LEN];
+
+static uint32_t rnd_seed;
+
+static uint32_t rnd(void)
+{
+    /*xorshift32*/
+    rnd_seed ^= rnd_seed << 13;
+    rnd_seed ^= rnd_seed >> 17;
+    rnd_seed ^= rnd_seed << 5;
+    return rnd_seed;
+}
+
+static void fill_rnd(uint16_t * buf, uint32_t len, uint32_t max)
+{
+    uint32_t i;
+    for(i = 0; i < len; i++) buf[i] = rnd() % (max + 1);
+}
+
+/*lv_color_mix()'s per channel algorithm on byte swapped RGB565 pixels*/
+static uint16_t mix_px(uint16_t fg, uint16_t bg, uint16_t alpha, uint16_t round)
+{
+    uint32_t r = LV_UDIV255(((fg >> 3) & 0x1F) * alpha + ((bg >> 3) & 0x1F) * (255 - alpha) + round);
+    uint32_t b = LV_UDIV255(((fg >> 8) & 0x1F) * alpha + ((bg >> 8) & 0x1F) * (255 - alpha) + round);
+    uint32_t fg_g = ((fg & 0x7) << 3) | (fg >> 13);
+    uint32_t bg_g = ((bg & 0x7) << 3) | (bg >> 13);
+    uint32_t g = LV_UDIV255(fg_g * alpha + bg_g * (255 - alpha) + round);
+
+    return (uint16_t)((g >> 3) | (r << 3) | (b << 8) | ((g & 0x7) << 13));
+}
+
+void setUp(void)
+{
+    rnd_seed = 0x12345678;
+}
+
+void tearDown(void)
+{
+    lv_draw_esp32_pie_set_reference(false);
+}
+
+void test_gpu_esp32_pie_should_fill_and_copy_rows(void)
+{
+    uint32_t dest_ofs;
+    for(dest_ofs = 0; dest_ofs < 8; dest_ofs++) {
+        uint32_t src_ofs;
+        for(src_ofs = 0; src_ofs < 8; src_ofs++) {
+            int32_t len;
+            for(len = 0; len <= ROW_LEN; len++) {
+                fill_rnd(ref_buf, BUF_LEN, 0xFFFF);
+                fill_rnd(src_buf, BUF_LEN, 0xFFFF);
+                int32_t i;
+
+                lv_memcpy(dest_buf, ref_buf, sizeof(ref_buf));
+                for(i = 0; i < len; i++) ref_buf[dest_ofs + i] = src_buf[src_ofs + i];
+                _lv_esp32_pie_copy_row(&dest_buf[dest_ofs], &src_buf[src_ofs], len);
+                TEST_ASSERT_EQUAL_HEX16_ARRAY(ref_buf, dest_buf, BUF_LEN);
+
+                for(i = 0; i < len; i++) ref_buf[dest_ofs + i] = src_buf[src_ofs];
+                _lv_esp32_pie_fill_row(&dest_buf[dest_ofs], src_buf[src_ofs], len);
+                TEST_ASSERT_EQUAL_HEX16_ARRAY(ref_buf, dest_buf, BUF_LEN);
+            }
+        }
+    }
+}
+
+void test_gpu_esp32_pie_should_mix_as_lv_color_mix(void)
+{
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+    /*Check the reference of the test too*/
+    uint32_t n;
+    for(n = 0; n < 10000; n++) {
+        lv_color_t fg;
+        lv_color_t bg;
+        fg.full = rnd();
+        bg.full = rnd();
+        lv_opa_t alpha = rnd();
+        TEST_ASSERT_EQUAL_HEX16(lv_color_mix(fg, bg, alpha).full, mix_px(fg.full, bg.full, alpha, LV_COLOR_MIX_ROUND_OFS));
+    }
+#endif
+
+    static const uint16_t rounds[] = {0, 64, 128, 254};
+    uint32_t r;
+    for(r = 0; r < sizeof(rounds) / sizeof(rounds[0]); r++) {
+        uint32_t alpha;
+        for(alpha = 0; alpha <= 255; alpha++) {
+            uint32_t ofs = alpha % 8;
+            uint32_t map;
+            for(map = 0; map < 2; map++) {
+                fill_rnd(ref_buf, BUF_LEN, 0xFFFF);
+                fill_rnd(src_buf, BUF_LEN, 0xFFFF);
+                /*The same and random opacities*/
+                uint32_t i;
+                for(i = 0; i < BUF_LEN; i++) alpha_buf[i] = i % 2 ? alpha : rnd() % 256;
+                lv_memcpy(dest_buf, ref_buf, sizeof(ref_buf));
+
+                for(i = 0; i < ROW_LEN; i++) {
+                    uint16_t fg = map ? src_buf[i] : src_buf[0];
+                    ref_buf[ofs + i] = mix_px(fg, ref_buf[ofs + i], alpha_buf[i], rounds[r]);
+                }
+                _lv_esp32_pie_mix_row(&dest_buf[ofs], map ? src_buf : NULL, src_buf[0], alpha_buf, ROW_LEN, rounds[r]);
+
+                TEST_ASSERT_EQUAL_HEX16_ARRAY(ref_buf, dest_buf, BUF_LEN);
+            }
+        }
+    }
+}
+
+#if LV_COLOR_DEPTH == 16
+static void blend(lv_draw_sw_ctx_t * draw_ctx, lv_color_t * buf, const lv_area_t * area, const lv_color_t * src,
+                  lv_color_t color, lv_opa_t opa, lv_opa_t * mask)
+{
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, 0, 0, BUF_W - 1, BUF_H - 1);
+    draw_ctx->base_draw.buf = buf;
+    draw_ctx->base_draw.buf_area = &buf_area;
+    draw_ctx->base_draw.clip_area = &buf_area;
+
+    lv_draw_sw_blend_dsc_t dsc;
+    lv_memset_00(&dsc, sizeof(dsc));
+    dsc.blend_area = area;
+    dsc.src_buf = src;
+    dsc.color = color;
+    dsc.opa = opa;
+    dsc.mask_buf = mask;
+    dsc.mask_res = mask ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+    dsc.mask_area = area;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    draw_ctx->blend((lv_draw_ctx_t *)draw_ctx, &dsc);
+}
+#endif
+
+void test_gpu_esp32_pie_should_blend_as_the_sw_renderer(void)
+{
+#if LV_COLOR_DEPTH == 16
+    static const lv_opa_t opas[] = {LV_OPA_COVER, 254, LV_OPA_MAX, 252, LV_OPA_50, 3};
+    static lv_color_t buf[BUF_W * BUF_H];
+    static lv_color_t buf_ref[BUF_W * BUF_H];
+    static lv_color_t src[BUF_W * BUF_H];
+    static lv_opa_t mask[BUF_W * BUF_H];
+
+    lv_disp_t * disp_refr_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(lv_disp_get_default());
+    lv_draw_esp32_pie_set_reference(true);
+
+    lv_draw_sw_ctx_t draw_ctx;
+    lv_draw_sw_ctx_t draw_ctx_ref;
+    lv_draw_esp32_pie_ctx_init(lv_disp_get_default()->driver, (lv_draw_ctx_t *)&draw_ctx);
+    lv_draw_sw_init_ctx(lv_disp_get_default()->driver, (lv_draw_ctx_t *)&draw_ctx_ref);
+
+    lv_area_t areas[3];
+    lv_area_set(&areas[0], 0, 0, BUF_W - 1, BUF_H - 1);
+    lv_area_set(&areas[1], 3, 1, BUF_W - 2, BUF_H - 3);
+    lv_area_set(&areas[2], 5, 2, 11, 6);
+
+    uint32_t a;
+    for(a = 0; a < sizeof(areas) / sizeof(areas[0]); a++) {
+        uint32_t o;
+        for(o = 0; o < sizeof(opas) / sizeof(opas[0]); o++) {
+            uint32_t c;
+            for(c = 0; c < 4; c++) {
+                bool map = c & 1;
+                bool masked = c & 2;
+                fill_rnd((uint16_t *)buf_ref, BUF_W * BUF_H, 0xFFFF);
+                fill_rnd((uint16_t *)src, BUF_W * BUF_H, 0xFFFF);
+                uint32_t i;
+                /*Runs of 0, 255 and random values*/
+                for(i = 0; i < BUF_W * BUF_H; i++) {
+                    uint32_t v = rnd() % 3;
+                    mask[i] = v == 0 ? LV_OPA_TRANSP : v == 1 ? LV_OPA_COVER : rnd();
+                }
+                lv_memcpy(buf, buf_ref, sizeof(buf));
+                lv_color_t color;
+                color.full = rnd();
+
+                blend(&draw_ctx_ref, buf_ref, &areas[a], map ? src : NULL, color, opas[o], masked ? mask : NULL);
+                blend(&draw_ctx, buf, &areas[a], map ? src : NULL, color, opas[o], masked ? mask : NULL);
+
+                char msg[64];
+                lv_snprintf(msg, sizeof(msg), "area: %d, opa: %d, map: %d, mask: %d", a, opas[o], map, masked);
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(buf_ref, buf, sizeof(buf), msg);
+            }
+        }
+    }
+
+    _lv_refr_set_disp_refreshing(disp_refr_ori);
+#else
+    TEST_IGNORE_MESSAGE("Needs LV_COLOR_DEPTH 16");
+#endif
+}
+
+#endif
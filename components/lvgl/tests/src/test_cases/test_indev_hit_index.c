@@ -0,0 +1,94 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define LIST_BTN_CNT 500
+
+static lv_obj_t * list;
+
+void setUp(void)
+{
+    lv_indev_enable_hit_index(true);
+
+    list = lv_list_create(lv_scr_act());
+    lv_obj_set_size(list, 400, 400);
+    lv_obj_center(list);
+    uint32_t i;
+    for(i = 0; i < LIST_BTN_CNT; i++) {
+        lv_list_add_btn(list, NULL, "Button");
+    }
+    lv_obj_update_layout(lv_scr_act());
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_indev_enable_hit_index(true);
+}
+
+/*Search the object on a grid of points with and without the index and check they are the same*/
+static void assert_same_search_results(void)
+{
+    lv_point_t p;
+    for(p.y = 0; p.y < LV_VER_RES; p.y += 7) {
+        for(p.x = 0; p.x < LV_HOR_RES; p.x += 13) {
+            lv_indev_enable_hit_index(false);
+            lv_obj_t * expected = lv_indev_search_obj(lv_scr_act(), &p);
+            lv_indev_enable_hit_index(true);
+            TEST_ASSERT_EQUAL_PTR(expected, lv_indev_search_obj(lv_scr_act(), &p));
+        }
+    }
+}
+
+void test_indev_hit_index_should_find_the_same_objects(void)
+{
+    assert_same_search_results();
+
+    /*Scrolling doesn't outdate the index*/
+    lv_obj_scroll_to_y(list, 3000, LV_ANIM_OFF);
+    assert_same_search_results();
+
+    lv_obj_scroll_by(list, -10, 123, LV_ANIM_OFF);
+    assert_same_search_results();
+}
+
+void test_indev_hit_index_should_follow_the_changes(void)
+{
+    lv_obj_t * btn = lv_obj_get_child(list, 3);
+    lv_obj_set_ext_click_area(btn, 30);
+    assert_same_search_results();
+
+    /*Out of the normal flow and on top of the others*/
+    lv_obj_add_flag(btn, LV_OBJ_FLAG_FLOATING);
+    lv_obj_set_pos(btn, 50, 100);
+    lv_obj_move_foreground(btn);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_search_results();
+
+    lv_obj_scroll_by(list, 0, -200, LV_ANIM_OFF);
+    assert_same_search_results();
+
+    /*A child out of its parent*/
+    btn = lv_obj_get_child(list, 10);
+    lv_obj_add_flag(btn, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    lv_obj_t * label = lv_obj_get_child(btn, 0);
+    lv_obj_add_flag(label, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_style_translate_x(label, -150, 0);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_search_results();
+
+    /*Transformed child*/
+    lv_obj_set_style_transform_angle(lv_obj_get_child(list, 12), 300, 0);
+    assert_same_search_results();
+
+    /*Deleting and creating children*/
+    lv_obj_del(lv_obj_get_child(list, 0));
+    lv_obj_del(lv_obj_get_child(list, 5));
+    lv_list_add_btn(list, NULL, "New");
+    lv_obj_set_height(lv_obj_get_child(list, 7), 150);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_search_results();
+}
+
+#endif
@@ -0,0 +1,182 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define TEST_HOR_RES 800
+#define TEST_VER_RES 480
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[TEST_HOR_RES * TEST_VER_RES];
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+/*Redraw the display without invalidating any object*/
+static void render(void)
+{
+    lv_area_t a = {0, 0, TEST_HOR_RES - 1, TEST_VER_RES - 1};
+    _lv_inv_area(NULL, &a);
+    lv_refr_now(NULL);
+}
+
+/*An opaque panel which doesn't need an alpha channel in its layer*/
+static lv_obj_t * create_panel(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h)
+{
+    lv_obj_t * panel = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_radius(panel, 0, 0);
+    lv_obj_set_style_shadow_width(panel, 0, 0);
+    lv_obj_set_pos(panel, x, y);
+    lv_obj_set_size(panel, w, h);
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * label = lv_label_create(panel);
+        lv_label_set_text_fmt(label, "Cached label %"LV_PRIu32, i);
+        lv_obj_set_y(label, i * 30);
+    }
+
+    return panel;
+}
+
+/*Render the screen with and without the layer cache of `panel` and compare the results*/
+static void assert_same_as_without_cache(lv_obj_t * panel)
+{
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    lv_obj_set_layer_cache(panel, false);
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_layer_cache_should_draw_the_cached_layer(void)
+{
+    lv_obj_t * panel = create_panel(50, 50, 300, 200);
+    lv_obj_set_layer_cache(panel, true);
+    TEST_ASSERT_TRUE(lv_obj_get_layer_cache(panel));
+
+    lv_draw_layer_cache_reset_stats();
+    render();
+    const lv_draw_layer_cache_stats_t * stats = lv_draw_layer_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(1, stats->render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->hit_cnt);
+
+    lv_draw_layer_cache_reset_stats();
+    render();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->hit_cnt);
+
+    assert_same_as_without_cache(panel);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->used_size);
+}
+
+void test_layer_cache_should_render_again_if_a_child_changes(void)
+{
+    lv_obj_t * panel = create_panel(50, 50, 300, 200);
+    lv_obj_set_layer_cache(panel, true);
+    render();
+
+    lv_draw_layer_cache_reset_stats();
+    lv_label_set_text(lv_obj_get_child(panel, 1), "Changed");
+    render();
+    const lv_draw_layer_cache_stats_t * stats = lv_draw_layer_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(1, stats->render_cnt);
+
+    assert_same_as_without_cache(panel);
+}
+
+void test_layer_cache_should_keep_the_layer_if_only_moved(void)
+{
+    lv_obj_t * panel = create_panel(50, 50, 300, 200);
+    lv_obj_set_layer_cache(panel, true);
+    render();
+
+    lv_draw_layer_cache_reset_stats();
+    lv_obj_set_pos(panel, 120, 90);
+    render();
+    const lv_draw_layer_cache_stats_t * stats = lv_draw_layer_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->hit_cnt);
+
+    assert_same_as_without_cache(panel);
+}
+
+void test_layer_cache_should_keep_the_layer_if_only_the_opacity_changes(void)
+{
+    lv_obj_t * panel = create_panel(50, 50, 300, 200);
+    lv_obj_set_layer_cache(panel, true);
+    render();
+
+    lv_draw_layer_cache_reset_stats();
+    lv_obj_set_style_opa(panel, LV_OPA_50, 0);
+    render();
+    const lv_draw_layer_cache_stats_t * stats = lv_draw_layer_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->hit_cnt);
+
+    assert_same_as_without_cache(panel);
+}
+
+void test_layer_cache_should_keep_the_layer_if_transformed(void)
+{
+    lv_obj_t * panel = create_panel(250, 100, 300, 200);
+    lv_obj_set_layer_cache(panel, true);
+    render();
+
+    lv_draw_layer_cache_reset_stats();
+    lv_obj_set_style_transform_angle(panel, 150, 0);
+    lv_obj_set_style_transform_zoom(panel, 300, 0);
+    lv_obj_set_style_transform_pivot_x(panel, lv_pct(50), 0);
+    lv_obj_set_style_transform_pivot_y(panel, lv_pct(50), 0);
+    render();
+    const lv_draw_layer_cache_stats_t * stats = lv_draw_layer_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->hit_cnt);
+
+    assert_same_as_without_cache(panel);
+}
+
+void test_layer_cache_should_evict_the_least_recently_used_layers(void)
+{
+    /*Only two of them fit into the cache*/
+    lv_obj_t * panels[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        panels[i] = create_panel(10 + i * 260, 100, 200, 150);
+        lv_obj_set_layer_cache(panels[i], true);
+    }
+
+    lv_draw_layer_cache_reset_stats();
+    render();
+    render();
+    const lv_draw_layer_cache_stats_t * stats = lv_draw_layer_cache_get_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->evict_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_LAYER_CACHE_SIZE, stats->used_size);
+
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    for(i = 0; i < 3; i++) lv_obj_set_layer_cache(panels[i], false);
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_layer_cache_should_draw_normally_if_the_layer_does_not_fit(void)
+{
+    lv_obj_t * panel = create_panel(0, 0, TEST_HOR_RES, TEST_VER_RES);
+    lv_obj_set_layer_cache(panel, true);
+
+    lv_draw_layer_cache_reset_stats();
+    render();
+    const lv_draw_layer_cache_stats_t * stats = lv_draw_layer_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->used_size);
+
+    assert_same_as_without_cache(panel);
+}
+
+#endif
@@ -0,0 +1,150 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define TREE_FANOUT     3
+
+static uint32_t measure_cnt;
+
+void setUp(void)
+{
+    measure_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+static void self_size_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    measure_cnt++;
+}
+
+/*Create nested content sized flex containers with labels on the leaves*/
+static void create_tree(lv_obj_t * parent, uint32_t depth)
+{
+    uint32_t i;
+    for(i = 0; i < TREE_FANOUT; i++) {
+        if(depth == 0) {
+            lv_obj_t * label = lv_label_create(parent);
+            lv_label_set_text_fmt(label, "Leaf %"LV_PRIu32, i);
+            lv_obj_add_event_cb(label, self_size_cb, LV_EVENT_GET_SELF_SIZE, NULL);
+        }
+        else {
+            lv_obj_t * cont = lv_obj_create(parent);
+            lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+            lv_obj_set_style_pad_all(cont, 2, 0);
+            lv_obj_set_flex_flow(cont, depth % 2 ? LV_FLEX_FLOW_ROW : LV_FLEX_FLOW_COLUMN);
+            create_tree(cont, depth - 1);
+        }
+    }
+}
+
+static lv_obj_t * create_root(uint32_t depth)
+{
+    lv_obj_t * root = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(root, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(root, LV_FLEX_FLOW_COLUMN);
+    create_tree(root, depth);
+    lv_obj_update_layout(root);
+    return root;
+}
+
+/*Get the first leaf label*/
+static lv_obj_t * get_leaf(lv_obj_t * root)
+{
+    lv_obj_t * obj = root;
+    while(lv_obj_get_child_cnt(obj)) obj = lv_obj_get_child(obj, 0);
+    return obj;
+}
+
+static void assert_same_coords(lv_obj_t * obj1, lv_obj_t * obj2, lv_coord_t ofs_x, lv_coord_t ofs_y)
+{
+    lv_area_t a = obj2->coords;
+    lv_area_move(&a, ofs_x, ofs_y);
+    TEST_ASSERT_EQUAL_MEMORY(&obj1->coords, &a, sizeof(lv_area_t));
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj1); i++) {
+        assert_same_coords(lv_obj_get_child(obj1, i), lv_obj_get_child(obj2, i), ofs_x, ofs_y);
+    }
+}
+
+void test_layout_incremental_should_give_the_same_result_as_a_new_tree(void)
+{
+    lv_obj_t * root1 = create_root(3);
+    lv_label_set_text(get_leaf(root1), "A much longer text\nin two lines");
+    lv_obj_update_layout(root1);
+
+    lv_obj_t * root2 = create_root(3);
+    lv_obj_align(root2, LV_ALIGN_TOP_RIGHT, 0, 0);
+    lv_label_set_text(get_leaf(root2), "A much longer text\nin two lines");
+    lv_obj_update_layout(root2);
+
+    assert_same_coords(root1, root2, root1->coords.x1 - root2->coords.x1, root1->coords.y1 - root2->coords.y1);
+}
+
+void test_layout_incremental_should_follow_the_inherited_style_changes(void)
+{
+    lv_obj_t * root = create_root(2);
+    lv_obj_t * leaf = get_leaf(root);
+    lv_coord_t h = lv_obj_get_height(leaf);
+
+    lv_obj_set_style_text_line_space(root, 20, 0);
+    lv_label_set_text(leaf, "Two\nlines");
+    lv_obj_update_layout(root);
+    TEST_ASSERT_GREATER_THAN(2 * h + 10, lv_obj_get_height(leaf));
+
+    /*Moving to a parent with other inherited values*/
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_parent(leaf, cont);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_LESS_THAN(2 * h + 10, lv_obj_get_height(leaf));
+}
+
+void test_layout_incremental_should_measure_only_the_changed_label(void)
+{
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    lv_obj_t * root = create_root(4);
+
+    measure_cnt = 0;
+    lv_label_set_text(get_leaf(root), "Changed text");
+    lv_obj_update_layout(root);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2, measure_cnt);
+#else
+    TEST_IGNORE_MESSAGE("Needs LV_USE_OBJ_SELF_SIZE_CACHE");
+#endif
+}
+
+void test_layout_incremental_should_not_measure_more_in_larger_trees(void)
+{
+#if LV_USE_OBJ_SELF_SIZE_CACHE
+    uint32_t first_cnt = 0;
+    uint32_t depth;
+    for(depth = 1; depth <= 4; depth++) {
+        lv_obj_t * root = create_root(depth);
+        lv_obj_t * leaf = get_leaf(root);
+
+        /*Change the text back and forth as an application updating a value would do*/
+        measure_cnt = 0;
+        uint32_t i;
+        for(i = 0; i < 10; i++) {
+            lv_label_set_text(leaf, i % 2 ? "Short" : "Somewhat longer");
+            lv_obj_update_layout(root);
+        }
+
+        if(depth == 1) first_cnt = measure_cnt;
+        else TEST_ASSERT_EQUAL_UINT32(first_cnt, measure_cnt);
+
+        lv_obj_del(root);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Needs LV_USE_OBJ_SELF_SIZE_CACHE");
+#endif
+}
+
+#endif
@@ -0,0 +1,269 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define SCREEN_CONT_CNT 50      /*With 4 buttons with a label and a label: 500 objects*/
+
+static lv_group_t * g;
+static uint32_t anim_deleted_cnt;
+static uint32_t del_order[32];
+static uint32_t del_index[32];      /*Index of the deleted objects in their parent*/
+static uint32_t del_cnt;
+
+void setUp(void)
+{
+    g = lv_group_create();
+    anim_deleted_cnt = 0;
+    del_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_group_del(g);
+    lv_obj_enable_bulk_del(true);
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(var);
+    LV_UNUSED(v);
+}
+
+static void anim_deleted_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    anim_deleted_cnt++;
+}
+
+static void start_anim(void * var)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, var);
+    lv_anim_set_exec_cb(&a, anim_exec_cb);
+    lv_anim_set_deleted_cb(&a, anim_deleted_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_time(&a, 100000);
+    lv_anim_start(&a);
+}
+
+static void count_event_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+static void record_del_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    del_order[del_cnt] = (uint32_t)(uintptr_t)lv_obj_get_user_data(obj);
+    del_index[del_cnt] = lv_obj_get_index(obj);
+    del_cnt++;
+}
+
+static void del_other_cb(lv_event_t * e)
+{
+    record_del_cb(e);
+    lv_obj_t * other = lv_event_get_user_data(e);
+    if(other) lv_obj_del(other);
+}
+
+void test_obj_bulk_del_should_remove_the_anims(void)
+{
+    lv_obj_t * kept = lv_obj_create(lv_scr_act());
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    start_anim(kept);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * obj = lv_obj_create(cont);
+        start_anim(obj);
+        start_anim(lv_obj_create(obj));
+    }
+    start_anim(cont);
+    TEST_ASSERT_EQUAL_UINT32(22, lv_anim_count_running());
+
+    lv_obj_del(cont);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_UINT32(21, anim_deleted_cnt);
+    TEST_ASSERT_NOT_NULL(lv_anim_get(kept, NULL));
+
+    lv_obj_clean(lv_scr_act());
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+}
+
+static void check_refocus(lv_group_refocus_policy_t policy, bool bulk)
+{
+    lv_obj_enable_bulk_del(bulk);
+    lv_group_set_refocus_policy(g, policy);
+
+    lv_obj_t * first = lv_btn_create(lv_scr_act());
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_t * last = lv_btn_create(lv_scr_act());
+    lv_group_add_obj(g, first);
+
+    uint32_t i;
+    lv_obj_t * focused = NULL;
+    for(i = 0; i < 5; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_group_add_obj(g, btn);
+        if(i == 2) focused = btn;
+    }
+    lv_group_add_obj(g, last);
+    lv_group_focus_obj(focused);
+
+    uint32_t defocused_cnt = 0;
+    uint32_t focused_cnt = 0;
+    lv_obj_add_event_cb(focused, count_event_cb, LV_EVENT_DEFOCUSED, &defocused_cnt);
+    lv_obj_add_event_cb(first, count_event_cb, LV_EVENT_FOCUSED, &focused_cnt);
+    lv_obj_add_event_cb(last, count_event_cb, LV_EVENT_FOCUSED, &focused_cnt);
+
+    lv_obj_del(cont);
+    TEST_ASSERT_EQUAL_PTR(policy == LV_GROUP_REFOCUS_POLICY_PREV ? first : last, lv_group_get_focused(g));
+    TEST_ASSERT_EQUAL_UINT32(2, lv_group_get_obj_count(g));
+    TEST_ASSERT_EQUAL_UINT32(1, defocused_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, focused_cnt);
+
+    lv_obj_clean(lv_scr_act());
+    TEST_ASSERT_NULL(lv_group_get_focused(g));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_group_get_obj_count(g));
+}
+
+void test_obj_bulk_del_should_refocus_like_the_normal_del(void)
+{
+    check_refocus(LV_GROUP_REFOCUS_POLICY_PREV, false);
+    check_refocus(LV_GROUP_REFOCUS_POLICY_PREV, true);
+    check_refocus(LV_GROUP_REFOCUS_POLICY_NEXT, false);
+    check_refocus(LV_GROUP_REFOCUS_POLICY_NEXT, true);
+}
+
+/*Delete a small tree where the `LV_EVENT_DELETE` handlers delete other objects and record the order*/
+static void del_tree(bool bulk)
+{
+    lv_obj_enable_bulk_del(bulk);
+    del_cnt = 0;
+
+    lv_obj_t * outside = lv_obj_create(lv_scr_act());
+    lv_obj_set_user_data(outside, (void *)100);
+    lv_obj_add_event_cb(outside, record_del_cb, LV_EVENT_DELETE, NULL);
+
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_user_data(cont, (void *)1);
+    lv_obj_add_event_cb(cont, del_other_cb, LV_EVENT_DELETE, outside);
+
+    uint32_t i;
+    lv_obj_t * children[6];
+    for(i = 0; i < 6; i++) {
+        children[i] = lv_obj_create(cont);
+        lv_obj_set_user_data(children[i], (void *)(uintptr_t)(10 + i));
+        lv_obj_t * grandchild = lv_obj_create(children[i]);
+        lv_obj_set_user_data(grandchild, (void *)(uintptr_t)(20 + i));
+        lv_obj_add_event_cb(grandchild, record_del_cb, LV_EVENT_DELETE, NULL);
+        start_anim(grandchild);
+    }
+    /*The first child deletes the 4th child*/
+    for(i = 0; i < 6; i++) {
+        lv_obj_add_event_cb(children[i], del_other_cb, LV_EVENT_DELETE, i == 0 ? children[3] : NULL);
+    }
+
+    lv_obj_del(cont);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_cnt(lv_scr_act()));
+    TEST_ASSERT_EQUAL_UINT32(6, anim_deleted_cnt);
+    anim_deleted_cnt = 0;
+}
+
+void test_obj_bulk_del_should_send_the_delete_events_in_the_same_order(void)
+{
+    del_tree(false);
+    uint32_t ref_order[32];
+    uint32_t ref_index[32];
+    uint32_t ref_cnt = del_cnt;
+    lv_memcpy(ref_order, del_order, sizeof(ref_order));
+    lv_memcpy(ref_index, del_index, sizeof(ref_index));
+
+    lv_obj_clean(lv_scr_act());
+    del_tree(true);
+    TEST_ASSERT_EQUAL_UINT32(1 + 1 + 6 + 6, ref_cnt);
+    TEST_ASSERT_EQUAL_UINT32(ref_cnt, del_cnt);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(ref_order, del_order, ref_cnt);
+    /*The siblings are in the same order in the `LV_EVENT_DELETE` handlers*/
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(ref_index, del_index, ref_cnt);
+}
+
+void test_obj_bulk_del_should_clean_the_screen(void)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_obj_t * btn = lv_btn_create(scr);
+        lv_group_add_obj(g, btn);
+        start_anim(btn);
+    }
+    lv_obj_t * kept = lv_btn_create(lv_scr_act());
+    lv_group_add_obj(g, kept);
+    lv_group_focus_obj(lv_obj_get_child(scr, 50));
+
+    lv_obj_clean(scr);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_cnt(scr));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_UINT32(1, lv_group_get_obj_count(g));
+    TEST_ASSERT_EQUAL_PTR(kept, lv_group_get_focused(g));
+
+    /*The screen is still usable*/
+    lv_obj_t * btn = lv_btn_create(scr);
+    TEST_ASSERT_EQUAL_PTR(btn, lv_obj_get_child(scr, 0));
+    lv_obj_del(scr);
+}
+
+/*Create a screen with a lot of focusable and animated buttons and count how many times they are focused*/
+static lv_obj_t * create_screen(uint32_t * focused_cnt)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < SCREEN_CONT_CNT; i++) {
+        lv_obj_t * cont = lv_obj_create(scr);
+        for(j = 0; j < 4; j++) {
+            lv_obj_t * btn = lv_btn_create(cont);
+            lv_label_create(btn);
+            lv_group_add_obj(g, btn);
+            lv_obj_add_event_cb(btn, count_event_cb, LV_EVENT_FOCUSED, focused_cnt);
+            start_anim(btn);
+        }
+        lv_label_create(cont);
+    }
+
+    /*Without bulk deletion the focus jumps to the next button before each deleted button*/
+    lv_group_set_refocus_policy(g, LV_GROUP_REFOCUS_POLICY_NEXT);
+    lv_group_focus_obj(lv_obj_get_child(lv_obj_get_child(scr, 0), 0));
+    *focused_cnt = 0;
+    return scr;
+}
+
+void test_obj_bulk_del_should_not_refocus_the_deleted_objects(void)
+{
+    uint32_t b;
+    for(b = 0; b < 2; b++) {
+        lv_obj_enable_bulk_del(b == 1);
+        /*One by one every button but the last one is focused once before its deletion*/
+        uint32_t focused_cnt_exp = b == 1 ? 0 : SCREEN_CONT_CNT * 4 - 1;
+
+        uint32_t del_focused_cnt;
+        lv_obj_del(create_screen(&del_focused_cnt));
+        TEST_ASSERT_EQUAL_UINT32(focused_cnt_exp, del_focused_cnt);
+        TEST_ASSERT_EQUAL_UINT32(0, lv_group_get_obj_count(g));
+        TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+
+        uint32_t clean_focused_cnt;
+        lv_obj_t * scr = create_screen(&clean_focused_cnt);
+        lv_obj_clean(scr);
+        TEST_ASSERT_EQUAL_UINT32(focused_cnt_exp, clean_focused_cnt);
+        TEST_ASSERT_EQUAL_UINT32(0, lv_group_get_obj_count(g));
+        TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+        lv_obj_del(scr);
+    }
+}
+
+#endif
@@ -0,0 +1,172 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define ITEM_CNT 300
+
+void setUp(void)
+{
+    lv_slab_enable(true);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_slab_enable(true);
+}
+
+static void fill(uint8_t * p, size_t size, uint8_t seed)
+{
+    size_t i;
+    for(i = 0; i < size; i++) p[i] = (uint8_t)(seed + i);
+}
+
+static void check(const uint8_t * p, size_t size, uint8_t seed)
+{
+    size_t i;
+    for(i = 0; i < size; i++) TEST_ASSERT_EQUAL_UINT8((uint8_t)(seed + i), p[i]);
+}
+
+void test_obj_pool_should_keep_the_data(void)
+{
+    static uint8_t * items[ITEM_CNT];
+    static size_t sizes[ITEM_CNT];
+    uint32_t chunk_cnt_start = lv_slab_get_stats()->chunk_cnt;
+
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        sizes[i] = 1 + (i * 37) % 300;  /*Some of them are larger than the largest size class*/
+        items[i] = lv_slab_alloc(sizes[i]);
+        TEST_ASSERT_NOT_NULL(items[i]);
+        TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)items[i] & 0x7);
+        fill(items[i], sizes[i], (uint8_t)i);
+    }
+
+    /*Free every third and grow or shrink the others*/
+    for(i = 0; i < ITEM_CNT; i++) {
+        if(i % 3 == 0) {
+            lv_slab_free(items[i]);
+            items[i] = NULL;
+            continue;
+        }
+
+        size_t new_size = i % 2 ? sizes[i] * 2 : sizes[i] / 2 + 1;
+        items[i] = lv_slab_realloc(items[i], new_size);
+        TEST_ASSERT_NOT_NULL(items[i]);
+        check(items[i], LV_MIN(sizes[i], new_size), (uint8_t)i);
+        sizes[i] = new_size;
+        fill(items[i], sizes[i], (uint8_t)(i + 1));
+    }
+
+    for(i = 0; i < ITEM_CNT; i++) {
+        if(items[i] == NULL) continue;
+        check(items[i], sizes[i], (uint8_t)(i + 1));
+        lv_slab_free(items[i]);
+    }
+
+    /*Only the last chunk of each size class can remain*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(chunk_cnt_start + _LV_SLAB_CLASS_CNT, lv_slab_get_stats()->chunk_cnt);
+}
+
+void test_obj_pool_should_keep_the_children(void)
+{
+    lv_obj_t * parent1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * parent2 = lv_obj_create(lv_scr_act());
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_obj_t * obj = lv_obj_create(parent1);
+        lv_obj_set_user_data(obj, (void *)(uintptr_t)i);
+    }
+
+    /*Move every second to the other parent and delete the first and last ones*/
+    for(i = 0; i < 50; i++) {
+        lv_obj_set_parent(lv_obj_get_child(parent1, i), parent2);
+    }
+    lv_obj_del(lv_obj_get_child(parent2, 0));
+    lv_obj_del(lv_obj_get_child(parent1, -1));
+
+    TEST_ASSERT_EQUAL_UINT32(49, lv_obj_get_child_cnt(parent1));
+    TEST_ASSERT_EQUAL_UINT32(49, lv_obj_get_child_cnt(parent2));
+    for(i = 0; i < 49; i++) {
+        TEST_ASSERT_EQUAL_PTR((void *)(uintptr_t)(i * 2 + 1), lv_obj_get_user_data(lv_obj_get_child(parent1, i)));
+        TEST_ASSERT_EQUAL_PTR((void *)(uintptr_t)(i * 2 + 2), lv_obj_get_user_data(lv_obj_get_child(parent2, i)));
+        TEST_ASSERT_EQUAL_UINT32(i, lv_obj_get_index(lv_obj_get_child(parent2, i)));
+    }
+
+    lv_obj_clean(parent1);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_cnt(parent1));
+    TEST_ASSERT_NULL(lv_obj_get_child(parent1, 0));
+}
+
+#if LV_MEM_CUSTOM == 0
+static uint32_t get_mem_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+/*Heap used by a list with `cnt` items*/
+static uint32_t list_mem_used(bool pool, uint32_t cnt)
+{
+    lv_slab_enable(pool);
+    uint32_t used_start = get_mem_used();
+    lv_obj_t * list = lv_list_create(lv_scr_act());
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_list_add_btn(list, NULL, "Item");
+    }
+    uint32_t used = get_mem_used() - used_start;
+    lv_obj_del(list);
+    return used;
+}
+#endif
+
+void test_obj_pool_should_not_use_more_memory_than_the_heap(void)
+{
+#if LV_MEM_CUSTOM == 0
+    /*The pool keeps some chunks, start with them allocated to not count them in the second round*/
+    list_mem_used(true, ITEM_CNT);
+
+    uint32_t heap_used = list_mem_used(false, ITEM_CNT);
+    uint32_t pool_used = list_mem_used(true, ITEM_CNT);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(heap_used, pool_used);
+#else
+    TEST_IGNORE_MESSAGE("Needs the LVGL heap to measure the memory usage");
+#endif
+}
+
+/*Create a long list and return how many of its allocations were served from the heap*/
+static uint32_t list_heap_alloc_cnt(bool pool, uint32_t * alloc_cnt)
+{
+    lv_slab_enable(pool);
+    lv_slab_reset_stats();
+    lv_obj_t * list = lv_list_create(lv_scr_act());
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_list_add_btn(list, NULL, "Item");
+    }
+    lv_obj_del(list);
+
+    const lv_slab_stats_t * stats = lv_slab_get_stats();
+    *alloc_cnt = stats->alloc_cnt;
+    return stats->heap_alloc_cnt;
+}
+
+void test_obj_pool_should_take_most_objects_from_the_chunks(void)
+{
+    uint32_t heap_alloc_cnt;
+    uint32_t alloc_cnt;
+    heap_alloc_cnt = list_heap_alloc_cnt(false, &alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(alloc_cnt, heap_alloc_cnt);
+
+    uint32_t pool_alloc_cnt;
+    heap_alloc_cnt = list_heap_alloc_cnt(true, &pool_alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(alloc_cnt, pool_alloc_cnt);
+    /*Only the new chunks and the items larger than the size classes come from the heap*/
+    TEST_ASSERT_LESS_THAN_UINT32(alloc_cnt / 5, heap_alloc_cnt);
+}
+
+#endif
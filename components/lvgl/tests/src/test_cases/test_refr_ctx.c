@@ -0,0 +1,273 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <pthread.h>
+
+#define DISP_CNT        2
+#define DISP1_HOR_RES   480
+#define DISP1_VER_RES   320
+#define DISP2_HOR_RES   320
+#define DISP2_VER_RES   240
+#define FRAME_CNT       8
+#define FRESH_OBJ_CNT   64
+#define FRESH_ROUND_CNT 10
+
+typedef struct {
+    lv_disp_drv_t drv;
+    lv_disp_draw_buf_t draw_buf;
+    lv_disp_t * disp;
+    lv_color_t * fb;
+    lv_color_t * ref_fb;
+    uint32_t px_cnt;
+    lv_obj_t * label;
+    lv_obj_t * arc;
+    lv_obj_t * bar;
+} test_disp_t;
+
+static test_disp_t test_disps[DISP_CNT];
+static lv_color_t disp1_fb[DISP1_HOR_RES * DISP1_VER_RES];
+static lv_color_t disp1_ref_fb[DISP1_HOR_RES * DISP1_VER_RES];
+static lv_color_t disp2_fb[DISP2_HOR_RES * DISP2_VER_RES];
+static lv_color_t disp2_ref_fb[DISP2_HOR_RES * DISP2_VER_RES];
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(color_p);
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void disp_init(test_disp_t * d, lv_color_t * fb, lv_color_t * ref_fb, lv_coord_t hor_res, lv_coord_t ver_res)
+{
+    d->fb = fb;
+    d->ref_fb = ref_fb;
+    d->px_cnt = hor_res * ver_res;
+
+    /*Direct mode to have the whole screen in the buffer after every refresh*/
+    lv_disp_draw_buf_init(&d->draw_buf, fb, NULL, d->px_cnt);
+    lv_disp_drv_init(&d->drv);
+    d->drv.draw_buf = &d->draw_buf;
+    d->drv.flush_cb = flush_cb;
+    d->drv.hor_res = hor_res;
+    d->drv.ver_res = ver_res;
+    d->drv.direct_mode = 1;
+    d->disp = lv_disp_drv_register(&d->drv);
+}
+
+static void create_scene(test_disp_t * d, uint32_t variant)
+{
+    LV_IMG_DECLARE(img_cogwheel_argb);
+
+    lv_obj_t * scr = lv_disp_get_scr_act(d->disp);
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(variant ? LV_PALETTE_ORANGE : LV_PALETTE_GREY, 3), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_palette_main(variant ? LV_PALETTE_PURPLE : LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_dir(scr, variant ? LV_GRAD_DIR_HOR : LV_GRAD_DIR_VER, 0);
+
+    /*Masks, shadows and images to use every per display buffer*/
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 200, 120);
+    lv_obj_set_pos(obj, 10 + variant * 20, 10);
+    lv_obj_set_style_radius(obj, 30 + variant * 10, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_70, 0);
+    lv_obj_set_style_shadow_width(obj, 20, 0);
+    lv_obj_set_style_clip_corner(obj, true, 0);
+
+    lv_obj_t * img = lv_img_create(obj);
+    lv_img_set_src(img, &img_cogwheel_argb);
+    lv_img_set_angle(img, 150 + variant * 300);
+    lv_obj_center(img);
+
+    d->arc = lv_arc_create(scr);
+    lv_obj_set_size(d->arc, 100, 100);
+    lv_obj_align(d->arc, LV_ALIGN_BOTTOM_LEFT, 10, -10);
+
+    d->bar = lv_bar_create(scr);
+    lv_obj_set_width(d->bar, 120);
+    lv_obj_align(d->bar, LV_ALIGN_BOTTOM_RIGHT, -10, -10);
+
+    /*A compressed font and right-to-left text*/
+    d->label = lv_label_create(scr);
+    lv_obj_set_style_text_font(d->label, variant ? &lv_font_dejavu_16_persian_hebrew : &lv_font_montserrat_28_compressed,
+                               0);
+    lv_obj_set_style_base_dir(d->label, variant ? LV_BASE_DIR_RTL : LV_BASE_DIR_LTR, 0);
+    lv_obj_align(d->label, LV_ALIGN_TOP_RIGHT, -10, 20);
+}
+
+static void update_scene(uint32_t frame)
+{
+    uint32_t i;
+    for(i = 0; i < DISP_CNT; i++) {
+        test_disp_t * d = &test_disps[i];
+        lv_arc_set_value(d->arc, (frame * 13 + i * 40) % 100);
+        lv_bar_set_value(d->bar, (frame * 17 + i * 30) % 100, LV_ANIM_OFF);
+        if(i == 0) lv_label_set_text_fmt(d->label, "Frame %"LV_PRIu32, frame);
+        else lv_label_set_text_fmt(d->label, "שלום %"LV_PRIu32" abc", frame);
+    }
+}
+
+static void * refr_thread(void * arg)
+{
+    test_disp_t * d = arg;
+    lv_refr_disp(d->disp);
+    return NULL;
+}
+
+/*Redraw every display from scratch, on the calling thread or on a thread per display*/
+static void render(bool concurrent)
+{
+    uint32_t i;
+    for(i = 0; i < DISP_CNT; i++) {
+        lv_memset_00(test_disps[i].fb, test_disps[i].px_cnt * sizeof(lv_color_t));
+        lv_obj_invalidate(lv_disp_get_scr_act(test_disps[i].disp));
+    }
+
+    if(concurrent) {
+        pthread_t threads[DISP_CNT];
+        for(i = 0; i < DISP_CNT; i++) {
+            TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, refr_thread, &test_disps[i]));
+        }
+        for(i = 0; i < DISP_CNT; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+    else {
+        for(i = 0; i < DISP_CNT; i++) {
+            lv_refr_disp(test_disps[i].disp);
+        }
+    }
+}
+
+void setUp(void)
+{
+    disp_init(&test_disps[0], disp1_fb, disp1_ref_fb, DISP1_HOR_RES, DISP1_VER_RES);
+    disp_init(&test_disps[1], disp2_fb, disp2_ref_fb, DISP2_HOR_RES, DISP2_VER_RES);
+    create_scene(&test_disps[0], 0);
+    create_scene(&test_disps[1], 1);
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < DISP_CNT; i++) {
+        lv_disp_remove(test_disps[i].disp);
+        test_disps[i].disp = NULL;
+
+        /*The draw context is owned by the driver*/
+        test_disps[i].drv.draw_ctx_deinit(&test_disps[i].drv, test_disps[i].drv.draw_ctx);
+        lv_mem_free(test_disps[i].drv.draw_ctx);
+    }
+}
+
+void test_refr_ctx_should_give_every_display_a_context(void)
+{
+    TEST_ASSERT_NOT_NULL(test_disps[0].disp->refr_ctx);
+    TEST_ASSERT_NOT_NULL(test_disps[1].disp->refr_ctx);
+    TEST_ASSERT_NOT_EQUAL(test_disps[0].disp->refr_ctx, test_disps[1].disp->refr_ctx);
+
+    /*Outside of a refresh the common context is used*/
+    lv_refr_disp(test_disps[0].disp);
+    TEST_ASSERT_NOT_EQUAL(test_disps[0].disp->refr_ctx, _lv_refr_ctx_get_act());
+}
+
+void test_refr_ctx_should_render_concurrently_as_serially(void)
+{
+    uint32_t frame;
+    for(frame = 0; frame < FRAME_CNT; frame++) {
+        update_scene(frame);
+
+        render(false);
+        uint32_t i;
+        for(i = 0; i < DISP_CNT; i++) {
+            lv_memcpy(test_disps[i].ref_fb, test_disps[i].fb, test_disps[i].px_cnt * sizeof(lv_color_t));
+        }
+
+        render(true);
+        for(i = 0; i < DISP_CNT; i++) {
+            TEST_ASSERT_EQUAL_MEMORY(test_disps[i].ref_fb, test_disps[i].fb, test_disps[i].px_cnt * sizeof(lv_color_t));
+        }
+    }
+}
+
+void test_refr_ctx_should_free_the_buffers_after_refresh(void)
+{
+    update_scene(1);
+    render(true);
+
+    uint32_t i;
+    for(i = 0; i < DISP_CNT; i++) {
+        _lv_refr_ctx_t * ctx = test_disps[i].disp->refr_ctx;
+        TEST_ASSERT_NULL(ctx->font_decompr_buf);
+        uint32_t j;
+        for(j = 0; j < LV_MEM_BUF_MAX_NUM; j++) {
+            TEST_ASSERT_NULL(ctx->mem_buf[j].p);
+        }
+        for(j = 0; j < _LV_MASK_MAX_NUM; j++) {
+            TEST_ASSERT_NULL(ctx->mask_list[j].param);
+        }
+    }
+}
+
+void test_refr_ctx_should_render_fresh_objects_concurrently(void)
+{
+#if LV_USE_OBJ_STYLE_CACHE
+    /*The style caches of the new objects are allocated from the shared pools while drawing*/
+    lv_obj_t * conts[DISP_CNT];
+    uint32_t i;
+    for(i = 0; i < DISP_CNT; i++) {
+        conts[i] = lv_obj_create(lv_disp_get_scr_act(test_disps[i].disp));
+        lv_obj_set_size(conts[i], LV_PCT(100), LV_PCT(100));
+        lv_obj_set_flex_flow(conts[i], LV_FLEX_FLOW_ROW_WRAP);
+    }
+
+    uint32_t round;
+    for(round = 0; round < FRESH_ROUND_CNT; round++) {
+        lv_obj_enable_style_cache(false);
+        for(i = 0; i < DISP_CNT; i++) {
+            lv_obj_clean(conts[i]);
+            uint32_t j;
+            for(j = 0; j < FRESH_OBJ_CNT; j++) {
+                lv_obj_t * btn = lv_btn_create(conts[i]);
+                lv_obj_set_size(btn, 20 + j % 3 * 10, 20);
+                lv_obj_t * label = lv_label_create(btn);
+                lv_label_set_text_fmt(label, "%"LV_PRIu32, j);
+            }
+        }
+        lv_obj_enable_style_cache(true);
+
+#if LV_USE_OBJ_POOL
+        lv_slab_reset_stats();
+        render(true);
+        /*At least the caches of the buttons and the labels are allocated by the render threads*/
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(DISP_CNT * FRESH_OBJ_CNT * 2, lv_slab_get_stats()->alloc_cnt);
+#else
+        render(true);
+#endif
+
+        for(i = 0; i < DISP_CNT; i++) {
+            uint32_t j;
+            for(j = 0; j < FRESH_OBJ_CNT; j++) {
+                lv_obj_t * btn = lv_obj_get_child(conts[i], j);
+                TEST_ASSERT_NOT_NULL(btn->style_cache);
+                TEST_ASSERT_NOT_NULL(lv_obj_get_child(btn, 0)->style_cache);
+            }
+        }
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+    }
+
+    /*The same pixels as rendering them on one thread*/
+    render(false);
+    for(i = 0; i < DISP_CNT; i++) {
+        lv_memcpy(test_disps[i].ref_fb, test_disps[i].fb, test_disps[i].px_cnt * sizeof(lv_color_t));
+    }
+    render(true);
+    for(i = 0; i < DISP_CNT; i++) {
+        TEST_ASSERT_EQUAL_MEMORY(test_disps[i].ref_fb, test_disps[i].fb, test_disps[i].px_cnt * sizeof(lv_color_t));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Needs LV_USE_OBJ_STYLE_CACHE");
+#endif
+}
+
+#endif
@@ -0,0 +1,137 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define TEST_HOR_RES 800
+#define TEST_VER_RES 480
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[TEST_HOR_RES * TEST_VER_RES];
+static lv_disp_draw_stats_t ref_stats;
+
+void setUp(void)
+{
+    lv_refr_set_occlusion_culling(true);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_refr_set_occlusion_culling(true);
+}
+
+static lv_obj_t * create_opaque_obj(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_radius(obj, 0, 0);
+    lv_obj_set_style_shadow_width(obj, 0, 0);
+    return obj;
+}
+
+static void render(void)
+{
+    /*Refresh the pending areas to redraw only the screen*/
+    lv_refr_now(NULL);
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_reset_draw_stats(NULL);
+    lv_refr_now(NULL);
+}
+
+/*Render once without and once with culling. Check that the result is the same.*/
+static const lv_disp_draw_stats_t * render_and_compare(void)
+{
+    lv_refr_set_occlusion_culling(false);
+    render();
+    ref_stats = *lv_refr_get_draw_stats(NULL);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    TEST_ASSERT_EQUAL_UINT32(0, ref_stats.cull_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, ref_stats.cull_px_cnt);
+
+    lv_refr_set_occlusion_culling(true);
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    return lv_refr_get_draw_stats(NULL);
+}
+
+void test_refr_occlusion_should_skip_covered_siblings(void)
+{
+    lv_obj_t * card = create_opaque_obj(lv_scr_act(), 100, 100, 200, 200);
+    lv_obj_t * label = lv_label_create(card);
+    lv_label_set_text(label, "Hidden behind the modal");
+
+    create_opaque_obj(lv_scr_act(), 50, 50, 400, 400);
+
+    const lv_disp_draw_stats_t * stats = render_and_compare();
+
+    /*The card and its label*/
+    TEST_ASSERT_EQUAL_UINT32(ref_stats.draw_cnt - 2, stats->draw_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->cull_cnt);
+    TEST_ASSERT_EQUAL_UINT32(200 * 200, stats->cull_px_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(ref_stats.draw_px_cnt, stats->draw_px_cnt);
+}
+
+void test_refr_occlusion_should_draw_only_the_visible_part(void)
+{
+    lv_obj_t * card = create_opaque_obj(lv_scr_act(), 0, 0, 200, 200);
+    lv_obj_set_style_bg_grad_color(card, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_dir(card, LV_GRAD_DIR_HOR, 0);
+
+    /*Covers the right half of the card*/
+    create_opaque_obj(lv_scr_act(), 100, 0, 300, 300);
+
+    const lv_disp_draw_stats_t * stats = render_and_compare();
+
+    TEST_ASSERT_EQUAL_UINT32(0, stats->cull_cnt);
+    TEST_ASSERT_EQUAL_UINT32(100 * 200, stats->cull_px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(ref_stats.draw_px_cnt - 100 * 200, stats->draw_px_cnt);
+}
+
+void test_refr_occlusion_should_not_skip_below_transparent_siblings(void)
+{
+    create_opaque_obj(lv_scr_act(), 100, 100, 200, 200);
+
+    lv_obj_t * glass = create_opaque_obj(lv_scr_act(), 50, 50, 400, 400);
+    lv_obj_set_style_bg_opa(glass, LV_OPA_50, 0);
+
+    lv_obj_t * faded = create_opaque_obj(lv_scr_act(), 50, 50, 400, 400);
+    lv_obj_set_style_opa(faded, LV_OPA_50, 0);
+
+    const lv_disp_draw_stats_t * stats = render_and_compare();
+
+    TEST_ASSERT_EQUAL_UINT32(0, stats->cull_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->cull_px_cnt);
+}
+
+void test_refr_occlusion_should_skip_covered_screen_in_load_anim(void)
+{
+    lv_obj_t * scr_ori = lv_scr_act();
+    create_opaque_obj(scr_ori, 500, 100, 200, 200);
+
+    lv_obj_t * scr = lv_obj_create(NULL);
+    create_opaque_obj(scr, 50, 50, 100, 100);
+
+    /*Both screens are drawn until the animation ends but the new one covers the old*/
+    lv_scr_load_anim(scr, LV_SCR_LOAD_ANIM_NONE, 1000, 0, false);
+    lv_tick_inc(500);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_PTR(scr_ori, lv_disp_get_default()->prev_scr);
+
+    const lv_disp_draw_stats_t * stats = render_and_compare();
+
+    TEST_ASSERT_EQUAL_UINT32(1, stats->cull_cnt);
+    TEST_ASSERT_EQUAL_UINT32(TEST_HOR_RES * TEST_VER_RES, stats->cull_px_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(ref_stats.draw_cnt, stats->draw_cnt);
+
+    lv_tick_inc(1000);
+    lv_timer_handler();
+    lv_scr_load(scr_ori);
+    lv_obj_del(scr);
+}
+
+#endif
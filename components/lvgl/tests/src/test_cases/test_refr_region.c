@@ -0,0 +1,117 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_disp_t * disp;
+
+static void inv_area(lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2)
+{
+    lv_area_t a;
+    lv_area_set(&a, x1, y1, x2, y2);
+    _lv_inv_area(disp, &a);
+}
+
+static bool is_saved(const lv_area_t * a)
+{
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(_lv_area_is_in(a, &disp->inv_areas[i], 0)) return true;
+    }
+    return false;
+}
+
+void setUp(void)
+{
+    disp = lv_disp_get_default();
+
+    /*Start from a clean state*/
+    lv_refr_now(disp);
+    lv_refr_reset_inv_stats(disp);
+}
+
+void tearDown(void)
+{
+    _lv_inv_area(disp, NULL);
+}
+
+void test_refr_region_should_not_invalidate_the_screen_on_overflow(void)
+{
+    const lv_disp_inv_stats_t * stats = lv_refr_get_inv_stats(disp);
+    lv_area_t areas[LV_INV_BUF_SIZE * 2];
+    uint32_t i;
+    for(i = 0; i < LV_INV_BUF_SIZE * 2; i++) {
+        lv_area_set(&areas[i], (i % 8) * 100, (i / 8) * 60, (i % 8) * 100 + 3, (i / 8) * 60 + 3);
+        _lv_inv_area(disp, &areas[i]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_SIZE * 2, stats->inv_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_SIZE, stats->overflow_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_SIZE, disp->inv_p);
+
+    uint32_t px_cnt = 0;
+    for(i = 0; i < disp->inv_p; i++) px_cnt += lv_area_get_size(&disp->inv_areas[i]);
+    TEST_ASSERT_LESS_THAN_UINT32(lv_disp_get_hor_res(disp) * lv_disp_get_ver_res(disp) / 10, px_cnt);
+
+    for(i = 0; i < LV_INV_BUF_SIZE * 2; i++) {
+        TEST_ASSERT_TRUE(is_saved(&areas[i]));
+    }
+}
+
+void test_refr_region_should_drop_covered_areas(void)
+{
+    inv_area(10, 10, 19, 19);
+    inv_area(30, 10, 39, 19);
+    inv_area(500, 300, 509, 309);
+    TEST_ASSERT_EQUAL_UINT32(3, disp->inv_p);
+
+    /*Already invalidated*/
+    inv_area(12, 12, 15, 15);
+    TEST_ASSERT_EQUAL_UINT32(3, disp->inv_p);
+
+    /*Covers the first two*/
+    inv_area(0, 0, 99, 99);
+    TEST_ASSERT_EQUAL_UINT32(2, disp->inv_p);
+    TEST_ASSERT_EQUAL_UINT32(4, lv_refr_get_inv_stats(disp)->inv_cnt);
+}
+
+void test_refr_region_should_join_close_areas(void)
+{
+    inv_area(100, 100, 109, 109);
+    inv_area(115, 100, 124, 109);
+    lv_refr_now(disp);
+
+    const lv_disp_inv_stats_t * stats = lv_refr_get_inv_stats(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->refr_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->join_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(25 * 10, stats->px_cnt);
+}
+
+void test_refr_region_should_not_join_distant_areas(void)
+{
+    inv_area(0, 0, 9, 9);
+    inv_area(700, 400, 709, 409);
+    lv_refr_now(disp);
+
+    const lv_disp_inv_stats_t * stats = lv_refr_get_inv_stats(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->join_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * 10 * 10, stats->px_cnt);
+}
+
+void test_refr_region_should_draw_overlap_once(void)
+{
+    inv_area(0, 0, 99, 99);
+    inv_area(50, 0, 449, 49);
+    lv_refr_now(disp);
+
+    /*Joining them would redraw 450x100 px, so the second area is cut to 100..449 instead*/
+    const lv_disp_inv_stats_t * stats = lv_refr_get_inv_stats(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->join_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->trim_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(100 * 100 + 350 * 50, stats->px_cnt);
+}
+
+#endif
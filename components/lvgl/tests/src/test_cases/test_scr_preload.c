@@ -0,0 +1,220 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_color_t ref_buf[800 * 480];
+static lv_obj_t * base_scr;
+static uint32_t ready_cnt;
+
+void setUp(void)
+{
+    base_scr = lv_scr_act();
+    lv_disp_get_default()->driver->direct_mode = 1;
+    ready_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_disp_load_scr(base_scr);
+    lv_refr_now(NULL);
+    lv_disp_get_default()->driver->direct_mode = 0;
+}
+
+static void ready_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    ready_cnt++;
+}
+
+static lv_obj_t * create_screen(lv_palette_t palette, uint32_t btn_cnt)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(palette, 4), 0);
+    lv_obj_add_event_cb(scr, ready_event_cb, LV_EVENT_READY, NULL);
+
+    uint32_t i;
+    for(i = 0; i < btn_cnt; i++) {
+        lv_obj_t * cont = lv_obj_create(scr);
+        lv_obj_set_size(cont, 180, LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_set_size(btn, 150, 40);
+        lv_obj_set_style_bg_color(btn, lv_palette_main(palette), 0);
+        lv_obj_set_style_shadow_width(btn, 20, 0);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %"LV_PRIu32, i);
+    }
+
+    return scr;
+}
+
+/*Run the preloading steps until the screen is ready*/
+static uint32_t preload(lv_obj_t * scr, bool render)
+{
+    lv_disp_t * d = lv_disp_get_default();
+    lv_scr_preload(scr, render);
+
+    uint32_t step_cnt = 0;
+    while(ready_cnt == 0) {
+        lv_timer_ready(d->preload_timer);
+        lv_timer_handler();
+        step_cnt++;
+        TEST_ASSERT_LESS_THAN_UINT32(1000, step_cnt);
+    }
+
+    return step_cnt;
+}
+
+static void check_with_full_redraw(void)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(lv_disp_get_default());
+    lv_memcpy(ref_buf, draw_buf->buf1, sizeof(ref_buf));
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(draw_buf->buf1, ref_buf, sizeof(ref_buf));
+}
+
+void test_scr_preload_should_prepare_the_screen_in_steps(void)
+{
+    lv_disp_t * d = lv_disp_get_default();
+    lv_obj_t * scr = create_screen(LV_PALETTE_BLUE, 12);
+
+    /*Change the buttons without changing the size of the containers*/
+    lv_obj_update_layout(scr);
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        lv_obj_set_style_pad_left(lv_obj_get_child(lv_obj_get_child(scr, i), 0), 30, 0);
+    }
+
+    /*Render 100 rows in a step*/
+    uint32_t buf_size_ori = d->driver->draw_buf->size;
+    d->driver->draw_buf->size = 800 * 100;
+    lv_draw_layer_cache_reset_stats();
+    uint32_t step_cnt = preload(scr, true);
+    d->driver->draw_buf->size = buf_size_ori;
+
+    TEST_ASSERT_TRUE(lv_scr_is_preloaded(scr));
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_FALSE(scr->scr_layout_inv);
+#if LV_MEM_CUSTOM
+    /*A step for each dirty child, then the bands of 100 rows*/
+    TEST_ASSERT_EQUAL_UINT32(12 + 5, step_cnt);
+    TEST_ASSERT_TRUE(lv_obj_get_layer_cache(scr));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_draw_layer_cache_get_stats()->render_cnt);
+#else
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(12, step_cnt);
+#endif
+
+    /*Nothing to do while it's not changed*/
+    lv_timer_ready(d->preload_timer);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+
+    /*Loaded from the layer and the layer is freed after the first refresh*/
+    lv_draw_layer_cache_reset_stats();
+    lv_disp_load_scr(scr);
+    TEST_ASSERT_NULL(d->preload_timer);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(d->preload_scr);
+    TEST_ASSERT_FALSE(lv_obj_get_layer_cache(scr));
+#if LV_MEM_CUSTOM
+    TEST_ASSERT_EQUAL_UINT32(0, lv_draw_layer_cache_get_stats()->render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_draw_layer_cache_get_stats()->hit_cnt);
+#endif
+    check_with_full_redraw();
+
+    lv_disp_load_scr(base_scr);
+    lv_obj_del(scr);
+}
+
+void test_scr_preload_should_restart_when_changed(void)
+{
+    lv_disp_t * d = lv_disp_get_default();
+    lv_obj_t * scr = create_screen(LV_PALETTE_GREEN, 4);
+    preload(scr, true);
+    TEST_ASSERT_TRUE(lv_scr_is_preloaded(scr));
+
+    /*A changed style invalidates the layer, a new child the layout*/
+    lv_obj_set_style_bg_color(lv_obj_get_child(scr, 1), lv_color_black(), 0);
+    TEST_ASSERT_FALSE(lv_scr_is_preloaded(scr));
+    lv_obj_create(scr);
+    TEST_ASSERT_FALSE(lv_scr_is_preloaded(scr));
+
+    ready_cnt = 0;
+    preload(scr, true);
+    TEST_ASSERT_TRUE(lv_scr_is_preloaded(scr));
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+
+    lv_disp_load_scr(scr);
+    lv_refr_now(NULL);
+    check_with_full_redraw();
+
+    /*Deleting a preloaded screen stops the preloading*/
+    lv_obj_t * scr2 = create_screen(LV_PALETTE_RED, 4);
+    lv_scr_preload(scr2, true);
+    lv_obj_del(scr2);
+    TEST_ASSERT_NULL(d->preload_scr);
+    TEST_ASSERT_NULL(d->preload_timer);
+
+    lv_disp_load_scr(base_scr);
+    lv_obj_del(scr);
+}
+
+/*Move the new screen halfway in and render a frame of the transition into `buf`*/
+static void render_transition(bool preloaded, lv_color_t * buf)
+{
+    lv_disp_t * d = lv_disp_get_default();
+    lv_obj_t * old_scr = create_screen(LV_PALETTE_ORANGE, 20);
+    lv_disp_load_scr(old_scr);
+    lv_refr_now(NULL);
+
+    lv_obj_t * new_scr = create_screen(LV_PALETTE_TEAL, 20);
+    if(preloaded) preload(new_scr, true);
+    lv_draw_layer_cache_reset_stats();
+
+    lv_scr_load_anim(new_scr, LV_SCR_LOAD_ANIM_MOVE_LEFT, 1000, 0, false);
+    lv_anim_refr_now();
+    lv_refr_now(NULL);
+
+    lv_obj_set_x(new_scr, 400);
+    lv_obj_set_x(old_scr, -400);
+    lv_refr_now(NULL);
+    lv_memcpy(buf, d->driver->draw_buf->buf1, sizeof(ref_buf));
+
+#if LV_MEM_CUSTOM
+    /*Only the old screen is rendered into its layer in the first frame*/
+    if(preloaded) {
+        TEST_ASSERT_EQUAL_UINT32(1, lv_draw_layer_cache_get_stats()->render_cnt);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, lv_draw_layer_cache_get_stats()->hit_cnt);
+    }
+#endif
+
+    /*Finish the animations*/
+    lv_anim_get(new_scr, NULL)->act_time = 1000;
+    lv_anim_get(old_scr, NULL)->act_time = 1000;
+    lv_anim_refr_now();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(new_scr, lv_scr_act());
+    TEST_ASSERT_NULL(d->preload_scr);
+    TEST_ASSERT_FALSE(lv_obj_get_layer_cache(new_scr));
+    TEST_ASSERT_FALSE(lv_obj_get_layer_cache(old_scr));
+    check_with_full_redraw();
+
+    lv_disp_load_scr(base_scr);
+    lv_obj_del(old_scr);
+    lv_obj_del(new_scr);
+}
+
+void test_scr_preload_transition_should_draw_the_same(void)
+{
+    static lv_color_t normal_buf[800 * 480];
+    static lv_color_t preloaded_buf[800 * 480];
+    render_transition(false, normal_buf);
+    render_transition(true, preloaded_buf);
+    TEST_ASSERT_EQUAL_MEMORY(normal_buf, preloaded_buf, sizeof(normal_buf));
+}
+
+#endif
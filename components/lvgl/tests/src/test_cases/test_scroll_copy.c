@@ -0,0 +1,201 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/core/lv_indev_scroll.h"
+
+#include "unity/unity.h"
+
+#define SCROLL_FRAME_CNT 20
+
+static lv_color_t ref_buf[800 * 480];
+
+void setUp(void)
+{
+    lv_disp_get_default()->driver->direct_mode = 1;
+    lv_refr_set_scroll_copy(true);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_refr_reset_scroll_copy_stats(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_disp_get_default()->driver->direct_mode = 0;
+    lv_refr_set_scroll_copy(true);
+}
+
+static lv_obj_t * create_scene(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_set_pos(cont, 50, 40);
+    lv_obj_set_style_bg_color(cont, lv_palette_lighten(LV_PALETTE_BLUE, 4), 0);
+    lv_obj_set_style_border_width(cont, 3, 0);
+    lv_obj_set_style_radius(cont, 10, 0);
+
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_set_size(btn, 130 + (i % 3) * 40, 37);
+        lv_obj_set_pos(btn, (i % 4) * 60, i * 45);
+        lv_obj_set_style_bg_color(btn, lv_palette_main(i % 16), 0);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %"LV_PRIu32, i);
+    }
+
+    /*Something which is not scrolled next to it*/
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "Not scrolled");
+    lv_obj_set_pos(label, 500, 40);
+
+    return cont;
+}
+
+/*Scroll like dragging, throwing and animations: the SCROLLED state is not changed in every step*/
+static void scroll(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
+{
+    _lv_obj_scroll_by_raw(obj, x, y);
+}
+
+static void check_with_full_redraw(void)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(lv_disp_get_default());
+    lv_memcpy(ref_buf, draw_buf->buf1, sizeof(ref_buf));
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(draw_buf->buf1, ref_buf, sizeof(ref_buf));
+}
+
+void test_scroll_copy_throw_should_not_depend_on_the_period(void)
+{
+    static const uint32_t periods[] = {1, 5, 10, 16, 30, 33, 50};
+    int32_t ref_dist = 0;
+    uint32_t ref_time = 0;
+
+    uint32_t p;
+    for(p = 0; p < sizeof(periods) / sizeof(periods[0]); p++) {
+        int32_t v = 40 * 65536;
+        int32_t rem = 0;
+        int32_t dist = 0;
+        uint32_t time = 0;
+        while(v) {
+            dist += _lv_indev_scroll_throw_step(&v, &rem, periods[p], 10);
+            time += periods[p];
+        }
+
+        if(p == 0) {
+            ref_dist = dist;
+            ref_time = time;
+        }
+        else {
+            TEST_ASSERT_INT32_WITHIN(ref_dist / 50, ref_dist, dist);
+            TEST_ASSERT_UINT32_WITHIN(periods[p], ref_time, time);
+        }
+    }
+
+    /*About the distance of the original per read period steps: 40 * 0.9 + 40 * 0.9^2 + ...*/
+    TEST_ASSERT_INT32_WITHIN(30, 360, ref_dist);
+}
+
+void test_scroll_copy_should_draw_the_same_as_a_full_redraw(void)
+{
+    lv_obj_t * cont = create_scene();
+    lv_refr_now(NULL);
+
+    static const lv_point_t steps[] = {{0, -7}, {0, -40}, {0, 13}, {-5, -3}, {0, -290}, {4, 0}, {0, -1}};
+    uint32_t i;
+    for(i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+        scroll(cont, steps[i].x, steps[i].y);
+        lv_refr_now(NULL);
+        check_with_full_redraw();
+    }
+
+    /*More steps before a refresh and a changed child in between*/
+    scroll(cont, 0, -11);
+    lv_obj_set_style_bg_color(lv_obj_get_child(cont, 12), lv_color_black(), 0);
+    scroll(cont, 0, -9);
+    scroll(cont, 0, 3);
+    lv_refr_now(NULL);
+    check_with_full_redraw();
+
+    const lv_disp_scroll_copy_stats_t * stats = lv_refr_get_scroll_copy_stats(NULL);
+    /*The 290 px step is larger than the moved area*/
+    TEST_ASSERT_EQUAL_UINT32(sizeof(steps) / sizeof(steps[0]) - 1 + 3, stats->copy_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->fallback_cnt);
+
+#if LV_USE_REFR_REGION
+    /*Only the new strip, the edges and the scrollbar are drawn*/
+    lv_refr_reset_inv_stats(NULL);
+    scroll(cont, 0, -5);
+    lv_refr_now(NULL);
+    TEST_ASSERT_LESS_THAN_UINT32(400 * 300 / 4, lv_refr_get_inv_stats(NULL)->px_cnt);
+    check_with_full_redraw();
+#endif
+}
+
+void test_scroll_copy_should_fall_back_when_covered(void)
+{
+    lv_obj_t * cont = create_scene();
+    lv_obj_t * cover = lv_obj_create(lv_layer_top());
+    lv_obj_set_pos(cover, 300, 200);
+    lv_refr_now(NULL);
+
+    scroll(cont, 0, -20);
+    lv_refr_now(NULL);
+    check_with_full_redraw();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_refr_get_scroll_copy_stats(NULL)->copy_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_refr_get_scroll_copy_stats(NULL)->fallback_cnt);
+
+    lv_obj_del(cover);
+    lv_refr_now(NULL);
+    scroll(cont, 0, -20);
+    lv_refr_now(NULL);
+    check_with_full_redraw();
+    TEST_ASSERT_EQUAL_UINT32(1, lv_refr_get_scroll_copy_stats(NULL)->copy_cnt);
+}
+
+#if LV_USE_REFR_REGION
+/*Scroll the list slowly and return the number of rendered pixels*/
+static uint32_t scroll_px_cnt(lv_obj_t * list, bool copy)
+{
+    lv_refr_set_scroll_copy(copy);
+    lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    lv_refr_reset_scroll_copy_stats(NULL);
+    lv_refr_reset_inv_stats(NULL);
+
+    uint32_t i;
+    for(i = 0; i < SCROLL_FRAME_CNT; i++) {
+        scroll(list, 0, -4);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_EQUAL_UINT32(copy ? SCROLL_FRAME_CNT : 0, lv_refr_get_scroll_copy_stats(NULL)->copy_cnt);
+    uint32_t px_cnt = lv_refr_get_inv_stats(NULL)->px_cnt;
+
+    check_with_full_redraw();
+    return px_cnt;
+}
+#endif
+
+void test_scroll_copy_should_render_less_on_a_slowly_scrolled_list(void)
+{
+#if LV_USE_REFR_REGION
+    lv_obj_t * list = lv_list_create(lv_scr_act());
+    lv_obj_set_size(list, 400, 440);
+    lv_obj_center(list);
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        lv_list_add_btn(list, LV_SYMBOL_FILE, "Item");
+    }
+
+    uint32_t redraw_px_cnt = scroll_px_cnt(list, false);
+    uint32_t copy_px_cnt = scroll_px_cnt(list, true);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(SCROLL_FRAME_CNT * 400 * 440, redraw_px_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(redraw_px_cnt / 4, copy_px_cnt);
+#else
+    TEST_IGNORE_MESSAGE("Needs LV_USE_REFR_REGION");
+#endif
+}
+
+#endif
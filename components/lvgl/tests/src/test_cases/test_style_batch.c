@@ -0,0 +1,161 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define SCREEN_WIDGET_CNT 50
+
+static uint32_t style_changed_cnt;
+
+void setUp(void)
+{
+    style_changed_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+static void style_changed_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    style_changed_cnt++;
+}
+
+/*Set a few inherited properties which affect the layout of the children*/
+static void set_text_props(lv_obj_t * obj)
+{
+    lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_letter_space(obj, 2, 0);
+    lv_obj_set_style_text_line_space(obj, 4, 0);
+}
+
+void test_style_batch_should_refresh_the_children_once(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_t * child = lv_label_create(parent);
+    lv_obj_add_event_cb(child, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+
+    set_text_props(parent);
+    TEST_ASSERT_EQUAL_UINT32(3, style_changed_cnt);
+
+    style_changed_cnt = 0;
+    lv_obj_begin_style_batch();
+    set_text_props(parent);
+    TEST_ASSERT_EQUAL_UINT32(0, style_changed_cnt);
+    lv_obj_commit_style_batch();
+    TEST_ASSERT_EQUAL_UINT32(1, style_changed_cnt);
+}
+
+void test_style_batch_should_give_the_same_layout(void)
+{
+    lv_obj_t * objs[2];
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        objs[i] = lv_obj_create(lv_scr_act());
+        lv_obj_set_size(objs[i], LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+        lv_label_set_text(lv_label_create(objs[i]), "Some text\nin two lines");
+    }
+    lv_obj_update_layout(lv_scr_act());
+
+    set_text_props(objs[0]);
+    lv_obj_set_style_pad_all(objs[0], 17, 0);
+    lv_obj_set_style_shadow_width(objs[0], 30, LV_PART_SCROLLBAR);
+
+    lv_obj_begin_style_batch();
+    set_text_props(objs[1]);
+    lv_obj_set_style_pad_all(objs[1], 17, 0);
+    lv_obj_set_style_shadow_width(objs[1], 30, LV_PART_SCROLLBAR);
+    lv_obj_commit_style_batch();
+
+    lv_obj_update_layout(lv_scr_act());
+    TEST_ASSERT_EQUAL(lv_obj_get_width(objs[0]), lv_obj_get_width(objs[1]));
+    TEST_ASSERT_EQUAL(lv_obj_get_height(objs[0]), lv_obj_get_height(objs[1]));
+    TEST_ASSERT_EQUAL(_lv_obj_get_ext_draw_size(objs[0]), _lv_obj_get_ext_draw_size(objs[1]));
+}
+
+void test_style_batch_should_skip_deleted_objects(void)
+{
+    lv_obj_t * obj1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * obj2 = lv_obj_create(lv_scr_act());
+    lv_obj_add_event_cb(obj2, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+
+    lv_obj_begin_style_batch();
+    lv_obj_set_style_width(obj1, 100, 0);
+    lv_obj_set_style_width(obj2, 100, 0);
+    lv_obj_del(obj1);
+    lv_obj_commit_style_batch();
+
+    TEST_ASSERT_EQUAL_UINT32(1, style_changed_cnt);
+}
+
+void test_style_batch_should_refresh_on_the_outermost_commit(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_add_event_cb(obj, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+
+    lv_obj_begin_style_batch();
+    lv_obj_set_style_width(obj, 100, 0);
+    lv_obj_begin_style_batch();
+    lv_obj_set_style_height(obj, 100, 0);
+    lv_obj_commit_style_batch();
+    TEST_ASSERT_EQUAL_UINT32(0, style_changed_cnt);
+    lv_obj_commit_style_batch();
+    TEST_ASSERT_EQUAL_UINT32(1, style_changed_cnt);
+
+    /*An extra commit is ignored*/
+    lv_obj_commit_style_batch();
+    lv_obj_set_style_width(obj, 50, 0);
+    TEST_ASSERT_EQUAL_UINT32(2, style_changed_cnt);
+}
+
+/*Build a screen with a lot of widgets and style its root like an application would do.
+ *Return how many times the labels were notified about the changes of the root.*/
+static uint32_t build_screen(bool batch)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < SCREEN_WIDGET_CNT; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_set_style_pad_all(btn, 4, 0);
+        lv_obj_set_style_radius(btn, 3, 0);
+        lv_obj_set_style_border_width(btn, 1, 0);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text(label, "Button");
+        lv_obj_add_event_cb(label, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    }
+
+    /*Set 10 properties on the root of the tree*/
+    style_changed_cnt = 0;
+    if(batch) lv_obj_begin_style_batch();
+    set_text_props(cont);
+    lv_obj_set_style_text_color(cont, lv_color_hex(0x202020), 0);
+    lv_obj_set_style_text_opa(cont, LV_OPA_90, 0);
+    lv_obj_set_style_pad_row(cont, 6, 0);
+    lv_obj_set_style_pad_column(cont, 6, 0);
+    lv_obj_set_style_bg_color(cont, lv_color_hex(0xf0f0f0), 0);
+    lv_obj_set_style_border_width(cont, 2, 0);
+    lv_obj_set_style_shadow_width(cont, 10, 0);
+    if(batch) lv_obj_commit_style_batch();
+
+    lv_obj_update_layout(lv_scr_act());
+    lv_obj_del(cont);
+
+    return style_changed_cnt;
+}
+
+void test_style_batch_should_notify_every_label_once_on_a_large_screen(void)
+{
+    uint32_t direct_cnt = build_screen(false);
+    uint32_t batch_cnt = build_screen(true);
+
+    /*Without batching every inherited layout property is sent down to every label one by one*/
+    TEST_ASSERT_EQUAL_UINT32(SCREEN_WIDGET_CNT, batch_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(batch_cnt, direct_cnt);
+}
+
+#endif
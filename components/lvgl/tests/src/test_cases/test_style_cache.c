@@ -0,0 +1,156 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#define TEST_HOR_RES 800
+#define TEST_VER_RES 480
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[TEST_HOR_RES * TEST_VER_RES];
+static lv_style_t style;
+static lv_style_t style_pr;
+
+void setUp(void)
+{
+    lv_style_init(&style);
+    lv_style_init(&style_pr);
+    lv_obj_enable_style_cache(true);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_style_reset(&style);
+    lv_style_reset(&style_pr);
+    lv_obj_enable_style_cache(true);
+}
+
+/*Get the text color of an object with and without the cache and check they are the same*/
+static uint32_t get_text_color(lv_obj_t * obj)
+{
+    lv_color_t c1 = lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    lv_obj_enable_style_cache(false);
+    lv_color_t c2 = lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    lv_obj_enable_style_cache(true);
+    TEST_ASSERT_EQUAL_UINT32(lv_color_to32(c2), lv_color_to32(c1));
+    return lv_color_to32(c1);
+}
+
+void test_style_cache_should_read_cached_values(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_bg_opa(obj, LV_OPA_50, 0);
+
+    lv_obj_reset_style_cache_stats();
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    lv_obj_get_style_bg_opa(obj, LV_PART_SCROLLBAR);    /*Only the main part is cached*/
+    lv_obj_get_style_bg_opa(obj, LV_PART_SCROLLBAR);
+
+    const lv_obj_style_cache_stats_t * stats = lv_obj_get_style_cache_stats();
+    TEST_ASSERT_EQUAL_UINT32(1, stats->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->miss_cnt);
+
+    /*Any style change outdates the cache*/
+    lv_obj_set_style_bg_opa(obj, LV_OPA_30, 0);
+    TEST_ASSERT_EQUAL(LV_OPA_30, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+}
+
+void test_style_cache_should_follow_the_changes_of_shared_styles(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_style_set_text_color(&style, lv_color_hex(0xff0000));
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL_UINT32(lv_color_to32(lv_color_hex(0xff0000)), get_text_color(obj));
+
+    /*Even without `lv_obj_report_style_change()`*/
+    lv_style_set_text_color(&style, lv_color_hex(0x00ff00));
+    TEST_ASSERT_EQUAL_UINT32(lv_color_to32(lv_color_hex(0x00ff00)), get_text_color(obj));
+
+    lv_style_remove_prop(&style, LV_STYLE_TEXT_COLOR);
+    get_text_color(obj);
+
+    lv_obj_remove_style(obj, &style, 0);
+    get_text_color(obj);
+}
+
+void test_style_cache_should_follow_the_state(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_style_set_text_color(&style_pr, lv_color_hex(0x0000ff));
+    lv_obj_add_style(obj, &style_pr, LV_STATE_PRESSED);
+    uint32_t c_def = get_text_color(obj);
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_UINT32(lv_color_to32(lv_color_hex(0x0000ff)), get_text_color(obj));
+
+    lv_obj_clear_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_UINT32(c_def, get_text_color(obj));
+}
+
+void test_style_cache_should_follow_the_inherited_values(void)
+{
+    lv_obj_t * parent1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * parent2 = lv_obj_create(lv_scr_act());
+    lv_obj_t * child = lv_label_create(parent1);
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0x112233), 0);
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x445566), 0);
+    TEST_ASSERT_EQUAL_UINT32(lv_color_to32(lv_color_hex(0x112233)), get_text_color(child));
+
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0x778899), 0);
+    TEST_ASSERT_EQUAL_UINT32(lv_color_to32(lv_color_hex(0x778899)), get_text_color(child));
+
+    lv_obj_set_parent(child, parent2);
+    TEST_ASSERT_EQUAL_UINT32(lv_color_to32(lv_color_hex(0x445566)), get_text_color(child));
+
+    /*The state of the parent can change the inherited value too*/
+    lv_style_set_text_color(&style_pr, lv_color_hex(0xaabbcc));
+    lv_obj_add_style(parent2, &style_pr, LV_STATE_CHECKED);
+    lv_obj_add_state(parent2, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_UINT32(lv_color_to32(lv_color_hex(0xaabbcc)), get_text_color(child));
+}
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+void test_style_cache_should_redraw_the_widgets_demo_from_the_cache(void)
+{
+#if LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+#if LV_USE_DRAW_LIST
+    /*Replaying the draw lists would skip reading the styles*/
+    lv_refr_set_draw_list(false);
+#endif
+
+    lv_obj_enable_style_cache(false);
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_obj_enable_style_cache(true);
+    render();
+    lv_obj_reset_style_cache_stats();
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*Nothing has changed since the previous frame so every cached property is a hit*/
+    const lv_obj_style_cache_stats_t * stats = lv_obj_get_style_cache_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->miss_cnt);
+
+#if LV_USE_DRAW_LIST
+    lv_refr_set_draw_list(true);
+#endif
+    /*The demo's animations would keep running on the next screen*/
+    lv_anim_del_all();
+#else
+    TEST_IGNORE_MESSAGE("Needs LV_USE_DEMO_WIDGETS");
+#endif
+}
+
+#endif
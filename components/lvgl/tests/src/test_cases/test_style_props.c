@@ -0,0 +1,164 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_style_t style;
+
+/*The properties of a busy theme style, e.g. a button merged with its card and text styles*/
+static const lv_style_prop_t theme_props[] = {
+    LV_STYLE_TEXT_COLOR, LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_RADIUS, LV_STYLE_PAD_TOP,
+    LV_STYLE_PAD_BOTTOM, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN,
+    LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_OPA, LV_STYLE_SHADOW_WIDTH,
+    LV_STYLE_SHADOW_OFS_Y, LV_STYLE_SHADOW_OPA, LV_STYLE_SHADOW_COLOR, LV_STYLE_OUTLINE_WIDTH,
+    LV_STYLE_OUTLINE_COLOR, LV_STYLE_OUTLINE_PAD, LV_STYLE_TEXT_FONT, LV_STYLE_TEXT_LINE_SPACE,
+    LV_STYLE_ANIM_TIME, LV_STYLE_TRANSITION, LV_STYLE_LINE_WIDTH, LV_STYLE_ARC_WIDTH,
+};
+
+#define THEME_PROP_CNT (sizeof(theme_props) / sizeof(theme_props[0]))
+
+static const lv_style_const_prop_t theme_const_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x10, 0x20, 0x30)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x40, 0x50, 0x60)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_RADIUS(8),
+    LV_STYLE_CONST_PAD_TOP(10),
+    LV_STYLE_CONST_PAD_BOTTOM(10),
+    LV_STYLE_CONST_PAD_LEFT(20),
+    LV_STYLE_CONST_PAD_RIGHT(20),
+    LV_STYLE_CONST_PAD_ROW(5),
+    LV_STYLE_CONST_PAD_COLUMN(5),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x70, 0x80, 0x90)),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_BORDER_OPA(LV_OPA_50),
+    LV_STYLE_CONST_SHADOW_WIDTH(20),
+    LV_STYLE_CONST_SHADOW_OFS_Y(4),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_30),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_OUTLINE_WIDTH(3),
+    LV_STYLE_CONST_OUTLINE_COLOR(LV_COLOR_MAKE(0xa0, 0xb0, 0xc0)),
+    LV_STYLE_CONST_OUTLINE_PAD(2),
+    LV_STYLE_CONST_TEXT_FONT(LV_FONT_DEFAULT),
+    LV_STYLE_CONST_TEXT_LINE_SPACE(1),
+    LV_STYLE_CONST_ANIM_TIME(200),
+    LV_STYLE_CONST_TRANSITION(NULL),
+    LV_STYLE_CONST_LINE_WIDTH(4),
+    LV_STYLE_CONST_ARC_WIDTH(6),
+};
+
+LV_STYLE_CONST_INIT(theme_const_style, theme_const_props);
+
+void setUp(void)
+{
+    lv_style_init(&style);
+}
+
+void tearDown(void)
+{
+    lv_style_reset(&style);
+}
+
+/*Simple LCG to get the same "random" order in every run*/
+static uint32_t next_rand(uint32_t * seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7FFF;
+}
+
+/*Check every built-in property of `style` against a plain array of the expected values*/
+static void assert_props(const int32_t * expected, const bool * set)
+{
+    lv_style_prop_t p;
+    for(p = 1; p < _LV_STYLE_NUM_BUILT_IN_PROPS; p++) {
+        lv_style_value_t v;
+        lv_style_res_t res = lv_style_get_prop(&style, p, &v);
+        if(set[p]) {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, res);
+            TEST_ASSERT_EQUAL_INT32(expected[p], v.num);
+        }
+        else {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, res);
+        }
+    }
+}
+
+void test_style_props_should_be_found_in_any_insertion_order(void)
+{
+    static int32_t expected[_LV_STYLE_NUM_BUILT_IN_PROPS];
+    static bool set[_LV_STYLE_NUM_BUILT_IN_PROPS];
+    lv_memset_00(set, sizeof(set));
+
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < 400; i++) {
+        lv_style_prop_t p = 1 + next_rand(&seed) % (_LV_STYLE_NUM_BUILT_IN_PROPS - 1);
+        /*Mostly add or overwrite to let the style grow, but remove sometimes too*/
+        if(next_rand(&seed) % 4 == 0) {
+            TEST_ASSERT_EQUAL(set[p], lv_style_remove_prop(&style, p));
+            set[p] = false;
+        }
+        else {
+            lv_style_value_t v = { .num = (int32_t)next_rand(&seed) };
+            lv_style_set_prop(&style, p, v);
+            expected[p] = v.num;
+            set[p] = true;
+        }
+
+        assert_props(expected, set);
+    }
+
+    /*Remove everything to go through all the shrinking steps*/
+    lv_style_prop_t p;
+    for(p = 1; p < _LV_STYLE_NUM_BUILT_IN_PROPS; p++) {
+        TEST_ASSERT_EQUAL(set[p], lv_style_remove_prop(&style, p));
+        set[p] = false;
+        assert_props(expected, set);
+    }
+    TEST_ASSERT_TRUE(lv_style_is_empty(&style));
+}
+
+void test_style_props_should_keep_the_meta_flags(void)
+{
+    uint32_t i;
+    for(i = THEME_PROP_CNT; i > 0; i--) {
+        lv_style_value_t v = { .num = (int32_t)i };
+        lv_style_set_prop(&style, theme_props[i - 1], v);
+    }
+
+    lv_style_set_prop_meta(&style, LV_STYLE_BG_OPA, LV_STYLE_PROP_META_INHERIT);
+    lv_style_set_prop_meta(&style, LV_STYLE_RADIUS, LV_STYLE_PROP_META_INITIAL);
+    /*Add a new property with meta too*/
+    lv_style_set_prop_meta(&style, LV_STYLE_TEXT_OPA, LV_STYLE_PROP_META_INHERIT);
+
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_INHERIT, lv_style_get_prop(&style, LV_STYLE_BG_OPA, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_INHERIT, lv_style_get_prop(&style, LV_STYLE_TEXT_OPA, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_RADIUS, &v));
+    TEST_ASSERT_EQUAL_INT32(lv_style_prop_get_default(LV_STYLE_RADIUS).num, v.num);
+
+    /*The neighbours are not affected*/
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_BG_COLOR, &v));
+    TEST_ASSERT_EQUAL_INT32(2, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_PAD_TOP, &v));
+    TEST_ASSERT_EQUAL_INT32(5, v.num);
+}
+
+void test_style_props_should_find_the_same_values_as_a_const_style(void)
+{
+    uint32_t i;
+    for(i = 0; i < THEME_PROP_CNT; i++) {
+        lv_style_set_prop(&style, theme_const_props[i].prop, theme_const_props[i].value);
+    }
+
+    /*Const styles are still searched linearly so they can serve as a reference for hits and misses too*/
+    lv_style_prop_t p;
+    for(p = 1; p < _LV_STYLE_NUM_BUILT_IN_PROPS; p++) {
+        lv_style_value_t v_sorted;
+        lv_style_value_t v_linear;
+        lv_style_res_t res = lv_style_get_prop_inlined(&theme_const_style, p, &v_linear);
+        TEST_ASSERT_EQUAL(res, lv_style_get_prop_inlined(&style, p, &v_sorted));
+        if(res == LV_STYLE_RES_FOUND) TEST_ASSERT_EQUAL_PTR(v_linear.ptr, v_sorted.ptr);
+    }
+}
+
+#endif
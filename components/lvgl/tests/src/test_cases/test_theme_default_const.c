@@ -0,0 +1,226 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define REC_MAX 8192
+
+typedef struct {
+    uint16_t obj_id;
+    uint16_t prop;
+    uint32_t selector;
+    uint32_t value;
+} rec_t;
+
+static rec_t recs_ref[REC_MAX];
+static rec_t recs_act[REC_MAX];
+
+static void theme_init(lv_color_t primary, bool dark)
+{
+    lv_theme_default_init(NULL, primary, lv_palette_main(LV_PALETTE_RED), dark, LV_FONT_DEFAULT);
+}
+
+void setUp(void)
+{
+    lv_theme_default_enable_const(true);
+    theme_init(lv_palette_main(LV_PALETTE_BLUE), LV_THEME_DEFAULT_DARK);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_theme_default_enable_const(true);
+    theme_init(lv_palette_main(LV_PALETTE_BLUE), LV_THEME_DEFAULT_DARK);
+}
+
+static void create_widgets(lv_obj_t * parent)
+{
+    lv_obj_t * btn = lv_btn_create(parent);
+    lv_label_create(btn);
+    lv_obj_add_state(lv_btn_create(parent), LV_STATE_CHECKED);
+    lv_slider_create(parent);
+    lv_switch_create(parent);
+    lv_arc_create(parent);
+    lv_bar_create(parent);
+    lv_checkbox_create(parent);
+    lv_dropdown_create(parent);
+    lv_roller_create(parent);
+    lv_table_create(parent);
+    lv_textarea_create(parent);
+    lv_keyboard_create(parent);
+    lv_chart_create(parent);
+    lv_list_add_btn(lv_list_create(parent), LV_SYMBOL_OK, "Item");
+    lv_tabview_add_tab(lv_tabview_create(parent, LV_DIR_TOP, 40), "Tab");
+    lv_win_add_title(lv_win_create(parent, 40), "Title");
+    lv_msgbox_create(parent, "Title", "Text", NULL, true);
+    lv_calendar_create(parent);
+    lv_meter_create(parent);
+    lv_spinbox_create(parent);
+    lv_led_create(parent);
+    lv_colorwheel_create(parent, true);
+    lv_menu_create(parent);
+}
+
+static void rec_add(rec_t * recs, uint32_t * cnt, uint16_t obj_id, uint32_t selector, uint16_t prop,
+                    uint32_t value)
+{
+    TEST_ASSERT_LESS_THAN_UINT32(REC_MAX, *cnt);
+    recs[*cnt].obj_id = obj_id;
+    recs[*cnt].selector = selector;
+    recs[*cnt].prop = prop;
+    recs[*cnt].value = value;
+    (*cnt)++;
+}
+
+/*Record the properties of the styles added to `parent` and its children in the order of the tree*/
+static uint32_t record(lv_obj_t * parent, rec_t * recs)
+{
+    uint32_t cnt = 0;
+    uint16_t obj_id = 0;
+    lv_obj_t * stack[64];
+    uint32_t stack_cnt = 0;
+    stack[stack_cnt++] = parent;
+
+    while(stack_cnt) {
+        lv_obj_t * obj = stack[--stack_cnt];
+        uint32_t i;
+        for(i = 0; i < obj->style_cnt; i++) {
+            const lv_style_t * style = obj->styles[i].style;
+            rec_add(recs, &cnt, obj_id, obj->styles[i].selector, 0, 0);
+
+            lv_style_prop_t prop;
+            for(prop = 1; prop <= _LV_STYLE_LAST_BUILT_IN_PROP; prop++) {
+                lv_style_value_t v;
+                if(lv_style_get_prop(style, prop, &v) != LV_STYLE_RES_FOUND) continue;
+                uint32_t value;
+                if(prop == LV_STYLE_BG_COLOR || prop == LV_STYLE_BG_GRAD_COLOR || prop == LV_STYLE_TEXT_COLOR ||
+                   prop == LV_STYLE_BORDER_COLOR || prop == LV_STYLE_OUTLINE_COLOR || prop == LV_STYLE_SHADOW_COLOR ||
+                   prop == LV_STYLE_LINE_COLOR || prop == LV_STYLE_ARC_COLOR || prop == LV_STYLE_IMG_RECOLOR) {
+                    value = lv_color_to32(v.color);
+                }
+                else if(prop == LV_STYLE_TEXT_FONT || prop == LV_STYLE_TRANSITION ||
+                        prop == LV_STYLE_COLOR_FILTER_DSC || prop == LV_STYLE_ANIM || prop == LV_STYLE_BG_IMG_SRC ||
+                        prop == LV_STYLE_ARC_IMG_SRC || prop == LV_STYLE_BG_GRAD || prop == LV_STYLE_BG_DITHER_MODE) {
+                    value = (uint32_t)(uintptr_t)v.ptr;
+                }
+                else {
+                    value = (uint32_t)v.num;
+                }
+                rec_add(recs, &cnt, obj_id, obj->styles[i].selector, prop, value);
+            }
+        }
+
+        /*Push the children in reverse order to visit them in order*/
+        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+        for(i = child_cnt; i > 0; i--) {
+            TEST_ASSERT_LESS_THAN_UINT32(64, stack_cnt);
+            stack[stack_cnt++] = lv_obj_get_child(obj, i - 1);
+        }
+        obj_id++;
+    }
+
+    return cnt;
+}
+
+static void assert_same_recs(uint32_t ref_cnt, uint32_t act_cnt)
+{
+    TEST_ASSERT_EQUAL_UINT32(ref_cnt, act_cnt);
+    uint32_t i;
+    for(i = 0; i < ref_cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT16(recs_ref[i].obj_id, recs_act[i].obj_id);
+        TEST_ASSERT_EQUAL_UINT32(recs_ref[i].selector, recs_act[i].selector);
+        TEST_ASSERT_EQUAL_UINT16(recs_ref[i].prop, recs_act[i].prop);
+        TEST_ASSERT_EQUAL_HEX32(recs_ref[i].value, recs_act[i].value);
+    }
+}
+
+void test_theme_default_const_should_be_used_with_the_default_parameters(void)
+{
+    TEST_ASSERT_TRUE(lv_theme_default_is_const());
+    TEST_ASSERT_TRUE(lv_theme_default_is_inited());
+}
+
+void test_theme_default_const_should_apply_the_same_styles_as_in_ram(void)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    create_widgets(scr);
+    uint32_t ref_cnt = record(scr, recs_ref);
+    lv_obj_del(scr);
+
+    lv_theme_default_enable_const(false);
+    theme_init(lv_palette_main(LV_PALETTE_BLUE), LV_THEME_DEFAULT_DARK);
+    TEST_ASSERT_FALSE(lv_theme_default_is_const());
+
+    scr = lv_obj_create(NULL);
+    create_widgets(scr);
+    uint32_t act_cnt = record(scr, recs_act);
+    lv_obj_del(scr);
+
+    /*Pointers (e.g. transitions, filters) are the same in both modes*/
+    assert_same_recs(ref_cnt, act_cnt);
+}
+
+void test_theme_default_const_should_move_the_styles_of_the_objects(void)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    create_widgets(scr);
+    uint32_t ref_cnt = record(scr, recs_ref);
+
+    /*Not the compiled mode: RAM styles*/
+    theme_init(lv_palette_main(LV_PALETTE_BLUE), !LV_THEME_DEFAULT_DARK);
+    TEST_ASSERT_FALSE(lv_theme_default_is_const());
+    lv_color_t scr_color = lv_obj_get_style_bg_color(scr, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(LV_THEME_DEFAULT_DARK ? lv_color_hex(0xF5F5F5) : lv_color_hex(0x15171A)),
+                            lv_color_to32(scr_color));
+
+    /*Back to the constant tables*/
+    theme_init(lv_palette_main(LV_PALETTE_BLUE), LV_THEME_DEFAULT_DARK);
+    TEST_ASSERT_TRUE(lv_theme_default_is_const());
+    uint32_t act_cnt = record(scr, recs_act);
+    assert_same_recs(ref_cnt, act_cnt);
+
+    lv_obj_del(scr);
+}
+
+void test_theme_default_const_should_use_the_runtime_colors(void)
+{
+    theme_init(lv_palette_main(LV_PALETTE_GREEN), LV_THEME_DEFAULT_DARK);
+    TEST_ASSERT_TRUE(lv_theme_default_is_const());
+
+    lv_obj_t * btn = lv_btn_create(lv_scr_act());
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_palette_main(LV_PALETTE_GREEN)),
+                            lv_color_to32(lv_obj_get_style_bg_color(btn, LV_PART_MAIN)));
+
+    theme_init(lv_palette_main(LV_PALETTE_BLUE), LV_THEME_DEFAULT_DARK);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_palette_main(LV_PALETTE_BLUE)),
+                            lv_color_to32(lv_obj_get_style_bg_color(btn, LV_PART_MAIN)));
+}
+
+#if LV_MEM_CUSTOM == 0
+static uint32_t get_mem_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+#endif
+
+void test_theme_default_const_should_not_allocate_the_styles(void)
+{
+#if LV_MEM_CUSTOM == 0
+    /*`setUp()` has already initialized the theme with the constant tables*/
+    uint32_t const_used = get_mem_used();
+    theme_init(lv_palette_main(LV_PALETTE_GREEN), LV_THEME_DEFAULT_DARK);
+    TEST_ASSERT_TRUE(lv_theme_default_is_const());
+    TEST_ASSERT_EQUAL_UINT32(const_used, get_mem_used());
+
+    /*The RAM styles allocate their property arrays*/
+    lv_theme_default_enable_const(false);
+    theme_init(lv_palette_main(LV_PALETTE_GREEN), LV_THEME_DEFAULT_DARK);
+    TEST_ASSERT_GREATER_THAN_UINT32(const_used, get_mem_used());
+#else
+    TEST_IGNORE_MESSAGE("Needs the LVGL heap to measure the memory usage");
+#endif
+}
+
+#endif
@@ -0,0 +1,214 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define ROW_H           30
+#define ROW_CNT         100000
+#define BOUND_ROW_MAX   32
+
+static lv_obj_t * vlist;
+static uint32_t create_cnt;
+static uint32_t update_cnt;
+
+/*The index bound to the row objects by `update_row_cb` (doesn't need `LV_USE_USER_DATA`)*/
+static lv_obj_t * bound_rows[BOUND_ROW_MAX];
+static uint32_t bound_indices[BOUND_ROW_MAX];
+
+static const char * get_text_cb(lv_obj_t * obj, uint32_t row, uint16_t col)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+    lv_snprintf(buf, sizeof(buf), "%"LV_PRIu32"/%d", row, col);
+    return buf;
+}
+
+static lv_obj_t * create_row_cb(lv_obj_t * obj)
+{
+    create_cnt++;
+    lv_obj_t * row = lv_obj_class_create_obj(&lv_vlist_row_class, obj);
+    lv_obj_class_init_obj(row);
+    return row;
+}
+
+static void update_row_cb(lv_obj_t * obj, lv_obj_t * row, uint32_t index)
+{
+    LV_UNUSED(obj);
+    update_cnt++;
+
+    uint32_t i;
+    for(i = 0; i < BOUND_ROW_MAX; i++) {
+        if(bound_rows[i] == row || bound_rows[i] == NULL) break;
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(BOUND_ROW_MAX, i);
+    bound_rows[i] = row;
+    bound_indices[i] = index;
+}
+
+static uint32_t get_bound_index(lv_obj_t * row)
+{
+    uint32_t i;
+    for(i = 0; i < BOUND_ROW_MAX && bound_rows[i]; i++) {
+        if(bound_rows[i] == row) return bound_indices[i];
+    }
+    return UINT32_MAX;
+}
+
+void setUp(void)
+{
+    vlist = lv_vlist_create(lv_scr_act());
+    lv_obj_set_size(vlist, 200, 300);
+    lv_obj_set_style_pad_all(vlist, 0, 0);
+    lv_obj_set_style_border_width(vlist, 0, 0);
+    lv_vlist_set_row_height(vlist, ROW_H);
+    lv_obj_update_layout(vlist);
+    create_cnt = 0;
+    update_cnt = 0;
+    lv_memset_00(bound_rows, sizeof(bound_rows));
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_vlist_should_create_only_the_visible_rows(void)
+{
+    lv_vlist_set_overscan(vlist, 2);
+    lv_vlist_set_text_cb(vlist, get_text_cb);
+    lv_vlist_set_row_cnt(vlist, ROW_CNT);
+    lv_obj_update_layout(vlist);
+
+    /*300 / 30 visible rows and the overscan below*/
+    TEST_ASSERT_EQUAL_UINT32(12, lv_obj_get_child_cnt(vlist));
+
+    /*The scroll range is the same as with real rows*/
+    TEST_ASSERT_EQUAL_INT32(ROW_CNT * ROW_H - 300, lv_obj_get_scroll_bottom(vlist));
+
+    lv_obj_scroll_to_y(vlist, 1000 * ROW_H + 10, LV_ANIM_OFF);
+    lv_obj_update_layout(vlist);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(15, lv_obj_get_child_cnt(vlist));
+    TEST_ASSERT_EQUAL_INT32(ROW_CNT * ROW_H - 300 - 1000 * ROW_H - 10, lv_obj_get_scroll_bottom(vlist));
+
+    lv_obj_t * row = lv_vlist_get_row(vlist, 1000);
+    TEST_ASSERT_NOT_NULL(row);
+    TEST_ASSERT_EQUAL_INT32(-10, row->coords.y1 - vlist->coords.y1);
+    TEST_ASSERT_EQUAL_STRING("1000/0", lv_label_get_text(lv_obj_get_child(row, 0)));
+    TEST_ASSERT_EQUAL_UINT32(1000, lv_vlist_get_row_index(vlist, row));
+    TEST_ASSERT_NULL(lv_vlist_get_row(vlist, 990));
+}
+
+void test_vlist_should_reuse_the_rows(void)
+{
+    lv_vlist_set_row_cb(vlist, create_row_cb, update_row_cb);
+    lv_vlist_set_row_cnt(vlist, ROW_CNT);
+    uint32_t create_cnt_start = create_cnt;
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_obj_scroll_by(vlist, 0, -17, LV_ANIM_OFF);
+    }
+    lv_obj_update_layout(vlist);
+
+    /*The overscan above and one more row when the rows are not aligned to the top*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(create_cnt_start + 3, create_cnt);
+    /*Only the rows coming into view are updated*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(create_cnt_start + 100 * 17 / ROW_H + 2, update_cnt);
+
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(vlist);
+    uint32_t first = scroll_y / ROW_H;
+    lv_obj_t * row = lv_vlist_get_row(vlist, first);
+    TEST_ASSERT_NOT_NULL(row);
+    TEST_ASSERT_EQUAL_UINT32(first, get_bound_index(row));
+    TEST_ASSERT_EQUAL_INT32(first * ROW_H - scroll_y, row->coords.y1 - vlist->coords.y1);
+}
+
+void test_vlist_should_show_columns(void)
+{
+    lv_vlist_set_col_cnt(vlist, 3);
+    lv_vlist_set_col_width(vlist, 0, 50);
+    lv_vlist_set_col_width(vlist, 1, 100);
+    lv_vlist_set_col_width(vlist, 2, 150);
+    lv_vlist_set_text_cb(vlist, get_text_cb);
+    lv_vlist_set_row_cnt(vlist, 20);
+    lv_obj_update_layout(vlist);
+
+    /*The columns are wider than the list, so it can be scrolled horizontally*/
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_scroll_right(vlist));
+
+    lv_obj_t * row = lv_vlist_get_row(vlist, 3);
+    TEST_ASSERT_EQUAL_STRING("3/2", lv_label_get_text(lv_obj_get_child(row, 2)));
+    TEST_ASSERT_EQUAL_INT32(150, lv_obj_get_child(row, 2)->coords.x1 - row->coords.x1);
+}
+
+void test_vlist_should_follow_the_row_cnt(void)
+{
+    lv_vlist_set_text_cb(vlist, get_text_cb);
+    lv_vlist_set_row_cnt(vlist, 1000);
+    lv_vlist_scroll_to_row(vlist, 999, LV_ANIM_OFF);
+    lv_obj_update_layout(vlist);
+    TEST_ASSERT_NOT_NULL(lv_vlist_get_row(vlist, 999));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_bottom(vlist));
+
+    /*The scroll position is adjusted to the new end*/
+    lv_vlist_set_row_cnt(vlist, 50);
+    lv_obj_update_layout(vlist);
+    TEST_ASSERT_EQUAL_INT32(50 * ROW_H - 300, lv_obj_get_scroll_y(vlist));
+    TEST_ASSERT_NOT_NULL(lv_vlist_get_row(vlist, 49));
+    TEST_ASSERT_NULL(lv_vlist_get_row(vlist, 999));
+
+    /*Few rows: the extra row objects are hidden*/
+    lv_vlist_set_row_cnt(vlist, 3);
+    lv_obj_update_layout(vlist);
+    uint32_t i;
+    uint32_t visible_cnt = 0;
+    for(i = 0; i < lv_obj_get_child_cnt(vlist); i++) {
+        if(!lv_obj_has_flag(lv_obj_get_child(vlist, i), LV_OBJ_FLAG_HIDDEN)) visible_cnt++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, visible_cnt);
+
+    /*The rows are created again after deleting them*/
+    lv_obj_clean(vlist);
+    lv_vlist_refresh(vlist);
+    TEST_ASSERT_EQUAL_STRING("2/0", lv_label_get_text(lv_obj_get_child(lv_vlist_get_row(vlist, 2), 0)));
+}
+
+void test_vlist_should_limit_the_height(void)
+{
+    lv_vlist_set_text_cb(vlist, get_text_cb);
+    lv_vlist_set_row_height(vlist, 1000);
+    lv_vlist_set_row_cnt(vlist, UINT32_MAX / 2);
+    lv_obj_update_layout(vlist);
+
+    /*The rows don't fit into the coordinate range, so the list is as high as possible*/
+    TEST_ASSERT_EQUAL_INT32(LV_COORD_MAX - 300, lv_obj_get_scroll_bottom(vlist));
+    TEST_ASSERT_NOT_NULL(lv_vlist_get_row(vlist, 0));
+}
+
+void test_vlist_should_keep_the_row_objects_while_scrolled_quickly(void)
+{
+    lv_obj_set_size(vlist, LV_PCT(100), LV_PCT(100));
+    lv_vlist_set_col_cnt(vlist, 3);
+    lv_vlist_set_text_cb(vlist, get_text_cb);
+    lv_vlist_set_row_cnt(vlist, ROW_CNT);
+    lv_refr_now(NULL);
+    uint32_t row_obj_cnt = lv_obj_get_child_cnt(vlist);
+
+    /*Scroll more than a screen in every frame*/
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_obj_scroll_by(vlist, 0, -(ROW_H * 20 + 7), LV_ANIM_OFF);
+        lv_refr_now(NULL);
+        /*The overscan above and one more row when the rows are not aligned to the top*/
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(row_obj_cnt + 3, lv_obj_get_child_cnt(vlist));
+    }
+
+    uint32_t first = lv_obj_get_scroll_y(vlist) / ROW_H;
+    lv_obj_t * row = lv_vlist_get_row(vlist, first);
+    TEST_ASSERT_NOT_NULL(row);
+    char buf[32];
+    lv_snprintf(buf, sizeof(buf), "%"LV_PRIu32"/2", first);
+    TEST_ASSERT_EQUAL_STRING(buf, lv_label_get_text(lv_obj_get_child(row, 2)));
+}
+
+#endif
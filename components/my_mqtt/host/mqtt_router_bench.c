@@ -0,0 +1,213 @@
+/**
+ * @file mqtt_router_bench.c
+ *
+ * @brief Host benchmark for the MQTT topic router. It matches a mix of topics
+ * against a route table with the trie and with a linear scan comparing every
+ * filter level by level, then dispatches game payloads through the decoder.
+ *
+ * Build on the host from components/my_mqtt:
+ *   gcc -O2 -I. -I../tictactoe host/mqtt_router_bench.c mqtt_router.c mqtt_game_payload.c -o mqtt_router_bench
+ *
+ * Usage:
+ *   mqtt_router_bench [messages]
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mqtt_router.h"
+#include "mqtt_game_payload.h"
+#include "tictactoe_game.h"
+
+//---------------------------------- MACROS -----------------------------------
+#define DEFAULT_MESSAGES (10000000U)
+#define TOPIC_COUNT      (sizeof(topics) / sizeof(topics[0]))
+#define ROUTE_COUNT      (sizeof(routes) / sizeof(routes[0]))
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+static const mqtt_router_route_t *_linear_match(const char *p_topic, size_t topic_len);
+static bool _filter_matches(const char *p_filter, const char *p_topic, size_t topic_len);
+static void _handler(const mqtt_router_msg_t *p_msg, const void *p_decoded);
+static double _now_s(void);
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+/* The device routes plus the kind of topics a bigger application would subscribe to. */
+static const mqtt_router_route_t routes[] = {
+    {.p_filter = "WES/Uranus/game", .decode = mqtt_game_payload_decode, .decoded_size = sizeof(tictactoe_handler_t), .handler = _handler},
+    {.p_filter = "WES/Uranus/games/+", .decode = mqtt_game_payload_decode, .decoded_size = sizeof(tictactoe_handler_t), .handler = _handler},
+    {.p_filter = "WES/Uranus/games/+/chat", .handler = _handler},
+    {.p_filter = "WES/Uranus/config/display", .handler = _handler},
+    {.p_filter = "WES/Uranus/config/network", .handler = _handler},
+    {.p_filter = "WES/Uranus/ota/+", .handler = _handler},
+    {.p_filter = "WES/+/sensor/temperature", .handler = _handler},
+    {.p_filter = "WES/+/sensor/humidity", .handler = _handler},
+    {.p_filter = "WES/+/status", .handler = _handler},
+    {.p_filter = "WES/broadcast/#", .handler = _handler},
+};
+
+static const char *const topics[] = {
+    "WES/Uranus/games/g17",
+    "WES/Uranus/games/g4711",
+    "WES/Uranus/game",
+    "WES/Mars/sensor/humidity",
+    "WES/Uranus/games/g17/chat",
+    "WES/broadcast/news/today",
+    "WES/Venus/status",
+    "WES/Uranus/unknown/topic",
+};
+
+static const char payload[] = "{\"indexX\": [0, 4], \"indexO\": [8], \"turn\": \"device\"}";
+
+static mqtt_router_t router;
+static uint32_t handled;
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+int main(int argc, char **argv)
+{
+    uint32_t messages = argc >= 2 ? (uint32_t)strtoul(argv[1], NULL, 0) : DEFAULT_MESSAGES;
+    size_t topic_lens[TOPIC_COUNT];
+    uintptr_t checksum_trie = 0;
+    uintptr_t checksum_linear = 0;
+
+    if (!mqtt_router_init(&router, routes, ROUTE_COUNT))
+    {
+        fprintf(stderr, "invalid route table\n");
+        return 2;
+    }
+    for (size_t i = 0; i < TOPIC_COUNT; i++)
+    {
+        topic_lens[i] = strlen(topics[i]);
+        if (mqtt_router_match(&router, topics[i], topic_lens[i], NULL) != _linear_match(topics[i], topic_lens[i]))
+        {
+            fprintf(stderr, "trie and linear scan disagree on %s\n", topics[i]);
+            return 1;
+        }
+    }
+
+    double start = _now_s();
+    for (uint32_t i = 0; i < messages; i++)
+    {
+        size_t t = i % TOPIC_COUNT;
+        checksum_trie += (uintptr_t)mqtt_router_match(&router, topics[t], topic_lens[t], NULL);
+    }
+    double trie_s = _now_s() - start;
+
+    start = _now_s();
+    for (uint32_t i = 0; i < messages; i++)
+    {
+        size_t t = i % TOPIC_COUNT;
+        checksum_linear += (uintptr_t)_linear_match(topics[t], topic_lens[t]);
+    }
+    double linear_s = _now_s() - start;
+
+    /* Game topics only, so every message goes through the payload decoder too */
+    start = _now_s();
+    for (uint32_t i = 0; i < messages; i++)
+    {
+        size_t t = i % 3;
+        mqtt_router_dispatch(&router, topics[t], topic_lens[t], payload, sizeof(payload) - 1);
+    }
+    double dispatch_s = _now_s() - start;
+
+    if (checksum_trie != checksum_linear || handled != messages)
+    {
+        fprintf(stderr, "result mismatch\n");
+        return 1;
+    }
+
+    printf("routes: %zu, topics: %zu, trie nodes: %u, router size: %zu bytes\n", ROUTE_COUNT, TOPIC_COUNT, router.node_count,
+           sizeof(router));
+    printf("trie match:      %.1f M topics/s (%.0f ns/topic)\n", messages / trie_s / 1e6, trie_s * 1e9 / messages);
+    printf("linear match:    %.1f M topics/s (%.0f ns/topic)\n", messages / linear_s / 1e6, linear_s * 1e9 / messages);
+    printf("decode+dispatch: %.1f M messages/s (%.0f ns/message)\n", messages / dispatch_s / 1e6, dispatch_s * 1e9 / messages);
+    return 0;
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+static const mqtt_router_route_t *_linear_match(const char *p_topic, size_t topic_len)
+{
+    /* Same priorities as the trie: the most specific filter wins, i.e. the one whose first wildcard comes latest. */
+    const mqtt_router_route_t *p_best = NULL;
+    size_t best_wildcard = 0;
+
+    for (size_t i = 0; i < ROUTE_COUNT; i++)
+    {
+        if (_filter_matches(routes[i].p_filter, p_topic, topic_len))
+        {
+            size_t wildcard = strcspn(routes[i].p_filter, "+#");
+            if (p_best == NULL || wildcard > best_wildcard)
+            {
+                p_best = &routes[i];
+                best_wildcard = wildcard;
+            }
+        }
+    }
+    return p_best;
+}
+
+static bool _filter_matches(const char *p_filter, const char *p_topic, size_t topic_len)
+{
+    size_t pos = 0;
+
+    while (*p_filter != '\0')
+    {
+        /* "a/#" also matches "a" */
+        if (p_filter[0] == '#')
+        {
+            return true;
+        }
+
+        if (pos > topic_len)
+        {
+            return false;
+        }
+
+        const char *p_slash = memchr(&p_topic[pos], '/', topic_len - pos);
+        size_t end = p_slash != NULL ? (size_t)(p_slash - p_topic) : topic_len;
+        size_t filter_level = strcspn(p_filter, "/");
+
+        if (!(filter_level == 1 && p_filter[0] == '+') &&
+            (filter_level != end - pos || memcmp(p_filter, &p_topic[pos], filter_level) != 0))
+        {
+            return false;
+        }
+
+        p_filter += filter_level;
+        pos = end + 1;
+        if (*p_filter == '/')
+        {
+            p_filter++;
+        }
+        else
+        {
+            return pos > topic_len;
+        }
+    }
+    return false;
+}
+
+static void _handler(const mqtt_router_msg_t *p_msg, const void *p_decoded)
+{
+    (void)p_msg;
+    (void)p_decoded;
+    handled++;
+}
+
+static double _now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
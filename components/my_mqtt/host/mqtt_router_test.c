@@ -0,0 +1,268 @@
+/**
+ * @file mqtt_router_test.c
+ *
+ * @brief Host test for the MQTT topic router and the game payload decoder.
+ * It checks wildcard matching and priorities, route table validation,
+ * fragment reassembly and malformed payloads.
+ *
+ * Build and run on the host from components/my_mqtt:
+ *   gcc -O2 -I. -I../tictactoe host/mqtt_router_test.c mqtt_router.c mqtt_game_payload.c -o mqtt_router_test
+ *   ./mqtt_router_test
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "mqtt_router.h"
+#include "mqtt_game_payload.h"
+#include "tictactoe_game.h"
+
+//---------------------------------- MACROS -----------------------------------
+#define CHECK(cond)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if (!(cond))                                                       \
+        {                                                                  \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+#define STR_LEN(str) (sizeof(str) - 1)
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+static void _test_match(void);
+static void _test_invalid_routes(void);
+static void _test_dispatch(void);
+static void _test_fragments(void);
+static void _test_payload(void);
+static const char *_match(const char *p_topic, const char **pp_wildcard, size_t *p_wildcard_len);
+static void _handler(const mqtt_router_msg_t *p_msg, const void *p_decoded);
+static bool _decode_ok(const char *p_data, size_t data_len, void *p_decoded);
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+static const mqtt_router_route_t routes[] = {
+    {.p_filter = "WES/Uranus/game", .handler = _handler},
+    {.p_filter = "WES/Uranus/games/+", .handler = _handler},
+    {.p_filter = "WES/Uranus/games/+/chat", .handler = _handler},
+    {.p_filter = "WES/Uranus/games/lobby", .handler = _handler},
+    {.p_filter = "WES/+/sensor/#", .handler = _handler},
+    {.p_filter = "WES/Uranus/#", .handler = _handler},
+};
+
+static int failures;
+static mqtt_router_t router;
+static mqtt_router_msg_t last_msg;
+static char last_data[MQTT_ROUTER_PAYLOAD_SIZE];
+static int handled;
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+int main(void)
+{
+    _test_match();
+    _test_invalid_routes();
+    _test_dispatch();
+    _test_fragments();
+    _test_payload();
+
+    if (failures != 0)
+    {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+static void _test_match(void)
+{
+    const char *p_wildcard;
+    size_t wildcard_len;
+
+    CHECK(mqtt_router_init(&router, routes, sizeof(routes) / sizeof(routes[0])));
+
+    CHECK(strcmp(_match("WES/Uranus/game", &p_wildcard, &wildcard_len), "WES/Uranus/game") == 0);
+    CHECK(p_wildcard == NULL);
+
+    /* '+' takes one level, the exact "lobby" level wins over it */
+    CHECK(strcmp(_match("WES/Uranus/games/g42", &p_wildcard, &wildcard_len), "WES/Uranus/games/+") == 0);
+    CHECK(wildcard_len == 3 && memcmp(p_wildcard, "g42", 3) == 0);
+    CHECK(strcmp(_match("WES/Uranus/games/lobby", &p_wildcard, &wildcard_len), "WES/Uranus/games/lobby") == 0);
+    CHECK(strcmp(_match("WES/Uranus/games/g42/chat", &p_wildcard, &wildcard_len), "WES/Uranus/games/+/chat") == 0);
+    CHECK(wildcard_len == 3 && memcmp(p_wildcard, "g42", 3) == 0);
+
+    /* '+' wins over '#', '#' takes the rest of the topic and also its parent level */
+    CHECK(strcmp(_match("WES/Mars/sensor/temp/1", &p_wildcard, &wildcard_len), "WES/+/sensor/#") == 0);
+    CHECK(wildcard_len == 6 && memcmp(p_wildcard, "temp/1", 6) == 0);
+    CHECK(strcmp(_match("WES/Mars/sensor", &p_wildcard, &wildcard_len), "WES/+/sensor/#") == 0);
+    CHECK(wildcard_len == 0);
+    CHECK(strcmp(_match("WES/Uranus/games/g42/moves", &p_wildcard, &wildcard_len), "WES/Uranus/#") == 0);
+    CHECK(wildcard_len == 15 && memcmp(p_wildcard, "games/g42/moves", 15) == 0);
+    CHECK(strcmp(_match("WES/Uranus/gam", &p_wildcard, &wildcard_len), "WES/Uranus/#") == 0);
+
+    /* Empty levels are levels too */
+    CHECK(strcmp(_match("WES/Uranus/games/", &p_wildcard, &wildcard_len), "WES/Uranus/games/+") == 0);
+    CHECK(wildcard_len == 0);
+
+    CHECK(_match("WES/Mars/game", &p_wildcard, &wildcard_len) == NULL);
+    CHECK(_match("WES", &p_wildcard, &wildcard_len) == NULL);
+    CHECK(_match("", &p_wildcard, &wildcard_len) == NULL);
+    CHECK(_match("/WES/Uranus/game", &p_wildcard, &wildcard_len) == NULL);
+
+    /* The topic does not have to be NUL terminated */
+    CHECK(mqtt_router_match(&router, "WES/Uranus/gamexyz", STR_LEN("WES/Uranus/game"), NULL) == &routes[0]);
+}
+
+static void _test_invalid_routes(void)
+{
+    const mqtt_router_route_t hash_not_last[] = {{.p_filter = "a/#/b", .handler = _handler}};
+    const mqtt_router_route_t wildcard_in_level[] = {{.p_filter = "a/b+", .handler = _handler}};
+    const mqtt_router_route_t duplicate[] = {{.p_filter = "a/+", .handler = _handler}, {.p_filter = "a/+", .handler = _handler}};
+    const mqtt_router_route_t no_handler[] = {{.p_filter = "a"}};
+    const mqtt_router_route_t empty[] = {{.p_filter = "", .handler = _handler}};
+    const mqtt_router_route_t too_large[] = {{.p_filter = "a", .decode = _decode_ok, .decoded_size = MQTT_ROUTER_DECODED_SIZE + 1, .handler = _handler}};
+    const mqtt_router_route_t too_many[] = {{.p_filter = "1/2/3/4/5/6/7/8/9/10/11/12/13/14/15/16/17", .handler = _handler},
+                                            {.p_filter = "a/b/c/d/e/f/g/h/i/j/k/l/m/n/o/p/q", .handler = _handler}};
+    mqtt_router_t tmp;
+
+    CHECK(!mqtt_router_init(&tmp, hash_not_last, 1));
+    CHECK(!mqtt_router_init(&tmp, wildcard_in_level, 1));
+    CHECK(!mqtt_router_init(&tmp, duplicate, 2));
+    CHECK(!mqtt_router_init(&tmp, no_handler, 1));
+    CHECK(!mqtt_router_init(&tmp, empty, 1));
+    CHECK(!mqtt_router_init(&tmp, too_large, 1));
+    CHECK(!mqtt_router_init(&tmp, too_many, 2));
+}
+
+static void _test_dispatch(void)
+{
+    const mqtt_router_route_t game_routes[] = {
+        {.p_filter = "WES/Uranus/games/+", .decode = mqtt_game_payload_decode, .decoded_size = sizeof(tictactoe_handler_t), .handler = _handler},
+    };
+    const char payload[] = "{\"indexX\": [0, 4], \"indexO\": [8], \"turn\": \"device\"}";
+
+    CHECK(mqtt_router_init(&router, game_routes, 1));
+
+    handled = 0;
+    CHECK(mqtt_router_dispatch(&router, "WES/Uranus/games/g1", STR_LEN("WES/Uranus/games/g1"), payload, STR_LEN(payload)) ==
+          MQTT_ROUTER_DISPATCHED);
+    CHECK(handled == 1);
+    CHECK(last_msg.wildcard_len == 2 && memcmp(last_msg.p_wildcard, "g1", 2) == 0);
+
+    CHECK(mqtt_router_dispatch(&router, "WES/Uranus/games/g1", STR_LEN("WES/Uranus/games/g1"), payload, STR_LEN(payload) - 1) ==
+          MQTT_ROUTER_REJECTED);
+    CHECK(mqtt_router_dispatch(&router, "WES/Uranus/game", STR_LEN("WES/Uranus/game"), payload, STR_LEN(payload)) == MQTT_ROUTER_NO_ROUTE);
+    CHECK(handled == 1);
+    CHECK(router.dispatched == 1 && router.rejected == 1 && router.no_route == 1);
+}
+
+static void _test_fragments(void)
+{
+    const mqtt_router_route_t game_routes[] = {
+        {.p_filter = "WES/Uranus/games/+", .decode = mqtt_game_payload_decode, .decoded_size = sizeof(tictactoe_handler_t), .handler = _handler},
+    };
+    const char topic[] = "WES/Uranus/games/g7";
+    const char payload[] = "{\"indexX\": [0, 4], \"indexO\": [8], \"turn\": \"device\", \"comment\": \"a rather long message\"}";
+    const size_t len = STR_LEN(payload);
+    char big[MQTT_ROUTER_PAYLOAD_SIZE + 8];
+
+    CHECK(mqtt_router_init(&router, game_routes, 1));
+    handled = 0;
+
+    /* Only the first fragment has the topic */
+    CHECK(mqtt_router_dispatch_fragment(&router, topic, STR_LEN(topic), payload, 10, 0, len) == MQTT_ROUTER_PENDING);
+    CHECK(mqtt_router_dispatch_fragment(&router, NULL, 0, &payload[10], 30, 10, len) == MQTT_ROUTER_PENDING);
+    CHECK(handled == 0);
+    CHECK(mqtt_router_dispatch_fragment(&router, NULL, 0, &payload[40], len - 40, 40, len) == MQTT_ROUTER_DISPATCHED);
+    CHECK(handled == 1);
+    CHECK(last_msg.data_len == len && memcmp(last_data, payload, len) == 0);
+    CHECK(last_msg.wildcard_len == 2 && memcmp(last_msg.p_wildcard, "g7", 2) == 0);
+
+    /* A message in one piece is dispatched as is */
+    CHECK(mqtt_router_dispatch_fragment(&router, topic, STR_LEN(topic), payload, len, 0, len) == MQTT_ROUTER_DISPATCHED);
+    CHECK(handled == 2 && last_msg.p_data == payload);
+
+    /* A gap drops the message, the next one is received again */
+    CHECK(mqtt_router_dispatch_fragment(&router, topic, STR_LEN(topic), payload, 10, 0, len) == MQTT_ROUTER_PENDING);
+    CHECK(mqtt_router_dispatch_fragment(&router, NULL, 0, &payload[20], len - 20, 20, len) == MQTT_ROUTER_DROPPED);
+    CHECK(mqtt_router_dispatch_fragment(&router, NULL, 0, &payload[10], len - 10, 10, len) == MQTT_ROUTER_DROPPED);
+    CHECK(mqtt_router_dispatch_fragment(&router, topic, STR_LEN(topic), payload, 10, 0, len) == MQTT_ROUTER_PENDING);
+    CHECK(mqtt_router_dispatch_fragment(&router, NULL, 0, &payload[10], len - 10, 10, len) == MQTT_ROUTER_DISPATCHED);
+    CHECK(handled == 3);
+
+    /* A fragment longer than the announced total is dropped, not copied past it */
+    CHECK(mqtt_router_dispatch_fragment(&router, topic, STR_LEN(topic), payload, 10, 0, 20) == MQTT_ROUTER_PENDING);
+    CHECK(mqtt_router_dispatch_fragment(&router, NULL, 0, &payload[10], 20, 10, 20) == MQTT_ROUTER_DROPPED);
+
+    /* Too large for the reassembly buffer: every fragment is dropped */
+    memset(big, ' ', sizeof(big));
+    CHECK(mqtt_router_dispatch_fragment(&router, topic, STR_LEN(topic), big, 100, 0, sizeof(big)) == MQTT_ROUTER_DROPPED);
+    CHECK(mqtt_router_dispatch_fragment(&router, NULL, 0, &big[100], sizeof(big) - 100, 100, sizeof(big)) == MQTT_ROUTER_DROPPED);
+    CHECK(handled == 3);
+
+    /* The reassembled payload is still validated */
+    CHECK(mqtt_router_dispatch_fragment(&router, topic, STR_LEN(topic), payload, 10, 0, len - 1) == MQTT_ROUTER_PENDING);
+    CHECK(mqtt_router_dispatch_fragment(&router, NULL, 0, &payload[10], len - 11, 10, len - 1) == MQTT_ROUTER_REJECTED);
+    CHECK(handled == 3);
+}
+
+static void _test_payload(void)
+{
+    tictactoe_handler_t board;
+    const char ok[] = " {\"turn\":\"server\",\"score\":-1.5e3,\"flag\":true,\"extra\":[1,{\"a\":null}],\"indexX\":[],\"indexO\":[2,5]} ";
+    const char nul_in_number[] = "{\"indexX\":[],\"indexO\":[],\"turn\":\"device\",\"n\":1\0}";
+    const char nul_as_value[] = "{\"indexX\":[],\"indexO\":[],\"turn\":\"device\",\"n\":\0}";
+
+    CHECK(mqtt_game_payload_decode(ok, STR_LEN(ok), &board));
+    CHECK(board.turn == SERVER);
+    CHECK(board.index_of_O[2] == 1 && board.index_of_O[5] == 1 && board.index_of_O[0] == 0);
+
+    /* A NUL byte is neither a delimiter nor part of a literal */
+    CHECK(!mqtt_game_payload_decode(nul_in_number, STR_LEN(nul_in_number), &board));
+    CHECK(!mqtt_game_payload_decode(nul_as_value, STR_LEN(nul_as_value), &board));
+
+    CHECK(!mqtt_game_payload_decode("{\"indexX\":[9],\"indexO\":[],\"turn\":\"device\"}", 42, &board));
+    CHECK(!mqtt_game_payload_decode("{\"indexX\":[1],\"indexO\":[],\"turn\":\"device\"} x", 44, &board));
+    CHECK(!mqtt_game_payload_decode("{\"indexX\":[1],\"indexO\":[],\"turn\":\"nobody\"}", 42, &board));
+    CHECK(!mqtt_game_payload_decode("{\"indexX\":[1],\"indexO\":[]}", 27, &board));
+    CHECK(!mqtt_game_payload_decode("{\"indexX\":[1],\"indexX\":[2],\"indexO\":[],\"turn\":\"device\"}", 55, &board));
+}
+
+static const char *_match(const char *p_topic, const char **pp_wildcard, size_t *p_wildcard_len)
+{
+    mqtt_router_msg_t msg;
+    const mqtt_router_route_t *p_route = mqtt_router_match(&router, p_topic, strlen(p_topic), &msg);
+
+    *pp_wildcard = msg.p_wildcard;
+    *p_wildcard_len = msg.wildcard_len;
+    return p_route != NULL ? p_route->p_filter : NULL;
+}
+
+static void _handler(const mqtt_router_msg_t *p_msg, const void *p_decoded)
+{
+    (void)p_decoded;
+    last_msg = *p_msg;
+    if (p_msg->data_len <= sizeof(last_data))
+    {
+        memcpy(last_data, p_msg->p_data, p_msg->data_len);
+    }
+    handled++;
+}
+
+static bool _decode_ok(const char *p_data, size_t data_len, void *p_decoded)
+{
+    (void)p_data;
+    (void)data_len;
+    (void)p_decoded;
+    return true;
+}
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
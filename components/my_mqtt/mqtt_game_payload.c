@@ -0,0 +1,276 @@
+/**
+ * @file mqtt_game_payload.c
+ *
+ * @brief This file decodes incoming game payloads. It only understands the
+ * small JSON subset the game uses, so malformed messages are rejected after a
+ * single pass over the receive buffer instead of building a cJSON tree.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include "mqtt_game_payload.h"
+#include <string.h>
+#include "tictactoe_game.h"
+
+//---------------------------------- MACROS -----------------------------------
+#define MAX_SKIP_DEPTH (4U)
+
+#define KEY_IS(p_key, key_len, literal) ((key_len) == sizeof(literal) - 1 && memcmp((p_key), (literal), (key_len)) == 0)
+
+//-------------------------------- DATA TYPES ---------------------------------
+typedef struct
+{
+    const char *p_pos;
+    const char *p_end;
+} reader_t;
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+static void _skip_ws(reader_t *p_reader);
+static bool _consume(reader_t *p_reader, char c);
+static bool _read_string(reader_t *p_reader, const char **pp_str, size_t *p_len);
+static bool _read_index_array(reader_t *p_reader, int *p_indexes);
+static bool _skip_value(reader_t *p_reader, unsigned depth);
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+bool mqtt_game_payload_decode(const char *p_data, size_t data_len, void *p_decoded)
+{
+    tictactoe_handler_t *p_game = p_decoded;
+    reader_t reader = {.p_pos = p_data, .p_end = p_data + data_len};
+    bool has_x = false;
+    bool has_o = false;
+    bool has_turn = false;
+
+    memset(p_game, 0, sizeof(*p_game));
+
+    if (!_consume(&reader, '{'))
+    {
+        return false;
+    }
+
+    if (!_consume(&reader, '}'))
+    {
+        do
+        {
+            const char *p_key;
+            size_t key_len;
+
+            if (!_read_string(&reader, &p_key, &key_len) || !_consume(&reader, ':'))
+            {
+                return false;
+            }
+
+            if (KEY_IS(p_key, key_len, "indexX"))
+            {
+                if (has_x || !_read_index_array(&reader, p_game->index_of_X))
+                {
+                    return false;
+                }
+                has_x = true;
+            }
+            else if (KEY_IS(p_key, key_len, "indexO"))
+            {
+                if (has_o || !_read_index_array(&reader, p_game->index_of_O))
+                {
+                    return false;
+                }
+                has_o = true;
+            }
+            else if (KEY_IS(p_key, key_len, "turn"))
+            {
+                const char *p_turn;
+                size_t turn_len;
+                if (has_turn || !_read_string(&reader, &p_turn, &turn_len))
+                {
+                    return false;
+                }
+                if (KEY_IS(p_turn, turn_len, "server"))
+                {
+                    p_game->turn = SERVER;
+                }
+                else if (KEY_IS(p_turn, turn_len, "device"))
+                {
+                    p_game->turn = DEVICE;
+                }
+                else
+                {
+                    return false;
+                }
+                has_turn = true;
+            }
+            else if (!_skip_value(&reader, 0))
+            {
+                return false;
+            }
+        } while (_consume(&reader, ','));
+
+        if (!_consume(&reader, '}'))
+        {
+            return false;
+        }
+    }
+
+    _skip_ws(&reader);
+    return has_x && has_o && has_turn && reader.p_pos == reader.p_end;
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+static void _skip_ws(reader_t *p_reader)
+{
+    while (p_reader->p_pos < p_reader->p_end &&
+           (*p_reader->p_pos == ' ' || *p_reader->p_pos == '\t' || *p_reader->p_pos == '\n' || *p_reader->p_pos == '\r'))
+    {
+        p_reader->p_pos++;
+    }
+}
+
+static bool _consume(reader_t *p_reader, char c)
+{
+    _skip_ws(p_reader);
+    if (p_reader->p_pos < p_reader->p_end && *p_reader->p_pos == c)
+    {
+        p_reader->p_pos++;
+        return true;
+    }
+    return false;
+}
+
+static bool _read_string(reader_t *p_reader, const char **pp_str, size_t *p_len)
+{
+    if (!_consume(p_reader, '"'))
+    {
+        return false;
+    }
+
+    const char *p_start = p_reader->p_pos;
+    while (p_reader->p_pos < p_reader->p_end && *p_reader->p_pos != '"')
+    {
+        /* The game never sends escapes, a backslash means a payload we do not care about. */
+        if (*p_reader->p_pos == '\\' || (unsigned char)*p_reader->p_pos < 0x20)
+        {
+            return false;
+        }
+        p_reader->p_pos++;
+    }
+    if (p_reader->p_pos == p_reader->p_end)
+    {
+        return false;
+    }
+
+    *pp_str = p_start;
+    *p_len = (size_t)(p_reader->p_pos - p_start);
+    p_reader->p_pos++;
+    return true;
+}
+
+static bool _read_index_array(reader_t *p_reader, int *p_indexes)
+{
+    int count = 0;
+
+    if (!_consume(p_reader, '['))
+    {
+        return false;
+    }
+    if (_consume(p_reader, ']'))
+    {
+        return true;
+    }
+
+    do
+    {
+        _skip_ws(p_reader);
+        if (p_reader->p_pos >= p_reader->p_end || *p_reader->p_pos < '0' || *p_reader->p_pos >= '0' + MAX_SYMBOLS_ON_FIELD)
+        {
+            return false;
+        }
+        int index = *p_reader->p_pos++ - '0';
+        /* Single digit only, "10" or "1.5" are out of the board anyway. */
+        if (p_reader->p_pos < p_reader->p_end && ((*p_reader->p_pos >= '0' && *p_reader->p_pos <= '9') || *p_reader->p_pos == '.'))
+        {
+            return false;
+        }
+        if (++count > MAX_SYMBOLS_ON_FIELD)
+        {
+            return false;
+        }
+        p_indexes[index] = 1;
+    } while (_consume(p_reader, ','));
+
+    return _consume(p_reader, ']');
+}
+
+static bool _skip_value(reader_t *p_reader, unsigned depth)
+{
+    const char *p_str;
+    size_t len;
+
+    if (depth > MAX_SKIP_DEPTH)
+    {
+        return false;
+    }
+
+    _skip_ws(p_reader);
+    if (p_reader->p_pos >= p_reader->p_end)
+    {
+        return false;
+    }
+
+    switch (*p_reader->p_pos)
+    {
+    case '"':
+        return _read_string(p_reader, &p_str, &len);
+
+    case '[':
+        p_reader->p_pos++;
+        if (_consume(p_reader, ']'))
+        {
+            return true;
+        }
+        do
+        {
+            if (!_skip_value(p_reader, depth + 1))
+            {
+                return false;
+            }
+        } while (_consume(p_reader, ','));
+        return _consume(p_reader, ']');
+
+    case '{':
+        p_reader->p_pos++;
+        if (_consume(p_reader, '}'))
+        {
+            return true;
+        }
+        do
+        {
+            if (!_read_string(p_reader, &p_str, &len) || !_consume(p_reader, ':') || !_skip_value(p_reader, depth + 1))
+            {
+                return false;
+            }
+        } while (_consume(p_reader, ','));
+        return _consume(p_reader, '}');
+
+    default:
+    {
+        /* Numbers and literals: anything up to the next delimiter. strchr() also finds the terminating NUL,
+         * so a NUL byte has to be caught before it is taken for a delimiter or a valid character. */
+        const char *p_start = p_reader->p_pos;
+        while (p_reader->p_pos < p_reader->p_end && (*p_reader->p_pos == '\0' || strchr(",]} \t\r\n", *p_reader->p_pos) == NULL))
+        {
+            if (*p_reader->p_pos == '\0' || strchr("0123456789+-.eEtruefalsn", *p_reader->p_pos) == NULL)
+            {
+                return false;
+            }
+            p_reader->p_pos++;
+        }
+        return p_reader->p_pos != p_start;
+    }
+    }
+}
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
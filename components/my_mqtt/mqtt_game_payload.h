@@ -0,0 +1,43 @@
+/**
+ * @file mqtt_game_payload.h
+ *
+ * @brief See the source file.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+#ifndef __MQTT_GAME_PAYLOAD_H__
+#define __MQTT_GAME_PAYLOAD_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <stdbool.h>
+#include <stddef.h>
+
+//---------------------------------- MACROS -----------------------------------
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PUBLIC FUNCTION PROTOTYPES --------------------------
+/**
+ * @brief The function decodes a game payload ({"indexX": [..], "indexO": [..], "turn": "device"|"server"})
+ *        straight from the receive buffer, without allocating. Unknown keys are skipped.
+ *        Matches mqtt_router_decode_cb_t.
+ *
+ * @param [in]  p_data    Payload, does not have to be NUL terminated.
+ * @param [in]  data_len  Payload length.
+ * @param [out] p_decoded tictactoe_handler_t to fill.
+ *
+ * @return bool true if the payload matches the schema and all cell indexes are in 0..8.
+ */
+bool mqtt_game_payload_decode(const char *p_data, size_t data_len, void *p_decoded);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __MQTT_GAME_PAYLOAD_H__
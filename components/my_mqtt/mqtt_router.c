@@ -0,0 +1,320 @@
+/**
+ * @file mqtt_router.c
+ *
+ * @brief This file routes incoming MQTT messages to typed handlers. The route
+ * filters are compiled into a trie of topic levels once at init, so matching a
+ * topic costs one short compare per level instead of one compare per route.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include "mqtt_router.h"
+#include <string.h>
+
+//---------------------------------- MACROS -----------------------------------
+#define NO_NODE  (-1)
+#define NO_ROUTE (-1)
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+static int _node_new(mqtt_router_t *p_router, const char *p_level, size_t level_len);
+static bool _insert(mqtt_router_t *p_router, int route_index);
+static int _match(const mqtt_router_t *p_router, int node, const char *p_topic, size_t topic_len, size_t pos, unsigned depth,
+                  mqtt_router_msg_t *p_msg);
+static size_t _level_end(const char *p_topic, size_t topic_len, size_t pos);
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+bool mqtt_router_init(mqtt_router_t *p_router, const mqtt_router_route_t *p_routes, size_t route_count)
+{
+    memset(p_router, 0, sizeof(*p_router));
+    p_router->p_routes = p_routes;
+    p_router->route_count = route_count;
+
+    /* Root node */
+    if (_node_new(p_router, NULL, 0) != 0)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < route_count; i++)
+    {
+        if (p_routes[i].handler == NULL || p_routes[i].decoded_size > MQTT_ROUTER_DECODED_SIZE || !_insert(p_router, (int)i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+const mqtt_router_route_t *mqtt_router_match(const mqtt_router_t *p_router, const char *p_topic, size_t topic_len, mqtt_router_msg_t *p_msg)
+{
+    mqtt_router_msg_t msg;
+    if (p_msg == NULL)
+    {
+        p_msg = &msg;
+    }
+    p_msg->p_wildcard = NULL;
+    p_msg->wildcard_len = 0;
+
+    if (p_router->node_count == 0)
+    {
+        return NULL;
+    }
+
+    int route = _match(p_router, 0, p_topic, topic_len, 0, 0, p_msg);
+    return route == NO_ROUTE ? NULL : &p_router->p_routes[route];
+}
+
+mqtt_router_result_t mqtt_router_dispatch(mqtt_router_t *p_router, const char *p_topic, size_t topic_len, const char *p_data, size_t data_len)
+{
+    mqtt_router_msg_t msg;
+    const mqtt_router_route_t *p_route = mqtt_router_match(p_router, p_topic, topic_len, &msg);
+    if (p_route == NULL)
+    {
+        p_router->no_route++;
+        return MQTT_ROUTER_NO_ROUTE;
+    }
+
+    msg.p_topic = p_topic;
+    msg.topic_len = topic_len;
+    msg.p_data = p_data;
+    msg.data_len = data_len;
+
+    uint64_t decoded[MQTT_ROUTER_DECODED_SIZE / sizeof(uint64_t)];
+    if (p_route->decode != NULL && !p_route->decode(p_data, data_len, decoded))
+    {
+        p_router->rejected++;
+        return MQTT_ROUTER_REJECTED;
+    }
+
+    p_route->handler(&msg, p_route->decode != NULL ? decoded : NULL);
+    p_router->dispatched++;
+    return MQTT_ROUTER_DISPATCHED;
+}
+
+mqtt_router_result_t mqtt_router_dispatch_fragment(mqtt_router_t *p_router, const char *p_topic, size_t topic_len, const char *p_data,
+                                                   size_t data_len, size_t offset, size_t total_len)
+{
+    if (offset == 0 && data_len == total_len)
+    {
+        p_router->total_len = 0;
+        return mqtt_router_dispatch(p_router, p_topic, topic_len, p_data, data_len);
+    }
+
+    if (offset == 0)
+    {
+        p_router->total_len = 0;
+        if (topic_len > MQTT_ROUTER_TOPIC_SIZE || total_len > MQTT_ROUTER_PAYLOAD_SIZE)
+        {
+            p_router->dropped++;
+            return MQTT_ROUTER_DROPPED;
+        }
+        memcpy(p_router->topic, p_topic, topic_len);
+        p_router->topic_len = topic_len;
+        p_router->received = 0;
+        p_router->total_len = total_len;
+    }
+
+    /* Continuation of a dropped message, or a fragment of an other one */
+    if (p_router->total_len == 0 || offset != p_router->received || data_len > p_router->total_len - offset)
+    {
+        p_router->total_len = 0;
+        p_router->dropped++;
+        return MQTT_ROUTER_DROPPED;
+    }
+
+    memcpy(&p_router->payload[offset], p_data, data_len);
+    p_router->received += data_len;
+    if (p_router->received < p_router->total_len)
+    {
+        return MQTT_ROUTER_PENDING;
+    }
+
+    p_router->total_len = 0;
+    return mqtt_router_dispatch(p_router, p_router->topic, p_router->topic_len, p_router->payload, p_router->received);
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+static int _node_new(mqtt_router_t *p_router, const char *p_level, size_t level_len)
+{
+    if (p_router->node_count >= MQTT_ROUTER_MAX_NODES || level_len > UINT8_MAX)
+    {
+        return NO_NODE;
+    }
+
+    int index = p_router->node_count++;
+    mqtt_router_node_t *p_node = &p_router->nodes[index];
+    p_node->p_level = p_level;
+    p_node->level_len = (uint8_t)level_len;
+    p_node->first_child = NO_NODE;
+    p_node->next_sibling = NO_NODE;
+    p_node->plus_child = NO_NODE;
+    p_node->hash_child = NO_NODE;
+    p_node->route = NO_ROUTE;
+    return index;
+}
+
+static bool _insert(mqtt_router_t *p_router, int route_index)
+{
+    const char *p_filter = p_router->p_routes[route_index].p_filter;
+    size_t filter_len = p_filter != NULL ? strlen(p_filter) : 0;
+    size_t pos = 0;
+    int node = 0;
+
+    if (filter_len == 0)
+    {
+        return false;
+    }
+
+    while (pos <= filter_len)
+    {
+        size_t end = _level_end(p_filter, filter_len, pos);
+        const char *p_level = &p_filter[pos];
+        size_t level_len = end - pos;
+        mqtt_router_node_t *p_parent = &p_router->nodes[node];
+        int child;
+
+        if (level_len == 1 && p_level[0] == '#')
+        {
+            /* '#' has to be the last level */
+            if (end != filter_len)
+            {
+                return false;
+            }
+            if (p_parent->hash_child == NO_NODE)
+            {
+                p_parent->hash_child = (int8_t)_node_new(p_router, p_level, level_len);
+            }
+            child = p_router->nodes[node].hash_child;
+        }
+        else if (level_len == 1 && p_level[0] == '+')
+        {
+            if (p_parent->plus_child == NO_NODE)
+            {
+                p_parent->plus_child = (int8_t)_node_new(p_router, p_level, level_len);
+            }
+            child = p_router->nodes[node].plus_child;
+        }
+        else
+        {
+            if (memchr(p_level, '+', level_len) != NULL || memchr(p_level, '#', level_len) != NULL)
+            {
+                return false;
+            }
+
+            child = p_parent->first_child;
+            while (child != NO_NODE && !(p_router->nodes[child].level_len == level_len &&
+                                         memcmp(p_router->nodes[child].p_level, p_level, level_len) == 0))
+            {
+                child = p_router->nodes[child].next_sibling;
+            }
+            if (child == NO_NODE)
+            {
+                child = _node_new(p_router, p_level, level_len);
+                if (child != NO_NODE)
+                {
+                    p_router->nodes[child].next_sibling = p_router->nodes[node].first_child;
+                    p_router->nodes[node].first_child = (int8_t)child;
+                }
+            }
+        }
+
+        if (child == NO_NODE)
+        {
+            return false;
+        }
+        node = child;
+        pos = end + 1;
+    }
+
+    if (p_router->nodes[node].route != NO_ROUTE)
+    {
+        return false;
+    }
+    p_router->nodes[node].route = (int8_t)route_index;
+    return true;
+}
+
+static int _match(const mqtt_router_t *p_router, int node, const char *p_topic, size_t topic_len, size_t pos, unsigned depth,
+                  mqtt_router_msg_t *p_msg)
+{
+    const mqtt_router_node_t *p_node = &p_router->nodes[node];
+
+    if (pos > topic_len)
+    {
+        /* All levels consumed. "a/#" also matches "a". */
+        if (p_node->route != NO_ROUTE)
+        {
+            return p_node->route;
+        }
+        if (p_node->hash_child != NO_NODE && p_router->nodes[p_node->hash_child].route != NO_ROUTE)
+        {
+            p_msg->p_wildcard = &p_topic[topic_len];
+            p_msg->wildcard_len = 0;
+            return p_router->nodes[p_node->hash_child].route;
+        }
+        return NO_ROUTE;
+    }
+
+    if (depth >= MQTT_ROUTER_MAX_DEPTH)
+    {
+        return NO_ROUTE;
+    }
+
+    size_t end = _level_end(p_topic, topic_len, pos);
+    const char *p_level = &p_topic[pos];
+    size_t level_len = end - pos;
+
+    for (int child = p_node->first_child; child != NO_NODE; child = p_router->nodes[child].next_sibling)
+    {
+        const mqtt_router_node_t *p_child = &p_router->nodes[child];
+        if (p_child->level_len == level_len && memcmp(p_child->p_level, p_level, level_len) == 0)
+        {
+            int route = _match(p_router, child, p_topic, topic_len, end + 1, depth + 1, p_msg);
+            if (route != NO_ROUTE)
+            {
+                return route;
+            }
+            break;
+        }
+    }
+
+    if (p_node->plus_child != NO_NODE)
+    {
+        int route = _match(p_router, p_node->plus_child, p_topic, topic_len, end + 1, depth + 1, p_msg);
+        if (route != NO_ROUTE)
+        {
+            /* Deeper wildcards were recorded first, keep the last one. */
+            if (p_msg->p_wildcard == NULL)
+            {
+                p_msg->p_wildcard = p_level;
+                p_msg->wildcard_len = level_len;
+            }
+            return route;
+        }
+    }
+
+    if (p_node->hash_child != NO_NODE && p_router->nodes[p_node->hash_child].route != NO_ROUTE)
+    {
+        p_msg->p_wildcard = p_level;
+        p_msg->wildcard_len = topic_len - pos;
+        return p_router->nodes[p_node->hash_child].route;
+    }
+
+    return NO_ROUTE;
+}
+
+static size_t _level_end(const char *p_topic, size_t topic_len, size_t pos)
+{
+    const char *p_slash = memchr(&p_topic[pos], '/', topic_len - pos);
+    return p_slash != NULL ? (size_t)(p_slash - p_topic) : topic_len;
+}
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
@@ -0,0 +1,174 @@
+/**
+ * @file mqtt_router.h
+ *
+ * @brief See the source file.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+#ifndef __MQTT_ROUTER_H__
+#define __MQTT_ROUTER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//---------------------------------- MACROS -----------------------------------
+#define MQTT_ROUTER_MAX_NODES    (32U)
+#define MQTT_ROUTER_MAX_DEPTH    (8U)
+#define MQTT_ROUTER_DECODED_SIZE (128U)
+#define MQTT_ROUTER_TOPIC_SIZE   (64U)
+#define MQTT_ROUTER_PAYLOAD_SIZE (512U)
+
+//-------------------------------- DATA TYPES ---------------------------------
+/**
+ * @brief One received message. All pointers point into the MQTT client buffers, nothing is copied.
+ *
+ */
+typedef struct
+{
+    const char *p_topic;
+    size_t topic_len;
+    const char *p_data;
+    size_t data_len;
+    const char *p_wildcard; /**< Topic part matched by the last '+' or '#' of the filter. */
+    size_t wildcard_len;
+} mqtt_router_msg_t;
+
+/**
+ * @brief Decodes and validates a payload into the route's typed message. Runs before the handler,
+ *        so malformed payloads are rejected without any work in the handler.
+ *
+ * @return true if the payload matches the schema.
+ */
+typedef bool (*mqtt_router_decode_cb_t)(const char *p_data, size_t data_len, void *p_decoded);
+
+/**
+ * @brief Handles a decoded message. @p p_decoded points to the type the route's decoder fills.
+ *
+ */
+typedef void (*mqtt_router_handler_cb_t)(const mqtt_router_msg_t *p_msg, const void *p_decoded);
+
+/**
+ * @brief One topic filter and the callbacks serving it.
+ *
+ */
+typedef struct
+{
+    const char *p_filter;            /**< Topic filter, may contain '+' levels and a trailing '#'. */
+    mqtt_router_decode_cb_t decode;  /**< Optional, the handler gets NULL if not set. */
+    size_t decoded_size;             /**< Size of the decoded type, at most MQTT_ROUTER_DECODED_SIZE. */
+    mqtt_router_handler_cb_t handler;
+} mqtt_router_route_t;
+
+/**
+ * @brief Enums hold the outcome of dispatching one message.
+ *
+ */
+typedef enum
+{
+    MQTT_ROUTER_DISPATCHED,
+    MQTT_ROUTER_NO_ROUTE,
+    MQTT_ROUTER_REJECTED, /**< The decoder rejected the payload. */
+    MQTT_ROUTER_PENDING,  /**< The fragment was stored, the rest of the message has not arrived yet. */
+    MQTT_ROUTER_DROPPED,  /**< The message does not fit the reassembly buffer or the fragment is out of order. */
+} mqtt_router_result_t;
+
+/**
+ * @brief Trie node, one per topic level of the route filters.
+ *
+ */
+typedef struct
+{
+    const char *p_level;
+    uint8_t level_len;
+    int8_t first_child;
+    int8_t next_sibling;
+    int8_t plus_child;
+    int8_t hash_child;
+    int8_t route;
+} mqtt_router_node_t;
+
+typedef struct
+{
+    const mqtt_router_route_t *p_routes;
+    size_t route_count;
+    mqtt_router_node_t nodes[MQTT_ROUTER_MAX_NODES];
+    uint8_t node_count;
+    char topic[MQTT_ROUTER_TOPIC_SIZE];     /**< Topic of the fragmented message being reassembled. */
+    size_t topic_len;
+    char payload[MQTT_ROUTER_PAYLOAD_SIZE]; /**< Fragments received so far. */
+    size_t received;
+    size_t total_len;                       /**< Length of the whole message, 0 if none is being reassembled. */
+    uint32_t dispatched;
+    uint32_t no_route;
+    uint32_t rejected;
+    uint32_t dropped;
+} mqtt_router_t;
+
+//---------------------- PUBLIC FUNCTION PROTOTYPES --------------------------
+/**
+ * @brief The function builds the dispatch trie. @p p_routes must stay valid while the router is used.
+ *
+ * @param [out] p_router    Router to build.
+ * @param [in]  p_routes    Route table.
+ * @param [in]  route_count Number of routes.
+ *
+ * @return bool true on success, false if a filter is invalid or the trie does not fit.
+ */
+bool mqtt_router_init(mqtt_router_t *p_router, const mqtt_router_route_t *p_routes, size_t route_count);
+
+/**
+ * @brief The function finds the route of a topic. Exact levels win over '+', '+' wins over '#'.
+ *
+ * @param [in]  p_router       Router.
+ * @param [in]  p_topic        Topic, does not have to be NUL terminated.
+ * @param [in]  topic_len      Topic length.
+ * @param [out] p_msg          Optional, wildcard part of the topic is stored here.
+ *
+ * @return const mqtt_router_route_t* Matching route, NULL if none.
+ */
+const mqtt_router_route_t *mqtt_router_match(const mqtt_router_t *p_router, const char *p_topic, size_t topic_len, mqtt_router_msg_t *p_msg);
+
+/**
+ * @brief The function matches a topic, decodes the payload and calls the route handler.
+ *
+ * @param [in,out] p_router  Router.
+ * @param [in]     p_topic   Topic, does not have to be NUL terminated.
+ * @param [in]     topic_len Topic length.
+ * @param [in]     p_data    Payload.
+ * @param [in]     data_len  Payload length.
+ *
+ * @return mqtt_router_result_t Outcome of the dispatch.
+ */
+mqtt_router_result_t mqtt_router_dispatch(mqtt_router_t *p_router, const char *p_topic, size_t topic_len, const char *p_data, size_t data_len);
+
+/**
+ * @brief The function dispatches one fragment of a message, as the MQTT client delivers messages larger than its
+ *        receive buffer. Fragments are copied until the message is complete, then it is dispatched as a whole.
+ *        A message that is not fragmented is dispatched from the client buffer without a copy.
+ *
+ * @param [in,out] p_router  Router.
+ * @param [in]     p_topic   Topic, only needed with the first fragment.
+ * @param [in]     topic_len Topic length.
+ * @param [in]     p_data    Fragment.
+ * @param [in]     data_len  Fragment length.
+ * @param [in]     offset    Offset of the fragment in the message.
+ * @param [in]     total_len Length of the whole message.
+ *
+ * @return mqtt_router_result_t Outcome of the dispatch, MQTT_ROUTER_PENDING until the last fragment.
+ */
+mqtt_router_result_t mqtt_router_dispatch_fragment(mqtt_router_t *p_router, const char *p_topic, size_t topic_len, const char *p_data,
+                                                   size_t data_len, size_t offset, size_t total_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __MQTT_ROUTER_H__
@@ -34,12 +34,20 @@
 #include "temp_hum_sensor.h"
 #include <math.h>
 #include "tictactoe.h"
+#include "tictactoe_session.h"
+#include "mqtt_router.h"
+#include "mqtt_game_payload.h"
 #include "led.h"
 
 //---------------------------------- MACROS -----------------------------------
 #define DELAY_TIME_MS (1000U)
 #define USE_PROPERTY_ARR_SIZE sizeof(user_property_arr) / sizeof(esp_mqtt5_user_property_item_t)
 
+#define GAME_TOPIC "WES/Uranus/game"
+/* Every game id published under this prefix gets its own session, the device referees and plays all of them. */
+#define SESSION_TOPIC_PREFIX     "WES/Uranus/games/"
+#define ROUTE_COUNT (sizeof(routes) / sizeof(routes[0]))
+
 //-------------------------------- DATA TYPES ---------------------------------
 
 //---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
@@ -54,11 +62,44 @@ static void mqtt5_app_start(void);
 static void mqtt_tictactoe_task(void *pvParameters);
 static void mqtt_temp_hum_task(void *pvParameters);
 
+/**
+ * @brief Forwards a board received on the single game topic to the tictactoe task.
+ *
+ * @param [in] p_msg     Received message.
+ * @param [in] p_decoded Decoded tictactoe_handler_t.
+ */
+static void _handle_game_message(const mqtt_router_msg_t *p_msg, const void *p_decoded);
+
+/**
+ * @brief Referees a board received on a session topic and publishes the device move.
+ *
+ * @param [in] p_msg     Received message, the wildcard part of the topic is the game id.
+ * @param [in] p_decoded Decoded tictactoe_handler_t.
+ */
+static void _handle_session_message(const mqtt_router_msg_t *p_msg, const void *p_decoded);
+
 //------------------------- STATIC DATA & CONSTANTS ---------------------------
+static const mqtt_router_route_t routes[] = {
+    {
+        .p_filter = GAME_TOPIC,
+        .decode = mqtt_game_payload_decode,
+        .decoded_size = sizeof(tictactoe_handler_t),
+        .handler = _handle_game_message,
+    },
+    {
+        .p_filter = SESSION_TOPIC_PREFIX "+",
+        .decode = mqtt_game_payload_decode,
+        .decoded_size = sizeof(tictactoe_handler_t),
+        .handler = _handle_session_message,
+    },
+};
 
 //------------------------------- GLOBAL DATA ---------------------------------
 esp_mqtt_client_handle_t client;
 int is_mqtt_connected_to_broker = false;
+/* Only touched from the MQTT event handler, no locking needed. */
+static tictactoe_session_table_t session_table;
+static mqtt_router_t router;
 extern QueueHandle_t p_tictactoe_queue_send;
 extern QueueHandle_t p_tictactoe_queue_rec;
 extern QueueHandle_t temperature_change_queue;
@@ -66,6 +107,13 @@ extern QueueHandle_t temperature_change_queue;
 //------------------------------ PUBLIC FUNCTIONS -----------------------------
 esp_err_t my_mqtt_init()
 {
+    tictactoe_session_table_init(&session_table);
+    if (!mqtt_router_init(&router, routes, ROUTE_COUNT))
+    {
+        ESP_LOGE(TAG, "Invalid MQTT route table");
+        return ESP_FAIL;
+    }
+
     // Start MQTT tasks for Tic-Tac-Toe and Temperature/Humidity
     xTaskCreate(mqtt_tictactoe_task, "MQTT_TicTacToe_Task", 2048, NULL, 10, NULL);
     xTaskCreate(mqtt_temp_hum_task, "MQTT_TempHum_Task", 4096, NULL, 10, NULL);
@@ -172,6 +220,73 @@ static char *create_json_payload_game(tictactoe_handler_t *game_data)
     return formatted_json;
 }
 
+static void _handle_game_message(const mqtt_router_msg_t *p_msg, const void *p_decoded)
+{
+    const tictactoe_handler_t *p_game_state = p_decoded;
+
+    printf("Data: Topic=%.*s, Data=%.*s\n", (int)p_msg->topic_len, p_msg->p_topic, (int)p_msg->data_len, p_msg->p_data);
+
+    if (p_game_state->turn == DEVICE)
+    {
+        ESP_LOGI(TAG, "MQTT_EVENT_DATA from EARTH Received");
+        if ((xQueueSend(p_tictactoe_queue_rec, p_game_state, 0U) != pdPASS))
+        {
+            ESP_LOGE(TAG, "Failed to send to tictactoe queue");
+        }
+    }
+}
+
+static void _handle_session_message(const mqtt_router_msg_t *p_msg, const void *p_decoded)
+{
+    const tictactoe_handler_t *p_board = p_decoded;
+    const char *p_id = p_msg->p_wildcard;
+    int id_len = (int)p_msg->wildcard_len;
+
+    /* Our own replies come back with turn "server", only the opponent's boards are refereed. */
+    if (p_board->turn != DEVICE)
+    {
+        return;
+    }
+
+    tictactoe_session_t *p_session = tictactoe_session_get(&session_table, p_id, (size_t)id_len, true);
+    if (p_session == NULL)
+    {
+        ESP_LOGE(TAG, "Invalid game id %.*s", id_len, p_id);
+        return;
+    }
+
+    tictactoe_bitboard_t incoming;
+    tictactoe_session_result_t result;
+    tictactoe_board_to_masks(p_board, &incoming.x, &incoming.o);
+    tictactoe_session_handle(p_session, incoming, &result);
+
+    if (result.verdict == TICTACTOE_VERDICT_ILLEGAL)
+    {
+        ESP_LOGW(TAG, "Illegal move in game %.*s", id_len, p_id);
+        return;
+    }
+
+    if (result.reply)
+    {
+        char topic[sizeof(SESSION_TOPIC_PREFIX) + TICTACTOE_SESSION_ID_LEN];
+        tictactoe_handler_t reply;
+
+        tictactoe_masks_to_board(result.board.x, result.board.o, SERVER, &reply);
+        snprintf(topic, sizeof(topic), SESSION_TOPIC_PREFIX "%.*s", id_len, p_id);
+        char *json_payload = create_json_payload_game(&reply);
+        if (json_payload != NULL)
+        {
+            esp_mqtt_client_publish(client, topic, json_payload, 0, 0, 0);
+            free(json_payload);
+        }
+    }
+
+    if (result.verdict != TICTACTOE_VERDICT_IN_PROGRESS)
+    {
+        ESP_LOGI(TAG, "Game %.*s finished, verdict %d, %" PRIu32 " active sessions", id_len, p_id, result.verdict, session_table.active);
+    }
+}
+
 //---------------------------- EVENT HANDLERS -----------------------------
 
 /*
@@ -189,16 +304,17 @@ static void mqtt5_event_handler(void *handler_args, esp_event_base_t base, int32
     ESP_LOGD(TAG, "Event dispatched from event loop base=%s, event_id=%" PRIi32 "", base, event_id);
     esp_mqtt_event_handle_t event = event_data;
     client = event->client;
-    char topic[20];
-    char data[2500];
 
     switch ((esp_mqtt_event_id_t)event_id)
     {
 
     case MQTT_EVENT_CONNECTED:
         ESP_LOGI(TAG, "MQTT_EVENT_CONNECTED");
-        esp_mqtt_client_subscribe(client, "WES/Uranus/game", 0);
-        ESP_LOGI(TAG, "Subscribed to topic WES/Uranus/game !");
+        for (size_t i = 0; i < ROUTE_COUNT; i++)
+        {
+            esp_mqtt_client_subscribe(client, routes[i].p_filter, 0);
+            ESP_LOGI(TAG, "Subscribed to topic %s !", routes[i].p_filter);
+        }
         is_mqtt_connected_to_broker = true;
         break;
 
@@ -218,95 +334,29 @@ static void mqtt5_event_handler(void *handler_args, esp_event_base_t base, int32
         break;
 
     case MQTT_EVENT_DATA:
-
-        printf("Data: Topic=%.*s, Data=%.*s\n", event->topic_len, event->topic, event->data_len, event->data);
-
-        // Parse the JSON payload from the received data
-        cJSON *root = cJSON_ParseWithLength(event->data, event->data_len);
-        if (root == NULL)
+        /* Messages larger than the client buffer arrive in several events, only the first one has the topic. */
+        switch (mqtt_router_dispatch_fragment(&router, event->topic, (size_t)event->topic_len, event->data, (size_t)event->data_len,
+                                              (size_t)event->current_data_offset, (size_t)event->total_data_len))
         {
-            const char *error_ptr = cJSON_GetErrorPtr();
-            if (error_ptr != NULL)
+        case MQTT_ROUTER_REJECTED:
+            if (event->current_data_offset == 0)
             {
-                fprintf(stderr, "Error before: %s\n", error_ptr);
+                ESP_LOGE(TAG, "Malformed payload on %.*s", event->topic_len, event->topic);
             }
-            ESP_LOGE(TAG, "Failed to parse JSON");
-        }
-        else
-        {
-            cJSON *turn = cJSON_GetObjectItemCaseSensitive(root, "turn");
-            if (strcmp(turn->valuestring, "server") == 0)
-                break;
-
-            cJSON *indexX = cJSON_GetObjectItemCaseSensitive(root, "indexX");
-            cJSON *indexO = cJSON_GetObjectItemCaseSensitive(root, "indexO");
-
-            if (cJSON_IsArray(indexX) && cJSON_IsArray(indexO) && cJSON_IsString(turn))
+            else
             {
-                printf("Turn: %s\n", turn->valuestring);
-
-                // Initialize a tictactoe_handler_t structure to be sent to the queue
-                tictactoe_handler_t game_state;
-                memset(&game_state, 0, sizeof(game_state)); // Zero out the structure
-
-                // Assign turn based on received data
-                if (strcmp(turn->valuestring, "device") == 0)
-                {
-                    game_state.turn = DEVICE;
-                }
-                else if (strcmp(turn->valuestring, "server") == 0)
-                {
-                    game_state.turn = SERVER;
-                }
-
-                // Fill indexX array
-                // printf("IndexX: ");
-                int count = cJSON_GetArraySize(indexX);
-                count = count > 9 ? 9 : count; // Ensure not to overflow the array
-                for (int i = 0; i < count; i++)
-                {
-                    cJSON *ix = cJSON_GetArrayItem(indexX, i);
-                    if (cJSON_IsNumber(ix))
-                    {
-                        game_state.index_of_X[ix->valueint] = 1;
-                        // printf("%d ", ix->valueint);
-                    }
-                }
-                // printf("\n");
-
-                // Fill indexO array
-                // printf("IndexO: ");
-                count = cJSON_GetArraySize(indexO);
-                count = count > 9 ? 9 : count; // Ensure not to overflow the array
-                for (int i = 0; i < count; i++)
-                {
-                    cJSON *io = cJSON_GetArrayItem(indexO, i);
-                    if (cJSON_IsNumber(io))
-                    {
-                        game_state.index_of_O[io->valueint] = 1;
-                        // printf("%d ", io->valueint);
-                    }
-                }
-                // printf("\n");
-                //  printf("%d", game_state.turn);
-                //  printf("\n");
-                //  Send the game state to the queue
-                if (game_state.turn == DEVICE)
-                {
-                    ESP_LOGI(TAG, "MQTT_EVENT_DATA from EARTH Received");
-                    if ((xQueueSend(p_tictactoe_queue_rec, &game_state, 0U) != pdPASS))
-                    {
-                        ESP_LOGE(TAG, "Failed to send to tictactoe queue");
-                    }
-                }
+                ESP_LOGE(TAG, "Malformed payload on %.*s", (int)router.topic_len, router.topic);
             }
-            else
+            break;
+        case MQTT_ROUTER_DROPPED:
+            if (event->current_data_offset == 0)
             {
-                ESP_LOGE(TAG, "JSON does not contain the expected structure or types");
+                ESP_LOGW(TAG, "Dropping %d byte message on %.*s, it does not fit the reassembly buffer", event->total_data_len,
+                         event->topic_len, event->topic);
             }
-
-            // Free the JSON object
-            cJSON_Delete(root);
+            break;
+        default:
+            break;
         }
         break;
 
@@ -348,7 +398,7 @@ static void mqtt_tictactoe_task(void *pvParameters)
             char *json_payload = create_json_payload_game(&tictactoe_msg);
             if (json_payload != NULL)
             {
-                esp_mqtt_client_publish(client, "WES/Uranus/game", json_payload, 0, 1, 0);
+                esp_mqtt_client_publish(client, GAME_TOPIC, json_payload, 0, 1, 0);
                 free(json_payload);
             }
             else
@@ -0,0 +1,288 @@
+/**
+ * @file tictactoe_replay.c
+ *
+ * @brief Host harness for the tictactoe game logic. It replays event logs
+ * dumped with tictactoe_dump_events() (the firmware prints them at the end of
+ * every game) and soak-tests the game with randomly interleaved device/server
+ * events.
+ *
+ * Build on the host from components/tictactoe:
+ *   gcc -O2 -I. host/tictactoe_replay.c tictactoe_game.c tictactoe_rec.c -o tictactoe_replay
+ *
+ * Usage:
+ *   tictactoe_replay <log>               replay a console log (TTTREC lines)
+ *   tictactoe_replay --soak <games> [seed]
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "tictactoe_game.h"
+#include "tictactoe_rec.h"
+
+//---------------------------------- MACROS -----------------------------------
+#define LINE_LEN     (256U)
+#define SOAK_CHUNK   (4096U)
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+static int _replay_file(const char *p_path);
+static int _soak(uint32_t games, uint32_t seed);
+static void _print_stats(const tictactoe_replay_stats_t *p_stats);
+static uint32_t _rand(void);
+static int _random_cell(uint16_t taken);
+static double _now_s(void);
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+static uint32_t rand_state = 1;
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+int main(int argc, char **argv)
+{
+   if (argc >= 3 && strcmp(argv[1], "--soak") == 0)
+   {
+      uint32_t games = (uint32_t)strtoul(argv[2], NULL, 0);
+      uint32_t seed = argc >= 4 ? (uint32_t)strtoul(argv[3], NULL, 0) : 1;
+      return _soak(games, seed);
+   }
+   if (argc == 2)
+   {
+      return _replay_file(argv[1]);
+   }
+
+   fprintf(stderr, "usage: %s <log> | --soak <games> [seed]\n", argv[0]);
+   return 2;
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+static int _replay_file(const char *p_path)
+{
+   FILE *p_file = fopen(p_path, "r");
+   if (p_file == NULL)
+   {
+      perror(p_path);
+      return 2;
+   }
+
+   size_t capacity = SOAK_CHUNK;
+   size_t count = 0;
+   tictactoe_event_t *p_events = malloc(capacity * sizeof(*p_events));
+   char line[LINE_LEN];
+
+   while (p_events != NULL && fgets(line, sizeof(line), p_file) != NULL)
+   {
+      if (count == capacity)
+      {
+         capacity *= 2;
+         tictactoe_event_t *p_grown = realloc(p_events, capacity * sizeof(*p_events));
+         if (p_grown == NULL)
+         {
+            free(p_events);
+            p_events = NULL;
+            break;
+         }
+         p_events = p_grown;
+      }
+      if (tictactoe_rec_parse_line(line, &p_events[count]))
+      {
+         count++;
+      }
+   }
+   fclose(p_file);
+
+   if (p_events == NULL)
+   {
+      fprintf(stderr, "out of memory\n");
+      return 2;
+   }
+
+   tictactoe_replay_stats_t stats;
+   tictactoe_gamestate_t state = tictactoe_game_replay(p_events, count, &stats);
+   if (count > 0)
+   {
+      printf("span: %.3f s\n", (double)(p_events[count - 1].timestamp_us - p_events[0].timestamp_us) / 1e6);
+   }
+   printf("final state: %d\n", state);
+   _print_stats(&stats);
+   free(p_events);
+
+   return stats.violations == 0 ? 0 : 1;
+}
+
+/* Plays random games the way the two device tasks would see them: GUI presses and server boards
+ * arrive in any order, including server boards that land after the game was already reset. Every
+ * event stream is played live, then replayed; both runs must agree. */
+static int _soak(uint32_t games, uint32_t seed)
+{
+   tictactoe_event_t *p_events = malloc(SOAK_CHUNK * sizeof(*p_events));
+   tictactoe_replay_stats_t total = {0};
+   uint32_t mismatches = 0;
+   double replay_time = 0;
+   double start = _now_s();
+
+   if (p_events == NULL)
+   {
+      fprintf(stderr, "out of memory\n");
+      return 2;
+   }
+   rand_state = seed != 0 ? seed : 1;
+
+   uint32_t played = 0;
+   while (played < games)
+   {
+      tictactoe_game_t game;
+      tictactoe_game_result_t result;
+      size_t count = 0;
+      uint32_t chunk_games = 0;
+      uint32_t chunk_ended = 0;
+
+      tictactoe_game_init(&game);
+      while (played + chunk_games < games && count + 32 < SOAK_CHUNK)
+      {
+         tictactoe_handler_t server_view = {0};
+         tictactoe_event_t event = {0};
+         int finished = 0;
+
+         event.type = (_rand() & 1) ? TICTACTOE_EVENT_DEVICE_FIRST : TICTACTOE_EVENT_SERVER_FIRST;
+         chunk_games++;
+
+         while (!finished && count + 4 < SOAK_CHUNK)
+         {
+            event.timestamp_us = (int64_t)count * 1000;
+            p_events[count++] = event;
+            tictactoe_game_apply(&game, &event, &result);
+            if (result.publish)
+            {
+               server_view = result.published;
+            }
+            if (result.state != IN_PROGRESS)
+            {
+               finished = 1;
+               chunk_ended++;
+               /* A late server board racing the reset must be dropped by the game. */
+               if ((_rand() & 3) == 0)
+               {
+                  event.type = TICTACTOE_EVENT_SERVER_MOVE;
+                  event.timestamp_us = (int64_t)count * 1000;
+                  p_events[count++] = event;
+                  tictactoe_game_apply(&game, &event, &result);
+               }
+               break;
+            }
+
+            if (game.board.turn == SERVER && (_rand() % 4) != 0)
+            {
+               uint16_t x_mask;
+               uint16_t o_mask;
+               tictactoe_board_to_masks(&server_view, &x_mask, &o_mask);
+               int cell = _random_cell(x_mask | o_mask);
+               if (cell < 0)
+               {
+                  finished = 1;
+                  break;
+               }
+               if (game.player_x == SERVER)
+               {
+                  x_mask |= TICTACTOE_CELL_MASK(cell);
+               }
+               else
+               {
+                  o_mask |= TICTACTOE_CELL_MASK(cell);
+               }
+               event.type = TICTACTOE_EVENT_SERVER_MOVE;
+               event.arg = 0;
+               event.x_mask = x_mask;
+               event.o_mask = o_mask;
+            }
+            else
+            {
+               /* Presses can come at any time, also while the server is thinking. */
+               event.type = TICTACTOE_EVENT_CELL;
+               event.arg = (uint8_t)(_rand() % MAX_SYMBOLS_ON_FIELD);
+               event.x_mask = 0;
+               event.o_mask = 0;
+            }
+         }
+      }
+      played += chunk_games;
+
+      tictactoe_replay_stats_t stats;
+      double replay_start = _now_s();
+      tictactoe_game_replay(p_events, count, &stats);
+      replay_time += _now_s() - replay_start;
+
+      if (stats.games != chunk_ended)
+      {
+         mismatches++;
+      }
+      total.events += stats.events;
+      total.ignored += stats.ignored;
+      total.games += stats.games;
+      total.wins += stats.wins;
+      total.losses += stats.losses;
+      total.draws += stats.draws;
+      total.violations += stats.violations;
+   }
+
+   double elapsed = _now_s() - start;
+   printf("games started: %" PRIu32 ", seed: %" PRIu32 "\n", played, seed);
+   _print_stats(&total);
+   printf("live/replay mismatches: %" PRIu32 "\n", mismatches);
+   printf("total time: %.3f s (%.0f games/min generated and replayed)\n", elapsed,
+          elapsed > 0 ? (double)total.games * 60.0 / elapsed : 0.0);
+   printf("replay time: %.3f s (%.0f games/min replay only)\n", replay_time,
+          replay_time > 0 ? (double)total.games * 60.0 / replay_time : 0.0);
+   free(p_events);
+
+   return (total.violations == 0 && mismatches == 0) ? 0 : 1;
+}
+
+static void _print_stats(const tictactoe_replay_stats_t *p_stats)
+{
+   printf("events: %" PRIu32 " (ignored %" PRIu32 ")\n", p_stats->events, p_stats->ignored);
+   printf("games: %" PRIu32 " (won %" PRIu32 ", lost %" PRIu32 ", draw %" PRIu32 ")\n", p_stats->games, p_stats->wins,
+          p_stats->losses, p_stats->draws);
+   printf("violations: %" PRIu32 "\n", p_stats->violations);
+}
+
+static uint32_t _rand(void)
+{
+   /* xorshift32, fixed seed keeps soak runs reproducible */
+   rand_state ^= rand_state << 13;
+   rand_state ^= rand_state >> 17;
+   rand_state ^= rand_state << 5;
+   return rand_state;
+}
+
+static int _random_cell(uint16_t taken)
+{
+   int free_cells[MAX_SYMBOLS_ON_FIELD];
+   int count = 0;
+
+   for (int i = 0; i < MAX_SYMBOLS_ON_FIELD; i++)
+   {
+      if (!(taken & TICTACTOE_CELL_MASK(i)))
+      {
+         free_cells[count++] = i;
+      }
+   }
+   return count > 0 ? free_cells[_rand() % (uint32_t)count] : -1;
+}
+
+static double _now_s(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
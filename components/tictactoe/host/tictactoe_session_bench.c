@@ -0,0 +1,164 @@
+/**
+ * @file tictactoe_session_bench.c
+ *
+ * @brief Host throughput benchmark for the multi-session tictactoe mode. It
+ * plays random opponents against the device logic on many game ids at once,
+ * interleaving their messages the way a wildcard subscription delivers them.
+ *
+ * Build on the host from components/tictactoe:
+ *   gcc -O2 -I. host/tictactoe_session_bench.c tictactoe_session.c -o tictactoe_session_bench
+ *
+ * Usage:
+ *   tictactoe_session_bench [sessions] [messages]
+ *
+ * More sessions than TICTACTOE_SESSION_ACTIVE_MAX exercise LRU eviction, rebuild
+ * with -DTICTACTOE_SESSION_MAX=<slots> to size the table.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "tictactoe_session.h"
+
+//---------------------------------- MACROS -----------------------------------
+#define DEFAULT_SESSIONS (150U)
+#define DEFAULT_MESSAGES (10000000U)
+
+//-------------------------------- DATA TYPES ---------------------------------
+/**
+ * @brief Opponent side of one game, as the remote player sees it.
+ *
+ */
+typedef struct
+{
+   char id[TICTACTOE_SESSION_ID_LEN];
+   size_t id_len;
+   tictactoe_bitboard_t board;
+   int opponent_is_x;
+} opponent_t;
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+static void _opponent_new_game(opponent_t *p_opponent);
+static void _opponent_move(opponent_t *p_opponent);
+static uint32_t _rand(void);
+static double _now_s(void);
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+static uint32_t rand_state = 1;
+static tictactoe_session_table_t table;
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+int main(int argc, char **argv)
+{
+   uint32_t session_count = argc >= 2 ? (uint32_t)strtoul(argv[1], NULL, 0) : DEFAULT_SESSIONS;
+   uint32_t messages = argc >= 3 ? (uint32_t)strtoul(argv[2], NULL, 0) : DEFAULT_MESSAGES;
+   uint32_t verdicts[TICTACTOE_VERDICT_DRAW + 1] = {0};
+   uint32_t lost_state = 0;
+
+   opponent_t *p_opponents = calloc(session_count, sizeof(*p_opponents));
+   if (p_opponents == NULL || session_count == 0)
+   {
+      fprintf(stderr, "invalid session count\n");
+      return 2;
+   }
+
+   tictactoe_session_table_init(&table);
+   for (uint32_t i = 0; i < session_count; i++)
+   {
+      p_opponents[i].id_len = (size_t)snprintf(p_opponents[i].id, sizeof(p_opponents[i].id), "game%" PRIu32, i);
+      _opponent_new_game(&p_opponents[i]);
+   }
+
+   double start = _now_s();
+   for (uint32_t n = 0; n < messages; n++)
+   {
+      opponent_t *p_opponent = &p_opponents[_rand() % session_count];
+      tictactoe_session_result_t result;
+
+      tictactoe_session_t *p_session = tictactoe_session_get(&table, p_opponent->id, p_opponent->id_len, true);
+      tictactoe_session_handle(p_session, p_opponent->board, &result);
+      verdicts[result.verdict]++;
+
+      if (result.verdict == TICTACTOE_VERDICT_ILLEGAL)
+      {
+         /* Only happens when the session was evicted mid-game. */
+         lost_state++;
+         tictactoe_session_remove(&table, p_session);
+         _opponent_new_game(p_opponent);
+      }
+      else if (result.verdict != TICTACTOE_VERDICT_IN_PROGRESS)
+      {
+         _opponent_new_game(p_opponent);
+      }
+      else
+      {
+         p_opponent->board = result.board;
+         _opponent_move(p_opponent);
+      }
+   }
+   double elapsed = _now_s() - start;
+
+   printf("sessions: %" PRIu32 " (table slots %u, active max %u)\n", session_count, TICTACTOE_SESSION_MAX,
+          TICTACTOE_SESSION_ACTIVE_MAX);
+   printf("messages: %" PRIu32 " in %.3f s, %.0f msg/s\n", messages, elapsed, elapsed > 0 ? messages / elapsed : 0.0);
+   printf("in progress %" PRIu32 ", X won %" PRIu32 ", O won %" PRIu32 ", draw %" PRIu32 ", illegal %" PRIu32 "\n",
+          verdicts[TICTACTOE_VERDICT_IN_PROGRESS], verdicts[TICTACTOE_VERDICT_X_WON], verdicts[TICTACTOE_VERDICT_O_WON],
+          verdicts[TICTACTOE_VERDICT_DRAW], verdicts[TICTACTOE_VERDICT_ILLEGAL]);
+   printf("evicted: %" PRIu32 ", games lost to eviction: %" PRIu32 "\n", table.evicted, lost_state);
+   free(p_opponents);
+
+   return 0;
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+static void _opponent_new_game(opponent_t *p_opponent)
+{
+   memset(&p_opponent->board, 0, sizeof(p_opponent->board));
+   p_opponent->opponent_is_x = (int)(_rand() & 1);
+   if (p_opponent->opponent_is_x)
+   {
+      p_opponent->board.x = (uint16_t)(1U << (_rand() % 9));
+   }
+}
+
+static void _opponent_move(opponent_t *p_opponent)
+{
+   uint16_t taken = p_opponent->board.x | p_opponent->board.o;
+   uint16_t *p_own = p_opponent->opponent_is_x ? &p_opponent->board.x : &p_opponent->board.o;
+   uint32_t start = _rand() % 9;
+
+   for (uint32_t i = 0; i < 9; i++)
+   {
+      uint32_t cell = (start + i) % 9;
+      if (!(taken & (1U << cell)))
+      {
+         *p_own |= (uint16_t)(1U << cell);
+         return;
+      }
+   }
+}
+
+static uint32_t _rand(void)
+{
+   rand_state ^= rand_state << 13;
+   rand_state ^= rand_state >> 17;
+   rand_state ^= rand_state << 5;
+   return rand_state;
+}
+
+static double _now_s(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
@@ -1,5 +1,5 @@
 /**
- * @file user_interface.c
+ * @file tictactoe.c
  *
  * @brief This file is responsible for complete user interface (LEDs, buttons
  * and GUI).
@@ -18,6 +18,9 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "tictactoe_rec.h"
 #include <stdio.h>
 #include <string.h>
 #include "esp_log.h"
@@ -34,34 +37,27 @@
  */
 static void _tictactoe_task(void *p_parameter);
 static void tictactoe_first_move_task(void *p_parameter);
-int check_winner(const int *indexes);
-int check_game_state(tictactoe_handler_t *game);
-void refresh_game_state();
+
+/**
+ * @brief The function records an event, applies it to the game and performs the resulting side effects.
+ *
+ * @param [in,out] p_event Event to apply, its timestamp is set here.
+ */
+static void _game_apply(tictactoe_event_t *p_event);
 
 //------------------------- STATIC DATA & CONSTANTS ---------------------------
 static TaskHandle_t p_tictactoe_task = NULL;
-static int game_reset_mode = 0;
+static SemaphoreHandle_t p_game_mutex = NULL;
 static const char *TAG = "tictactoe";
-const int winning_combinations[8][3] = {
-    {0, 1, 2}, {3, 4, 5}, {6, 7, 8}, // Horizontal
-    {0, 3, 6},
-    {1, 4, 7},
-    {2, 5, 8}, // Vertical
-    {0, 4, 8},
-    {2, 4, 6} // Diagonal
-};
 
 //------------------------------- GLOBAL DATA ---------------------------------
 QueueHandle_t p_tictactoe_queue_send = NULL;
 QueueHandle_t p_tictactoe_queue_rec = NULL;
-tictactoe_turn_t playerX = DEVICE;
 extern QueueHandle_t gui_queue;
 extern QueueHandle_t reset_queue;
-tictactoe_handler_t game;
-tictactoe_gamestate_t gamestate = IN_PROGRESS;
+static tictactoe_game_t game;
 
 //------------------------------ PUBLIC FUNCTIONS -----------------------------
-void reset_game();
 esp_err_t tictactoe_init(void)
 {
 
@@ -73,7 +69,14 @@ esp_err_t tictactoe_init(void)
       printf("User interface queue was not initialized successfully\n");
       return ESP_FAIL;
    }
-   memset(&game, 0, sizeof(game));
+   p_game_mutex = xSemaphoreCreateMutex();
+   if (p_game_mutex == NULL)
+   {
+      printf("Tictactoe game mutex was not initialized successfully\n");
+      return ESP_FAIL;
+   }
+   tictactoe_game_init(&game);
+   tictactoe_rec_clear();
    TaskHandle_t p_tictactoe_first_move_task = NULL;
    if (pdPASS != xTaskCreate(&tictactoe_first_move_task, "tictactoe_first_move_task", 2 * 1024, NULL, 5, &p_tictactoe_first_move_task))
    {
@@ -84,7 +87,16 @@ esp_err_t tictactoe_init(void)
    return ESP_OK;
 }
 
-static void tictactoe_first_move_task()
+void tictactoe_dump_events(void)
+{
+   xSemaphoreTake(p_game_mutex, portMAX_DELAY);
+   tictactoe_rec_dump(stdout);
+   /* Consecutive dumps in a console log add up to the full event stream without repeating events. */
+   tictactoe_rec_clear();
+   xSemaphoreGive(p_game_mutex);
+}
+
+static void tictactoe_first_move_task(void *p_parameter)
 {
    gui_app_event_t gui_event;
    for (;;)
@@ -93,49 +105,21 @@ static void tictactoe_first_move_task()
       {
          printf("ttt: recieved bttn press, %d\n", gui_event);
 
+         tictactoe_event_t event = {0};
          if (gui_event == GUI_APP_EVENT_ME_FIRST_BUTTON_PRESSED)
          {
-            playerX = SERVER;
-            game.index_of_O[1] = 1;
-            game.turn = SERVER;
-            game_reset_mode = 0;
-            crtaj_xo(1, "o");
+            event.type = TICTACTOE_EVENT_DEVICE_FIRST;
          }
          else if (gui_event == GUI_APP_EVENT_EARTHLING_FIRST_BUTTON_PRESSED)
          {
-            playerX = SERVER;
-            game.turn = SERVER;
-            game_reset_mode = 0;
+            event.type = TICTACTOE_EVENT_SERVER_FIRST;
          }
          else
          {
-            ESP_LOGI(TAG, "PLAYERX = %d", playerX);
-            if (playerX == DEVICE && game.index_of_X[gui_event] == 0 && game.turn == DEVICE)
-            {
-               game.index_of_X[gui_event] = 1;
-               crtaj_xo(gui_event, "x");
-               game.turn = SERVER;
-               xQueueSend(p_tictactoe_queue_send, &game, 0U);
-            }
-            else if (playerX == SERVER && game.index_of_O[gui_event] == 0 && game.turn == DEVICE)
-            {
-               game.index_of_O[gui_event] = 1;
-               crtaj_xo(gui_event, "o");
-               game.turn = SERVER;
-               xQueueSend(p_tictactoe_queue_send, &game, 0U);
-            }
-            refresh_game_state();
-            continue;
-         }
-         if (p_tictactoe_queue_send != NULL)
-         {
-            printf("ttt: sending struct to mqqt task: turn = %d\n", game.turn);
-            xQueueSend(p_tictactoe_queue_send, &game, 0U);
-         }
-         if (pdPASS != xTaskCreate(&_tictactoe_task, "tictactoe_task", 2 * 1024, NULL, 5, &p_tictactoe_task))
-         {
-            printf("TICTACTOE task was not initialized successfully\n");
+            event.type = TICTACTOE_EVENT_CELL;
+            event.arg = (uint8_t)gui_event;
          }
+         _game_apply(&event);
       }
    }
 }
@@ -149,115 +133,76 @@ static void _tictactoe_task(void *p_parameter)
    {
       tictactoe_handler_t tictactoe_event;
       /* Blockingly wait on an event. */
-      if ((p_tictactoe_queue_rec != NULL) && (xQueueReceive(p_tictactoe_queue_rec, &tictactoe_event, portMAX_DELAY) == pdTRUE) && game_reset_mode == 0)
+      if ((p_tictactoe_queue_rec != NULL) && (xQueueReceive(p_tictactoe_queue_rec, &tictactoe_event, portMAX_DELAY) == pdTRUE))
       {
          ESP_LOGI(TAG, "MQTT event received");
-         game.turn = DEVICE;
-         for (int i = 0; i < 9; i++)
-         {
-            printf("%d ", tictactoe_event.index_of_X[i]);
-            if (tictactoe_event.index_of_X[i] != 0 && game.index_of_X[i] == 0 && game.index_of_O[i] == 0)
-            {
-               game.index_of_X[i] = 1;
-
-               crtaj_xo(i, "x");
-            }
-         }
-         printf("\n");
-         for (int i = 0; i < 9; i++)
-         {
-            printf("%d ", tictactoe_event.index_of_O[i]);
-            if (tictactoe_event.index_of_O[i] != 0 && game.index_of_O[i] == 0 && game.index_of_O[i] == 0)
-            {
-               game.index_of_O[i] = 1;
-               crtaj_xo(i, "o");
-            }
-         }
-         refresh_game_state();
+         tictactoe_event_t event = {.type = TICTACTOE_EVENT_SERVER_MOVE};
+         tictactoe_board_to_masks(&tictactoe_event, &event.x_mask, &event.o_mask);
+         _game_apply(&event);
       }
    }
 }
 
-// Function to check if a player has won
-int check_winner(const int *indexes)
+static void _game_apply(tictactoe_event_t *p_event)
 {
-   for (int i = 0; i < 8; ++i)
-   {
-      int a = winning_combinations[i][0];
-      int b = winning_combinations[i][1];
-      int c = winning_combinations[i][2];
-      if (indexes[a] && indexes[b] && indexes[c])
-      {
-         return 1; // Player X wins
-      }
-   }
-   return 0; // No winner yet
-}
+   tictactoe_game_result_t result;
 
-// Function to check game state
-int check_game_state(tictactoe_handler_t *game)
-{
-   if (check_winner(game->index_of_X))
-   {
-      return playerX == DEVICE ? WIN : LOSS; // Player X wins
-   }
-   else if (check_winner(game->index_of_O))
-   {
-      return playerX == DEVICE ? LOSS : WIN; // Player O wins
-   }
+   /* Recording and applying under one lock keeps the log in the order the game saw the events. */
+   xSemaphoreTake(p_game_mutex, portMAX_DELAY);
+   p_event->timestamp_us = esp_timer_get_time();
+   tictactoe_rec_log(p_event);
+   tictactoe_game_apply(&game, p_event, &result);
+   xSemaphoreGive(p_game_mutex);
 
-   // Check for draw
-   int is_draw = 1;
-   for (int i = 0; i < 9; ++i)
+   for (int i = 0; i < MAX_SYMBOLS_ON_FIELD; i++)
    {
-      if (!game->index_of_X[i] && !game->index_of_O[i])
+      if (result.drawn_x & TICTACTOE_CELL_MASK(i))
       {
-         is_draw = 0; // There are still empty cells
-         break;
+         crtaj_xo(i, "x");
+      }
+      if (result.drawn_o & TICTACTOE_CELL_MASK(i))
+      {
+         crtaj_xo(i, "o");
       }
    }
-   if (is_draw)
+
+   if (result.publish && p_tictactoe_queue_send != NULL)
    {
-      return DRAW; // Draw
+      printf("ttt: sending struct to mqqt task: turn = %d\n", result.published.turn);
+      xQueueSend(p_tictactoe_queue_send, &result.published, 0U);
    }
 
-   // Game in progress
-   return IN_PROGRESS;
-}
-
-void refresh_game_state()
-{
-   int game_state = check_game_state(&game);
-   switch (game_state)
+   switch (result.state)
    {
    case WIN:
-      reset_game();
       ESP_LOGW(TAG, "WE WON");
-      xQueueSend(reset_queue, &game_state, 0U);
+      xQueueSend(reset_queue, &result.state, 0U);
       break;
    case LOSS:
-      reset_game();
       ESP_LOGW(TAG, "THE EARTHLINGS WON...");
-      xQueueSend(reset_queue, &game_state, 0U);
-
+      xQueueSend(reset_queue, &result.state, 0U);
       break;
    case DRAW:
-      reset_game();
       ESP_LOGW(TAG, "ILL GET YOU NEXT TIME");
-      xQueueSend(reset_queue, &game_state, 0U);
-
+      xQueueSend(reset_queue, &result.state, 0U);
       break;
    default:
       break;
    }
-}
 
-void reset_game()
-{
-   game_reset_mode = 1;
-   playerX = DEVICE;
-   memset(&game, 0, sizeof(game));
-   gamestate = IN_PROGRESS;
+   if (result.state == WIN || result.state == LOSS || result.state == DRAW)
+   {
+      /* Every finished game leaves its events on the console for host/tictactoe_replay. */
+      tictactoe_dump_events();
+   }
+
+   if (result.start_session && p_tictactoe_task == NULL)
+   {
+      if (pdPASS != xTaskCreate(&_tictactoe_task, "tictactoe_task", 2 * 1024, NULL, 5, &p_tictactoe_task))
+      {
+         printf("TICTACTOE task was not initialized successfully\n");
+      }
+   }
 }
 
 //---------------------------- INTERRUPT HANDLERS -----------------------------
\ No newline at end of file
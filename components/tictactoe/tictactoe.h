@@ -1,26 +1,19 @@
-#define TICTACTOE_QUEUE_SIZE (20U)
+#ifndef __TICTACTOE_H__
+#define __TICTACTOE_H__
 
-#define MAX_SYMBOLS_ON_FIELD 9
+#include "esp_err.h"
+#include "tictactoe_game.h"
 
-typedef enum
-{
-   DEVICE,
-   SERVER
-} tictactoe_turn_t;
+#define TICTACTOE_QUEUE_SIZE (20U)
 
-typedef enum
-{
-   WIN,
-   LOSS,
-   DRAW,
-   IN_PROGRESS
-} tictactoe_gamestate_t;
+esp_err_t tictactoe_init(void);
 
-typedef struct
-{
-   int index_of_X[MAX_SYMBOLS_ON_FIELD];
-   int index_of_O[MAX_SYMBOLS_ON_FIELD];
-   tictactoe_turn_t turn;
-} tictactoe_handler_t;
+/**
+ * @brief The function prints the recorded game events so they can be replayed on the host,
+ *        then clears the recorder. It is called at the end of every game. Save the serial
+ *        monitor output (e.g. idf.py monitor | tee game.log) and pass it to host/tictactoe_replay.
+ *
+ */
+void tictactoe_dump_events(void);
 
-esp_err_t tictactoe_init(void);
\ No newline at end of file
+#endif // __TICTACTOE_H__
\ No newline at end of file
@@ -0,0 +1,283 @@
+/**
+ * @file tictactoe_game.c
+ *
+ * @brief This file holds the tictactoe game rules. It does not depend on
+ * FreeRTOS, LVGL or MQTT so it can be replayed and soak-tested on the host.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include "tictactoe_game.h"
+#include <string.h>
+
+//---------------------------------- MACROS -----------------------------------
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+/**
+ * @brief The function checks if the given symbol holds a winning combination.
+ *
+ * @param [in] indexes Cells of one symbol.
+ *
+ * @return int 1 if there is a winner, 0 otherwise.
+ */
+static int _check_winner(const int *indexes);
+
+/**
+ * @brief The function resets a finished game and reports the final state.
+ *
+ * @param [in,out] p_game   Game to check.
+ * @param [out]    p_result Result to fill.
+ */
+static void _refresh_game_state(tictactoe_game_t *p_game, tictactoe_game_result_t *p_result);
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+static const int winning_combinations[8][3] = {
+    {0, 1, 2}, {3, 4, 5}, {6, 7, 8}, // Horizontal
+    {0, 3, 6},
+    {1, 4, 7},
+    {2, 5, 8}, // Vertical
+    {0, 4, 8},
+    {2, 4, 6} // Diagonal
+};
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+void tictactoe_game_init(tictactoe_game_t *p_game)
+{
+   memset(p_game, 0, sizeof(*p_game));
+   p_game->player_x = DEVICE;
+   p_game->reset_mode = 0;
+}
+
+void tictactoe_game_reset(tictactoe_game_t *p_game)
+{
+   p_game->reset_mode = 1;
+   p_game->player_x = DEVICE;
+   memset(&p_game->board, 0, sizeof(p_game->board));
+}
+
+tictactoe_gamestate_t tictactoe_game_check_state(const tictactoe_game_t *p_game)
+{
+   if (_check_winner(p_game->board.index_of_X))
+   {
+      return p_game->player_x == DEVICE ? WIN : LOSS; // Player X wins
+   }
+   else if (_check_winner(p_game->board.index_of_O))
+   {
+      return p_game->player_x == DEVICE ? LOSS : WIN; // Player O wins
+   }
+
+   // Check for draw
+   for (int i = 0; i < MAX_SYMBOLS_ON_FIELD; ++i)
+   {
+      if (!p_game->board.index_of_X[i] && !p_game->board.index_of_O[i])
+      {
+         return IN_PROGRESS; // There are still empty cells
+      }
+   }
+
+   return DRAW;
+}
+
+void tictactoe_game_apply(tictactoe_game_t *p_game, const tictactoe_event_t *p_event, tictactoe_game_result_t *p_result)
+{
+   tictactoe_handler_t *p_board = &p_game->board;
+
+   memset(p_result, 0, sizeof(*p_result));
+   p_result->state = IN_PROGRESS;
+
+   switch ((tictactoe_event_type_t)p_event->type)
+   {
+   case TICTACTOE_EVENT_DEVICE_FIRST:
+      p_game->player_x = SERVER;
+      p_board->index_of_O[1] = 1;
+      p_board->turn = SERVER;
+      p_game->reset_mode = 0;
+      p_result->drawn_o |= TICTACTOE_CELL_MASK(1);
+      p_result->publish = true;
+      p_result->start_session = true;
+      p_result->published = *p_board;
+      break;
+
+   case TICTACTOE_EVENT_SERVER_FIRST:
+      p_game->player_x = SERVER;
+      p_board->turn = SERVER;
+      p_game->reset_mode = 0;
+      p_result->publish = true;
+      p_result->start_session = true;
+      p_result->published = *p_board;
+      break;
+
+   case TICTACTOE_EVENT_CELL:
+   {
+      int cell = p_event->arg;
+      if (cell >= MAX_SYMBOLS_ON_FIELD)
+      {
+         p_result->ignored = true;
+         break;
+      }
+
+      if (p_board->index_of_X[cell] != 0 || p_board->index_of_O[cell] != 0 || p_board->turn != DEVICE)
+      {
+         p_result->ignored = true;
+      }
+      else if (p_game->player_x == DEVICE)
+      {
+         p_board->index_of_X[cell] = 1;
+         p_result->drawn_x |= TICTACTOE_CELL_MASK(cell);
+         p_board->turn = SERVER;
+         p_result->publish = true;
+         p_result->published = *p_board;
+      }
+      else
+      {
+         p_board->index_of_O[cell] = 1;
+         p_result->drawn_o |= TICTACTOE_CELL_MASK(cell);
+         p_board->turn = SERVER;
+         p_result->publish = true;
+         p_result->published = *p_board;
+      }
+      _refresh_game_state(p_game, p_result);
+      break;
+   }
+
+   case TICTACTOE_EVENT_SERVER_MOVE:
+      if (p_game->reset_mode != 0)
+      {
+         p_result->ignored = true;
+         break;
+      }
+
+      p_board->turn = DEVICE;
+      for (int i = 0; i < MAX_SYMBOLS_ON_FIELD; i++)
+      {
+         if ((p_event->x_mask & TICTACTOE_CELL_MASK(i)) && p_board->index_of_X[i] == 0 && p_board->index_of_O[i] == 0)
+         {
+            p_board->index_of_X[i] = 1;
+            p_result->drawn_x |= TICTACTOE_CELL_MASK(i);
+         }
+      }
+      for (int i = 0; i < MAX_SYMBOLS_ON_FIELD; i++)
+      {
+         if ((p_event->o_mask & TICTACTOE_CELL_MASK(i)) && p_board->index_of_X[i] == 0 && p_board->index_of_O[i] == 0)
+         {
+            p_board->index_of_O[i] = 1;
+            p_result->drawn_o |= TICTACTOE_CELL_MASK(i);
+         }
+      }
+      _refresh_game_state(p_game, p_result);
+      break;
+
+   default:
+      p_result->ignored = true;
+      break;
+   }
+}
+
+tictactoe_gamestate_t tictactoe_game_replay(const tictactoe_event_t *p_events, size_t count, tictactoe_replay_stats_t *p_stats)
+{
+   tictactoe_game_t game;
+   tictactoe_game_result_t result;
+
+   tictactoe_game_init(&game);
+   memset(p_stats, 0, sizeof(*p_stats));
+
+   for (size_t i = 0; i < count; i++)
+   {
+      tictactoe_game_apply(&game, &p_events[i], &result);
+      p_stats->events++;
+
+      if (result.ignored)
+      {
+         p_stats->ignored++;
+      }
+
+      uint16_t x_mask;
+      uint16_t o_mask;
+      tictactoe_board_to_masks(result.publish ? &result.published : &game.board, &x_mask, &o_mask);
+      if (x_mask & o_mask)
+      {
+         p_stats->violations++;
+      }
+
+      switch (result.state)
+      {
+      case WIN:
+         p_stats->wins++;
+         p_stats->games++;
+         break;
+      case LOSS:
+         p_stats->losses++;
+         p_stats->games++;
+         break;
+      case DRAW:
+         p_stats->draws++;
+         p_stats->games++;
+         break;
+      default:
+         break;
+      }
+   }
+
+   return tictactoe_game_check_state(&game);
+}
+
+void tictactoe_board_to_masks(const tictactoe_handler_t *p_board, uint16_t *p_x_mask, uint16_t *p_o_mask)
+{
+   *p_x_mask = 0;
+   *p_o_mask = 0;
+   for (int i = 0; i < MAX_SYMBOLS_ON_FIELD; i++)
+   {
+      if (p_board->index_of_X[i])
+      {
+         *p_x_mask |= TICTACTOE_CELL_MASK(i);
+      }
+      if (p_board->index_of_O[i])
+      {
+         *p_o_mask |= TICTACTOE_CELL_MASK(i);
+      }
+   }
+}
+
+void tictactoe_masks_to_board(uint16_t x_mask, uint16_t o_mask, tictactoe_turn_t turn, tictactoe_handler_t *p_board)
+{
+   for (int i = 0; i < MAX_SYMBOLS_ON_FIELD; i++)
+   {
+      p_board->index_of_X[i] = (x_mask & TICTACTOE_CELL_MASK(i)) ? 1 : 0;
+      p_board->index_of_O[i] = (o_mask & TICTACTOE_CELL_MASK(i)) ? 1 : 0;
+   }
+   p_board->turn = turn;
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+static int _check_winner(const int *indexes)
+{
+   for (int i = 0; i < 8; ++i)
+   {
+      int a = winning_combinations[i][0];
+      int b = winning_combinations[i][1];
+      int c = winning_combinations[i][2];
+      if (indexes[a] && indexes[b] && indexes[c])
+      {
+         return 1;
+      }
+   }
+   return 0;
+}
+
+static void _refresh_game_state(tictactoe_game_t *p_game, tictactoe_game_result_t *p_result)
+{
+   tictactoe_gamestate_t state = tictactoe_game_check_state(p_game);
+   if (state != IN_PROGRESS)
+   {
+      tictactoe_game_reset(p_game);
+      p_result->state = state;
+   }
+}
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
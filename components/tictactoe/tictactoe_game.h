@@ -0,0 +1,184 @@
+/**
+ * @file tictactoe_game.h
+ *
+ * @brief See the source file.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+#ifndef __TICTACTOE_GAME_H__
+#define __TICTACTOE_GAME_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//---------------------------------- MACROS -----------------------------------
+#define MAX_SYMBOLS_ON_FIELD 9
+
+#define TICTACTOE_CELL_MASK(cell) ((uint16_t)(1U << (cell)))
+
+//-------------------------------- DATA TYPES ---------------------------------
+typedef enum
+{
+   DEVICE,
+   SERVER
+} tictactoe_turn_t;
+
+typedef enum
+{
+   WIN,
+   LOSS,
+   DRAW,
+   IN_PROGRESS
+} tictactoe_gamestate_t;
+
+typedef struct
+{
+   int index_of_X[MAX_SYMBOLS_ON_FIELD];
+   int index_of_O[MAX_SYMBOLS_ON_FIELD];
+   tictactoe_turn_t turn;
+} tictactoe_handler_t;
+
+/**
+ * @brief Complete state of one game, owned by whoever drives the game logic.
+ *
+ */
+typedef struct
+{
+   tictactoe_handler_t board;
+   tictactoe_turn_t player_x;
+   int reset_mode;
+} tictactoe_game_t;
+
+/**
+ * @brief Enums hold every input that changes the game state.
+ *
+ */
+typedef enum
+{
+   TICTACTOE_EVENT_CELL,         /**< Local player selected a cell, arg is the cell index. */
+   TICTACTOE_EVENT_DEVICE_FIRST, /**< Local player chose to play first. */
+   TICTACTOE_EVENT_SERVER_FIRST, /**< Local player let the server play first. */
+   TICTACTOE_EVENT_SERVER_MOVE,  /**< Board received from the server, in x_mask/o_mask. */
+
+   TICTACTOE_EVENT_COUNT
+} tictactoe_event_type_t;
+
+/**
+ * @brief One recorded game event. Boards are stored as 9-bit cell masks.
+ *
+ */
+typedef struct
+{
+   int64_t timestamp_us;
+   uint8_t type;
+   uint8_t arg;
+   uint16_t x_mask;
+   uint16_t o_mask;
+} tictactoe_event_t;
+
+/**
+ * @brief Side effects the caller has to perform after an event was applied.
+ *
+ */
+typedef struct
+{
+   uint16_t drawn_x;              /**< Cells that got a new X. */
+   uint16_t drawn_o;              /**< Cells that got a new O. */
+   bool publish;                  /**< Send @ref published to the server. */
+   bool start_session;            /**< A new game started, server moves are expected. */
+   bool ignored;                  /**< Event was rejected (wrong turn, reset mode...). */
+   tictactoe_handler_t published; /**< Board snapshot to publish. */
+   tictactoe_gamestate_t state;   /**< Final state if the game ended (and was reset). */
+} tictactoe_game_result_t;
+
+/**
+ * @brief Statistics gathered while replaying an event log.
+ *
+ */
+typedef struct
+{
+   uint32_t events;
+   uint32_t ignored;
+   uint32_t games;
+   uint32_t wins;
+   uint32_t losses;
+   uint32_t draws;
+   uint32_t violations; /**< Events after which a cell held both X and O. */
+} tictactoe_replay_stats_t;
+
+//---------------------- PUBLIC FUNCTION PROTOTYPES --------------------------
+/**
+ * @brief The function puts the game into its power-on state.
+ *
+ * @param [out] p_game Game to reset.
+ */
+void tictactoe_game_init(tictactoe_game_t *p_game);
+
+/**
+ * @brief The function clears the board after a finished game and blocks server moves until a new game starts.
+ *
+ * @param [in,out] p_game Game to reset.
+ */
+void tictactoe_game_reset(tictactoe_game_t *p_game);
+
+/**
+ * @brief The function evaluates the board from the local player's point of view.
+ *
+ * @param [in] p_game Game to evaluate.
+ *
+ * @return tictactoe_gamestate_t WIN, LOSS, DRAW or IN_PROGRESS.
+ */
+tictactoe_gamestate_t tictactoe_game_check_state(const tictactoe_game_t *p_game);
+
+/**
+ * @brief The function applies one event to the game. It has no side effects besides changing @p p_game.
+ *
+ * @param [in,out] p_game   Game to update.
+ * @param [in]     p_event  Event to apply.
+ * @param [out]    p_result Actions the caller has to perform (drawing, publishing...).
+ */
+void tictactoe_game_apply(tictactoe_game_t *p_game, const tictactoe_event_t *p_event, tictactoe_game_result_t *p_result);
+
+/**
+ * @brief The function replays an event log from the power-on state as fast as possible.
+ *
+ * @param [in]  p_events Events to replay, oldest first.
+ * @param [in]  count    Number of events.
+ * @param [out] p_stats  Replay statistics.
+ *
+ * @return tictactoe_gamestate_t State of the game after the last event.
+ */
+tictactoe_gamestate_t tictactoe_game_replay(const tictactoe_event_t *p_events, size_t count, tictactoe_replay_stats_t *p_stats);
+
+/**
+ * @brief The function converts a board to cell masks.
+ *
+ * @param [in]  p_board  Board to convert.
+ * @param [out] p_x_mask Cells occupied by X.
+ * @param [out] p_o_mask Cells occupied by O.
+ */
+void tictactoe_board_to_masks(const tictactoe_handler_t *p_board, uint16_t *p_x_mask, uint16_t *p_o_mask);
+
+/**
+ * @brief The function converts cell masks to a board.
+ *
+ * @param [in]  x_mask  Cells occupied by X.
+ * @param [in]  o_mask  Cells occupied by O.
+ * @param [in]  turn    Player on turn.
+ * @param [out] p_board Board to fill.
+ */
+void tictactoe_masks_to_board(uint16_t x_mask, uint16_t o_mask, tictactoe_turn_t turn, tictactoe_handler_t *p_board);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TICTACTOE_GAME_H__
@@ -0,0 +1,106 @@
+/**
+ * @file tictactoe_rec.c
+ *
+ * @brief This file records every game event in a ring buffer so a game can be
+ * dumped over the console and replayed with tictactoe_game_replay().
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include "tictactoe_rec.h"
+#include <inttypes.h>
+#include <string.h>
+
+//---------------------------------- MACROS -----------------------------------
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+static tictactoe_event_t rec_events[TICTACTOE_REC_SIZE];
+static size_t rec_head = 0;
+static size_t rec_count = 0;
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+void tictactoe_rec_clear(void)
+{
+   rec_head = 0;
+   rec_count = 0;
+}
+
+void tictactoe_rec_log(const tictactoe_event_t *p_event)
+{
+   rec_events[rec_head] = *p_event;
+   rec_head = (rec_head + 1) % TICTACTOE_REC_SIZE;
+   if (rec_count < TICTACTOE_REC_SIZE)
+   {
+      rec_count++;
+   }
+}
+
+size_t tictactoe_rec_count(void)
+{
+   return rec_count;
+}
+
+size_t tictactoe_rec_read(tictactoe_event_t *p_events, size_t max)
+{
+   size_t count = rec_count < max ? rec_count : max;
+   size_t start = (rec_head + TICTACTOE_REC_SIZE - rec_count) % TICTACTOE_REC_SIZE;
+
+   for (size_t i = 0; i < count; i++)
+   {
+      p_events[i] = rec_events[(start + i) % TICTACTOE_REC_SIZE];
+   }
+   return count;
+}
+
+void tictactoe_rec_dump(FILE *p_stream)
+{
+   size_t start = (rec_head + TICTACTOE_REC_SIZE - rec_count) % TICTACTOE_REC_SIZE;
+
+   for (size_t i = 0; i < rec_count; i++)
+   {
+      const tictactoe_event_t *p_event = &rec_events[(start + i) % TICTACTOE_REC_SIZE];
+      fprintf(p_stream, TICTACTOE_REC_LINE_PREFIX ",%" PRId64 ",%u,%u,%03x,%03x\n", p_event->timestamp_us,
+              p_event->type, p_event->arg, p_event->x_mask, p_event->o_mask);
+   }
+}
+
+int tictactoe_rec_parse_line(const char *p_line, tictactoe_event_t *p_event)
+{
+   unsigned int type;
+   unsigned int arg;
+   unsigned int x_mask;
+   unsigned int o_mask;
+   int64_t timestamp_us;
+
+   const char *p_start = strstr(p_line, TICTACTOE_REC_LINE_PREFIX ",");
+   if (p_start == NULL)
+   {
+      return 0;
+   }
+
+   if (sscanf(p_start + sizeof(TICTACTOE_REC_LINE_PREFIX), "%" SCNd64 ",%u,%u,%x,%x", &timestamp_us, &type, &arg, &x_mask,
+              &o_mask) != 5 ||
+       type >= TICTACTOE_EVENT_COUNT)
+   {
+      return 0;
+   }
+
+   p_event->timestamp_us = timestamp_us;
+   p_event->type = (uint8_t)type;
+   p_event->arg = (uint8_t)arg;
+   p_event->x_mask = (uint16_t)x_mask;
+   p_event->o_mask = (uint16_t)o_mask;
+   return 1;
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
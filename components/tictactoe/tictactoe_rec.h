@@ -0,0 +1,83 @@
+/**
+ * @file tictactoe_rec.h
+ *
+ * @brief See the source file.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+#ifndef __TICTACTOE_REC_H__
+#define __TICTACTOE_REC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <stddef.h>
+#include <stdio.h>
+#include "tictactoe_game.h"
+
+//---------------------------------- MACROS -----------------------------------
+#define TICTACTOE_REC_SIZE (256U)
+
+/* One dumped event per line: prefix,timestamp_us,type,arg,x_mask,o_mask */
+#define TICTACTOE_REC_LINE_PREFIX "TTTREC"
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PUBLIC FUNCTION PROTOTYPES --------------------------
+/**
+ * @brief The function clears the recorder.
+ *
+ */
+void tictactoe_rec_clear(void);
+
+/**
+ * @brief The function appends an event, overwriting the oldest one when the recorder is full.
+ *        The caller has to serialize calls (the game lock is held while logging).
+ *
+ * @param [in] p_event Event to record.
+ */
+void tictactoe_rec_log(const tictactoe_event_t *p_event);
+
+/**
+ * @brief The function returns the number of recorded events.
+ *
+ * @return size_t Number of events, at most TICTACTOE_REC_SIZE.
+ */
+size_t tictactoe_rec_count(void);
+
+/**
+ * @brief The function copies recorded events, oldest first.
+ *
+ * @param [out] p_events Destination buffer.
+ * @param [in]  max      Capacity of the destination buffer.
+ *
+ * @return size_t Number of copied events.
+ */
+size_t tictactoe_rec_read(tictactoe_event_t *p_events, size_t max);
+
+/**
+ * @brief The function prints recorded events, one TICTACTOE_REC_LINE_PREFIX line each, oldest first.
+ *
+ * @param [in] p_stream Output stream (e.g. stdout).
+ */
+void tictactoe_rec_dump(FILE *p_stream);
+
+/**
+ * @brief The function parses one dumped line. Anything before the prefix (log tags, timestamps) is skipped.
+ *
+ * @param [in]  p_line  Line to parse.
+ * @param [out] p_event Parsed event.
+ *
+ * @return int 1 if the line contained an event, 0 otherwise.
+ */
+int tictactoe_rec_parse_line(const char *p_line, tictactoe_event_t *p_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TICTACTOE_REC_H__
@@ -0,0 +1,315 @@
+/**
+ * @file tictactoe_session.c
+ *
+ * @brief This file keeps the state of many concurrent tictactoe games, one
+ * session per game id, so the device can referee and play every game it sees
+ * on a wildcard subscription. Like tictactoe_game.c it builds on the host.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+#include "tictactoe_session.h"
+#include <string.h>
+
+//---------------------------------- MACROS -----------------------------------
+#define CELL_MASK(cell) ((uint16_t)(1U << (cell)))
+
+//-------------------------------- DATA TYPES ---------------------------------
+
+//---------------------- PRIVATE FUNCTION PROTOTYPES --------------------------
+static uint32_t _hash(const char *p_id, size_t id_len);
+static int _popcount(uint16_t mask);
+static int _has_line(uint16_t mask);
+static int _completing_cell(uint16_t own, uint16_t other);
+static void _new_game(tictactoe_session_t *p_session, tictactoe_bitboard_t board, bool device_is_x);
+static void _evict_lru(tictactoe_session_table_t *p_table);
+
+//------------------------- STATIC DATA & CONSTANTS ---------------------------
+static const uint16_t winning_masks[8] = {
+    0x007, 0x038, 0x1C0, // Horizontal
+    0x049, 0x092, 0x124, // Vertical
+    0x111, 0x054         // Diagonal
+};
+
+/* Preferred cells when there is nothing to win or block: center, corners, edges. */
+static const uint8_t move_order[9] = {4, 0, 2, 6, 8, 1, 3, 5, 7};
+
+//------------------------------- GLOBAL DATA ---------------------------------
+
+//------------------------------ PUBLIC FUNCTIONS -----------------------------
+void tictactoe_session_table_init(tictactoe_session_table_t *p_table)
+{
+   memset(p_table, 0, sizeof(*p_table));
+}
+
+tictactoe_session_t *tictactoe_session_get(tictactoe_session_table_t *p_table, const char *p_id, size_t id_len, bool create)
+{
+   if (id_len == 0 || id_len >= TICTACTOE_SESSION_ID_LEN)
+   {
+      return NULL;
+   }
+
+   uint32_t hash = _hash(p_id, id_len);
+   uint32_t slot = hash % TICTACTOE_SESSION_MAX;
+
+   for (;;)
+   {
+      tictactoe_session_t *p_session = &p_table->sessions[slot];
+      if (!p_session->in_use)
+      {
+         break;
+      }
+      if (p_session->hash == hash && p_session->id_len == id_len && memcmp(p_session->id, p_id, id_len) == 0)
+      {
+         p_session->last_used = ++p_table->clock;
+         return p_session;
+      }
+      slot = (slot + 1) % TICTACTOE_SESSION_MAX;
+   }
+
+   if (!create)
+   {
+      return NULL;
+   }
+
+   if (p_table->active >= TICTACTOE_SESSION_ACTIVE_MAX)
+   {
+      /* Eviction can shift entries, so probe again for a free slot. */
+      _evict_lru(p_table);
+      slot = hash % TICTACTOE_SESSION_MAX;
+      while (p_table->sessions[slot].in_use)
+      {
+         slot = (slot + 1) % TICTACTOE_SESSION_MAX;
+      }
+   }
+
+   tictactoe_session_t *p_session = &p_table->sessions[slot];
+   memset(p_session, 0, sizeof(*p_session));
+   p_session->in_use = 1;
+   p_session->hash = hash;
+   p_session->id_len = (uint8_t)id_len;
+   memcpy(p_session->id, p_id, id_len);
+   p_session->last_used = ++p_table->clock;
+   p_table->active++;
+
+   return p_session;
+}
+
+void tictactoe_session_remove(tictactoe_session_table_t *p_table, tictactoe_session_t *p_session)
+{
+   uint32_t hole = (uint32_t)(p_session - p_table->sessions);
+   uint32_t slot = hole;
+
+   p_table->sessions[hole].in_use = 0;
+   p_table->active--;
+
+   /* Backward shift deletion keeps probe chains intact without tombstones. */
+   for (;;)
+   {
+      slot = (slot + 1) % TICTACTOE_SESSION_MAX;
+      tictactoe_session_t *p_next = &p_table->sessions[slot];
+      if (!p_next->in_use)
+      {
+         return;
+      }
+
+      uint32_t home = p_next->hash % TICTACTOE_SESSION_MAX;
+      bool movable = (hole <= slot) ? (home <= hole || home > slot) : (home <= hole && home > slot);
+      if (movable)
+      {
+         p_table->sessions[hole] = *p_next;
+         p_next->in_use = 0;
+         hole = slot;
+      }
+   }
+}
+
+void tictactoe_session_handle(tictactoe_session_t *p_session, tictactoe_bitboard_t incoming, tictactoe_session_result_t *p_result)
+{
+   tictactoe_bitboard_t board = p_session->board;
+
+   memset(p_result, 0, sizeof(*p_result));
+   p_result->verdict = TICTACTOE_VERDICT_ILLEGAL;
+
+   if ((incoming.x & incoming.o) != 0 || ((incoming.x | incoming.o) & ~TICTACTOE_BITBOARD_FULL) != 0)
+   {
+      return;
+   }
+
+   if (incoming.x == 0 && incoming.o == 0)
+   {
+      /* Empty board: the opponent lets the device open as X. */
+      _new_game(p_session, incoming, true);
+   }
+   else if (p_session->finished || (board.x == 0 && board.o == 0))
+   {
+      if (_popcount(incoming.x) != 1 || incoming.o != 0)
+      {
+         return;
+      }
+      _new_game(p_session, incoming, false);
+   }
+   else
+   {
+      uint16_t own = p_session->device_is_x ? board.x : board.o;
+      uint16_t own_in = p_session->device_is_x ? incoming.x : incoming.o;
+      uint16_t other = p_session->device_is_x ? board.o : board.x;
+      uint16_t other_in = p_session->device_is_x ? incoming.o : incoming.x;
+
+      if (own_in != own || (other_in & other) != other || _popcount(other_in & ~other) != 1)
+      {
+         return;
+      }
+      p_session->board = incoming;
+   }
+
+   p_result->verdict = tictactoe_bitboard_verdict(p_session->board);
+   if (p_result->verdict != TICTACTOE_VERDICT_IN_PROGRESS)
+   {
+      p_session->finished = 1;
+      p_result->board = p_session->board;
+      return;
+   }
+
+   uint16_t *p_own = p_session->device_is_x ? &p_session->board.x : &p_session->board.o;
+   uint16_t other = p_session->device_is_x ? p_session->board.o : p_session->board.x;
+   int cell = tictactoe_bitboard_best_move(*p_own, other);
+   if (cell >= 0)
+   {
+      *p_own |= CELL_MASK(cell);
+      p_result->reply = true;
+   }
+
+   p_result->board = p_session->board;
+   p_result->verdict = tictactoe_bitboard_verdict(p_session->board);
+   if (p_result->verdict != TICTACTOE_VERDICT_IN_PROGRESS)
+   {
+      p_session->finished = 1;
+   }
+}
+
+tictactoe_verdict_t tictactoe_bitboard_verdict(tictactoe_bitboard_t board)
+{
+   if (_has_line(board.x))
+   {
+      return TICTACTOE_VERDICT_X_WON;
+   }
+   if (_has_line(board.o))
+   {
+      return TICTACTOE_VERDICT_O_WON;
+   }
+   if ((board.x | board.o) == TICTACTOE_BITBOARD_FULL)
+   {
+      return TICTACTOE_VERDICT_DRAW;
+   }
+   return TICTACTOE_VERDICT_IN_PROGRESS;
+}
+
+int tictactoe_bitboard_best_move(uint16_t own, uint16_t other)
+{
+   int cell = _completing_cell(own, other);
+   if (cell < 0)
+   {
+      cell = _completing_cell(other, own);
+   }
+   if (cell >= 0)
+   {
+      return cell;
+   }
+
+   for (size_t i = 0; i < sizeof(move_order); i++)
+   {
+      if (!((own | other) & CELL_MASK(move_order[i])))
+      {
+         return move_order[i];
+      }
+   }
+   return -1;
+}
+
+//---------------------------- PRIVATE FUNCTIONS ------------------------------
+static uint32_t _hash(const char *p_id, size_t id_len)
+{
+   /* FNV-1a */
+   uint32_t hash = 2166136261U;
+   for (size_t i = 0; i < id_len; i++)
+   {
+      hash ^= (uint8_t)p_id[i];
+      hash *= 16777619U;
+   }
+   return hash;
+}
+
+static int _popcount(uint16_t mask)
+{
+   int count = 0;
+   while (mask)
+   {
+      mask &= (uint16_t)(mask - 1);
+      count++;
+   }
+   return count;
+}
+
+static int _has_line(uint16_t mask)
+{
+   for (int i = 0; i < 8; i++)
+   {
+      if ((mask & winning_masks[i]) == winning_masks[i])
+      {
+         return 1;
+      }
+   }
+   return 0;
+}
+
+static int _completing_cell(uint16_t own, uint16_t other)
+{
+   for (int i = 0; i < 8; i++)
+   {
+      uint16_t missing = winning_masks[i] & ~own;
+      /* Exactly one cell of the line is missing and it is free. */
+      if (missing != 0 && (missing & (missing - 1)) == 0 && !(missing & other))
+      {
+         for (int cell = 0; cell < 9; cell++)
+         {
+            if (missing == CELL_MASK(cell))
+            {
+               return cell;
+            }
+         }
+      }
+   }
+   return -1;
+}
+
+static void _new_game(tictactoe_session_t *p_session, tictactoe_bitboard_t board, bool device_is_x)
+{
+   p_session->board = board;
+   p_session->device_is_x = device_is_x ? 1 : 0;
+   p_session->finished = 0;
+}
+
+static void _evict_lru(tictactoe_session_table_t *p_table)
+{
+   tictactoe_session_t *p_oldest = NULL;
+
+   for (uint32_t i = 0; i < TICTACTOE_SESSION_MAX; i++)
+   {
+      tictactoe_session_t *p_session = &p_table->sessions[i];
+      if (p_session->in_use && (p_oldest == NULL || p_session->last_used < p_oldest->last_used))
+      {
+         p_oldest = p_session;
+      }
+   }
+
+   if (p_oldest != NULL)
+   {
+      tictactoe_session_remove(p_table, p_oldest);
+      p_table->evicted++;
+   }
+}
+
+//---------------------------- INTERRUPT HANDLERS -----------------------------
@@ -0,0 +1,158 @@
+/**
+ * @file tictactoe_session.h
+ *
+ * @brief See the source file.
+ *
+ * COPYRIGHT NOTICE: (c) 2024 Byte Lab Grupa d.o.o.
+ * All rights reserved.
+ */
+
+#ifndef __TICTACTOE_SESSION_H__
+#define __TICTACTOE_SESSION_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//--------------------------------- INCLUDES ----------------------------------
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//---------------------------------- MACROS -----------------------------------
+/* Number of hash slots. At most 3/4 of them are used, the least recently used session is evicted after that. */
+#ifndef TICTACTOE_SESSION_MAX
+#define TICTACTOE_SESSION_MAX (256U)
+#endif
+
+#define TICTACTOE_SESSION_ID_LEN  (24U)
+#define TICTACTOE_SESSION_ACTIVE_MAX ((TICTACTOE_SESSION_MAX * 3U) / 4U)
+
+#define TICTACTOE_BITBOARD_FULL (0x1FFU)
+
+//-------------------------------- DATA TYPES ---------------------------------
+/**
+ * @brief Board stored as two 9-bit cell masks, bit n is cell n.
+ *
+ */
+typedef struct
+{
+   uint16_t x;
+   uint16_t o;
+} tictactoe_bitboard_t;
+
+/**
+ * @brief Enums hold the outcome of refereeing one incoming board.
+ *
+ */
+typedef enum
+{
+   TICTACTOE_VERDICT_IN_PROGRESS,
+   TICTACTOE_VERDICT_ILLEGAL, /**< Board is not reachable with one opponent move, session is unchanged. */
+   TICTACTOE_VERDICT_X_WON,
+   TICTACTOE_VERDICT_O_WON,
+   TICTACTOE_VERDICT_DRAW
+} tictactoe_verdict_t;
+
+/**
+ * @brief Compact per-game state.
+ *
+ */
+typedef struct
+{
+   uint32_t hash;
+   uint32_t last_used;
+   tictactoe_bitboard_t board;
+   uint8_t in_use;
+   uint8_t device_is_x; /**< Device plays X in this game, decided by the first board. */
+   uint8_t finished;
+   uint8_t id_len;
+   char id[TICTACTOE_SESSION_ID_LEN];
+} tictactoe_session_t;
+
+/**
+ * @brief Open addressing hash table of sessions, keyed by game id.
+ *
+ */
+typedef struct
+{
+   tictactoe_session_t sessions[TICTACTOE_SESSION_MAX];
+   uint32_t clock;
+   uint32_t active;
+   uint32_t evicted;
+} tictactoe_session_table_t;
+
+/**
+ * @brief Result of one incoming board.
+ *
+ */
+typedef struct
+{
+   tictactoe_verdict_t verdict;
+   bool reply;                 /**< The device made a move, publish @ref board. */
+   tictactoe_bitboard_t board; /**< Board after the device move. */
+} tictactoe_session_result_t;
+
+//---------------------- PUBLIC FUNCTION PROTOTYPES --------------------------
+/**
+ * @brief The function clears the session table.
+ *
+ * @param [out] p_table Table to initialize.
+ */
+void tictactoe_session_table_init(tictactoe_session_table_t *p_table);
+
+/**
+ * @brief The function finds the session of a game, optionally creating it.
+ *        Creating a session in a full table evicts the least recently used one.
+ *
+ * @param [in,out] p_table Session table.
+ * @param [in]     p_id    Game id, does not have to be NUL terminated.
+ * @param [in]     id_len  Length of the game id, at most TICTACTOE_SESSION_ID_LEN - 1.
+ * @param [in]     create  Create the session when it does not exist.
+ *
+ * @return tictactoe_session_t* The session, NULL if not found or the id is too long.
+ */
+tictactoe_session_t *tictactoe_session_get(tictactoe_session_table_t *p_table, const char *p_id, size_t id_len, bool create);
+
+/**
+ * @brief The function removes a session.
+ *
+ * @param [in,out] p_table   Session table.
+ * @param [in]     p_session Session returned by tictactoe_session_get().
+ */
+void tictactoe_session_remove(tictactoe_session_table_t *p_table, tictactoe_session_t *p_session);
+
+/**
+ * @brief The function referees a board sent by the opponent and answers with the device move.
+ *        An empty board starts a new game, the opponent plays X unless it is the device's turn on an empty board.
+ *
+ * @param [in,out] p_session Session of the game.
+ * @param [in]     incoming  Board received from the opponent.
+ * @param [out]    p_result  Verdict and the board to publish.
+ */
+void tictactoe_session_handle(tictactoe_session_t *p_session, tictactoe_bitboard_t incoming, tictactoe_session_result_t *p_result);
+
+/**
+ * @brief The function evaluates a board.
+ *
+ * @param [in] board Board to evaluate.
+ *
+ * @return tictactoe_verdict_t Winner, draw or in progress.
+ */
+tictactoe_verdict_t tictactoe_bitboard_verdict(tictactoe_bitboard_t board);
+
+/**
+ * @brief The function picks a move for the given side: win, block, center, corner, edge.
+ *
+ * @param [in] own   Cells of the side to move.
+ * @param [in] other Cells of the opponent.
+ *
+ * @return int Cell index, -1 if the board is full.
+ */
+int tictactoe_bitboard_best_move(uint16_t own, uint16_t other);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TICTACTOE_SESSION_H__